@@ -71,7 +71,7 @@ OPERAND_VMEMORYA_INDIRECT_OFFSET(L, 4)
 opclass vmemA(indirect, vmemA_indOffI4, vmemA_indOffL4);
 
 source_hpp %{
-  bool op_sve_supported(int opcode);
+  bool op_sve_supported(int opcode, int vlen, BasicType bt);
 %}
 
 source %{
@@ -128,8 +128,32 @@ source %{
     }
   }
 
-  bool op_sve_supported(int opcode) {
+  bool op_sve_supported(int opcode, int vlen, BasicType bt) {
     switch (opcode) {
+      case Op_VectorCastB2X:
+      case Op_VectorCastS2X:
+      case Op_VectorCastI2X:
+      case Op_VectorCastL2X:
+      case Op_VectorCastF2X:
+      case Op_VectorCastD2X: {
+        // Casts where both sides fit in 64/128 bits use the NEON rules. Wider
+        // vectors are VecA, and only same element size SVE casts exist.
+        int src_size = 0;
+        switch (opcode) {
+          case Op_VectorCastB2X: src_size = 1; break;
+          case Op_VectorCastS2X: src_size = 2; break;
+          case Op_VectorCastI2X:
+          case Op_VectorCastF2X: src_size = 4; break;
+          default:               src_size = 8; break;
+        }
+        if (vlen * src_size < 16 && vlen * type2aelembytes(bt) < 16) {
+          return true;
+        }
+        return (opcode == Op_VectorCastI2X && bt == T_FLOAT)  ||
+               (opcode == Op_VectorCastL2X && bt == T_DOUBLE) ||
+               (opcode == Op_VectorCastF2X && bt == T_INT)    ||
+               (opcode == Op_VectorCastD2X && bt == T_LONG);
+      }
       case Op_MulAddVS2VI:
         // No multiply reduction instructions
       case Op_MulReductionVD:
@@ -290,6 +314,12 @@ instruct vdiv$1(vReg dst_src1, vReg src2) %{
   ins_pipe(pipe_slow);
 %}')dnl
 
+// vector cast, same element size
+UNARY_OP_TRUE_PREDICATE_ETYPE(vcvtItoF, VectorCastI2X, T_FLOAT,  S, 4, sve_scvtf)
+UNARY_OP_TRUE_PREDICATE_ETYPE(vcvtLtoD, VectorCastL2X, T_DOUBLE, D, 2, sve_scvtf)
+UNARY_OP_TRUE_PREDICATE_ETYPE(vcvtFtoI, VectorCastF2X, T_INT,    S, 4, sve_fcvtzs)
+UNARY_OP_TRUE_PREDICATE_ETYPE(vcvtDtoL, VectorCastD2X, T_LONG,   D, 2, sve_fcvtzs)
+
 // vector float div
 VDIVF(F, S, 4)
 VDIVF(D, D, 2)
@@ -2986,6 +2986,17 @@ public:
   INSN(sve_fsub,    0b01100101, 0b000001100);
 #undef INSN
 
+// SVE floating-point convert, same element size - predicate
+#define INSN(NAME, op_s, op_d)                                                     \
+  void NAME(FloatRegister Zd, SIMD_RegVariant T, PRegister Pg, FloatRegister Zn) { \
+    assert(T == S || T == D, "invalid register variant");                          \
+    sve_predicate_reg_insn(0b01100101, T == S ? op_s : op_d, Zd, T, Pg, Zn);       \
+  }
+
+  INSN(sve_scvtf,  0b010100101, 0b010110101); // signed integer convert to floating-point
+  INSN(sve_fcvtzs, 0b011100101, 0b011110101); // floating-point convert to signed integer, rounding toward zero
+#undef INSN
+
   // SVE multiple-add/sub - predicated
 #define INSN(NAME, op0, op1, op2)                                                                     \
   void NAME(FloatRegister Zda, SIMD_RegVariant T, PRegister Pg, FloatRegister Zn, FloatRegister Zm) { \
@@ -673,6 +673,50 @@ void TemplateTable::dload()
 void TemplateTable::aload()
 {
   transition(vtos, atos);
+  // As for _aload_0 (see aload_0_internal), the pairs
+  //
+  // _aload, _fast_igetfield
+  // _aload, _fast_agetfield
+  // _aload, _fast_fgetfield
+  //
+  // are rewritten into a pair bytecode. Any other _aload is left alone,
+  // so the check is repeated until the next bytecode has been quickened.
+  // The _getfield of CDS archived methods is never quickened, so their
+  // read-only bytecodes are not patched here.
+  if (RewriteFrequentPairs) {
+    Label rewrite, done;
+    const Register bc = r4;
+
+    // get next bytecode
+    __ load_unsigned_byte(r1, at_bcp(Bytecodes::length_for(Bytecodes::_aload)));
+
+    // if _igetfield then rewrite to _fast_iaccess
+    assert(Bytecodes::java_code(Bytecodes::_fast_iaccess) == Bytecodes::_aload, "fix bytecode definition");
+    __ cmpw(r1, Bytecodes::_fast_igetfield);
+    __ movw(bc, Bytecodes::_fast_iaccess);
+    __ br(Assembler::EQ, rewrite);
+
+    // if _agetfield then rewrite to _fast_aaccess
+    assert(Bytecodes::java_code(Bytecodes::_fast_aaccess) == Bytecodes::_aload, "fix bytecode definition");
+    __ cmpw(r1, Bytecodes::_fast_agetfield);
+    __ movw(bc, Bytecodes::_fast_aaccess);
+    __ br(Assembler::EQ, rewrite);
+
+    // if _fgetfield then rewrite to _fast_faccess
+    assert(Bytecodes::java_code(Bytecodes::_fast_faccess) == Bytecodes::_aload, "fix bytecode definition");
+    __ cmpw(r1, Bytecodes::_fast_fgetfield);
+    __ movw(bc, Bytecodes::_fast_faccess);
+    __ br(Assembler::NE, done);
+
+    // rewrite
+    // bc: new bytecode
+    __ bind(rewrite);
+    patch_bytecode(Bytecodes::_aload, bc, r1, false);
+
+    __ bind(done);
+  }
+
+  // Do actual aload (must do this after patch_bytecode which might call VM and GC might change oop).
   locals_index(r1);
   __ ldr(r0, iaddress(r1));
 }
@@ -3136,8 +3180,25 @@ void TemplateTable::fast_xaccess(TosState state)
 
   // get receiver
   __ ldr(r0, aaddress(0));
+  fast_xaccess_field(state, Bytecodes::length_for(Bytecodes::_aload_0));
+}
+
+void TemplateTable::fast_aload_xaccess(TosState state)
+{
+  transition(vtos, state);
+
+  // get receiver
+  locals_index(r1);
+  __ ldr(r0, iaddress(r1));
+  fast_xaccess_field(state, Bytecodes::length_for(Bytecodes::_aload));
+}
+
+// Load the field of the receiver in r0 that is accessed by the getfield
+// at getfield_offset from the current bcp.
+void TemplateTable::fast_xaccess_field(TosState state, int getfield_offset)
+{
   // access constant pool cache
-  __ get_cache_and_index_at_bcp(r2, r3, 2);
+  __ get_cache_and_index_at_bcp(r2, r3, getfield_offset + 1);
   __ ldr(r1, Address(r2, in_bytes(ConstantPoolCache::base_offset() +
                                   ConstantPoolCacheEntry::f2_offset())));
 
@@ -3158,7 +3219,7 @@ void TemplateTable::fast_xaccess(TosState state)
 
   // make sure exception is reported in correct bcp range (getfield is
   // next instruction)
-  __ increment(rbcp);
+  __ increment(rbcp, getfield_offset);
   __ null_check(r0);
   switch (state) {
   case itos:
@@ -3184,7 +3245,7 @@ void TemplateTable::fast_xaccess(TosState state)
     __ bind(notVolatile);
   }
 
-  __ decrement(rbcp);
+  __ decrement(rbcp, getfield_offset);
 }
 
 
@@ -1281,6 +1281,7 @@ void LIRGenerator::do_If(If* x) {
     __ safepoint(LIR_OprFact::illegalOpr, state_for(x, x->state_before()));
   }
 
+  profile_branch_sampled(x, cond, left, right);
   __ cmp(lir_cond(cond), left, right);
   profile_branch(x, cond);
   move_to_phi(x->state());
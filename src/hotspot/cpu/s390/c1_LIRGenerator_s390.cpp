@@ -983,6 +983,7 @@ void LIRGenerator::do_If (If* x) {
     __ safepoint(safepoint_poll_register(), state_for (x, x->state_before()));
   }
 
+  profile_branch_sampled(x, cond, left, right);
   __ cmp(lir_cond(cond), left, right);
   // Generate branch profiling. Profiling code doesn't kill flags.
   profile_branch(x, cond);
@@ -1534,6 +1534,9 @@ private:
   void movdqu(XMMRegister dst, Address src);
   void movdqu(XMMRegister dst, XMMRegister src);
 
+  // Move Aligned Vector Using Non-Temporal Hint
+  void vmovntdq(Address dst, XMMRegister src, int vector_len);
+
   // Move Unaligned 256bit Vector
   void vmovdqu(Address dst, XMMRegister src);
   void vmovdqu(XMMRegister dst, Address src);
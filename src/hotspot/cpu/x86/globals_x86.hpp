@@ -215,6 +215,12 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              range(0, max_jint)                                             \
              constraint(AVX3ThresholdConstraintFunc,AfterErgo)              \
                                                                             \
+  product(size_t, ArrayCopyNonTemporalThreshold, 0, DIAGNOSTIC,             \
+             "Minimum size in bytes of a disjoint AVX512 array copy which " \
+             "uses non-temporal stores. Zero disables them; by default "    \
+             "the value is derived from the L3 cache size.")                \
+             range(0, max_jint)                                             \
+                                                                            \
   product(bool, IntelJccErratumMitigation, true, DIAGNOSTIC,                \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")
@@ -3625,6 +3625,110 @@ void MacroAssembler::lookup_interface_method(Register recv_klass,
   }
 }
 
+// Look up the method for a megamorphic invokeinterface call in a single
+// pass over the itable:
+// - check that recv_klass (the receiver's class) implements resolved_klass (REFC),
+// - find the itable offset of holder_klass (DECC) and load the method at itable_index.
+// On success, the result is in method_result and execution falls through.
+// On failure, execution transfers to L_no_such_interface.
+// Clobbers scan_temp and temp_reg; recv_klass is preserved.
+void MacroAssembler::lookup_interface_method_stub(Register recv_klass,
+                                                  Register holder_klass,
+                                                  Register resolved_klass,
+                                                  Register method_result,
+                                                  Register scan_temp,
+                                                  Register temp_reg,
+                                                  int itable_index,
+                                                  Label& L_no_such_interface) {
+  assert_different_registers(recv_klass, method_result, holder_klass, resolved_klass, scan_temp, temp_reg);
+  Register temp_itbl_klass = method_result;
+
+  int vtable_base = in_bytes(Klass::vtable_start_offset());
+  int itentry_off = itableMethodEntry::method_offset_in_bytes();
+  int scan_step   = itableOffsetEntry::size() * wordSize;
+  int vte_size    = vtableEntry::size_in_bytes();
+  int ioffset     = itableOffsetEntry::interface_offset_in_bytes();
+  int ooffset     = itableOffsetEntry::offset_offset_in_bytes();
+  Address::ScaleFactor times_vte_scale = Address::times_ptr;
+  assert(vte_size == wordSize, "else adjust times_vte_scale");
+
+  Label L_loop_scan_resolved_entry, L_resolved_found, L_holder_found, L_ready;
+
+  // temp_itbl_klass = recv_klass->itable[0].interface
+  // scan_temp = &recv_klass->itable[1].interface
+  movl(scan_temp, Address(recv_klass, Klass::vtable_length_offset()));
+  movptr(temp_itbl_klass, Address(recv_klass, scan_temp, times_vte_scale, vtable_base + ioffset));
+  lea(scan_temp, Address(recv_klass, scan_temp, times_vte_scale, vtable_base + ioffset + scan_step));
+  xorptr(temp_reg, temp_reg);
+
+  // Initial checks:
+  //   - if (holder_klass != resolved_klass), go to "scan for resolved"
+  //   - if (itable[0] == NULL), no such interface
+  //   - if (itable[0] == holder_klass), shortcut to "holder found"
+  cmpptr(holder_klass, resolved_klass);
+  jccb(Assembler::notEqual, L_loop_scan_resolved_entry);
+  testptr(temp_itbl_klass, temp_itbl_klass);
+  jcc(Assembler::zero, L_no_such_interface);
+  cmpptr(holder_klass, temp_itbl_klass);
+  jccb(Assembler::equal, L_holder_found);
+
+  // Loop: look for the holder_klass entry.
+  //   do {
+  //     tmp = itable[index].interface;
+  //     index++;
+  //     if (tmp == holder_klass) goto L_holder_found;
+  //   } while (tmp != NULL);
+  //   goto L_no_such_interface;
+  Label L_scan_holder;
+  bind(L_scan_holder);
+  movptr(temp_itbl_klass, Address(scan_temp, 0));
+  addptr(scan_temp, scan_step);
+  cmpptr(holder_klass, temp_itbl_klass);
+  jccb(Assembler::equal, L_holder_found);
+  testptr(temp_itbl_klass, temp_itbl_klass);
+  jccb(Assembler::notZero, L_scan_holder);
+
+  jmp(L_no_such_interface);
+
+  // Loop: look for the resolved_klass entry, noting the holder_klass
+  // offset if its entry is passed on the way.
+  //   do {
+  //     tmp = itable[index].interface;
+  //     index++;
+  //     if (tmp == holder_klass) holder_offset = itable[index - 1].offset;
+  //     if (tmp == resolved_klass) goto L_resolved_found;
+  //   } while (tmp != NULL);
+  //   goto L_no_such_interface;
+  Label L_loop_scan_resolved;
+  bind(L_loop_scan_resolved);
+  movptr(temp_itbl_klass, Address(scan_temp, 0));
+  addptr(scan_temp, scan_step);
+  bind(L_loop_scan_resolved_entry);
+  cmpptr(holder_klass, temp_itbl_klass);
+  cmovl(Assembler::equal, temp_reg, Address(scan_temp, ooffset - ioffset - scan_step));
+  cmpptr(resolved_klass, temp_itbl_klass);
+  jccb(Assembler::equal, L_resolved_found);
+  testptr(temp_itbl_klass, temp_itbl_klass);
+  jccb(Assembler::notZero, L_loop_scan_resolved);
+
+  jmp(L_no_such_interface);
+
+  // If the holder_klass entry has not been seen yet, it comes after the
+  // resolved_klass entry: continue with the holder scan.
+  bind(L_resolved_found);
+  testptr(temp_reg, temp_reg);
+  jccb(Assembler::zero, L_scan_holder);
+  jmpb(L_ready);
+
+  bind(L_holder_found);
+  movl(temp_reg, Address(scan_temp, ooffset - ioffset - scan_step));
+
+  // temp_reg holds the offset of holder_klass' itable methods.
+  bind(L_ready);
+  assert(itableMethodEntry::size() * wordSize == wordSize, "adjust the scaling in the code below");
+  movptr(method_result, Address(recv_klass, temp_reg, Address::times_1, itable_index * wordSize + itentry_off));
+}
+
 
 // virtual method calling
 void MacroAssembler::lookup_virtual_method(Register recv_klass,
@@ -3834,7 +3938,16 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
   else  jcc(Assembler::notEqual, *L_failure);
 
   // Success.  Cache the super we found and proceed in triumph.
+  // Skip the store if the cache already holds it, so that threads
+  // hitting the same pair do not bounce the cache line between them.
+  Label L_cached;
+  cmpptr(super_klass, super_cache_addr);
+  jccb(Assembler::equal, L_cached);
   movptr(super_cache_addr, super_klass);
+  if (set_cond_codes) {
+    cmpptr(super_klass, super_klass); // restore Z for the AD files
+  }
+  bind(L_cached);
 
   if (L_success != &L_fallthrough) {
     jmp(*L_success);
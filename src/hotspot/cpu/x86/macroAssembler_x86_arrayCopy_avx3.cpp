@@ -248,6 +248,16 @@ void MacroAssembler::copy64_avx(Register dst, Register src, Register index, XMMR
   }
 }
 
+// Copy 64 bytes with a non-temporal store, the destination must be
+// 64 byte aligned. Callers issue an sfence after the last store.
+void MacroAssembler::copy64_avx_nt(Register dst, Register src, Register index, XMMRegister xmm,
+                                   int shift, int offset) {
+  assert(MaxVectorSize == 64, "vector length mismatch");
+  Address::ScaleFactor scale = (Address::ScaleFactor)(shift);
+  evmovdquq(xmm, Address(src, index, scale, offset), Assembler::AVX_512bit);
+  vmovntdq(Address(dst, index, scale, offset), xmm, Assembler::AVX_512bit);
+}
+
 #endif // COMPILER2_OR_JVMCI
 
 #endif
@@ -1391,6 +1391,7 @@ class StubGenerator: public StubCodeGenerator {
     bool use64byteVector = MaxVectorSize > 32 && AVX3Threshold == 0;
     Label L_main_loop, L_main_loop_64bytes, L_tail, L_tail64, L_exit, L_entry;
     Label L_repmovs, L_main_pre_loop, L_main_pre_loop_64bytes, L_pre_main_post_64;
+    Label L_main_loop_64bytes_nt, L_main_post_64bytes;
     const Register from        = rdi;  // source array address
     const Register to          = rsi;  // destination array address
     const Register count       = rdx;  // elements count
@@ -1429,6 +1430,8 @@ class StubGenerator: public StubCodeGenerator {
       // Type(shift)           byte(0), short(1), int(2),   long(3)
       int loop_size[]        = { 192,     96,       48,      24};
       int threshold[]        = { 4096,    2048,     1024,    512};
+      // Element count above which the 64 byte loop uses non-temporal stores.
+      int nt_threshold       = (int)(ArrayCopyNonTemporalThreshold >> shift);
 
       // UnsafeCopyMemory page error: continue after ucm
       UnsafeCopyMemoryMark ucmm(this, !is_oop && !aligned, true);
@@ -1551,6 +1554,12 @@ class StubGenerator: public StubCodeGenerator {
         __ BIND(L_main_pre_loop_64bytes);
         __ subq(temp1, loop_size[shift]);
 
+        if (nt_threshold > 0) {
+          // Stream very large copies past the cache.
+          __ cmpq(temp1, nt_threshold);
+          __ jcc(Assembler::greaterEqual, L_main_loop_64bytes_nt);
+        }
+
         // Main loop with aligned copy block size of 192 bytes at
         // 64 byte copy granularity.
         __ BIND(L_main_loop_64bytes);
@@ -1561,6 +1570,7 @@ class StubGenerator: public StubCodeGenerator {
            __ subq(temp1, loop_size[shift]);
            __ jcc(Assembler::greater, L_main_loop_64bytes);
 
+        __ BIND(L_main_post_64bytes);
         __ addq(temp1, loop_size[shift]);
         // Zero length check.
         __ jcc(Assembler::lessEqual, L_exit);
@@ -1571,6 +1581,20 @@ class StubGenerator: public StubCodeGenerator {
         use64byteVector = true;
         __ arraycopy_avx3_special_cases(xmm1, k2, from, to, temp1, shift,
                                         temp4, temp3, use64byteVector, L_entry, L_exit);
+
+        if (nt_threshold > 0) {
+          // Main loop as above, with non-temporal stores to the 64 byte
+          // aligned destination.
+          __ BIND(L_main_loop_64bytes_nt);
+             __ copy64_avx_nt(to, from, temp4, xmm1, shift, 0);
+             __ copy64_avx_nt(to, from, temp4, xmm1, shift, 64);
+             __ copy64_avx_nt(to, from, temp4, xmm1, shift, 128);
+             __ addptr(temp4, loop_size[shift]);
+             __ subq(temp1, loop_size[shift]);
+             __ jcc(Assembler::greater, L_main_loop_64bytes_nt);
+          __ sfence();
+          __ jmp(L_main_post_64bytes);
+        }
       }
       __ BIND(L_exit);
     }
@@ -5905,6 +5929,106 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+/**
+  * Arguments:
+  *
+  *  Input:
+  *    c_rarg0   - ary      address of the first element
+  *    c_rarg1   - cnt      number of elements
+  *    c_rarg2   - scale    log2 of the element size (0 for Latin1, 1 for UTF16)
+  *
+  *  Output:
+  *        rax   - int, 31 * h + element folded over the elements
+  */
+  address generate_stringHashCode() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "stringHashCode");
+    address start = __ pc();
+
+    const Register ary    = c_rarg0;
+    const Register cnt    = c_rarg1;
+    const Register scale  = c_rarg2;
+    const Register result = rax;
+    const Register tmp1   = r10;
+    const Register tmp2   = r11;
+
+    Label L_bytes_loop, L_bytes_tail, L_chars_loop, L_chars_tail, L_done;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    __ xorl(result, result);
+    __ testl(scale, scale);
+    __ jcc(Assembler::notZero, L_chars_loop);
+
+    // Four elements per iteration:
+    //   h = h * 31^4 + a0 * 31^3 + a1 * 31^2 + a2 * 31 + a3
+    // which breaks the serial dependency on h of the scalar loop.
+    __ bind(L_bytes_loop);
+    __ cmpl(cnt, 4);
+    __ jccb(Assembler::less, L_bytes_tail);
+    __ imull(result, result, 923521);
+    __ movzbl(tmp1, Address(ary, 0));
+    __ movzbl(tmp2, Address(ary, 1));
+    __ imull(tmp1, tmp1, 29791);
+    __ imull(tmp2, tmp2, 961);
+    __ addl(result, tmp1);
+    __ addl(result, tmp2);
+    __ movzbl(tmp1, Address(ary, 2));
+    __ movzbl(tmp2, Address(ary, 3));
+    __ imull(tmp1, tmp1, 31);
+    __ addl(result, tmp2);
+    __ addl(result, tmp1);
+    __ addptr(ary, 4);
+    __ subl(cnt, 4);
+    __ jmpb(L_bytes_loop);
+
+    __ bind(L_bytes_tail);
+    __ testl(cnt, cnt);
+    __ jcc(Assembler::zero, L_done);
+    __ imull(result, result, 31);
+    __ movzbl(tmp1, Address(ary, 0));
+    __ addl(result, tmp1);
+    __ addptr(ary, 1);
+    __ decrementl(cnt);
+    __ jmpb(L_bytes_tail);
+
+    __ bind(L_chars_loop);
+    __ cmpl(cnt, 4);
+    __ jccb(Assembler::less, L_chars_tail);
+    __ imull(result, result, 923521);
+    __ movzwl(tmp1, Address(ary, 0));
+    __ movzwl(tmp2, Address(ary, 2));
+    __ imull(tmp1, tmp1, 29791);
+    __ imull(tmp2, tmp2, 961);
+    __ addl(result, tmp1);
+    __ addl(result, tmp2);
+    __ movzwl(tmp1, Address(ary, 4));
+    __ movzwl(tmp2, Address(ary, 6));
+    __ imull(tmp1, tmp1, 31);
+    __ addl(result, tmp2);
+    __ addl(result, tmp1);
+    __ addptr(ary, 8);
+    __ subl(cnt, 4);
+    __ jmpb(L_chars_loop);
+
+    __ bind(L_chars_tail);
+    __ testl(cnt, cnt);
+    __ jccb(Assembler::zero, L_done);
+    __ imull(result, result, 31);
+    __ movzwl(tmp1, Address(ary, 0));
+    __ addl(result, tmp1);
+    __ addptr(ary, 2);
+    __ decrementl(cnt);
+    __ jmpb(L_chars_tail);
+
+    __ bind(L_done);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
 /**
    *  Arguments:
    *
@@ -6845,6 +6969,9 @@ address generate_avx_ghash_processBlocks() {
     StubRoutines::x86::_vector_64_bit_mask = generate_vector_custom_i32("vector_64_bit_mask", Assembler::AVX_512bit,
                                                                         0xFFFFFFFF, 0xFFFFFFFF, 0, 0);
     StubRoutines::x86::_vector_int_shuffle_mask = generate_vector_mask("vector_int_shuffle_mask", 0x0302010003020100);
+    StubRoutines::x86::_vector_byte_shuffle_mask = generate_vector_custom_i32("vector_byte_shuffle_mask", Assembler::AVX_256bit,
+                                                                              0x70707070, 0x70707070, 0x70707070, 0x70707070,
+                                                                              0xF0F0F0F0, 0xF0F0F0F0, 0xF0F0F0F0, 0xF0F0F0F0);
     StubRoutines::x86::_vector_short_shuffle_mask = generate_vector_mask("vector_short_shuffle_mask", 0x0100010001000100);
     StubRoutines::x86::_vector_long_shuffle_mask = generate_vector_mask("vector_long_shuffle_mask", 0x0000000100000000);
     StubRoutines::x86::_vector_long_sign_mask = generate_vector_mask("vector_long_sign_mask", 0x8000000000000000);
@@ -6969,6 +7096,10 @@ address generate_avx_ghash_processBlocks() {
     if (UseVectorizedMismatchIntrinsic) {
       StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
     }
+
+    if (UseStringHashCodeIntrinsic) {
+      StubRoutines::_stringHashCode = generate_stringHashCode();
+    }
   }
 
  public:
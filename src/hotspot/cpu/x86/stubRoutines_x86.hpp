@@ -154,6 +154,7 @@ class x86 {
   static address _vector_32_bit_mask;
   static address _vector_64_bit_mask;
   static address _vector_int_shuffle_mask;
+  static address _vector_byte_shuffle_mask;
   static address _vector_short_shuffle_mask;
   static address _vector_long_shuffle_mask;
   static address _vector_iota_indices;
@@ -285,6 +286,10 @@ class x86 {
     return _vector_int_shuffle_mask;
   }
 
+  static address vector_byte_shuffle_mask() {
+    return _vector_byte_shuffle_mask;
+  }
+
   static address vector_short_shuffle_mask() {
     return _vector_short_shuffle_mask;
   }
@@ -694,6 +694,52 @@ void TemplateTable::dload() {
 
 void TemplateTable::aload() {
   transition(vtos, atos);
+  // As for _aload_0 (see aload_0_internal), the pairs
+  //
+  // _aload, _fast_igetfield
+  // _aload, _fast_agetfield
+  // _aload, _fast_fgetfield
+  //
+  // are rewritten into a pair bytecode. Any other _aload is left alone,
+  // so the check is repeated until the next bytecode has been quickened.
+  // The _getfield of CDS archived methods is never quickened, so their
+  // read-only bytecodes are not patched here.
+  if (RewriteFrequentPairs) {
+    Label rewrite, done;
+
+    const Register bc = LP64_ONLY(c_rarg3) NOT_LP64(rcx);
+    LP64_ONLY(assert(rbx != bc, "register damaged"));
+
+    // get next byte
+    __ load_unsigned_byte(rbx, at_bcp(Bytecodes::length_for(Bytecodes::_aload)));
+
+    // if _igetfield then rewrite to _fast_iaccess
+    assert(Bytecodes::java_code(Bytecodes::_fast_iaccess) == Bytecodes::_aload, "fix bytecode definition");
+    __ cmpl(rbx, Bytecodes::_fast_igetfield);
+    __ movl(bc, Bytecodes::_fast_iaccess);
+    __ jccb(Assembler::equal, rewrite);
+
+    // if _agetfield then rewrite to _fast_aaccess
+    assert(Bytecodes::java_code(Bytecodes::_fast_aaccess) == Bytecodes::_aload, "fix bytecode definition");
+    __ cmpl(rbx, Bytecodes::_fast_agetfield);
+    __ movl(bc, Bytecodes::_fast_aaccess);
+    __ jccb(Assembler::equal, rewrite);
+
+    // if _fgetfield then rewrite to _fast_faccess
+    assert(Bytecodes::java_code(Bytecodes::_fast_faccess) == Bytecodes::_aload, "fix bytecode definition");
+    __ cmpl(rbx, Bytecodes::_fast_fgetfield);
+    __ movl(bc, Bytecodes::_fast_faccess);
+    __ jcc(Assembler::notEqual, done);
+
+    // rewrite
+    // bc: fast bytecode
+    __ bind(rewrite);
+    patch_bytecode(Bytecodes::_aload, bc, rbx, false);
+
+    __ bind(done);
+  }
+
+  // Do actual aload (must do this after patch_bytecode which might call VM and GC might change oop).
   locals_index(rbx);
   __ movptr(rax, aaddress(rbx));
 }
@@ -3568,15 +3614,30 @@ void TemplateTable::fast_xaccess(TosState state) {
 
   // get receiver
   __ movptr(rax, aaddress(0));
+  fast_xaccess_field(state, Bytecodes::length_for(Bytecodes::_aload_0));
+}
+
+void TemplateTable::fast_aload_xaccess(TosState state) {
+  transition(vtos, state);
+
+  // get receiver
+  locals_index(rbx);
+  __ movptr(rax, aaddress(rbx));
+  fast_xaccess_field(state, Bytecodes::length_for(Bytecodes::_aload));
+}
+
+// Load the field of the receiver in rax that is accessed by the getfield
+// at getfield_offset from the current bcp.
+void TemplateTable::fast_xaccess_field(TosState state, int getfield_offset) {
   // access constant pool cache
-  __ get_cache_and_index_at_bcp(rcx, rdx, 2);
+  __ get_cache_and_index_at_bcp(rcx, rdx, getfield_offset + 1);
   __ movptr(rbx,
             Address(rcx, rdx, Address::times_ptr,
                     in_bytes(ConstantPoolCache::base_offset() +
                              ConstantPoolCacheEntry::f2_offset())));
   // make sure exception is reported in correct bcp range (getfield is
   // next instruction)
-  __ increment(rbcp);
+  __ increment(rbcp, getfield_offset);
   __ null_check(rax);
   const Address field = Address(rax, rbx, Address::times_1, 0*wordSize);
   switch (state) {
@@ -3605,7 +3666,7 @@ void TemplateTable::fast_xaccess(TosState state) {
   // __ membar(Assembler::LoadLoad);
   // __ bind(notVolatile);
 
-  __ decrement(rbcp);
+  __ decrement(rbcp, getfield_offset);
 }
 
 //-----------------------------------------------------------------------------
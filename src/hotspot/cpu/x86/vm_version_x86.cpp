@@ -223,6 +223,15 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ movl(Address(rsi, 8), rcx);
     __ movl(Address(rsi,12), rdx);
 
+    __ movl(rax, 4);
+    __ movl(rcx, 3);     // L3 cache
+    __ cpuid();
+    __ lea(rsi, Address(rbp, in_bytes(VM_Version::dcp_cpuid4_l3_offset())));
+    __ movl(Address(rsi, 0), rax);
+    __ movl(Address(rsi, 4), rbx);
+    __ movl(Address(rsi, 8), rcx);
+    __ movl(Address(rsi,12), rdx);
+
     //
     // Standard cpuid(0x1)
     //
@@ -1413,6 +1422,12 @@ void VM_Version::get_processor_features() {
     }
     FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
   }
+  if (UseStringHashCodeIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseStringHashCodeIntrinsic)) {
+      warning("String hashCode intrinsic is not available in 32-bit VM");
+    }
+    FLAG_SET_DEFAULT(UseStringHashCodeIntrinsic, false);
+  }
 #endif // _LP64
 
   // Use count leading zeros count instruction if available.
@@ -1481,6 +1496,15 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseFastStosb, false);
   }
 
+#ifdef _LP64
+  if (FLAG_IS_DEFAULT(ArrayCopyNonTemporalThreshold)) {
+    // A copy larger than half of the L3 cache would evict most of what
+    // other threads keep there, so stream it past the cache instead.
+    FLAG_SET_DEFAULT(ArrayCopyNonTemporalThreshold,
+                     MIN2(L3_cache_size() / 2, (size_t)max_jint));
+  }
+#endif
+
   // Use XMM/YMM MOVDQU instruction for Object Initialization
   if (!UseFastStosb && UseSSE >= 2 && UseUnalignedLoadStores) {
     if (FLAG_IS_DEFAULT(UseXMMForObjInit)) {
@@ -120,7 +120,8 @@ class VM_Version : public Abstract_VM_Version {
     uint32_t value;
     struct {
       uint32_t cache_type    : 5,
-                             : 21,
+               cache_level   : 3,
+                             : 18,
                cores_per_cpu : 6;
     } bits;
   };
@@ -429,6 +430,12 @@ enum Extended_Family {
     uint32_t     dcp_cpuid4_ecx; // unused currently
     uint32_t     dcp_cpuid4_edx; // unused currently
 
+    // cpuid function 4, subleaf 3 (L3 cache parameters on Intel)
+    DcpCpuid4Eax dcp_cpuid4_l3_eax;
+    DcpCpuid4Ebx dcp_cpuid4_l3_ebx;
+    uint32_t     dcp_cpuid4_l3_ecx; // number of sets - 1
+    uint32_t     dcp_cpuid4_l3_edx; // unused currently
+
     // cpuid function 7 (structured extended features)
     SefCpuid7Eax sef_cpuid7_eax;
     SefCpuid7Ebx sef_cpuid7_ebx;
@@ -727,6 +734,7 @@ public:
   static ByteSize std_cpuid0_offset() { return byte_offset_of(CpuidInfo, std_max_function); }
   static ByteSize std_cpuid1_offset() { return byte_offset_of(CpuidInfo, std_cpuid1_eax); }
   static ByteSize dcp_cpuid4_offset() { return byte_offset_of(CpuidInfo, dcp_cpuid4_eax); }
+  static ByteSize dcp_cpuid4_l3_offset() { return byte_offset_of(CpuidInfo, dcp_cpuid4_l3_eax); }
   static ByteSize sef_cpuid7_offset() { return byte_offset_of(CpuidInfo, sef_cpuid7_eax); }
   static ByteSize ext_cpuid1_offset() { return byte_offset_of(CpuidInfo, ext_cpuid1_eax); }
   static ByteSize ext_cpuid5_offset() { return byte_offset_of(CpuidInfo, ext_cpuid5_eax); }
@@ -857,6 +865,19 @@ public:
     return result;
   }
 
+  // Size of the L3 cache in bytes, 0 if unknown
+  static size_t L3_cache_size() {
+    if (is_intel() &&
+        _cpuid_info.dcp_cpuid4_l3_eax.bits.cache_type != 0 &&
+        _cpuid_info.dcp_cpuid4_l3_eax.bits.cache_level == 3) {
+      return (size_t)(_cpuid_info.dcp_cpuid4_l3_ebx.bits.associativity + 1) *
+                     (_cpuid_info.dcp_cpuid4_l3_ebx.bits.partitions + 1) *
+                     (_cpuid_info.dcp_cpuid4_l3_ebx.bits.L1_line_size + 1) *
+                     (_cpuid_info.dcp_cpuid4_l3_ecx + 1);
+    }
+    return 0;
+  }
+
   static intx prefetch_data_size()  {
     return L1_line_size();
   }
@@ -79,7 +79,11 @@
           "be dumped into the corefile.")                               \
                                                                         \
   product(bool, UseCpuAllocPath, false, DIAGNOSTIC,                     \
-             "Use CPU_ALLOC code path in os::active_processor_count ")
+             "Use CPU_ALLOC code path in os::active_processor_count ")  \
+                                                                        \
+  product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
+          "Pre-touch memory with madvise(MADV_POPULATE_WRITE) when "    \
+          "supported by the kernel")
 
 // end of RUNTIME_OS_FLAGS
 
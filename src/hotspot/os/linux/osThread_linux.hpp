@@ -110,6 +110,16 @@ public:
   void set_alt_sig_stack(address val)     { _alt_sig_stack = val; }
   address alt_sig_stack(void)             { return _alt_sig_stack; }
 
+private:
+  timer_t _cpu_time_timer;              /* CPU-time sampling timer, see cpuTimeSampler.hpp */
+  bool _has_cpu_time_timer;
+
+public:
+  timer_t cpu_time_timer() const          { return _cpu_time_timer; }
+  bool has_cpu_time_timer() const         { return _has_cpu_time_timer; }
+  void set_cpu_time_timer(timer_t timer)  { _cpu_time_timer = timer; _has_cpu_time_timer = true; }
+  void clear_cpu_time_timer()             { _has_cpu_time_timer = false; }
+
 private:
   Monitor* _startThread_lock;     // sync parent and child in thread creation
 
@@ -45,6 +45,7 @@
 #include "prims/jvm_misc.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/cpuTimeSampler.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -657,6 +658,97 @@ bool os::Linux::manually_expand_stack(JavaThread * t, address addr) {
 // create new thread
 
 // Thread start routine for all newly created threads
+////////////////////////////////////////////////////////////////////////////////
+// CPU-time sampling support, see cpuTimeSampler.hpp
+
+// Each Java thread gets a POSIX timer on its own CPU-time clock that sends
+// SIGPROF to the thread itself. The timer functions are in librt on older
+// glibc versions, so they are looked up at runtime.
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+typedef int (*timer_create_func_t)(clockid_t, struct sigevent*, timer_t*);
+typedef int (*timer_settime_func_t)(timer_t, int, const struct itimerspec*, struct itimerspec*);
+typedef int (*timer_delete_func_t)(timer_t);
+
+static timer_create_func_t  _timer_create  = NULL;
+static timer_settime_func_t _timer_settime = NULL;
+static timer_delete_func_t  _timer_delete  = NULL;
+
+static void cpu_time_signal_handler(int sig, siginfo_t* info, void* ucontext) {
+  int saved_errno = errno;
+  Thread* thread = Thread::current_or_null_safe();
+  if (thread != NULL && thread->is_Java_thread()) {
+    CPUTimeSampler::tick(thread->as_Java_thread());
+  }
+  errno = saved_errno;
+}
+
+static void cpu_time_sampling_init() {
+  if (!CPUTimeSampler::is_enabled()) {
+    return;
+  }
+  timer_create_func_t  create_func  = (timer_create_func_t)  dlsym(RTLD_DEFAULT, "timer_create");
+  timer_settime_func_t settime_func = (timer_settime_func_t) dlsym(RTLD_DEFAULT, "timer_settime");
+  timer_delete_func_t  delete_func  = (timer_delete_func_t)  dlsym(RTLD_DEFAULT, "timer_delete");
+  if (create_func == NULL || settime_func == NULL || delete_func == NULL) {
+    log_info(os)("CPU-time sampling disabled: POSIX timers not available");
+    return;
+  }
+
+  struct sigaction act;
+  sigemptyset(&act.sa_mask);
+  act.sa_sigaction = cpu_time_signal_handler;
+  act.sa_flags = SA_SIGINFO | SA_RESTART;
+  if (sigaction(SIGPROF, &act, NULL) != 0) {
+    log_info(os)("CPU-time sampling disabled: cannot install SIGPROF handler (%s)", os::strerror(errno));
+    return;
+  }
+
+  _timer_create  = create_func;
+  _timer_settime = settime_func;
+  _timer_delete  = delete_func;
+  CPUTimeSampler::set_timers_available();
+}
+
+// Called on the new thread itself.
+static void cpu_time_timer_start(Thread* thread) {
+  if (_timer_create == NULL || !thread->is_Java_thread() || thread->is_Compiler_thread()) {
+    return;
+  }
+  struct sigevent sev;
+  memset(&sev, 0, sizeof(sev));
+  sev.sigev_notify = SIGEV_THREAD_ID;
+  sev.sigev_signo = SIGPROF;
+  sev.sigev_notify_thread_id = os::Linux::gettid();
+
+  timer_t timer;
+  if (_timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &timer) != 0) {
+    log_debug(os, thread)("Failed to create CPU-time timer (%s)", os::strerror(errno));
+    return;
+  }
+
+  struct itimerspec its;
+  its.it_interval.tv_sec  = CPUTimeSamplingInterval / MILLIUNITS;
+  its.it_interval.tv_nsec = (CPUTimeSamplingInterval % MILLIUNITS) * NANOSECS_PER_MILLISEC;
+  its.it_value = its.it_interval;
+  if (_timer_settime(timer, 0, &its, NULL) != 0) {
+    log_debug(os, thread)("Failed to arm CPU-time timer (%s)", os::strerror(errno));
+    _timer_delete(timer);
+    return;
+  }
+  thread->osthread()->set_cpu_time_timer(timer);
+}
+
+static void cpu_time_timer_stop(OSThread* osthread) {
+  if (osthread->has_cpu_time_timer()) {
+    _timer_delete(osthread->cpu_time_timer());
+    osthread->clear_cpu_time_timer();
+  }
+}
+
 static void *thread_native_entry(Thread *thread) {
 
   thread->record_stack_base_and_size();
@@ -689,6 +781,8 @@ static void *thread_native_entry(Thread *thread) {
   // initialize signal mask for this thread
   PosixSignals::hotspot_sigmask(thread);
 
+  cpu_time_timer_start(thread);
+
   // initialize floating point control register
   os::Linux::init_thread_fpu_state();
 
@@ -966,6 +1060,8 @@ bool os::create_attached_thread(JavaThread* thread) {
   // and save the caller's signal mask
   PosixSignals::hotspot_sigmask(thread);
 
+  cpu_time_timer_start(thread);
+
   log_info(os, thread)("Thread attached (tid: " UINTX_FORMAT ", pthread id: " UINTX_FORMAT ").",
     os::current_thread_id(), (uintx) pthread_self());
 
@@ -996,6 +1092,8 @@ void os::free_thread(OSThread* osthread) {
   assert(!sigismember(&current, SR_signum), "SR signal should not be blocked!");
 #endif
 
+  cpu_time_timer_stop(osthread);
+
   // Restore caller's signal mask
   sigset_t sigmask = osthread->caller_sigmask();
   pthread_sigmask(SIG_SETMASK, &sigmask, NULL);
@@ -1357,6 +1455,39 @@ void os::Linux::fast_thread_clock_init() {
   }
 }
 
+bool os::Linux::huge_page_mappings_do(HugePageMappingClosure* cl) {
+  FILE* f = fopen("/proc/self/smaps", "r");
+  if (f == NULL) {
+    return false;
+  }
+  char line[512];
+  uintptr_t start = 0;
+  uintptr_t end = 0;
+  size_t huge_bytes = 0;
+  while (fgets(line, sizeof(line), f) != NULL) {
+    uintptr_t s, e;
+    size_t kb;
+    if (sscanf(line, "%" SCNxPTR "-%" SCNxPTR, &s, &e) == 2) {
+      // Start of the next mapping
+      if (huge_bytes > 0) {
+        cl->do_mapping((address)start, (address)end, huge_bytes);
+      }
+      start = s;
+      end = e;
+      huge_bytes = 0;
+    } else if (sscanf(line, "AnonHugePages: " SIZE_FORMAT " kB", &kb) == 1 ||
+               sscanf(line, "Shared_Hugetlb: " SIZE_FORMAT " kB", &kb) == 1 ||
+               sscanf(line, "Private_Hugetlb: " SIZE_FORMAT " kB", &kb) == 1) {
+      huge_bytes += kb * K;
+    }
+  }
+  if (huge_bytes > 0) {
+    cl->do_mapping((address)start, (address)end, huge_bytes);
+  }
+  fclose(f);
+  return true;
+}
+
 jlong os::javaTimeNanos() {
   if (os::supports_monotonic_clock()) {
     struct timespec tp;
@@ -2884,6 +3015,14 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
+// Cleared when the kernel does not support MADV_POPULATE_WRITE (Linux 5.14).
+static volatile bool _madv_populate_write_supported = true;
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
@@ -2918,6 +3057,29 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+size_t os::pd_pretouch_memory(void* start, void* end, size_t page_size) {
+  if (UseMadvPopulateWrite && _madv_populate_write_supported) {
+    // Populate the whole range with a single call. This faults in huge pages
+    // directly when the range is backed by transparent huge pages, and the
+    // pages are placed according to the memory policy of the range.
+    char* first = align_down((char*)start, os::vm_page_size());
+    char* last = align_up((char*)end, os::vm_page_size());
+    size_t len = pointer_delta(last, first, sizeof(char));
+    if (::madvise(first, len, MADV_POPULATE_WRITE) == 0) {
+      return 0;
+    }
+    int err = errno;
+    if (err == EINVAL) {
+      _madv_populate_write_supported = false;
+    }
+    log_debug(os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", MADV_POPULATE_WRITE) failed; "
+                  "error='%s' (errno=%d)", p2i(first), len, os::strerror(err), err);
+  }
+  // With transparent huge pages the kernel initially backs the memory with
+  // small pages, so every small page has to be touched.
+  return UseTransparentHugePages ? (size_t)os::vm_page_size() : page_size;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -4540,6 +4702,7 @@ jint os::init_2(void) {
 
   PosixSignals::signal_sets_init();
   PosixSignals::install_signal_handlers();
+  cpu_time_sampling_init();
   // Initialize data for jdk.internal.misc.Signal
   if (!ReduceSignalUsage) {
     PosixSignals::jdk_misc_signal_init();
@@ -171,6 +171,15 @@ class Linux {
 
   static jlong fast_thread_cpu_time(clockid_t clockid);
 
+  // Huge page usage from /proc/self/smaps
+  class HugePageMappingClosure {
+   public:
+    // Called, in address order, for each mapping with huge pages in it.
+    // huge_bytes counts transparent huge pages and hugetlbfs pages.
+    virtual void do_mapping(address start, address end, size_t huge_bytes) = 0;
+  };
+  static bool huge_page_mappings_do(HugePageMappingClosure* cl);
+
   // Stack repair handling
 
   // none present
@@ -39,9 +39,16 @@ inline bool os::uses_stack_guard_pages() {
   return true;
 }
 
+// Only the primordial thread's stack is a growable mapping that may not
+// reach down to the guard zone yet.  Other thread stacks are mapped in full
+// by pthread_create() or by whoever created an attached thread, so the
+// zone only needs to be protected, and unprotected again on thread exit.
+// That keeps a stack that glibc caches for reuse intact, and saves the
+// mmap() calls that would otherwise replace the zone on every thread start
+// and exit.
 inline bool os::must_commit_stack_guard_pages() {
   assert(uses_stack_guard_pages(), "sanity check");
-  return true;
+  return os::is_primordial_thread();
 }
 
 // Bang the shadow pages if they need to be touched to be mapped.
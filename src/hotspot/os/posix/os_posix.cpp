@@ -1643,6 +1643,17 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+  // Optional fast-path check:
+  // If a permit is already available there is nothing to do. The parked
+  // thread, if any, was either signalled by the unpark that set the permit
+  // or has not yet waited and will consume the permit without blocking, so
+  // this unpark can be coalesced with the earlier one without taking the
+  // mutex. The fence orders the caller's preceding stores (typically the
+  // state the unparked thread will re-check) before the load of _counter,
+  // matching the full barrier of the xchg on the park() fast path.
+  OrderAccess::fence();
+  if (Atomic::load(&_counter) > 0) return;
+
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "invariant");
   const int s = _counter;
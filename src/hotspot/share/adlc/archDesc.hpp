@@ -135,6 +135,10 @@ private:
   void expand_opclass(FILE *fp, const char *indent, const Expr *cost,
                       const char *result_type, ProductionState &status);
   Expr *calc_cost(FILE *fp, const char *spaces, MatchList &mList, ProductionState &status);
+  // Methods for outputting the shared State::_chain_<operand> routines
+  bool has_chain_routine(const char *operand);
+  bool chain_rule_is_checked(const char *operand, Dict &operands_chained_from, ProductionState &status);
+  void gen_chain_routine(FILE *fp, const char *operand, ProductionState &status, Dict &operands_chained_from);
   void prune_matchlist(Dict &minimize, MatchList &mlist);
 
   // Helper function that outputs code to generate an instruction in MachNodeGenerator
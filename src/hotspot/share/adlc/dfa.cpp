@@ -37,6 +37,10 @@ static const char *sRight  = "_kids[1]";
 static const char *dfa_production           = "DFA_PRODUCTION";
 static const char *dfa_production_set_valid = "DFA_PRODUCTION__SET_VALID";
 
+//---------------------------Shared chain rules--------------------------------
+// Rule argument of the State::_chain_<operand> routines, see gen_chain_routine
+static const char *chain_rule_arg           = "rule";
+
 //---------------------------Production State----------------------------------
 static const char *knownInvalid = "knownInvalid";    // The result does NOT have a rule defined
 static const char *knownValid   = "knownValid";      // The result must be produced by a rule
@@ -114,6 +118,8 @@ private:
 // 2)        DFA_PRODUCTION__SET_VALID(EBXREGI, cmovI_memu_rule, c)
 // 3)      }
 //
+// A NULL 'fp' only updates 'status', as if the check had been emitted.
+//
 static void cost_check(FILE *fp, const char *spaces,
                        const char *arrayIdx, const Expr *cost, const char *rule, ProductionState &status) {
   bool state_check               = false;  // true if this production needs to check validity
@@ -126,7 +132,7 @@ static void cost_check(FILE *fp, const char *spaces,
   if( !previous_ub->is_unknown() ) {
     if( previous_ub->less_than_or_equal(cost) ) {
       cost_is_above_upper_bound = true;
-      if( debug_output ) { fprintf(fp, "// Previous rule with lower cost than: %s === %s_rule costs %s\n", arrayIdx, rule, cost->as_string()); }
+      if( debug_output && fp != NULL ) { fprintf(fp, "// Previous rule with lower cost than: %s === %s_rule costs %s\n", arrayIdx, rule, cost->as_string()); }
     }
   }
 
@@ -134,7 +140,7 @@ static void cost_check(FILE *fp, const char *spaces,
   if( !previous_lb->is_unknown() ) {
     if( cost->less_than_or_equal(previous_lb) ) {
       cost_is_below_lower_bound = true;
-      if( debug_output ) { fprintf(fp, "// Previous rule with higher cost\n"); }
+      if( debug_output && fp != NULL ) { fprintf(fp, "// Previous rule with higher cost\n"); }
     }
   }
 
@@ -142,12 +148,12 @@ static void cost_check(FILE *fp, const char *spaces,
   // Check for validity and compare to other match costs
   const char *validity_check = status.valid(arrayIdx);
   if( validity_check == unknownValid ) {
-    fprintf(fp, "%sif (STATE__NOT_YET_VALID(%s) || _cost[%s] > %s) {\n",  spaces, arrayIdx, arrayIdx, cost->as_string());
+    if( fp != NULL ) fprintf(fp, "%sif (STATE__NOT_YET_VALID(%s) || _cost[%s] > %s) {\n",  spaces, arrayIdx, arrayIdx, cost->as_string());
     state_check = true;
     cost_check  = true;
   }
   else if( validity_check == knownInvalid ) {
-    if( debug_output ) { fprintf(fp, "%s// %s KNOWN_INVALID \n",  spaces, arrayIdx); }
+    if( debug_output && fp != NULL ) { fprintf(fp, "%s// %s KNOWN_INVALID \n",  spaces, arrayIdx); }
   }
   else if( validity_check == knownValid ) {
     if( cost_is_above_upper_bound ) {
@@ -156,23 +162,29 @@ static void cost_check(FILE *fp, const char *spaces,
     } else if( cost_is_below_lower_bound ) {
       // production will unconditionally overwrite a previous production that had higher cost
     } else {
-      fprintf(fp, "%sif ( /* %s KNOWN_VALID || */ _cost[%s] > %s) {\n",  spaces, arrayIdx, arrayIdx, cost->as_string());
+      if( fp != NULL ) fprintf(fp, "%sif ( /* %s KNOWN_VALID || */ _cost[%s] > %s) {\n",  spaces, arrayIdx, arrayIdx, cost->as_string());
       cost_check  = true;
     }
   }
 
-  // line 2)
-  // no need to set State vector if our state is knownValid
-  const char *production = (validity_check == knownValid) ? dfa_production : dfa_production_set_valid;
-  fprintf(fp, "%s  %s(%s, %s_rule, %s)", spaces, production, arrayIdx, rule, cost->as_string() );
-  if( validity_check == knownValid ) {
-    if( cost_is_below_lower_bound ) { fprintf(fp, "\t  // overwrites higher cost rule"); }
-   }
-   fprintf(fp, "\n");
-
-  // line 3)
-  if( cost_check || state_check ) {
-    fprintf(fp, "%s}\n", spaces);
+  if( fp != NULL ) {
+    // line 2)
+    // no need to set State vector if our state is knownValid
+    const char *production = (validity_check == knownValid) ? dfa_production : dfa_production_set_valid;
+    if( rule == chain_rule_arg ) {
+      fprintf(fp, "%s  %s(%s, %s, %s)", spaces, production, arrayIdx, rule, cost->as_string() );
+    } else {
+      fprintf(fp, "%s  %s(%s, %s_rule, %s)", spaces, production, arrayIdx, rule, cost->as_string() );
+    }
+    if( validity_check == knownValid ) {
+      if( cost_is_below_lower_bound ) { fprintf(fp, "\t  // overwrites higher cost rule"); }
+    }
+    fprintf(fp, "\n");
+
+    // line 3)
+    if( cost_check || state_check ) {
+      fprintf(fp, "%s}\n", spaces);
+    }
   }
 
   status.set_cost_bounds(arrayIdx, cost, state_check, cost_check);
@@ -280,6 +292,20 @@ void ArchDesc::gen_match(FILE *fp, MatchList &mList, ProductionState &status, Di
 
   // If this rule produces an operand which has associated chain rules,
   // update the operands with the chain rule + this rule cost & this rule.
+  // When each of those productions needs its full validity and cost check
+  // anyway, call the operand's shared chain routine instead of repeating it.
+  if (strcmp(rule, "Invalid") != 0 && status.constraint() == hasConstraint &&
+      has_chain_routine(mList._resultStr)) {
+    Dict checked(cmpstr, hashstr, Form::arena);
+    if (chain_rule_is_checked(mList._resultStr, checked, status)) {
+      fprintf(fp, "%s_chain_%s(%s, %s_rule);\n", spaces6, mList._resultStr, cost->as_string(), rule);
+      // Account for the productions of the shared routine
+      chain_rule(NULL, spaces6, mList._resultStr, cost, rule, operands_chained_from, status);
+      // Close the child-and-predicate-test braces
+      fprintf(fp, "    }\n");
+      return;
+    }
+  }
   chain_rule(fp, spaces6, mList._resultStr, cost, rule, operands_chained_from, status);
 
   // Close the child-and-predicate-test braces
@@ -295,7 +321,7 @@ void ArchDesc::expand_opclass(FILE *fp, const char *indent, const Expr *cost,
   const Form *form = _globalNames[result_type];
   OperandForm *op = form ? form->is_operand() : NULL;
   if( op && op->_classes.count() > 0 ) {
-    if( debug_output ) { fprintf(fp, "// expand operand classes for operand: %s \n", (char *)op->_ident  ); } // %%%%% Explanation
+    if( debug_output && fp != NULL ) { fprintf(fp, "// expand operand classes for operand: %s \n", (char *)op->_ident  ); } // %%%%% Explanation
     // Iterate through all operand classes which include this operand
     op->_classes.reset();
     const char *oclass;
@@ -317,7 +343,7 @@ void ArchDesc::chain_rule(FILE *fp, const char *indent, const char *operand,
   } else {
     operands_chained_from.Insert( operand, operand);
   }
-  if( debug_output ) { fprintf(fp, "// chain rules starting from: %s  and  %s \n", (char *)operand, (char *)irule); } // %%%%% Explanation
+  if( debug_output && fp != NULL ) { fprintf(fp, "// chain rules starting from: %s  and  %s \n", (char *)operand, (char *)irule); } // %%%%% Explanation
 
   ChainList *lst = (ChainList *)_chainRules[operand];
   if (lst) {
@@ -355,6 +381,81 @@ void ArchDesc::chain_rule(FILE *fp, const char *indent, const char *operand,
   }
 }
 
+//---------------------------has_chain_routine---------------------------------
+// Machine operands with chain rules get a State::_chain_<operand> routine
+// which applies all of them, shared by every match producing the operand.
+bool ArchDesc::has_chain_routine(const char *operand) {
+  const Form *form = _globalNames[operand];
+  OperandForm *op = form ? form->is_operand() : NULL;
+  return op != NULL && !op->ideal_only() && _chainRules[operand] != NULL;
+}
+
+//---------------------------chain_rule_is_checked-----------------------------
+// Check that chain_rule would guard each production reached from 'operand'
+// by a full validity and cost check, as the shared chain routine does.
+// Mirrors the walk of chain_rule and expand_opclass.
+bool ArchDesc::chain_rule_is_checked(const char *operand, Dict &operands_chained_from, ProductionState &status) {
+  if( operands_chained_from[operand] != NULL ) {
+    return true;
+  } else {
+    operands_chained_from.Insert( operand, operand);
+  }
+
+  ChainList *lst = (ChainList *)_chainRules[operand];
+  if (lst) {
+    const char *result, *cost, *rule;
+    for(lst->reset(); (lst->iter(result,cost,rule)) == true; ) {
+      if( operands_chained_from[result] != NULL ) {
+        continue;
+      }
+      if( status.valid(ArchDesc::getMachOperEnum(result)) == knownValid ) {
+        return false;
+      }
+      const Form *form = _globalNames[result];
+      OperandForm *op = form ? form->is_operand() : NULL;
+      if( op && op->_classes.count() > 0 ) {
+        op->_classes.reset();
+        const char *oclass;
+        while( (oclass = op->_classes.iter()) != NULL ) {
+          if( status.valid(ArchDesc::getMachOperEnum(oclass)) == knownValid ) {
+            return false;
+          }
+        }
+      }
+      if( !chain_rule_is_checked(result, operands_chained_from, status) ) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//---------------------------gen_chain_routine---------------------------------
+// Example:
+//   void  State::_chain_rRegI(unsigned int c, unsigned int rule) {
+//     if (STATE__NOT_YET_VALID(RAX_REGI) || _cost[RAX_REGI] > c) {
+//       DFA_PRODUCTION__SET_VALID(RAX_REGI, rule, c)
+//     }
+//     ...
+//   }
+// 'rule' is the rule producing the operand at cost 'c'.  The State may
+// already hold any of the results, so every production gets a full check.
+void ArchDesc::gen_chain_routine(FILE *fp, const char *operand, ProductionState &status, Dict &operands_chained_from) {
+  const char *spaces2 = "  ";
+  const Expr *cost = new Expr("c", "c", Expr::Zero, Expr::Max);
+
+  // Prime the status so that each result reached is unknownValid
+  status.initialize();
+  status.set_constraint(hasConstraint);
+  operands_chained_from.Clear();
+  chain_rule(NULL, spaces2, operand, cost, chain_rule_arg, operands_chained_from, status);
+
+  fprintf(fp, "void  State::_chain_%s(unsigned int c, unsigned int %s) {\n", operand, chain_rule_arg);
+  operands_chained_from.Clear();
+  chain_rule(fp, spaces2, operand, cost, chain_rule_arg, operands_chained_from, status);
+  fprintf(fp, "}\n");
+}
+
 //---------------------------prune_matchlist-----------------------------------
 // Check for duplicate entries in a matchlist, and prune out the higher cost
 // entry.
@@ -421,6 +522,14 @@ void ArchDesc::buildDFA(FILE* fp) {
 );
   fprintf(fp, "\n");
   fprintf(fp, "\n");
+  // Build the shared chain rule routines called from the matches below
+  _operands.reset();
+  OperandForm *op;
+  for( ; (op = (OperandForm*)_operands.iter()) != NULL; ) {
+    if (has_chain_routine(op->_ident)) {
+      gen_chain_routine(fp, op->_ident, status, operands_chained_from);
+    }
+  }
   if (_dfa_small) {
     // Now build the individual routines just like the switch entries in large version
     // Iterate over the table of MatchLists, start at first valid opcode of 1
@@ -971,6 +1080,10 @@ Production *ProductionState::getProduction(const char *result) {
   return p;
 }
 
+const char *ProductionState::constraint() {
+  return _constraint;
+}
+
 void ProductionState::set_constraint(const char *constraint) {
   _constraint = constraint;
 }
@@ -2072,6 +2072,14 @@ void ArchDesc::defineStateClass(FILE *fp) {
   fprintf(fp,"  void dump();                // Debugging prints\n");
   fprintf(fp,"  void dump(int depth);\n");
   fprintf(fp,"#endif\n");
+  // Generate the shared chain rule routines, see ArchDesc::gen_chain_routine
+  _operands.reset();
+  OperandForm *op;
+  for( ; (op = (OperandForm*)_operands.iter()) != NULL; ) {
+    if (has_chain_routine(op->_ident)) {
+      fprintf(fp, "  void  _chain_%s(unsigned int c, unsigned int rule);\n", op->_ident);
+    }
+  }
   if (_dfa_small) {
     // Generate the routine name we'll need
     for (int i = 1; i < _last_opcode; i++) {
@@ -189,6 +189,11 @@ void AOTLib::verify_config() {
   if (!TieredCompilation && _config->_tieredAOT) {
     handle_config_error("Shared file %s error: Expected to run with tiered compilation on", _name);
   }
+  // Only code compiled for tiered compilation counts invocations and
+  // backedges, so hot methods of other libraries are never recompiled.
+  if (_valid && TieredCompilation && !_config->_tieredAOT && PrintAOT) {
+    tty->print_cr("Shared file %s was not compiled for tiered compilation: its methods will not be recompiled", _name);
+  }
 
   // Shifts are static values which initialized by 0 until java heap initialization.
   // AOT libs are loaded before heap initialized so shift values are not set.
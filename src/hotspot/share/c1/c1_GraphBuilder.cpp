@@ -1635,8 +1635,12 @@ void GraphBuilder::access_field(Bytecodes::Code code) {
   BasicType field_type = field->type()->basic_type();
   ValueType* type = as_ValueType(field_type);
   // call will_link again to determine if the field is valid.
+  // Accesses to fields watched by JVMTI are patched too: the patching
+  // stub deoptimizes so that the interpreter posts the event.
+  const bool is_get = (code == Bytecodes::_getstatic || code == Bytecodes::_getfield);
   const bool needs_patching = !holder->is_loaded() ||
                               !field->will_link(method(), code) ||
+                              field->is_watched_by_jvmti(is_get) ||
                               PatchALot;
 
   ValueStack* state_before = NULL;
@@ -938,7 +938,7 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
 }
 
 void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
-  if (if_instr->should_profile()) {
+  if (if_instr->should_profile() && !C1SampledProfiling) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != NULL, "method should be set if branch is profiled");
     ciMethodData* md = method->method_data_or_null();
@@ -974,6 +974,99 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
   }
 }
 
+// Sampled profiling: count down a thread local stride and only update the
+// MDO when it expires, adding a freshly drawn stride to the counter. The
+// strides are independent with mean 2^C1ProfileSampleStrideLog, so the
+// expected counts match those of exact profiling. Jumps to 'skip' while the
+// countdown has not expired, otherwise returns the (pointer sized) step.
+// Kills the condition codes.
+LIR_Opr LIRGenerator::sampled_profile_step(LabelObj* skip) {
+  LIR_Opr thread = getThreadPointer();
+  int countdown_offset = in_bytes(JavaThread::profile_sample_countdown_offset());
+  int seed_offset = in_bytes(JavaThread::profile_sample_seed_offset());
+
+  LIR_Opr countdown = new_register(T_INT);
+  __ move(new LIR_Address(thread, countdown_offset, T_INT), countdown);
+  __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+  __ move(countdown, new LIR_Address(thread, countdown_offset, T_INT));
+  __ cmp(lir_cond_greater, countdown, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_greater, skip->label());
+
+  // xorshift32 for the next stride
+  LIR_Opr seed = new_register(T_INT);
+  LIR_Opr tmp = new_register(T_INT);
+  __ move(new LIR_Address(thread, seed_offset, T_INT), seed);
+  __ move(seed, tmp);
+  __ shift_left(tmp, 13, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ move(seed, tmp);
+  __ unsigned_shift_right(tmp, 17, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ move(seed, tmp);
+  __ shift_left(tmp, 5, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ move(seed, new LIR_Address(thread, seed_offset, T_INT));
+
+  // stride in [mean/2 + 1, 3*mean/2]
+  int mean = 1 << C1ProfileSampleStrideLog;
+  LIR_Opr stride = new_register(T_INT);
+  __ move(seed, stride);
+  __ logical_and(stride, LIR_OprFact::intConst(mean - 1), stride);
+  __ add(stride, LIR_OprFact::intConst(mean / 2 + 1), stride);
+  __ move(stride, new LIR_Address(thread, countdown_offset, T_INT));
+
+#ifdef _LP64
+  LIR_Opr step = new_pointer_register();
+  __ convert(Bytecodes::_i2l, stride, step);
+  return step;
+#else
+  return stride;
+#endif
+}
+
+// Called before the compare of an If when C1SampledProfiling is on: the
+// sampling check kills the condition codes, so it redoes the compare to
+// select the taken or not taken counter.
+void LIRGenerator::profile_branch_sampled(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
+  if (!C1SampledProfiling || !if_instr->should_profile()) {
+    return;
+  }
+  ciMethod* method = if_instr->profiled_method();
+  assert(method != NULL, "method should be set if branch is profiled");
+  ciMethodData* md = method->method_data_or_null();
+  assert(md != NULL, "Sanity");
+  ciProfileData* data = md->bci_to_data(if_instr->profiled_bci());
+  assert(data != NULL, "must have profiling data");
+  assert(data->is_BranchData(), "need BranchData for two-way branches");
+  int taken_count_offset     = md->byte_offset_of_slot(data, BranchData::taken_offset());
+  int not_taken_count_offset = md->byte_offset_of_slot(data, BranchData::not_taken_offset());
+  if (if_instr->is_swapped()) {
+    int t = taken_count_offset;
+    taken_count_offset = not_taken_count_offset;
+    not_taken_count_offset = t;
+  }
+
+  LabelObj* skip = new LabelObj();
+  LIR_Opr step = sampled_profile_step(skip);
+
+  LIR_Opr md_reg = new_register(T_METADATA);
+  __ metadata2reg(md->constant_encoding(), md_reg);
+
+  LIR_Opr data_offset_reg = new_pointer_register();
+  __ cmp(lir_cond(cond), left, right);
+  __ cmove(lir_cond(cond),
+           LIR_OprFact::intptrConst(taken_count_offset),
+           LIR_OprFact::intptrConst(not_taken_count_offset),
+           data_offset_reg, as_BasicType(if_instr->x()->type()));
+
+  LIR_Opr data_reg = new_pointer_register();
+  LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
+  __ move(data_addr, data_reg);
+  __ add(data_reg, step, data_reg);
+  __ move(data_reg, data_addr);
+  __ branch_destination(skip->label());
+}
+
 // Phi technique:
 // This is about passing live values from one basic block to the other.
 // In code generated with Java it is rather rare that more than one
@@ -2479,11 +2572,24 @@ void LIRGenerator::do_Goto(Goto* x) {
       assert(data->is_JumpData(), "need JumpData for branches");
       offset = md->byte_offset_of_slot(data, JumpData::taken_offset());
     }
-    LIR_Opr md_reg = new_register(T_METADATA);
-    __ metadata2reg(md->constant_encoding(), md_reg);
+    if (C1SampledProfiling) {
+      LabelObj* skip = new LabelObj();
+      LIR_Opr step = sampled_profile_step(skip);
+      LIR_Opr md_reg = new_register(T_METADATA);
+      __ metadata2reg(md->constant_encoding(), md_reg);
+      LIR_Opr data_reg = new_pointer_register();
+      LIR_Address* data_addr = new LIR_Address(md_reg, offset, data_reg->type());
+      __ move(data_addr, data_reg);
+      __ add(data_reg, step, data_reg);
+      __ move(data_reg, data_addr);
+      __ branch_destination(skip->label());
+    } else {
+      LIR_Opr md_reg = new_register(T_METADATA);
+      __ metadata2reg(md->constant_encoding(), md_reg);
 
-    increment_counter(new LIR_Address(md_reg, offset,
-                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+      increment_counter(new LIR_Address(md_reg, offset,
+                                        NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+    }
   }
 
   // emit phi-instruction move after safepoint since this simplifies
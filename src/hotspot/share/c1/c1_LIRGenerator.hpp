@@ -394,6 +394,8 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
   LIR_Opr safepoint_poll_register();
 
   void profile_branch(If* if_instr, If::Condition cond);
+  void profile_branch_sampled(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right);
+  LIR_Opr sampled_profile_step(LabelObj* skip);
   void increment_event_counter_impl(CodeEmitInfo* info,
                                     ciMethod *method, LIR_Opr step, int frequency,
                                     int bci, bool backedge, bool notify);
@@ -4331,11 +4331,30 @@ int Interval::first_usage(IntervalUseKind min_use_kind) const {
   return max_jint;
 }
 
+// The use positions are sorted descending, so the positions >= from are
+// exactly the entries up to the returned index. Returns the index of the
+// smallest use position >= from, or -2 if there is none. Binary search
+// keeps the usage queries of the allocator independent of the number of
+// uses of long intervals.
+int Interval::use_pos_index_from(int from) const {
+  int lo = 0;
+  int hi = _use_pos_and_kinds.length() / 2;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (_use_pos_and_kinds.at(2 * mid) >= from) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return 2 * lo - 2;
+}
+
 int Interval::next_usage(IntervalUseKind min_use_kind, int from) const {
   assert(LinearScan::is_virtual_interval(this), "cannot access use positions for fixed intervals");
 
-  for (int i = _use_pos_and_kinds.length() - 2; i >= 0; i -= 2) {
-    if (_use_pos_and_kinds.at(i) >= from && _use_pos_and_kinds.at(i + 1) >= min_use_kind) {
+  for (int i = use_pos_index_from(from); i >= 0; i -= 2) {
+    if (_use_pos_and_kinds.at(i + 1) >= min_use_kind) {
       return _use_pos_and_kinds.at(i);
     }
   }
@@ -4345,8 +4364,8 @@ int Interval::next_usage(IntervalUseKind min_use_kind, int from) const {
 int Interval::next_usage_exact(IntervalUseKind exact_use_kind, int from) const {
   assert(LinearScan::is_virtual_interval(this), "cannot access use positions for fixed intervals");
 
-  for (int i = _use_pos_and_kinds.length() - 2; i >= 0; i -= 2) {
-    if (_use_pos_and_kinds.at(i) >= from && _use_pos_and_kinds.at(i + 1) == exact_use_kind) {
+  for (int i = use_pos_index_from(from); i >= 0; i -= 2) {
+    if (_use_pos_and_kinds.at(i + 1) == exact_use_kind) {
       return _use_pos_and_kinds.at(i);
     }
   }
@@ -4356,16 +4375,16 @@ int Interval::next_usage_exact(IntervalUseKind exact_use_kind, int from) const {
 int Interval::previous_usage(IntervalUseKind min_use_kind, int from) const {
   assert(LinearScan::is_virtual_interval(this), "cannot access use positions for fixed intervals");
 
-  int prev = 0;
-  for (int i = _use_pos_and_kinds.length() - 2; i >= 0; i -= 2) {
-    if (_use_pos_and_kinds.at(i) > from) {
-      return prev;
-    }
+  // the entries after the last position > from are the ones <= from,
+  // the first of them with a matching kind is the closest usage
+  int len = _use_pos_and_kinds.length();
+  int start = (from == max_jint ? 0 : use_pos_index_from(from + 1) + 2);
+  for (int i = start; i < len; i += 2) {
     if (_use_pos_and_kinds.at(i + 1) >= min_use_kind) {
-      prev = _use_pos_and_kinds.at(i);
+      return _use_pos_and_kinds.at(i);
     }
   }
-  return prev;
+  return 0;
 }
 
 void Interval::add_use_pos(int pos, IntervalUseKind use_kind) {
@@ -4474,10 +4493,7 @@ Interval* Interval::split(int split_pos) {
 
   // split list of use positions
   int total_len = _use_pos_and_kinds.length();
-  int start_idx = total_len - 2;
-  while (start_idx >= 0 && _use_pos_and_kinds.at(start_idx) < split_pos) {
-    start_idx -= 2;
-  }
+  int start_idx = use_pos_index_from(split_pos);
 
   intStack new_use_pos_and_kinds(total_len - start_idx);
   int i;
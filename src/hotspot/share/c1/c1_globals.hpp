@@ -325,6 +325,14 @@
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
+  product(bool, C1SampledProfiling, false, DIAGNOSTIC,                      \
+          "Update branch profiles in MDOs only once per randomized "        \
+          "per-thread stride of profiled events")                           \
+                                                                            \
+  product(intx, C1ProfileSampleStrideLog, 4, DIAGNOSTIC,                    \
+          "log2 of the mean stride used by C1SampledProfiling")             \
+          range(1, 10)                                                      \
+                                                                            \
   product(bool, C1ProfileCheckcasts, true,                                  \
           "Profile checkcasts when generating code for updating MDOs")      \
                                                                             \
@@ -39,12 +39,13 @@ private:
   friend class ciMethodHandle;
 
   enum { MorphismLimit = 2 }; // Max call site's morphism we care about
+  enum { ReceiverLimit = 8 }; // Max receivers kept (see TypeProfileWidth)
   int  _limit;                // number of receivers have been determined
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
-  int  _receiver_count[MorphismLimit + 1]; // # times receivers have been seen
-  ciMethod* _method[MorphismLimit + 1];    // receivers methods
-  ciKlass*  _receiver[MorphismLimit + 1];  // receivers (exact)
+  int  _receiver_count[ReceiverLimit + 1]; // # times receivers have been seen
+  ciMethod* _method[ReceiverLimit + 1];    // receivers methods
+  ciKlass*  _receiver[ReceiverLimit + 1];  // receivers (exact)
 
   ciCallProfile() {
     _limit = 0;
@@ -61,6 +62,7 @@ public:
   // Note:  The following predicates return false for invalid profiles:
   bool      has_receiver(int i) const { return _limit > i; }
   int       morphism() const          { return _morphism; }
+  int       receivers() const         { return _limit; }
 
   int       count() const             { return _count; }
   int       receiver_count(int i)  {
@@ -122,6 +122,7 @@ ciEnv::ciEnv(CompileTask* task)
 #endif /* !PRODUCT */
 
   _num_inlined_bytecodes = 0;
+  _arena_peak = 0;
   assert(task == NULL || thread->task() == task, "sanity");
   if (task != NULL) {
     task->mark_started(os::elapsed_counter());
@@ -158,6 +159,7 @@ ciEnv::ciEnv(CompileTask* task)
   _the_min_jint_string = NULL;
 
   _jvmti_redefinition_count = 0;
+  _jvmti_field_watch_count = 0;
   _jvmti_can_hotswap_or_post_breakpoint = false;
   _jvmti_can_access_local_variables = false;
   _jvmti_can_post_on_exceptions = false;
@@ -187,6 +189,7 @@ ciEnv::ciEnv(Arena* arena) : _ciEnv_arena(mtCompiler) {
 #endif /* !PRODUCT */
 
   _num_inlined_bytecodes = 0;
+  _arena_peak = 0;
   _task = NULL;
   _log = NULL;
 
@@ -214,6 +217,7 @@ ciEnv::ciEnv(Arena* arena) : _ciEnv_arena(mtCompiler) {
   _the_min_jint_string = NULL;
 
   _jvmti_redefinition_count = 0;
+  _jvmti_field_watch_count = 0;
   _jvmti_can_hotswap_or_post_breakpoint = false;
   _jvmti_can_access_local_variables = false;
   _jvmti_can_post_on_exceptions = false;
@@ -237,6 +241,7 @@ bool ciEnv::cache_jvmti_state() {
   // Get Jvmti capabilities under lock to get consistant values.
   MutexLocker mu(JvmtiThreadState_lock);
   _jvmti_redefinition_count             = JvmtiExport::redefinition_count();
+  _jvmti_field_watch_count              = JvmtiExport::field_watch_count();
   _jvmti_can_hotswap_or_post_breakpoint = JvmtiExport::can_hotswap_or_post_breakpoint();
   _jvmti_can_access_local_variables     = JvmtiExport::can_access_local_variables();
   _jvmti_can_post_on_exceptions         = JvmtiExport::can_post_on_exceptions();
@@ -251,6 +256,11 @@ bool ciEnv::jvmti_state_changed() const {
     return true;
   }
 
+  // Some fields were watched, and may have been accessed by this compilation
+  if (_jvmti_field_watch_count != JvmtiExport::field_watch_count()) {
+    return true;
+  }
+
   if (!_jvmti_can_access_local_variables &&
       JvmtiExport::can_access_local_variables()) {
     return true;
@@ -60,6 +60,7 @@ private:
   int              _compilable;
   bool             _break_at_compile;
   int              _num_inlined_bytecodes;
+  size_t           _arena_peak;
   CompileTask*     _task;           // faster access to CompilerThread::task
   CompileLog*      _log;            // faster access to CompilerThread::log
   void*            _compiler_data;  // compiler-specific stuff, if any
@@ -69,6 +70,7 @@ private:
 
   // Cache Jvmti state
   uint64_t _jvmti_redefinition_count;
+  uint64_t _jvmti_field_watch_count;
   bool  _jvmti_can_hotswap_or_post_breakpoint;
   bool  _jvmti_can_access_local_variables;
   bool  _jvmti_can_post_on_exceptions;
@@ -451,6 +453,10 @@ public:
   // Total number of bytecodes in inlined methods in this compile
   int num_inlined_bytecodes() const;
 
+  // Peak arena memory reported by the compiler; used only for statistics.
+  void   record_arena_peak(size_t peak) { _arena_peak = MAX2(_arena_peak, peak); }
+  size_t arena_peak() const             { return _arena_peak; }
+
   // Output stream for logging compilation info.
   CompileLog* log() { return _log; }
   void set_log(CompileLog* log) { _log = log; }
@@ -30,6 +30,7 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/linkResolver.hpp"
 #include "oops/oop.inline.hpp"
+#include "prims/jvmtiExport.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/reflectionUtils.hpp"
@@ -415,6 +416,13 @@ bool ciField::will_link(ciMethod* accessing_method,
   return true;
 }
 
+// ------------------------------------------------------------------
+// ciField::is_watched_by_jvmti
+bool ciField::is_watched_by_jvmti(bool is_get) const {
+  return JvmtiExport::selective_field_watch_deoptimization() &&
+         (is_get ? flags().is_field_access_watched() : flags().is_field_modification_watched());
+}
+
 // ------------------------------------------------------------------
 // ciField::print
 void ciField::print() {
@@ -178,6 +178,10 @@ public:
   // (or class/initializer methods if the field is static).
   bool has_initialized_final_update() const { return flags().has_initialized_final_update(); }
 
+  // Does a JVMTI agent watch this kind of access to the field? Compiled
+  // code leaves such accesses to the interpreter, which posts the event.
+  bool is_watched_by_jvmti(bool is_get) const;
+
   bool is_call_site_target() {
     ciInstanceKlass* callsite_klass = CURRENT_ENV->CallSite_klass();
     if (callsite_klass == NULL)
@@ -65,6 +65,9 @@ public:
   // (or class/initializer methods if the field is static) and false
   // otherwise.
   bool has_initialized_final_update() const { return (_flags & JVM_ACC_FIELD_INITIALIZED_FINAL_UPDATE) != 0; };
+  // Fields watched by a JVMTI agent.
+  bool is_field_access_watched      () const { return (_flags & JVM_ACC_FIELD_ACCESS_WATCHED      ) != 0; }
+  bool is_field_modification_watched() const { return (_flags & JVM_ACC_FIELD_MODIFICATION_WATCHED) != 0; }
 
   // Conversion
   jint   as_int()                      { return _flags; }
@@ -37,6 +37,7 @@
 #include "classfile/packageEntry.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/verificationType.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -5313,6 +5314,12 @@ InstanceKlass* ClassFileParser::create_instance_klass(bool changed_by_loadhook,
     ik->store_fingerprint(_stream->compute_fingerprint());
   }
 
+  if (VerificationCache::is_enabled() && !is_hidden() && !is_unsafe_anonymous() &&
+      _major_version >= Verifier::STACKMAP_ATTRIBUTE_MAJOR_VERSION &&
+      Verifier::should_verify_for(ik->class_loader(), true)) {
+    VerificationCache::record_class_file(ik, _stream);
+  }
+
   ik->set_has_passed_fingerprint_check(false);
   if (UseAOT && ik->supers_have_passed_fingerprint_checks()) {
     uint64_t aot_fp = AOTLoader::get_saved_fingerprint(ik);
@@ -88,6 +88,7 @@ typedef void     (*ZipClose_t)(jzfile *zip);
 typedef jzentry* (*FindEntry_t)(jzfile *zip, const char *name, jint *sizeP, jint *nameLen);
 typedef jboolean (*ReadEntry_t)(jzfile *zip, jzentry *entry, unsigned char *buf, char *namebuf);
 typedef jzentry* (*GetNextEntry_t)(jzfile *zip, jint n);
+typedef void     (*FreeEntry_t)(jzfile *zip, jzentry *entry);
 typedef jint     (*Crc32_t)(jint crc, const jbyte *buf, jint len);
 
 static ZipOpen_t         ZipOpen            = NULL;
@@ -95,6 +96,7 @@ static ZipClose_t        ZipClose           = NULL;
 static FindEntry_t       FindEntry          = NULL;
 static ReadEntry_t       ReadEntry          = NULL;
 static GetNextEntry_t    GetNextEntry       = NULL;
+static FreeEntry_t       FreeEntry          = NULL;
 static Crc32_t           Crc32              = NULL;
 int ClassLoader::_libzip_loaded = 0;
 
@@ -105,6 +107,7 @@ static JImageClose_t                   JImageClose            = NULL;
 static JImagePackageToModule_t         JImagePackageToModule  = NULL;
 static JImageFindResource_t            JImageFindResource     = NULL;
 static JImageGetResource_t             JImageGetResource      = NULL;
+static JImageGetResourceAddress_t      JImageGetResourceAddress = NULL;
 static JImageResourceIterator_t        JImageResourceIterator = NULL;
 
 // Globals
@@ -279,21 +282,95 @@ ClassPathZipEntry::ClassPathZipEntry(jzfile* zip, const char* zip_name,
   _zip = zip;
   _zip_name = copy_path(zip_name);
   _from_class_path_attr = from_class_path_attr;
+  _is_boot_append = is_boot_append;
+  _misses = 0;
+  _dir_filter = NULL;
 }
 
 ClassPathZipEntry::~ClassPathZipEntry() {
   (*ZipClose)(_zip);
   FREE_C_HEAP_ARRAY(char, _zip_name);
+  if (_dir_filter != NULL) {
+    FREE_C_HEAP_ARRAY(uint64_t, _dir_filter);
+  }
+}
+
+// Every -Xbootclasspath/a archive is probed for each class that is not
+// found in the entries before it. Once an archive has missed often
+// enough, a Bloom filter over its directory names lets later lookups
+// skip it without calling into the zip library. The filter has no false
+// negatives, so it never changes which entry a class is loaded from.
+static const int  DirFilterMissThreshold = 64;
+static const uint DirFilterBits = 64 * K;
+
+// Hash of the directory part of name, i.e. everything before the last '/'
+static unsigned int dir_name_hash(const char* name) {
+  const char* end = strrchr(name, '/');
+  unsigned int h = 0;
+  if (end != NULL) {
+    for (const char* p = name; p < end; p++) {
+      h = 31 * h + (unsigned char)*p;
+    }
+  }
+  return h;
+}
+
+static inline uint dir_filter_bit1(unsigned int h) {
+  return h % DirFilterBits;
+}
+
+static inline uint dir_filter_bit2(unsigned int h) {
+  return ((h * 2654435761U) >> 16) % DirFilterBits;
+}
+
+bool ClassPathZipEntry::may_contain(const char* name) const {
+  const uint64_t* filter = Atomic::load_acquire(&_dir_filter);
+  if (filter == NULL) {
+    return true;
+  }
+  unsigned int h = dir_name_hash(name);
+  uint b1 = dir_filter_bit1(h);
+  uint b2 = dir_filter_bit2(h);
+  return (filter[b1 / 64] & (UCONST64(1) << (b1 % 64))) != 0 &&
+         (filter[b2 / 64] & (UCONST64(1) << (b2 % 64))) != 0;
+}
+
+// Called in native state from open_entry().
+void ClassPathZipEntry::build_dir_filter() {
+  uint64_t* filter = NEW_C_HEAP_ARRAY(uint64_t, DirFilterBits / 64, mtClass);
+  memset(filter, 0, DirFilterBits / 8);
+  for (int n = 0; ; n++) {
+    jzentry* ze = (*GetNextEntry)(_zip, n);
+    if (ze == NULL) break;
+    unsigned int h = dir_name_hash(ze->name);
+    uint b1 = dir_filter_bit1(h);
+    uint b2 = dir_filter_bit2(h);
+    filter[b1 / 64] |= UCONST64(1) << (b1 % 64);
+    filter[b2 / 64] |= UCONST64(1) << (b2 % 64);
+    (*FreeEntry)(_zip, ze);
+  }
+  if (!Atomic::replace_if_null(&_dir_filter, filter)) {
+    // Another thread built it first.
+    FREE_C_HEAP_ARRAY(uint64_t, filter);
+  }
 }
 
 u1* ClassPathZipEntry::open_entry(const char* name, jint* filesize, bool nul_terminate, TRAPS) {
+  if (!may_contain(name)) {
+    return NULL;
+  }
     // enable call to C land
   JavaThread* thread = JavaThread::current();
   ThreadToNativeFromVM ttn(thread);
   // check whether zip archive contains name
   jint name_len;
   jzentry* entry = (*FindEntry)(_zip, name, filesize, &name_len);
-  if (entry == NULL) return NULL;
+  if (entry == NULL) {
+    if (_is_boot_append && _misses++ == DirFilterMissThreshold) {
+      build_dir_filter();
+    }
+    return NULL;
+  }
   u1* buffer;
   char name_buf[128];
   char* filename;
@@ -417,11 +494,17 @@ ClassFileStream* ClassPathImageEntry::open_stream_for_loader(const char* name, C
     if (UsePerfData) {
       ClassLoader::perf_sys_classfile_bytes_read()->inc(size);
     }
-    char* data = NEW_RESOURCE_ARRAY(char, size);
-    (*JImageGetResource)(_jimage, location, data, size);
+    // Uncompressed classes in the mapped image are parsed in place. The
+    // image stays open for the lifetime of the VM.
+    const char* data = (*JImageGetResourceAddress)(_jimage, location);
+    if (data == NULL) {
+      char* buffer = NEW_RESOURCE_ARRAY(char, size);
+      (*JImageGetResource)(_jimage, location, buffer, size);
+      data = buffer;
+    }
     // Resource allocated
     assert(this == (ClassPathImageEntry*)ClassLoader::get_jrt_entry(), "must be");
-    return new ClassFileStream((u1*)data,
+    return new ClassFileStream((const u1*)data,
                                (int)size,
                                _name,
                                ClassFileStream::verify,
@@ -996,6 +1079,7 @@ void ClassLoader::load_zip_library() {
   FindEntry = CAST_TO_FN_PTR(FindEntry_t, dll_lookup(handle, "ZIP_FindEntry", path));
   ReadEntry = CAST_TO_FN_PTR(ReadEntry_t, dll_lookup(handle, "ZIP_ReadEntry", path));
   GetNextEntry = CAST_TO_FN_PTR(GetNextEntry_t, dll_lookup(handle, "ZIP_GetNextEntry", path));
+  FreeEntry = CAST_TO_FN_PTR(FreeEntry_t, dll_lookup(handle, "ZIP_FreeEntry", path));
   Crc32 = CAST_TO_FN_PTR(Crc32_t, dll_lookup(handle, "ZIP_CRC32", path));
 }
 
@@ -1016,6 +1100,7 @@ void ClassLoader::load_jimage_library() {
   JImagePackageToModule = CAST_TO_FN_PTR(JImagePackageToModule_t, dll_lookup(handle, "JIMAGE_PackageToModule", path));
   JImageFindResource = CAST_TO_FN_PTR(JImageFindResource_t, dll_lookup(handle, "JIMAGE_FindResource", path));
   JImageGetResource = CAST_TO_FN_PTR(JImageGetResource_t, dll_lookup(handle, "JIMAGE_GetResource", path));
+  JImageGetResourceAddress = CAST_TO_FN_PTR(JImageGetResourceAddress_t, dll_lookup(handle, "JIMAGE_GetResourceAddress", path));
   JImageResourceIterator = CAST_TO_FN_PTR(JImageResourceIterator_t, dll_lookup(handle, "JIMAGE_ResourceIterator", path));
 }
 
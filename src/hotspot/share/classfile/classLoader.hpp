@@ -101,6 +101,11 @@ class ClassPathZipEntry: public ClassPathEntry {
   jzfile* _zip;              // The zip archive
   const char*   _zip_name;   // Name of zip archive
   bool _from_class_path_attr; // From the "Class-path" attribute of a jar file
+  bool _is_boot_append;      // Entry of the boot loader's append path
+  int _misses;               // Number of failed lookups, racy but only a heuristic
+  uint64_t* volatile _dir_filter; // Bloom filter over directory names, or NULL
+  bool may_contain(const char* name) const;
+  void build_dir_filter();
  public:
   bool is_jar_file() const { return true;  }
   bool from_class_path_attr() const { return _from_class_path_attr; }
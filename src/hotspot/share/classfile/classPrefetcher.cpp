@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "classfile/classPrefetcher.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+
+static GrowableArray<Symbol*>* _classes = NULL;
+static volatile int _next_class = 0;
+static volatile int _num_loaded = 0;
+static volatile int _num_running = 0;
+
+static bool read_class_list(const char* path) {
+  fileStream in(path, "r");
+  if (!in.is_open()) {
+    warning("Cannot open class prefetch list %s", path);
+    return false;
+  }
+
+  _classes = new (ResourceObj::C_HEAP, mtClass) GrowableArray<Symbol*>(1000, mtClass);
+  char line[1024];
+  while (in.readln(line, sizeof(line)) != NULL) {
+    // Skip comments and the @lambda-proxy/@lambda-form-invoker lines.
+    if (line[0] == '#' || line[0] == '@') {
+      continue;
+    }
+    char name[1024];
+    if (sscanf(line, "%1023s", name) == 1) {
+      for (char* p = name; *p != '\0'; p++) {
+        if (*p == '.') *p = '/';
+      }
+      _classes->append(SymbolTable::new_symbol(name));
+    }
+  }
+  return _classes->length() > 0;
+}
+
+void ClassPrefetcher::prefetch_thread_entry(JavaThread* thread, TRAPS) {
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  int loaded = 0;
+  int i;
+  while ((i = Atomic::fetch_and_add(&_next_class, 1)) < _classes->length()) {
+    Symbol* name = _classes->at(i);
+    Klass* k = SystemDictionary::resolve_or_null(name, loader, Handle(), THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      // Prefetching is only a hint. The application sees the failure
+      // again when it loads the class itself.
+      CLEAR_PENDING_EXCEPTION;
+    } else if (k != NULL) {
+      loaded++;
+    }
+    name->decrement_refcount();
+  }
+
+  Atomic::add(&_num_loaded, loaded);
+  if (Atomic::sub(&_num_running, 1) == 0) {
+    log_info(class, load)("Prefetched %d of %d classes from %s",
+                          Atomic::load(&_num_loaded), _classes->length(), PrefetchClassList);
+  }
+}
+
+void ClassPrefetcher::start(TRAPS) {
+  if (PrefetchClassList == NULL || !read_class_list(PrefetchClassList)) {
+    return;
+  }
+
+  int num_threads = MIN2((int)PrefetchClassThreads, _classes->length());
+  _num_running = num_threads;
+  for (int i = 0; i < num_threads; i++) {
+    char name[64];
+    jio_snprintf(name, sizeof(name), "Class Prefetch Thread#%d", i);
+    Handle string = java_lang_String::create_from_str(name, CHECK);
+
+    // Initialize thread_oop to put it into the system threadGroup
+    Handle thread_group (THREAD, Universe::system_thread_group());
+    Handle thread_oop = JavaCalls::construct_new_instance(
+                            SystemDictionary::Thread_klass(),
+                            vmSymbols::threadgroup_string_void_signature(),
+                            thread_group,
+                            string,
+                            CHECK);
+
+    MutexLocker mu(THREAD, Threads_lock);
+    JavaThread* thread = new JavaThread(&prefetch_thread_entry);
+    if (thread == NULL || thread->osthread() == NULL) {
+      // Not fatal: the remaining threads, or the application, load the classes.
+      log_info(class, load)("Could not create class prefetch thread");
+      if (thread != NULL) {
+        thread->smr_delete();
+      }
+      if (Atomic::sub(&_num_running, num_threads - i) == 0) {
+        // No thread was started, nobody else reads _classes.
+        return;
+      }
+      break;
+    }
+
+    java_lang_Thread::set_thread(thread_oop(), thread);
+    java_lang_Thread::set_priority(thread_oop(), NormPriority);
+    java_lang_Thread::set_daemon(thread_oop());
+    thread->set_threadObj(thread_oop());
+
+    Threads::add(thread);
+    Thread::start(thread);
+  }
+}
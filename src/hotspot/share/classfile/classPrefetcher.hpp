@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_CLASSPREFETCHER_HPP
+#define SHARE_CLASSFILE_CLASSPREFETCHER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/exceptions.hpp"
+
+class JavaThread;
+
+// ClassPrefetcher loads the classes named in -XX:PrefetchClassList through
+// the system class loader, using PrefetchClassThreads background threads,
+// once the VM has started.  The built-in loaders are parallel capable, so
+// the class files of different classes are read and parsed concurrently,
+// and only the define step is serialized by the SystemDictionary.  The
+// classes are loaded but not linked or initialized, so the application
+// finds them already defined on first use.
+//
+// The list uses the -XX:SharedClassListFile format; only the class name at
+// the start of each line is used.
+
+class ClassPrefetcher : AllStatic {
+  static void prefetch_thread_entry(JavaThread* thread, TRAPS);
+
+ public:
+  // Read the class list and start the prefetch threads.
+  static void start(TRAPS);
+};
+
+#endif // SHARE_CLASSFILE_CLASSPREFETCHER_HPP
@@ -26,6 +26,7 @@
 #include "jvm.h"
 #include "classfile/classFileParser.hpp"
 #include "classfile/fieldLayoutBuilder.hpp"
+#include "classfile/hotFieldProfile.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/array.hpp"
 #include "oops/fieldStreams.inline.hpp"
@@ -505,6 +506,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _fields(fields),
   _info(info),
   _root_group(NULL),
+  _hot_group(NULL),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(NULL),
   _layout(NULL),
@@ -538,6 +540,7 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  _hot_group = new FieldGroup();
 }
 
 // Field sorting for regular classes:
@@ -545,6 +548,8 @@ void FieldLayoutBuilder::prologue() {
 //   - non-static fields are also sorted according to their contention group
 //     (support of the @Contended annotation)
 //   - @Contended annotation is ignored for static fields
+//   - non-contended non-static fields recorded as hot in the HotFieldProfile
+//     are set apart, so they can be allocated first
 void FieldLayoutBuilder::regular_field_sorting() {
   for (AllFieldStream fs(_fields, _constant_pool); !fs.done(); fs.next()) {
     FieldGroup* group = NULL;
@@ -560,6 +565,8 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (HotFieldProfile::is_hot(_classname, fs.name())) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -587,6 +594,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
     }
   }
   _root_group->sort_by_size();
+  _hot_group->sort_by_size();
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
@@ -607,6 +615,8 @@ void FieldLayoutBuilder::insert_contended_padding(LayoutRawBlock* slot) {
 //   - primitive fields are allocated first (from the biggest to the smallest)
 //   - then oop fields are allocated, either in existing gaps or at the end of
 //     the layout
+//   - hot fields are allocated before all others, in the same order, so they
+//     get the lowest offsets and share a cache line with the object header
 void FieldLayoutBuilder::compute_regular_layout() {
   bool need_tail_padding = false;
   prologue();
@@ -619,6 +629,8 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  _layout->add(_hot_group->primitive_fields());
+  _layout->add(_hot_group->oop_fields());
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -662,6 +674,13 @@ void FieldLayoutBuilder::epilogue() {
     }
   }
 
+  if (_hot_group->oop_fields() != NULL) {
+    for (int i = 0; i < _hot_group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = _hot_group->oop_fields()->at(i);
+      nonstatic_oop_maps->add(b->offset(), 1);
+    }
+  }
+
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
       FieldGroup* cg = _contended_groups.at(i);
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/hotFieldProfile.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "interpreter/bytecodeStream.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/constantPool.hpp"
+#include "oops/cpCache.inline.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+// File format, one record per line:
+//
+//   field <holder> <name> <weight>
+//
+// The weight is the sum of the invocation and backedge counts of the
+// methods accessing the field and is informational.  Only fields whose
+// weight is within a factor of HotFieldRatio of the hottest field of the
+// same class are recorded.
+
+static const uint64_t HotFieldRatio = 8;
+
+class HotFieldKey {
+ public:
+  Symbol* _holder;
+  Symbol* _name;
+
+  HotFieldKey(Symbol* holder, Symbol* name) : _holder(holder), _name(name) {}
+
+  static unsigned hash(const HotFieldKey& k) {
+    return k._holder->identity_hash() ^ (31 * k._name->identity_hash());
+  }
+
+  static bool equals(const HotFieldKey& a, const HotFieldKey& b) {
+    return a._holder == b._holder && a._name == b._name;
+  }
+};
+
+// Maps to the accumulated weight.
+typedef ResourceHashtable<HotFieldKey, uint64_t,
+                          HotFieldKey::hash, HotFieldKey::equals,
+                          1009, ResourceObj::C_HEAP, mtClass> HotFieldTable;
+
+// Maps a holder to the weight of its hottest field.
+typedef ResourceHashtable<Symbol*, uint64_t,
+                          primitive_hash<Symbol*>, primitive_equals<Symbol*>,
+                          1009, ResourceObj::C_HEAP, mtClass> HotHolderTable;
+
+static HotFieldTable* _table = NULL;
+
+// Used while dumping only.
+static HotFieldTable* _weights = NULL;
+static HotHolderTable* _holders = NULL;
+
+bool HotFieldProfile::is_enabled() {
+  return HotFieldProfileFile != NULL;
+}
+
+void HotFieldProfile::load() {
+  if (!is_enabled()) {
+    return;
+  }
+  fileStream in(HotFieldProfileFile, "r");
+  if (!in.is_open()) {
+    // No profile yet; it is written when this VM exits.
+    return;
+  }
+
+  _table = new (ResourceObj::C_HEAP, mtClass) HotFieldTable();
+
+  const int max_name = 1024;
+  char line[2 * max_name + 64];
+  char holder[max_name];
+  char name[max_name];
+  int fields = 0;
+
+  while (in.readln(line, sizeof(line)) != NULL) {
+    julong weight;
+    if (sscanf(line, "field %1023s %1023s " JULONG_FORMAT, holder, name, &weight) == 3) {
+      HotFieldKey key(SymbolTable::new_symbol(holder), SymbolTable::new_symbol(name));
+      if (_table->put(key, (uint64_t)weight)) {
+        fields++;
+      }
+    }
+  }
+
+  log_info(class)("Loaded %d hot fields from %s", fields, HotFieldProfileFile);
+}
+
+bool HotFieldProfile::is_hot(const Symbol* holder, const Symbol* name) {
+  if (_table == NULL) {
+    return false;
+  }
+  HotFieldKey key(const_cast<Symbol*>(holder), const_cast<Symbol*>(name));
+  return _table->contains(key);
+}
+
+static void record_field_accesses(Method* m) {
+  if (m->method_holder()->is_hidden()) {
+    return;
+  }
+  uint64_t weight = (uint64_t)m->invocation_count() + (uint64_t)m->backedge_count();
+  ConstantPoolCache* cache = m->constants()->cache();
+  if (weight == 0 || cache == NULL) {
+    return;
+  }
+  BytecodeStream bcs(methodHandle(Thread::current(), m));
+  while (!bcs.is_last_bytecode()) {
+    Bytecodes::Code code = bcs.next();
+    if (code != Bytecodes::_getfield && code != Bytecodes::_putfield) {
+      continue;
+    }
+    ConstantPoolCacheEntry* e = cache->entry_at(bcs.get_index_u2_cpcache());
+    if (!e->is_resolved(Bytecodes::_getfield) && !e->is_resolved(Bytecodes::_putfield)) {
+      continue;
+    }
+    InstanceKlass* holder = InstanceKlass::cast(e->f1_as_klass());
+    if (holder->is_hidden()) {
+      continue;
+    }
+    HotFieldKey key(holder->name(), holder->field_name(e->field_index()));
+    bool created;
+    uint64_t* w = _weights->put_if_absent(key, 0, &created);
+    *w += weight;
+
+    uint64_t* max = _holders->put_if_absent(key._holder, 0, &created);
+    if (*w > *max) {
+      *max = *w;
+    }
+  }
+}
+
+class HotFieldWriter : StackObj {
+  outputStream* _out;
+  int _fields;
+ public:
+  HotFieldWriter(outputStream* out) : _out(out), _fields(0) {}
+
+  bool do_entry(const HotFieldKey& key, const uint64_t& weight) {
+    uint64_t* max = _holders->get(key._holder);
+    if (max != NULL && weight * HotFieldRatio >= *max) {
+      ResourceMark rm;
+      _out->print_cr("field %s %s " UINT64_FORMAT, key._holder->as_C_string(),
+                     key._name->as_C_string(), weight);
+      _fields++;
+    }
+    return true;
+  }
+
+  int fields() const { return _fields; }
+};
+
+void HotFieldProfile::dump() {
+  if (!is_enabled()) {
+    return;
+  }
+  fileStream out(HotFieldProfileFile, "w");
+  if (!out.is_open()) {
+    warning("Cannot open hot field profile file %s", HotFieldProfileFile);
+    return;
+  }
+  _weights = new (ResourceObj::C_HEAP, mtClass) HotFieldTable();
+  _holders = new (ResourceObj::C_HEAP, mtClass) HotHolderTable();
+  SystemDictionary::methods_do(record_field_accesses);
+
+  HotFieldWriter writer(&out);
+  _weights->iterate(&writer);
+  log_info(class)("Saved %d hot fields to %s", writer.fields(), HotFieldProfileFile);
+
+  delete _weights;
+  delete _holders;
+  _weights = NULL;
+  _holders = NULL;
+}
+
+void hotFieldProfile_init() {
+  HotFieldProfile::load();
+}
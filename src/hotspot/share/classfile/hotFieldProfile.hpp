@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_HOTFIELDPROFILE_HPP
+#define SHARE_CLASSFILE_HOTFIELDPROFILE_HPP
+
+#include "memory/allocation.hpp"
+
+class Symbol;
+
+// HotFieldProfile carries a field access profile of one run of the VM to
+// the next.  With -XX:HotFieldProfileFile, the getfield and putfield
+// bytecodes of every executed method are weighed with the invocation and
+// backedge counts of the method when the VM exits, and the hottest
+// instance fields of each class are written to the file.  When the file is
+// read at startup, the field layout builder places those fields ahead of
+// the other fields of their class, so that they share the first cache
+// lines of the object.
+
+class HotFieldProfile : AllStatic {
+ public:
+  // Read the profile file, if any.  Called once during VM startup.
+  static void load();
+
+  // Write the hot fields of all loaded classes to the profile file.
+  static void dump();
+
+  // True if the field was hot in the recorded run.
+  static bool is_hot(const Symbol* holder, const Symbol* name);
+
+  static bool is_enabled();
+};
+
+#endif // SHARE_CLASSFILE_HOTFIELDPROFILE_HPP
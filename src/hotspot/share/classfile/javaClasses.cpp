@@ -2404,6 +2404,35 @@ void java_lang_Throwable::java_printStackTrace(Handle throwable, TRAPS) {
                           THREAD);
 }
 
+// Names of the classes in OmitStackTraceInClasses, created on first use
+static GrowableArray<Symbol*>* volatile _omit_stack_trace_names = NULL;
+
+bool java_lang_Throwable::omits_stack_trace(Klass* k) {
+  if (OmitStackTraceInClasses == NULL) {
+    return false;
+  }
+  GrowableArray<Symbol*>* names = Atomic::load_acquire(&_omit_stack_trace_names);
+  if (names == NULL) {
+    names = new (ResourceObj::C_HEAP, mtInternal) GrowableArray<Symbol*>(4, mtInternal);
+    char* list = os::strdup_check_oom(OmitStackTraceInClasses, mtInternal);
+    char* save = NULL;
+    for (char* name = strtok_r(list, ",", &save); name != NULL; name = strtok_r(NULL, ",", &save)) {
+      for (char* p = name; *p != '\0'; p++) {
+        if (*p == '.') *p = '/';
+      }
+      names->append(SymbolTable::new_permanent_symbol(name));
+    }
+    os::free(list);
+    GrowableArray<Symbol*>* prev = Atomic::cmpxchg(&_omit_stack_trace_names, (GrowableArray<Symbol*>*)NULL, names);
+    if (prev != NULL) {
+      // Lost the race; the permanent symbols are shared anyway.
+      delete names;
+      names = prev;
+    }
+  }
+  return names->contains(k->name());
+}
+
 void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHandle& method, TRAPS) {
   if (!StackTraceInThrowable) return;
   ResourceMark rm(THREAD);
@@ -2415,6 +2444,11 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
   // This is unnecessary in 1.7+ but harmless
   clear_stacktrace(throwable());
 
+  if (omits_stack_trace(throwable->klass())) {
+    set_depth(throwable(), 0);
+    return;
+  }
+
   int max_depth = MaxJavaStackTraceDepth;
   JavaThread* thread = THREAD->as_Java_thread();
 
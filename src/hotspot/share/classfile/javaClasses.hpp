@@ -536,6 +536,9 @@ class java_lang_Throwable: AllStatic {
   static void set_stacktrace(oop throwable, oop st_element_array);
   static oop unassigned_stacktrace();
 
+  // True if the class is listed in OmitStackTraceInClasses
+  static bool omits_stack_trace(Klass* k);
+
  public:
   // Backtrace
   static oop backtrace(oop throwable);
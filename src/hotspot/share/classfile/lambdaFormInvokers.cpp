@@ -45,10 +45,44 @@
 #include "oops/typeArrayOop.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
+#include "utilities/resourceHash.hpp"
+
+static unsigned line_hash(const char* const& line) {
+  unsigned hash = 0;
+  for (const char* p = line; *p != '\0'; p++) {
+    hash = 31 * hash + (unsigned)*p;
+  }
+  return hash;
+}
+
+static bool line_equals(const char* const& a, const char* const& b) {
+  return strcmp(a, b) == 0;
+}
+
+typedef ResourceHashtable<const char*, bool, line_hash, line_equals,
+                          1009, ResourceObj::C_HEAP, mtClassShared> LambdaFormLineTable;
+
+static LambdaFormLineTable* _seen_lines = NULL;
 
 GrowableArray<char*>* LambdaFormInvokers::_lambdaform_lines = NULL;
 
+bool LambdaFormInvokers::record_unique(const char* line) {
+  if (_seen_lines == NULL) {
+    _seen_lines = new (ResourceObj::C_HEAP, mtClassShared) LambdaFormLineTable();
+  }
+  if (_seen_lines->contains(line)) {
+    return false;
+  }
+  _seen_lines->put(os::strdup(line, mtClassShared), true);
+  return true;
+}
+
 void LambdaFormInvokers::append(char* line) {
+  if (!record_unique(line)) {
+    log_debug(cds)("Duplicated lambda form invoker: %s", line);
+    os::free(line);
+    return;
+  }
   if (_lambdaform_lines == NULL) {
     _lambdaform_lines = new GrowableArray<char*>(100);
   }
@@ -37,6 +37,10 @@ class LambdaFormInvokers : public AllStatic {
   static void reload_class(char* name, ClassFileStream& st, TRAPS);
  public:
 
+  // Returns true the first time a given line is passed in.  Identical
+  // invokers spun by several class loaders are recorded only once.
+  static bool record_unique(const char* line);
+
   static void append(char* line);
   static void regenerate_holder_classes(TRAPS);
   static GrowableArray<char*>* lambdaform_lines() {
@@ -31,6 +31,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -365,6 +366,9 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
     if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      if (AssistTableGrowth) {
+        assist_growth(THREAD);
+      }
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
@@ -378,24 +382,37 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
 
 // Concurrent work
 void StringTable::grow(JavaThread* jt) {
-  StringTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
+  EventStringTableGrow event;
+  double load_factor = get_load_factor();
+  size_t old_size = _current_size;
   log_trace(stringtable)("Started to grow");
   {
     TraceTime timer("Grow", TRACETIME_LOG(Debug, stringtable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
-      }
-      gt.cont(jt);
+    if (!_local_table->grow_to_load_factor(jt, &_items_count, PREF_AVG_LIST_LEN, AssistTableGrowth)) {
+      return;
     }
   }
-  gt.done(jt);
   _current_size = table_size();
   log_debug(stringtable)("Grown to size:" SIZE_FORMAT, _current_size);
+  if (event.should_commit()) {
+    event.set_oldBucketCount(old_size);
+    event.set_newBucketCount(_current_size);
+    event.set_entryCount(_items_count);
+    event.set_loadFactor((float)load_factor);
+    event.commit();
+  }
+}
+
+// Interning threads move a range of buckets for an ongoing grow. Otherwise
+// they ask for a grow once the load factor is exceeded, instead of waiting
+// for the next GC notification.
+void StringTable::assist_growth(Thread* thread) {
+  if (_local_table->grow_assist_or_check(thread, &_items_count, PREF_AVG_LIST_LEN) &&
+      !has_work()) {
+    log_debug(stringtable)("Concurrent work triggered, live factor: %g",
+                           get_load_factor());
+    trigger_concurrent_work();
+  }
 }
 
 struct StringTableDoDelete : StackObj {
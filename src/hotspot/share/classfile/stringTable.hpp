@@ -54,6 +54,7 @@ class StringTable : public CHeapObj<mtSymbol>{
   static OopStorage* _oop_storage;
 
   static void grow(JavaThread* jt);
+  static void assist_growth(Thread* thread);
   static void clean_dead_entries(JavaThread* jt);
 
   static double get_load_factor();
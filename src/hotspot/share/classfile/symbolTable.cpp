@@ -27,6 +27,7 @@
 #include "classfile/compactHashtable.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/archiveBuilder.hpp"
 #include "memory/dynamicArchive.hpp"
@@ -489,6 +490,13 @@ Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, boo
     check_concurrent_work();
   }
 
+  // Move a range of buckets for an ongoing grow, or ask for one so that
+  // bursts of inserts do not wait for a clean hint to get short chains.
+  if (AssistTableGrowth &&
+      _local_table->grow_assist_or_check(THREAD, &_items_count, PREF_AVG_LIST_LEN)) {
+    check_concurrent_work();
+  }
+
   assert((sym == NULL) || sym->refcount() != 0, "found dead symbol");
   return sym;
 }
@@ -643,24 +651,25 @@ void SymbolTable::serialize_shared_table_header(SerializeClosure* soc,
 
 // Concurrent work
 void SymbolTable::grow(JavaThread* jt) {
-  SymbolTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
+  EventSymbolTableGrow event;
+  double load_factor = get_load_factor();
+  size_t old_size = _current_size;
   log_trace(symboltable)("Started to grow");
   {
     TraceTime timer("Grow", TRACETIME_LOG(Debug, symboltable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
-      }
-      gt.cont(jt);
+    if (!_local_table->grow_to_load_factor(jt, &_items_count, PREF_AVG_LIST_LEN, AssistTableGrowth)) {
+      return;
     }
   }
-  gt.done(jt);
   _current_size = table_size();
   log_debug(symboltable)("Grown to size:" SIZE_FORMAT, _current_size);
+  if (event.should_commit()) {
+    event.set_oldBucketCount(old_size);
+    event.set_newBucketCount(_current_size);
+    event.set_entryCount(_items_count);
+    event.set_loadFactor((float)load_factor);
+    event.commit();
+  }
 }
 
 struct SymbolTableDoDelete : StackObj {
@@ -2852,6 +2852,8 @@ Handle SystemDictionary::link_method_handle_constant(Klass* caller,
 // while linking an invokedynamic op, or compute a constant for Dynamic_info CP entry
 // with linkage results being stored back into the bootstrap specifier.
 void SystemDictionary::invoke_bootstrap_method(BootstrapInfo& bootstrap_specifier, TRAPS) {
+  EventBootstrapMethodInvocation event;
+
   // Resolve the bootstrap specifier, its name, type, and static arguments
   bootstrap_specifier.resolve_bsm(CHECK);
 
@@ -2900,6 +2902,13 @@ void SystemDictionary::invoke_bootstrap_method(BootstrapInfo& bootstrap_specifie
     bootstrap_specifier.set_resolved_value(value);
   }
 
+  if (event.should_commit()) {
+    event.set_callerClass(bootstrap_specifier.caller());
+    event.set_constantPoolIndex(bootstrap_specifier.bss_index());
+    event.set_dynamicConstant(!is_indy);
+    event.commit();
+  }
+
   // sanity check
   assert(bootstrap_specifier.is_resolved() ||
          (bootstrap_specifier.is_method_call() &&
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "classfile/altHashing.hpp"
+#include "classfile/classFileStream.hpp"
+#include "classfile/classLoader.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/verificationCache.hpp"
+#include "classfile/verificationType.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+// File format:
+//
+//   class <name> <length> <crc32> <hash1> <hash2> <number of constraints>
+//   constraint <name> <from name> <flags>
+//   ...
+//
+// The constraints follow the class they belong to.
+
+class VerificationDigest {
+ public:
+  u4 _length;
+  u4 _crc;
+  u4 _hash1;
+  u4 _hash2;
+
+  static unsigned hash(const VerificationDigest& d) {
+    return d._crc ^ d._hash1;
+  }
+
+  static bool equals(const VerificationDigest& a, const VerificationDigest& b) {
+    return a._length == b._length && a._crc == b._crc &&
+           a._hash1 == b._hash1 && a._hash2 == b._hash2;
+  }
+};
+
+class VerificationCacheEntry : public CHeapObj<mtClass> {
+ public:
+  Symbol* _name;
+  int _num_constraints;
+  VerificationCache::Constraint* _constraints;
+};
+
+typedef ResourceHashtable<VerificationDigest, VerificationCacheEntry*,
+                          VerificationDigest::hash, VerificationDigest::equals,
+                          4099, ResourceObj::C_HEAP, mtClass> VerificationCacheTable;
+
+// Digests of the classes that have been parsed but not verified yet.
+typedef ResourceHashtable<InstanceKlass*, VerificationDigest,
+                          primitive_hash<InstanceKlass*>, primitive_equals<InstanceKlass*>,
+                          1009, ResourceObj::C_HEAP, mtClass> PendingDigestTable;
+
+static VerificationCacheTable* _table = NULL;
+static PendingDigestTable* _pending = NULL;
+
+bool VerificationCache::is_enabled() {
+  return VerificationCacheFile != NULL;
+}
+
+static VerificationCacheEntry* new_entry(Symbol* name, int num_constraints) {
+  VerificationCacheEntry* e = new VerificationCacheEntry();
+  e->_name = name;
+  e->_num_constraints = num_constraints;
+  e->_constraints = NEW_C_HEAP_ARRAY(VerificationCache::Constraint, MAX2(num_constraints, 1), mtClass);
+  return e;
+}
+
+static void delete_entry(VerificationCacheEntry* e) {
+  FREE_C_HEAP_ARRAY(VerificationCache::Constraint, e->_constraints);
+  delete e;
+}
+
+void VerificationCache::load() {
+  if (!is_enabled()) {
+    return;
+  }
+  _table = new (ResourceObj::C_HEAP, mtClass) VerificationCacheTable();
+  _pending = new (ResourceObj::C_HEAP, mtClass) PendingDigestTable();
+
+  fileStream in(VerificationCacheFile, "r");
+  if (!in.is_open()) {
+    // No cache yet; it is written when this VM exits.
+    return;
+  }
+
+  const int max_name = 1024;
+  char line[2 * max_name + 64];
+  char name[max_name];
+  char from_name[max_name];
+  int classes = 0;
+
+  while (in.readln(line, sizeof(line)) != NULL) {
+    VerificationDigest d;
+    int n;
+    if (sscanf(line, "class %1023s %u %x %x %x %d", name,
+               &d._length, &d._crc, &d._hash1, &d._hash2, &n) != 6 || n < 0) {
+      continue;
+    }
+    VerificationCacheEntry* e = new_entry(SymbolTable::new_symbol(name), n);
+    int i = 0;
+    while (i < n && in.readln(line, sizeof(line)) != NULL) {
+      Constraint* c = &e->_constraints[i];
+      if (sscanf(line, "constraint %1023s %1023s %d", name, from_name, &c->_flags) != 3) {
+        break;
+      }
+      c->_name = SymbolTable::new_symbol(name);
+      c->_from_name = SymbolTable::new_symbol(from_name);
+      i++;
+    }
+    if (i < n || !_table->put(d, e)) {
+      // Truncated or duplicate record. Symbols are left to the SymbolTable.
+      delete_entry(e);
+      continue;
+    }
+    classes++;
+  }
+
+  log_info(verification)("Loaded %d verified classes from %s", classes, VerificationCacheFile);
+}
+
+class VerificationCacheWriter : StackObj {
+  outputStream* _out;
+ public:
+  VerificationCacheWriter(outputStream* out) : _out(out) {}
+  bool do_entry(const VerificationDigest& d, VerificationCacheEntry* e) {
+    ResourceMark rm;
+    _out->print_cr("class %s %u %x %x %x %d", e->_name->as_C_string(),
+                   d._length, d._crc, d._hash1, d._hash2, e->_num_constraints);
+    for (int i = 0; i < e->_num_constraints; i++) {
+      VerificationCache::Constraint* c = &e->_constraints[i];
+      _out->print_cr("constraint %s %s %d", c->_name->as_C_string(),
+                     c->_from_name->as_C_string(), c->_flags);
+    }
+    return true;
+  }
+};
+
+void VerificationCache::dump() {
+  if (!is_enabled() || _table == NULL) {
+    return;
+  }
+  fileStream out(VerificationCacheFile, "w");
+  if (!out.is_open()) {
+    warning("Cannot open verification cache file %s", VerificationCacheFile);
+    return;
+  }
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  VerificationCacheWriter writer(&out);
+  _table->iterate(&writer);
+}
+
+void VerificationCache::record_class_file(InstanceKlass* ik, const ClassFileStream* stream) {
+  assert(is_enabled(), "sanity");
+  if (_pending == NULL) {
+    return; // Not initialized yet.
+  }
+  const jbyte* bytes = (const jbyte*)stream->buffer();
+  int length = stream->length();
+  VerificationDigest d;
+  d._length = (u4)length;
+  d._crc = (u4)ClassLoader::crc32(0, (const char*)bytes, length);
+  d._hash1 = AltHashing::murmur3_32(0x5bd1e995, bytes, length);
+  d._hash2 = AltHashing::murmur3_32(0x9747b28c, bytes, length);
+
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  _pending->put(ik, d);
+}
+
+void VerificationCache::forget(InstanceKlass* ik) {
+  if (_pending != NULL) {
+    MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+    _pending->remove(ik);
+  }
+}
+
+bool VerificationCache::check(InstanceKlass* ik, TRAPS) {
+  if (_pending == NULL) {
+    return false;
+  }
+  int num_constraints = 0;
+  Constraint* constraints = NULL;
+  {
+    MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+    VerificationDigest* d = _pending->get(ik);
+    if (d == NULL) {
+      return false;
+    }
+    VerificationCacheEntry** e = _table->get(*d);
+    if (e == NULL || (*e)->_name != ik->name()) {
+      return false;
+    }
+    // Entries are never removed, so they can be used outside of the lock.
+    num_constraints = (*e)->_num_constraints;
+    constraints = (*e)->_constraints;
+  }
+
+  for (int i = 0; i < num_constraints; i++) {
+    Constraint* c = &constraints[i];
+    bool ok = VerificationType::resolve_and_check_assignability(ik, c->_name, c->_from_name,
+                (c->_flags & Constraint::FROM_FIELD_IS_PROTECTED) != 0,
+                (c->_flags & Constraint::FROM_IS_ARRAY) != 0,
+                (c->_flags & Constraint::FROM_IS_OBJECT) != 0, THREAD);
+    if (HAS_PENDING_EXCEPTION || !ok) {
+      // Let the verifier find out, and report, what changed.
+      CLEAR_PENDING_EXCEPTION;
+      return false;
+    }
+  }
+
+  forget(ik);
+  if (log_is_enabled(Info, verification)) {
+    ResourceMark rm(THREAD);
+    log_info(verification)("Verified %s from the verification cache (%d constraints)",
+                           ik->external_name(), num_constraints);
+  }
+  return true;
+}
+
+void VerificationCache::add(InstanceKlass* ik, const GrowableArray<Constraint>* constraints) {
+  if (_pending == NULL) {
+    return;
+  }
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  VerificationDigest* d = _pending->get(ik);
+  if (d == NULL) {
+    return;
+  }
+  VerificationDigest digest = *d;
+  _pending->remove(ik);
+  if (_table->get(digest) != NULL) {
+    // Verified again because a recorded constraint no longer holds. Keep
+    // the first entry; the class is verified in full in every run.
+    return;
+  }
+
+  int n = constraints == NULL ? 0 : constraints->length();
+  ik->name()->increment_refcount();
+  VerificationCacheEntry* e = new_entry(ik->name(), n);
+  for (int i = 0; i < n; i++) {
+    Constraint c = constraints->at(i);
+    c._name->increment_refcount();
+    c._from_name->increment_refcount();
+    e->_constraints[i] = c;
+  }
+  _table->put(digest, e);
+}
+
+void verificationCache_init() {
+  VerificationCache::load();
+}
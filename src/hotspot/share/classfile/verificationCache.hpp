@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_VERIFICATIONCACHE_HPP
+#define SHARE_CLASSFILE_VERIFICATIONCACHE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/exceptions.hpp"
+#include "utilities/growableArray.hpp"
+
+class ClassFileStream;
+class InstanceKlass;
+class Symbol;
+
+// VerificationCache remembers, across runs, the classes that passed the
+// split verifier.  With -XX:VerificationCacheFile, a class is identified by
+// a digest of its class file bytes.  Verification depends on the class
+// hierarchy of other classes only through the assignability checks made by
+// VerificationType::resolve_and_check_assignability(), so these are
+// recorded with the class, the same way SystemDictionaryShared records the
+// verification constraints of archived classes.  When a class with a known
+// digest is verified again, only the recorded checks are repeated; if any
+// of them fails, the class goes through the verifier as usual.
+
+class VerificationCache : AllStatic {
+ public:
+  class Constraint {
+   public:
+    enum {
+      FROM_FIELD_IS_PROTECTED = 1 << 0,
+      FROM_IS_ARRAY           = 1 << 1,
+      FROM_IS_OBJECT          = 1 << 2
+    };
+    Symbol* _name;
+    Symbol* _from_name;
+    int     _flags;
+  };
+
+  static bool is_enabled();
+
+  // Read the cache file, if any.  Called once during VM startup.
+  static void load();
+
+  // Write all known entries back to the cache file.
+  static void dump();
+
+  // Remember the class file digest of ik until it is verified.
+  static void record_class_file(InstanceKlass* ik, const ClassFileStream* stream);
+  static void forget(InstanceKlass* ik);
+
+  // Returns true if ik has been verified in an earlier run and all the
+  // recorded assignability checks still hold.
+  static bool check(InstanceKlass* ik, TRAPS);
+
+  // ik has passed the split verifier with the given assignability checks.
+  static void add(InstanceKlass* ik, const GrowableArray<Constraint>* constraints);
+};
+
+#endif // SHARE_CLASSFILE_VERIFICATIONCACHE_HPP
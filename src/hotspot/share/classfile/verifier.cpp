@@ -181,6 +181,13 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
                            jt->get_thread_stat()->perf_timers_addr(),
                            PerfClassTraceTime::CLASS_VERIFY);
 
+  // A class with the same bytes passed the split verifier in an earlier run.
+  if (VerificationCache::is_enabled() &&
+      klass->major_version() >= STACKMAP_ATTRIBUTE_MAJOR_VERSION &&
+      VerificationCache::check(klass, THREAD)) {
+    return true;
+  }
+
   // If the class should be verified, first see if we can use the split
   // verifier.  If not, or if verification fails and can failover, then
   // call the inference verifier.
@@ -195,6 +202,10 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
     split_verifier.verify_class(THREAD);
     exception_name = split_verifier.result();
 
+    if (exception_name == NULL && !HAS_PENDING_EXCEPTION && split_verifier.is_cacheable()) {
+      VerificationCache::add(klass, split_verifier.cache_constraints());
+    }
+
     // If DumpSharedSpaces is set then don't fall back to the old verifier on
     // verification failure. If a class fails verification with the split verifier,
     // it might fail the CDS runtime verifier constraint check. In that case, we
@@ -590,8 +601,11 @@ void ErrorContext::stackmap_details(outputStream* ss, const Method* method) cons
 ClassVerifier::ClassVerifier(
     InstanceKlass* klass, TRAPS)
     : _thread(THREAD), _previous_symbol(NULL), _symbols(NULL), _exception_type(NULL),
-      _message(NULL), _method_signatures_table(NULL), _klass(klass) {
+      _message(NULL), _method_signatures_table(NULL), _cache_constraints(NULL), _klass(klass) {
   _this_type = VerificationType::reference_type(klass->name());
+  if (VerificationCache::is_enabled()) {
+    _cache_constraints = new GrowableArray<VerificationCache::Constraint>(8);
+  }
 }
 
 ClassVerifier::~ClassVerifier() {
@@ -2090,6 +2104,10 @@ Klass* ClassVerifier::load_class(Symbol* name, TRAPS) {
 
   assert(name_in_supers(name, current_class()), "name should be a super class");
 
+  // The protected access checks look into the loaded class, which can't be
+  // expressed as a VerificationCache constraint.
+  _cache_constraints = NULL;
+
   Klass* kls = SystemDictionary::resolve_or_fail(
     name, Handle(THREAD, loader), Handle(THREAD, protection_domain),
     true, THREAD);
@@ -2102,6 +2120,27 @@ Klass* ClassVerifier::load_class(Symbol* name, TRAPS) {
   return kls;
 }
 
+void ClassVerifier::record_assignability_check(Symbol* name, Symbol* from_name,
+                                               bool from_field_is_protected,
+                                               bool from_is_array, bool from_is_object) {
+  if (_cache_constraints == NULL) {
+    return;
+  }
+  VerificationCache::Constraint c;
+  c._name = name;
+  c._from_name = from_name;
+  c._flags = (from_field_is_protected ? VerificationCache::Constraint::FROM_FIELD_IS_PROTECTED : 0) |
+             (from_is_array           ? VerificationCache::Constraint::FROM_IS_ARRAY           : 0) |
+             (from_is_object          ? VerificationCache::Constraint::FROM_IS_OBJECT          : 0);
+  for (int i = 0; i < _cache_constraints->length(); i++) {
+    const VerificationCache::Constraint& other = _cache_constraints->at(i);
+    if (other._name == c._name && other._from_name == c._from_name && other._flags == c._flags) {
+      return;
+    }
+  }
+  _cache_constraints->append(c);
+}
+
 bool ClassVerifier::is_protected_access(InstanceKlass* this_class,
                                         Klass* target_class,
                                         Symbol* field_name,
@@ -25,6 +25,7 @@
 #ifndef SHARE_CLASSFILE_VERIFIER_HPP
 #define SHARE_CLASSFILE_VERIFIER_HPP
 
+#include "classfile/verificationCache.hpp"
 #include "classfile/verificationType.hpp"
 #include "oops/klass.hpp"
 #include "oops/method.hpp"
@@ -289,6 +290,10 @@ class ClassVerifier : public StackObj {
 
   ErrorContext _error_context;  // contains information about an error
 
+  // Assignability checks made, for the VerificationCache. NULL if the
+  // result is not going to be cached.
+  GrowableArray<VerificationCache::Constraint>* _cache_constraints;
+
   void verify_method(const methodHandle& method, TRAPS);
   char* generate_code_data(const methodHandle& m, u4 code_length, TRAPS);
   void verify_exception_handler_table(u4 code_length, char* code_data,
@@ -437,6 +442,14 @@ class ClassVerifier : public StackObj {
 
   Klass* load_class(Symbol* name, TRAPS);
 
+  void record_assignability_check(Symbol* name, Symbol* from_name,
+                                  bool from_field_is_protected,
+                                  bool from_is_array, bool from_is_object);
+  bool is_cacheable() const { return _cache_constraints != NULL; }
+  const GrowableArray<VerificationCache::Constraint>* cache_constraints() const {
+    return _cache_constraints;
+  }
+
   method_signatures_table_type* method_signatures_table() const {
     return _method_signatures_table;
   }
@@ -133,6 +133,11 @@ bool vmIntrinsics::preserves_state(vmIntrinsics::ID id) {
   case vmIntrinsics::_dlog10:
   case vmIntrinsics::_dexp:
   case vmIntrinsics::_dpow:
+  case vmIntrinsics::_strict_dsin:
+  case vmIntrinsics::_strict_dcos:
+  case vmIntrinsics::_strict_dtan:
+  case vmIntrinsics::_strict_dlog:
+  case vmIntrinsics::_strict_dlog10:
   case vmIntrinsics::_checkIndex:
   case vmIntrinsics::_Reference_get:
   case vmIntrinsics::_updateCRC32:
@@ -177,6 +182,11 @@ bool vmIntrinsics::can_trap(vmIntrinsics::ID id) {
   case vmIntrinsics::_dlog10:
   case vmIntrinsics::_dexp:
   case vmIntrinsics::_dpow:
+  case vmIntrinsics::_strict_dsin:
+  case vmIntrinsics::_strict_dcos:
+  case vmIntrinsics::_strict_dtan:
+  case vmIntrinsics::_strict_dlog:
+  case vmIntrinsics::_strict_dlog10:
   case vmIntrinsics::_updateCRC32:
   case vmIntrinsics::_updateBytesCRC32:
   case vmIntrinsics::_updateByteBufferCRC32:
@@ -314,6 +324,11 @@ bool vmIntrinsics::disabled_by_jvm_flags(vmIntrinsics::ID id) {
   case vmIntrinsics::_dpow:
   case vmIntrinsics::_dlog10:
   case vmIntrinsics::_datan2:
+  case vmIntrinsics::_strict_dsin:
+  case vmIntrinsics::_strict_dcos:
+  case vmIntrinsics::_strict_dtan:
+  case vmIntrinsics::_strict_dlog:
+  case vmIntrinsics::_strict_dlog10:
   case vmIntrinsics::_min:
   case vmIntrinsics::_max:
   case vmIntrinsics::_floatToIntBits:
@@ -499,6 +514,10 @@ bool vmIntrinsics::disabled_by_jvm_flags(vmIntrinsics::ID id) {
   case vmIntrinsics::_vectorizedMismatch:
     if (!UseVectorizedMismatchIntrinsic) return true;
     break;
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
+    if (!UseStringHashCodeIntrinsic) return true;
+    break;
   case vmIntrinsics::_updateBytesAdler32:
   case vmIntrinsics::_updateByteBufferAdler32:
     if (!UseAdler32Intrinsics) return true;
@@ -161,6 +161,12 @@ class methodHandle;
   do_intrinsic(_dlog10,                   java_lang_Math,         log10_name, double_double_signature,           F_S)   \
   do_intrinsic(_dpow,                     java_lang_Math,         pow_name,   double2_double_signature,          F_S)   \
   do_intrinsic(_dexp,                     java_lang_Math,         exp_name,   double_double_signature,           F_S)   \
+  /* StrictMath natives that have a bit-compatible fdlibm port in SharedRuntime */                                      \
+  do_intrinsic(_strict_dsin,              java_lang_StrictMath,   sin_name,   double_double_signature,           F_SN)  \
+  do_intrinsic(_strict_dcos,              java_lang_StrictMath,   cos_name,   double_double_signature,           F_SN)  \
+  do_intrinsic(_strict_dtan,              java_lang_StrictMath,   tan_name,   double_double_signature,           F_SN)  \
+  do_intrinsic(_strict_dlog,              java_lang_StrictMath,   log_name,   double_double_signature,           F_SN)  \
+  do_intrinsic(_strict_dlog10,            java_lang_StrictMath,   log10_name, double_double_signature,           F_SN)  \
   do_intrinsic(_min,                      java_lang_Math,         min_name,   int2_int_signature,                F_S)   \
   do_intrinsic(_max,                      java_lang_Math,         max_name,   int2_int_signature,                F_S)   \
   do_intrinsic(_addExactI,                java_lang_Math,         addExact_name, int2_int_signature,             F_S)   \
@@ -326,6 +332,10 @@ class methodHandle;
   do_intrinsic(_equalsL,                  java_lang_StringLatin1,equals_name, equalsB_signature,                 F_S)   \
   do_intrinsic(_equalsU,                  java_lang_StringUTF16, equals_name, equalsB_signature,                 F_S)   \
                                                                                                                         \
+  do_intrinsic(_hashCodeL,                java_lang_StringLatin1,hashCode_name, hashCodeB_signature,             F_S)   \
+  do_intrinsic(_hashCodeU,                java_lang_StringUTF16, hashCode_name, hashCodeB_signature,             F_S)   \
+   do_signature(hashCodeB_signature,                            "([B)I")                                                \
+                                                                                                                        \
   do_intrinsic(_isDigit,                  java_lang_CharacterDataLatin1, isDigit_name,      int_bool_signature,  F_R)   \
    do_name(     isDigit_name,                                           "isDigit")                                      \
   do_intrinsic(_isLowerCase,              java_lang_CharacterDataLatin1, isLowerCase_name,  int_bool_signature,  F_R)   \
@@ -423,6 +423,12 @@ void CodeCache::add_heap(ReservedSpace rs, const char* name, int code_blob_type)
                                           heap->name(), size_initial/K));
   }
 
+  // C2 code goes to the non-profiled heap, or to the single heap
+  if (HotCodeRegionSize > 0 &&
+      (code_blob_type == CodeBlobType::MethodNonProfiled || code_blob_type == CodeBlobType::All)) {
+    heap->set_hot_region_size(HotCodeRegionSize);
+  }
+
   // Register the CodeHeap
   MemoryService::add_code_heap_memory_pool(heap, name);
 }
@@ -483,7 +489,7 @@ CodeBlob* CodeCache::next_blob(CodeHeap* heap, CodeBlob* cb) {
  * run the constructor for the CodeBlob subclass he is busy
  * instantiating.
  */
-CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_type) {
+CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_type, bool hot) {
   // Possibly wakes up the sweeper thread.
   NMethodSweeper::report_allocation(code_blob_type);
   assert_locked_or_safepoint(CodeCache_lock);
@@ -498,7 +504,7 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_t
   assert(heap != NULL, "heap is null");
 
   while (true) {
-    cb = (CodeBlob*)heap->allocate(size);
+    cb = (CodeBlob*)heap->allocate(size, hot);
     if (cb != NULL) break;
     if (!heap->expand_by(CodeCacheExpansionSize)) {
       // Save original type for error reporting
@@ -531,7 +537,7 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_t
             tty->print_cr("Extension of %s failed. Trying to allocate in %s.",
                           heap->name(), get_code_heap(type)->name());
           }
-          return allocate(size, type, orig_code_blob_type);
+          return allocate(size, type, orig_code_blob_type, hot);
         }
       }
       MutexUnlocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
@@ -995,6 +1001,8 @@ NOT_PRODUCT(static elapsedTimer dependentCheckTime;)
 int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   int number_of_marked_CodeBlobs = 0;
+  int number_of_contexts = 0;
+  EventDependencyCheck event;
 
   // search the hierarchy looking for nmethods which are affected by the loading of this class
 
@@ -1007,6 +1015,16 @@ int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     Klass* d = str.klass();
     number_of_marked_CodeBlobs += InstanceKlass::cast(d)->mark_dependent_nmethods(changes);
+    number_of_contexts++;
+  }
+
+  if (event.should_commit()) {
+    event.set_loadedClass(changes.new_type());
+    event.set_contexts(number_of_contexts);
+    event.set_nmethodsChecked(changes.nmethods_checked());
+    event.set_dependenciesChecked(changes.dependencies_checked());
+    event.set_marked(number_of_marked_CodeBlobs);
+    event.commit();
   }
 
 #ifndef PRODUCT
@@ -1215,6 +1233,29 @@ void CodeCache::flush_dependents_on_method(const methodHandle& m_h) {
   }
 }
 
+// Flushes compiled methods that may access a field with the given name
+// and signature, directly or through an inlined method.
+void CodeCache::flush_dependents_on_field(Symbol* name, Symbol* signature) {
+  assert_lock_strong(Compile_lock);
+
+  int number_of_marked_CodeBlobs = 0;
+  {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    CompiledMethodIterator iter(CompiledMethodIterator::only_alive_and_not_unloading);
+    while(iter.next()) {
+      CompiledMethod* nm = iter.method();
+      if (nm->may_access_field(name, signature)) {
+        nm->mark_for_deoptimization();
+        number_of_marked_CodeBlobs++;
+      }
+    }
+  }
+
+  if (number_of_marked_CodeBlobs > 0) {
+    Deoptimization::deoptimize_all_marked();
+  }
+}
+
 void CodeCache::verify() {
   assert_locked_or_safepoint(CodeCache_lock);
   FOR_ALL_HEAPS(heap) {
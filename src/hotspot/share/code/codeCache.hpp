@@ -136,7 +136,7 @@ class CodeCache : AllStatic {
   static const GrowableArray<CodeHeap*>* nmethod_heaps() { return _nmethod_heaps; }
 
   // Allocation/administration
-  static CodeBlob* allocate(int size, int code_blob_type, int orig_code_blob_type = CodeBlobType::All); // allocates a new CodeBlob
+  static CodeBlob* allocate(int size, int code_blob_type, int orig_code_blob_type = CodeBlobType::All, bool hot = false); // allocates a new CodeBlob
   static void commit(CodeBlob* cb);                        // called when the allocated CodeBlob has been filled
   static int  alignment_unit();                            // guaranteed alignment of all CodeBlobs
   static int  alignment_offset();                          // guaranteed offset of first CodeBlob byte within alignment unit (i.e., allocation header)
@@ -283,6 +283,7 @@ class CodeCache : AllStatic {
 
   // Support for fullspeed debugging
   static void flush_dependents_on_method(const methodHandle& dependee);
+  static void flush_dependents_on_field(Symbol* name, Symbol* signature);
 
   // tells how many nmethods have dependencies
   static int number_of_nmethods_with_dependencies();
@@ -33,6 +33,7 @@
 #include "gc/shared/barrierSetNMethod.hpp"
 #include "gc/shared/gcBehaviours.hpp"
 #include "interpreter/bytecode.inline.hpp"
+#include "interpreter/bytecodeStream.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
 #include "memory/resourceArea.hpp"
@@ -770,3 +771,43 @@ bool CompiledMethod::has_evol_metadata() {
   }
   return check_evol.has_evol_dependency();
 }
+
+class AccessesField : public MetadataClosure {
+  Symbol* _name;
+  Symbol* _signature;
+  bool _accesses_field;
+ public:
+  AccessesField(Symbol* name, Symbol* signature) :
+    _name(name), _signature(signature), _accesses_field(false) {}
+  void do_metadata(Metadata* md) {
+    if (_accesses_field || !md->is_method()) {
+      return;
+    }
+    Method* method = (Method*)md;
+    if (method->is_native() || method->is_abstract()) {
+      return;
+    }
+    methodHandle mh(Thread::current(), method);
+    BytecodeStream s(mh);
+    Bytecodes::Code c;
+    while ((c = s.next()) >= 0) {
+      if (c == Bytecodes::_getfield || c == Bytecodes::_putfield ||
+          c == Bytecodes::_getstatic || c == Bytecodes::_putstatic) {
+        Bytecode_field field(mh, s.bci());
+        if (field.name() == _name && field.signature() == _signature) {
+          _accesses_field = true;
+          return;
+        }
+      }
+    }
+  }
+  bool accesses_field() const { return _accesses_field; }
+};
+
+bool CompiledMethod::may_access_field(Symbol* name, Symbol* signature) {
+  // The metadata includes the inlined methods, and also methods that are
+  // only called, which can only make the answer more conservative.
+  AccessesField check_field(name, signature);
+  metadata_do(&check_field);
+  return check_field.accesses_field();
+}
@@ -373,6 +373,10 @@ public:
 
   bool has_evol_metadata();
 
+  // Tells if this compiled method, or a method it inlines, has bytecodes
+  // that access a field with the given name and signature.
+  bool may_access_field(Symbol* name, Symbol* signature);
+
   // Fast breakpoint support. Tells if this compiled method is
   // dependent on the given method. Returns true if this nmethod
   // corresponds to the given method as well.
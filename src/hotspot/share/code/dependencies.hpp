@@ -679,7 +679,19 @@ class DependencySignature : public ResourceObj {
 
 // Every particular DepChange is a sub-class of this class.
 class DepChange : public StackObj {
+ private:
+  // statistics: work done while checking this change
+  int _nmethods_checked;
+  int _dependencies_checked;
+
  public:
+  DepChange() : _nmethods_checked(0), _dependencies_checked(0) {}
+
+  void note_nmethod_checked()    { _nmethods_checked++; }
+  void note_dependency_checked() { _dependencies_checked++; }
+  int  nmethods_checked() const     { return _nmethods_checked; }
+  int  dependencies_checked() const { return _dependencies_checked; }
+
   // What kind of DepChange is this?
   virtual bool is_klass_change()     const { return false; }
   virtual bool is_call_site_change() const { return false; }
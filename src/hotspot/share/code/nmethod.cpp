@@ -465,7 +465,7 @@ nmethod* nmethod::new_native_nmethod(const methodHandle& method,
     CodeOffsets offsets;
     offsets.set_value(CodeOffsets::Verified_Entry, vep_offset);
     offsets.set_value(CodeOffsets::Frame_Complete, frame_complete);
-    nm = new (native_nmethod_size, CompLevel_none)
+    nm = new (native_nmethod_size, CompLevel_none, false)
     nmethod(method(), compiler_none, native_nmethod_size,
             compile_id, &offsets,
             code_buffer, frame_size,
@@ -484,6 +484,18 @@ nmethod* nmethod::new_native_nmethod(const methodHandle& method,
   return nm;
 }
 
+// With HotCodeRegionSize, C2 code for a method whose current code has
+// recently been seen active on a stack by the sweeper goes to the hot
+// region of the code heap (see CodeHeap::in_region()).
+static bool is_hot_code(const methodHandle& method, int comp_level) {
+  if (HotCodeRegionSize == 0 || comp_level != CompLevel_full_optimization) {
+    return false;
+  }
+  CompiledMethod* code = method->code();
+  nmethod* nm = (code != NULL) ? code->as_nmethod_or_null() : NULL;
+  return nm != NULL && nm->hotness_counter() > NMethodSweeper::hotness_counter_reset_val() / 2;
+}
+
 nmethod* nmethod::new_nmethod(const methodHandle& method,
   int compile_id,
   int entry_bci,
@@ -526,7 +538,7 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
 #endif
       + align_up(debug_info->data_size()           , oopSize);
 
-    nm = new (nmethod_size, comp_level)
+    nm = new (nmethod_size, comp_level, is_hot_code(method, comp_level))
     nmethod(method(), compiler->type(), nmethod_size, compile_id, entry_bci, offsets,
             orig_pc_offset, debug_info, dependencies, code_buffer, frame_size,
             oop_maps,
@@ -697,8 +709,8 @@ nmethod::nmethod(
   }
 }
 
-void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw () {
-  return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level));
+void* nmethod::operator new(size_t size, int nmethod_size, int comp_level, bool hot) throw () {
+  return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level), CodeBlobType::All, hot);
 }
 
 nmethod::nmethod(
@@ -2224,12 +2236,19 @@ void nmethod::check_all_dependencies(DepChange& changes) {
   }
 }
 
-bool nmethod::check_dependency_on(DepChange& changes) {
+bool nmethod::check_dependency_on(DepChange& changes, Klass* context) {
   // What has happened:
   // 1) a new class dependee has been added
   // 2) dependee and all its super classes have been marked
   bool found_check = false;  // set true if we are upset
+  changes.note_nmethod_checked();
   for (Dependencies::DepStream deps(this); deps.next(); ) {
+    // Klass dependencies are registered with their context type; when
+    // called for one context, leave the others to their own context.
+    if (context != NULL && deps.is_klass_type() && deps.context_type() != context) {
+      continue;
+    }
+    changes.note_dependency_checked();
     // Evaluate only relevant dependencies.
     if (deps.spot_check_dependency_at(changes) != NULL) {
       found_check = true;
@@ -321,7 +321,7 @@ class nmethod : public CompiledMethod {
           );
 
   // helper methods
-  void* operator new(size_t size, int nmethod_size, int comp_level) throw();
+  void* operator new(size_t size, int nmethod_size, int comp_level, bool hot) throw();
 
   const char* reloc_string_for(u_char* begin, u_char* end);
 
@@ -719,7 +719,7 @@ public:
 
   // tells if this compiled method is dependent on the given changes,
   // and the changes have invalidated it
-  bool check_dependency_on(DepChange& changes);
+  bool check_dependency_on(DepChange& changes, Klass* context = NULL);
 
   // Fast breakpoint support. Tells if this compiled method is
   // dependent on the given method. Returns true if this nmethod
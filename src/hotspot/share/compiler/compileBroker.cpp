@@ -312,6 +312,10 @@ bool CompileBroker::can_remove(CompilerThread *ct, bool do_it) {
   // Keep thread alive for at least some time.
   if (ct->idle_time_millis() < (c1 ? 500 : 100)) return false;
 
+  // Keep all started threads during the startup warm-up.
+  if (CompilerThreadWarmupTime > 0 &&
+      os::elapsedTime() * MILLIUNITS < CompilerThreadWarmupTime) return false;
+
 #if INCLUDE_JVMCI
   if (compiler->is_jvmci()) {
     // Handles for JVMCI thread objects may get released concurrently.
@@ -366,6 +370,7 @@ void CompileQueue::add(CompileTask* task) {
     _last = task;
   }
   ++_size;
+  _total_bytes += task->queued_bytes();
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -405,6 +410,7 @@ void CompileQueue::free_all() {
     CompileTask::free(current);
   }
   _first = NULL;
+  _total_bytes = 0;
 
   // Wake up all threads that block on the queue.
   MethodCompileQueue_lock->notify_all();
@@ -515,6 +521,8 @@ void CompileQueue::remove(CompileTask* task) {
     _last = task->prev();
   }
   --_size;
+  assert(_total_bytes >= (size_t)task->queued_bytes(), "queue work underflow");
+  _total_bytes -= task->queued_bytes();
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -960,6 +968,16 @@ void CompileBroker::init_compiler_sweeper_threads() {
   }
 }
 
+// Number of compiler threads warranted by the amount of bytecode waiting in
+// the queue. A few large methods can keep threads busy as long as many
+// small ones, which the task count alone does not show.
+static int queued_work_threads(CompileQueue* queue) {
+  if (CompilerThreadQueuedBytes == 0) {
+    return 0;
+  }
+  return (int)MIN2(queue->total_bytes() / CompilerThreadQueuedBytes, (size_t)max_jint);
+}
+
 void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
 
   julong available_memory = os::available_memory();
@@ -967,15 +985,21 @@ void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
 
+  // The compiler thread counts were sized for the processors available at
+  // startup. Scale them down if a container CPU quota has shrunk since.
+  int active_cpus = os::active_processor_count();
+  int initial_cpus = MAX2(os::initial_active_processor_count(), 1);
+
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
   if (_c2_compile_queue != NULL) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
-        _c2_compile_queue->size() / 2,
+    int new_c2_count = MIN2(MIN4(_c2_count,
+        MAX2(_c2_compile_queue->size() / 2, queued_work_threads(_c2_compile_queue)),
         (int)(available_memory / (200*M)),
-        (int)(available_cc_np / (128*K)));
+        (int)(available_cc_np / (128*K))),
+        MAX2(1, _c2_count * active_cpus / initial_cpus));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1025,10 +1049,11 @@ void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
 
   if (_c1_compile_queue != NULL) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
-        _c1_compile_queue->size() / 4,
+    int new_c1_count = MIN2(MIN4(_c1_count,
+        MAX2(_c1_compile_queue->size() / 4, queued_work_threads(_c1_compile_queue)),
         (int)(available_memory / (100*M)),
-        (int)(available_cc_p / (128*K)));
+        (int)(available_cc_p / (128*K))),
+        MAX2(1, _c1_count * active_cpus / initial_cpus));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2041,6 +2066,9 @@ static void codecache_print(outputStream* out, bool detailed) {
 
 void CompileBroker::post_compile(CompilerThread* thread, CompileTask* task, bool success, ciEnv* ci_env,
                                  int compilable, const char* failure_reason) {
+  if (ci_env != NULL) {
+    task->set_arena_peak(ci_env->arena_peak());
+  }
   if (success) {
     task->mark_success();
     if (ci_env != NULL) {
@@ -2074,7 +2102,9 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->is_success(),
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         (task->code() == NULL) ? 0 : task->code()->total_size(),
-                                        task->num_inlined_bytecodes());
+                                        task->num_inlined_bytecodes(),
+                                        task->arena_peak(),
+                                        Ticks(task->time_started()) - Ticks(task->time_queued()));
 }
 
 int DirectivesStack::_depth = 0;
@@ -2087,6 +2117,7 @@ CompilerDirectives* DirectivesStack::_bottom = NULL;
 // Compile a method.
 //
 void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
+  task->mark_started(os::elapsed_counter());
   task->print_ul();
   if (PrintCompilation) {
     ResourceMark rm;
@@ -2291,7 +2322,11 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     if (task->code() != NULL) {
       tty->print("size: %d(%d) ", task->code()->total_size(), task->code()->insts_size());
     }
-    tty->print_cr("time: %d inlined: %d bytes", (int)time.milliseconds(), task->num_inlined_bytecodes());
+    tty->print("time: %d inlined: %d bytes", (int)time.milliseconds(), task->num_inlined_bytecodes());
+    if (task->arena_peak() != 0) {
+      tty->print(" arena peak: " SIZE_FORMAT "K", task->arena_peak() / K);
+    }
+    tty->cr();
   }
 
   Log(compilation, codecache) log;
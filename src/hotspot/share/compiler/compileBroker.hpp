@@ -88,6 +88,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* _first_stale;
 
   int _size;
+  size_t _total_bytes;  // sum of CompileTask::queued_bytes() over the queue
 
   void purge_stale_tasks();
  public:
@@ -96,6 +97,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _first = NULL;
     _last = NULL;
     _size = 0;
+    _total_bytes = 0;
     _first_stale = NULL;
   }
 
@@ -111,6 +113,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
+  size_t       total_bytes() const               { return _total_bytes;   }
 
 
   // Redefine Classes support
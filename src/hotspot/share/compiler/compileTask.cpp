@@ -103,6 +103,8 @@ void CompileTask::initialize(int compile_id,
   JVMCI_ONLY(_blocking_jvmci_compile_state = NULL;)
   _comp_level = comp_level;
   _num_inlined_bytecodes = 0;
+  _arena_peak = 0;
+  _queued_bytes = method->code_size();
 
   _is_complete = false;
   _is_success = false;
@@ -405,6 +407,9 @@ void CompileTask::log_task_done(CompileLog* log) {
   if (_num_inlined_bytecodes != 0) {
     log->print(" inlined_bytes='%d'", _num_inlined_bytecodes);
   }
+  if (_arena_peak != 0) {
+    log->print(" arena_peak='" SIZE_FORMAT "'", _arena_peak);
+  }
   log->stamp();
   log->end_elem();
   log->clear_identities();   // next task will have different CI
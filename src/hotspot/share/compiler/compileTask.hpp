@@ -88,6 +88,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
 #endif
   int          _comp_level;
   int          _num_inlined_bytecodes;
+  size_t       _arena_peak;
+  int          _queued_bytes; // bytecode size of the method, for queue work estimates
   nmethodLocker* _code_handle;  // holder of eventual result
   CompileTask* _next, *_prev;
   bool         _is_free;
@@ -162,6 +164,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
   void         mark_complete()                   { _is_complete = true; }
   void         mark_success()                    { _is_success = true; }
   void         mark_started(jlong time)          { _time_started = time; }
+  jlong        time_queued() const               { return _time_queued; }
+  jlong        time_started() const              { return _time_started; }
 
   int          comp_level()                      { return _comp_level;}
   void         set_comp_level(int comp_level)    { _comp_level = comp_level;}
@@ -172,6 +176,10 @@ class CompileTask : public CHeapObj<mtCompiler> {
   int          num_inlined_bytecodes() const     { return _num_inlined_bytecodes; }
   void         set_num_inlined_bytecodes(int n)  { _num_inlined_bytecodes = n; }
 
+  size_t       arena_peak() const                { return _arena_peak; }
+  void         set_arena_peak(size_t n)          { _arena_peak = n; }
+  int          queued_bytes() const              { return _queued_bytes; }
+
   CompileTask* next() const                      { return _next; }
   void         set_next(CompileTask* next)       { _next = next; }
   CompileTask* prev() const                      { return _prev; }
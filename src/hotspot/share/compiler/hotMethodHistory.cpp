@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "compiler/compilerDefinitions.hpp"
+#include "compiler/hotMethodHistory.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+// File format, one record per line:
+//
+//   method <holder> <name> <signature> <code size> <invocations> <backedges>
+//
+// The counts are informational.  A method whose code size differs from
+// the recorded one has been changed and is treated as unknown.
+
+class HotMethodKey {
+ public:
+  Symbol* _holder;
+  Symbol* _name;
+  Symbol* _signature;
+
+  HotMethodKey(Symbol* holder, Symbol* name, Symbol* signature) :
+    _holder(holder), _name(name), _signature(signature) {}
+
+  static unsigned hash(const HotMethodKey& k) {
+    return k._holder->identity_hash() ^
+           (31 * k._name->identity_hash()) ^
+           (961 * k._signature->identity_hash());
+  }
+
+  static bool equals(const HotMethodKey& a, const HotMethodKey& b) {
+    return a._holder == b._holder && a._name == b._name && a._signature == b._signature;
+  }
+};
+
+// Maps to the recorded code size.
+typedef ResourceHashtable<HotMethodKey, int,
+                          HotMethodKey::hash, HotMethodKey::equals,
+                          1009, ResourceObj::C_HEAP, mtCompiler> HotMethodTable;
+
+static HotMethodTable* _table = NULL;
+static outputStream* _out = NULL;
+
+bool HotMethodHistory::is_enabled() {
+  return HotMethodHistoryFile != NULL;
+}
+
+void HotMethodHistory::load() {
+  if (!is_enabled()) {
+    return;
+  }
+  fileStream in(HotMethodHistoryFile, "r");
+  if (!in.is_open()) {
+    // No history yet; it is written when this VM exits.
+    return;
+  }
+
+  _table = new (ResourceObj::C_HEAP, mtCompiler) HotMethodTable();
+
+  const int max_name = 1024;
+  char line[3 * max_name + 64];
+  char holder[max_name];
+  char name[max_name];
+  char signature[max_name];
+  int methods = 0;
+
+  while (in.readln(line, sizeof(line)) != NULL) {
+    int code_size;
+    if (sscanf(line, "method %1023s %1023s %1023s %d", holder, name, signature, &code_size) == 4) {
+      HotMethodKey key(SymbolTable::new_symbol(holder),
+                       SymbolTable::new_symbol(name),
+                       SymbolTable::new_symbol(signature));
+      if (_table->put(key, code_size)) {
+        methods++;
+      }
+    }
+  }
+
+  log_info(jit)("Loaded %d hot methods from %s", methods, HotMethodHistoryFile);
+}
+
+static void dump_method(Method* m) {
+  if (m->highest_comp_level() < CompLevel_full_optimization || m->method_holder()->is_hidden()) {
+    return;
+  }
+  ResourceMark rm;
+  _out->print_cr("method %s %s %s %d %d %d", m->klass_name()->as_C_string(),
+                 m->name()->as_C_string(), m->signature()->as_C_string(), m->code_size(),
+                 m->invocation_count(), m->backedge_count());
+}
+
+void HotMethodHistory::dump() {
+  if (!is_enabled()) {
+    return;
+  }
+  fileStream out(HotMethodHistoryFile, "w");
+  if (!out.is_open()) {
+    warning("Cannot open hot method history file %s", HotMethodHistoryFile);
+    return;
+  }
+  _out = &out;
+  SystemDictionary::methods_do(dump_method);
+  _out = NULL;
+}
+
+double HotMethodHistory::threshold_scale(Method* m) {
+  if (_table == NULL) {
+    return 1.0;
+  }
+  HotMethodKey key(m->klass_name(), m->name(), m->signature());
+  int* code_size = _table->get(key);
+  if (code_size == NULL || *code_size != m->code_size()) {
+    return 1.0;
+  }
+  return HotMethodHistoryThresholdScaling;
+}
+
+void hotMethodHistory_init() {
+  HotMethodHistory::load();
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_HOTMETHODHISTORY_HPP
+#define SHARE_COMPILER_HOTMETHODHISTORY_HPP
+
+#include "memory/allocation.hpp"
+
+class Method;
+
+// HotMethodHistory carries the tiered compilation decisions of one run of
+// the VM to the next.  With -XX:HotMethodHistoryFile, the methods that
+// reached C2 are written to the file when the VM exits and read back when
+// it starts.  The tiered policy scales the thresholds of those methods by
+// HotMethodHistoryThresholdScaling, so they are profiled and compiled at
+// tier 4 much sooner instead of going through the full warm-up again.
+
+class HotMethodHistory : AllStatic {
+ public:
+  // Read the history file, if any.  Called once during VM startup.
+  static void load();
+
+  // Write all methods that have been compiled at tier 4 to the history file.
+  static void dump();
+
+  // Threshold scale for a method: HotMethodHistoryThresholdScaling if it
+  // was hot in the recorded run, 1 otherwise.
+  static double threshold_scale(Method* m);
+
+  static bool is_enabled();
+};
+
+#endif // SHARE_COMPILER_HOTMETHODHISTORY_HPP
@@ -524,8 +524,23 @@ int ImmutableOopMap::nr_of_bytes() const {
 }
 #endif
 
-ImmutableOopMapBuilder::ImmutableOopMapBuilder(const OopMapSet* set) : _set(set), _empty(NULL), _last(NULL), _empty_offset(-1), _last_offset(-1), _offset(0), _required(-1), _new_set(NULL) {
+ImmutableOopMapBuilder::ImmutableOopMapBuilder(const OopMapSet* set) : _set(set), _empty(NULL), _empty_offset(-1), _offset(0), _required(-1), _new_set(NULL) {
   _mapping = NEW_RESOURCE_ARRAY(Mapping, _set->size());
+  _distinct = new GrowableArray<int>(_set->size());
+}
+
+// Return the index of an earlier, identical, non-empty map, or -1.
+// Safepoints with the same live oops often recur apart from each other,
+// not only back to back, so all distinct maps seen so far are searched,
+// most recent first.
+int ImmutableOopMapBuilder::find_duplicate(const OopMap* map) const {
+  for (int i = _distinct->length() - 1; i >= 0; i--) {
+    int index = _distinct->at(i);
+    if (_mapping[index]._map->equals(map)) {
+      return index;
+    }
+  }
+  return -1;
 }
 
 int ImmutableOopMapBuilder::size_for(const OopMap* map) const {
@@ -554,15 +569,17 @@ int ImmutableOopMapBuilder::heap_size() {
         size = size_for(map);
         _mapping[i].set(Mapping::OOPMAP_NEW, _offset, size, map);
       }
-    } else if (is_last_duplicate(map)) {
-      /* if this entry is identical to the previous one, just point it there */
-      _mapping[i].set(Mapping::OOPMAP_DUPLICATE, _last_offset, 0, map, _last);
     } else {
-      /* not empty, not an identical copy of the previous entry */
-      size = size_for(map);
-      _mapping[i].set(Mapping::OOPMAP_NEW, _offset, size, map);
-      _last_offset = _offset;
-      _last = map;
+      int dup = find_duplicate(map);
+      if (dup != -1) {
+        /* if this entry is identical to an earlier one, just point it there */
+        _mapping[i].set(Mapping::OOPMAP_DUPLICATE, _mapping[dup]._offset, 0, map, _mapping[dup]._map);
+      } else {
+        /* not empty, not an identical copy of an earlier entry */
+        size = size_for(map);
+        _mapping[i].set(Mapping::OOPMAP_NEW, _offset, size, map);
+        _distinct->append(i);
+      }
     }
 
     assert(_mapping[i]._map == map, "check");
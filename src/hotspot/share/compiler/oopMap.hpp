@@ -340,12 +340,11 @@ private:
 private:
   const OopMapSet* _set;
   const OopMap* _empty;
-  const OopMap* _last;
   int _empty_offset;
-  int _last_offset;
   int _offset;
   int _required;
   Mapping* _mapping;
+  GrowableArray<int>* _distinct; // indices of the non-empty OOPMAP_NEW mappings
   ImmutableOopMapSet* _new_set;
 
   /* Used for bookkeeping when building ImmutableOopMaps */
@@ -381,12 +380,7 @@ private:
     return map->count() == 0;
   }
 
-  bool is_last_duplicate(const OopMap* map) {
-    if (_last != NULL && _last->count() > 0 && _last->equals(map)) {
-      return true;
-    }
-    return false;
-  }
+  int find_duplicate(const OopMap* map) const;
 
 #ifdef ASSERT
   void verify(address buffer, int size, const ImmutableOopMapSet* set);
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/hotMethodHistory.hpp"
 #include "compiler/tieredThresholdPolicy.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/arguments.hpp"
@@ -33,6 +34,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 #include "code/scopeDesc.hpp"
 #include "oops/method.inline.hpp"
 #if INCLUDE_JVMCI
@@ -49,6 +51,7 @@ bool TieredThresholdPolicy::call_predicate_helper(const methodHandle& method, Co
   if (CompilerOracle::has_option_value(method, "CompileThresholdScaling", threshold_scaling)) {
     scale *= threshold_scaling;
   }
+  scale *= HotMethodHistory::threshold_scale(method());
   switch(cur_level) {
   case CompLevel_aot:
     if (CompilationModeFlag::disable_intermediate()) {
@@ -80,6 +83,7 @@ bool TieredThresholdPolicy::loop_predicate_helper(const methodHandle& method, Co
   if (CompilerOracle::has_option_value(method, "CompileThresholdScaling", threshold_scaling)) {
     scale *= threshold_scaling;
   }
+  scale *= HotMethodHistory::threshold_scale(method());
   switch(cur_level) {
   case CompLevel_aot:
     if (CompilationModeFlag::disable_intermediate()) {
@@ -400,6 +404,7 @@ CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_task = NULL;
   Method* max_method = NULL;
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  jlong now = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != NULL;) {
     CompileTask* next_task = task->next();
@@ -418,14 +423,14 @@ CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, method);
-    if (max_task == NULL || compare_methods(method, max_method)) {
+    if (max_task == NULL || compare_tasks(task, max_task, now)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == NULL || compare_tasks(task, max_blocking_task, now)) {
         max_blocking_task = task;
       }
     }
@@ -662,14 +667,28 @@ double TieredThresholdPolicy::weight(Method* method) {
     (method->invocation_count() + 1) * (method->backedge_count() + 1);
 }
 
+// The weight of a task that has been waiting for a while in the queue is
+// raised so that methods with a moderate but steady rate are not starved by
+// a stream of bursty newcomers. 'now' is in elapsed counter ticks.
+double TieredThresholdPolicy::task_weight(CompileTask* task, jlong now) {
+  double w = weight(task->method());
+  if (TieredCompileTaskAging > 0) {
+    double age_ms = TimeHelper::counter_to_millis(now - task->time_queued());
+    w *= 1.0 + age_ms / TieredCompileTaskAging;
+  }
+  return w;
+}
+
 // Apply heuristics and return true if x should be compiled before y
-bool TieredThresholdPolicy::compare_methods(Method* x, Method* y) {
-  if (x->highest_comp_level() > y->highest_comp_level()) {
+bool TieredThresholdPolicy::compare_tasks(CompileTask* x, CompileTask* y, jlong now) {
+  Method* mx = x->method();
+  Method* my = y->method();
+  if (mx->highest_comp_level() > my->highest_comp_level()) {
     // recompilation after deopt
     return true;
   } else
-    if (x->highest_comp_level() == y->highest_comp_level()) {
-      if (weight(x) > weight(y)) {
+    if (mx->highest_comp_level() == my->highest_comp_level()) {
+      if (task_weight(x, now) > task_weight(y, now)) {
         return true;
       }
     }
@@ -199,8 +199,10 @@ class TieredThresholdPolicy : public CompilationPolicy {
   inline bool is_stale(jlong t, jlong timeout, Method* m);
   // Compute the weight of the method for the compilation scheduling
   inline double weight(Method* method);
+  // Weight of a queued task, including its aging bonus (see TieredCompileTaskAging)
+  inline double task_weight(CompileTask* task, jlong now);
   // Apply heuristics and return true if x should be compiled before y
-  inline bool compare_methods(Method* x, Method* y);
+  inline bool compare_tasks(CompileTask* x, CompileTask* y, jlong now);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline void update_rate(jlong t, Method* m);
@@ -27,14 +27,38 @@
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
+#include "gc/epsilon/epsilonVMOperations.hpp"
+#include "aot/aotLoader.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/oopMap.hpp"
 #include "gc/shared/gcArguments.hpp"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/gcLocker.inline.hpp"
+#include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/isGCActiveMark.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "gc/shared/preservedMarks.inline.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/biasedLocking.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vmThread.hpp"
+#include "services/memTracker.hpp"
+#include "services/memoryService.hpp"
+#include "utilities/copy.hpp"
+#include "utilities/stack.inline.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -63,6 +87,20 @@ jint EpsilonHeap::initialize() {
   _last_counter_update = 0;
   _last_heap_print = 0;
 
+  // Reserve the marking bitmap for the sliding GC. It is committed only
+  // for the duration of the collection.
+  _gc_trigger_capacity = max_byte_size;
+  if (EpsilonSlidingGC) {
+    size_t page_size = os::vm_page_size();
+    size_t bitmap_size = align_up(MarkBitMap::compute_size(heap_rs.size()), page_size);
+    ReservedSpace bitmap_rs(bitmap_size, page_size);
+    MemTracker::record_virtual_memory_type(bitmap_rs.base(), mtGC);
+    _bitmap_region = MemRegion((HeapWord*) bitmap_rs.base(), bitmap_rs.size() / HeapWordSize);
+    _bitmap.initialize(MemRegion((HeapWord*) heap_rs.base(), heap_rs.size() / HeapWordSize), _bitmap_region);
+
+    _gc_trigger_capacity = MAX2(align_down(max_byte_size / 100 * EpsilonSlidingGCOccupancy, align), align);
+  }
+
   // Install barrier set
   BarrierSet::set_barrier_set(new EpsilonBarrierSet());
 
@@ -103,7 +141,7 @@ EpsilonHeap* EpsilonHeap::heap() {
   return named_heap<EpsilonHeap>(CollectedHeap::Epsilon);
 }
 
-HeapWord* EpsilonHeap::allocate_work(size_t size) {
+HeapWord* EpsilonHeap::allocate_work(size_t size, size_t expand_limit) {
   assert(is_object_aligned(size), "Allocation size should be aligned: " SIZE_FORMAT, size);
 
   HeapWord* res = _space->par_allocate(size);
@@ -112,7 +150,8 @@ HeapWord* EpsilonHeap::allocate_work(size_t size) {
     // Allocation failed, attempt expansion, and retry:
     MutexLocker ml(Heap_lock);
 
-    size_t space_left = max_capacity() - capacity();
+    size_t limit = MIN2(expand_limit, max_capacity());
+    size_t space_left = (limit > capacity()) ? (limit - capacity()) : 0;
     size_t want_space = MAX2(size, EpsilonMinHeapExpand);
 
     if (want_space < space_left) {
@@ -156,6 +195,27 @@ HeapWord* EpsilonHeap::allocate_work(size_t size) {
   return res;
 }
 
+HeapWord* EpsilonHeap::allocate_or_collect_work(size_t size) {
+  if (!EpsilonSlidingGC) {
+    return allocate_work(size, max_capacity());
+  }
+
+  // Do not expand past the trigger capacity before trying to collect
+  uint gc_count = total_collections();
+  HeapWord* res = allocate_work(size, _gc_trigger_capacity);
+  if (res == NULL && Thread::current()->is_Java_thread() && !SafepointSynchronize::is_at_safepoint()) {
+    VM_EpsilonCollect vmop(gc_count, GCCause::_allocation_failure);
+    VMThread::execute(&vmop);
+    res = allocate_work(size, _gc_trigger_capacity);
+  }
+
+  // Collection did not free enough, expand up to the max heap size
+  if (res == NULL) {
+    res = allocate_work(size, max_capacity());
+  }
+  return res;
+}
+
 HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
                                          size_t requested_size,
                                          size_t* actual_size) {
@@ -222,7 +282,7 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   }
 
   // All prepared, let's do it!
-  HeapWord* res = allocate_work(size);
+  HeapWord* res = allocate_or_collect_work(size);
 
   if (res != NULL) {
     // Allocation successful
@@ -244,9 +304,14 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   return res;
 }
 
+HeapWord* EpsilonHeap::allocate_loaded_archive_space(size_t size) {
+  // Called once at startup, well before any allocation could trigger a GC.
+  return allocate_work(size, max_capacity());
+}
+
 HeapWord* EpsilonHeap::mem_allocate(size_t size, bool *gc_overhead_limit_was_exceeded) {
   *gc_overhead_limit_was_exceeded = false;
-  return allocate_work(size);
+  return allocate_or_collect_work(size);
 }
 
 void EpsilonHeap::collect(GCCause::Cause cause) {
@@ -263,9 +328,254 @@ void EpsilonHeap::collect(GCCause::Cause cause) {
       print_metaspace_info();
       break;
     default:
-      log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
+      if (EpsilonSlidingGC) {
+        if (SafepointSynchronize::is_at_safepoint()) {
+          entry_collect(cause);
+        } else {
+          vmentry_collect(cause);
+        }
+      } else {
+        log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
+      }
+  }
+  _monitoring_support->update_counters();
+}
+
+void EpsilonHeap::vmentry_collect(GCCause::Cause cause) {
+  uint gc_count;
+  {
+    MutexLocker ml(Heap_lock);
+    gc_count = total_collections();
+  }
+  VM_EpsilonCollect vmop(gc_count, cause);
+  VMThread::execute(&vmop);
+}
+
+// Marks the objects reachable from the visited slots, and pushes them
+// on the mark stack for scanning.
+class EpsilonMarkOopClosure : public BasicOopIterateClosure {
+private:
+  MarkBitMap* const _bitmap;
+  Stack<oop, mtGC>* const _stack;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      if (!_bitmap->is_marked(obj)) {
+        _bitmap->mark(obj);
+        _stack->push(obj);
+      }
+    }
+  }
+
+public:
+  EpsilonMarkOopClosure(MarkBitMap* bitmap, Stack<oop, mtGC>* stack) :
+    _bitmap(bitmap), _stack(stack) {}
+
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+// Computes the new location of every marked object, sliding them
+// towards the bottom of the space.
+class EpsilonCalcNewLocationClosure : public ObjectClosure {
+private:
+  HeapWord* _compact_point;
+  PreservedMarks* const _preserved_marks;
+  size_t _moved;
+
+public:
+  EpsilonCalcNewLocationClosure(HeapWord* start, PreservedMarks* pm) :
+    _compact_point(start), _preserved_marks(pm), _moved(0) {}
+
+  void do_object(oop obj) {
+    if ((HeapWord*) obj != _compact_point) {
+      markWord mark = obj->mark();
+      _preserved_marks->push_if_necessary(obj, mark);
+      obj->forward_to(oop(_compact_point));
+      _moved++;
+    }
+    _compact_point += obj->size();
+  }
+
+  HeapWord* compact_point() const { return _compact_point; }
+  size_t moved() const            { return _moved; }
+};
+
+// Updates the visited slots to point to the new object locations.
+class EpsilonAdjustPointersOopClosure : public BasicOopIterateClosure {
+private:
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      if (obj->is_forwarded()) {
+        RawAccess<IS_NOT_NULL>::oop_store(p, obj->forwardee());
+      }
+    }
+  }
+
+public:
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonAdjustPointersObjectClosure : public ObjectClosure {
+private:
+  EpsilonAdjustPointersOopClosure _cl;
+public:
+  void do_object(oop obj) {
+    obj->oop_iterate(&_cl);
+  }
+};
+
+// Copies the forwarded objects to their new locations. Objects are visited
+// in address order, so sliding down never overwrites a live object that
+// has not been moved yet.
+class EpsilonMoveObjectsObjectClosure : public ObjectClosure {
+public:
+  void do_object(oop obj) {
+    if (obj->is_forwarded()) {
+      oop fwd = obj->forwardee();
+      assert(fwd != NULL, "just checking");
+      Copy::aligned_conjoint_words(cast_from_oop<HeapWord*>(obj), cast_from_oop<HeapWord*>(fwd), obj->size());
+      fwd->init_mark();
+    }
+  }
+};
+
+void EpsilonHeap::entry_collect(GCCause::Cause cause) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  assert(EpsilonSlidingGC, "Sliding GC should be enabled");
+
+  if (GCLocker::check_active_before_gc()) {
+    log_info(gc)("GC request for \"%s\" is skipped, GC locker is active", GCCause::to_string(cause));
+    return;
   }
+
+  if (!os::commit_memory((char*) _bitmap_region.start(), _bitmap_region.byte_size(), false)) {
+    log_warning(gc)("Could not commit native memory for marking bitmap, GC failed");
+    return;
+  }
+
+  GCIdMark gc_id_mark;
+  GCTraceTime(Info, gc) time("Pause Full (Sliding)", NULL, cause, true);
+  SvcGCMarker sgcm(SvcGCMarker::FULL);
+  IsGCActiveMark is_active;
+  TraceMemoryManagerStats tmms(&_memory_manager, cause);
+  increment_total_collections(true /* full */);
+
+  size_t used_before = used();
+
+  // Prologue: make the heap parsable, and stash away the locked object marks
+  ensure_parsability(true /* retire_tlabs */);
+  BiasedLocking::preserve_marks();
+  COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::clear());
+
+  // Mark everything reachable from the roots. Weak roots are treated as
+  // strong: there is no reference processing or class unloading here.
+  size_t live = 0;
+  {
+    GCTraceTime(Info, gc, phases) time("Mark", NULL);
+    Stack<oop, mtGC> stack;
+    EpsilonMarkOopClosure cl(&_bitmap, &stack);
+    process_roots(&cl, false /* fix_relocations */);
+    while (!stack.is_empty()) {
+      oop obj = stack.pop();
+      obj->oop_iterate(&cl);
+      live++;
+    }
+  }
+
+  // Derived pointers were recorded while scanning the thread roots above,
+  // do not record them again when adjusting roots.
+  COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::set_active(false));
+
+  PreservedMarks preserved_marks;
+
+  HeapWord* new_top;
+  size_t moved;
+  {
+    GCTraceTime(Info, gc, phases) time("Calculate New Locations", NULL);
+    EpsilonCalcNewLocationClosure cl(_space->bottom(), &preserved_marks);
+    walk_bitmap(&cl);
+    new_top = cl.compact_point();
+    moved = cl.moved();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) time("Adjust Pointers", NULL);
+    EpsilonAdjustPointersObjectClosure cl;
+    walk_bitmap(&cl);
+
+    EpsilonAdjustPointersOopClosure roots_cl;
+    process_roots(&roots_cl, true /* fix_relocations */);
+
+    preserved_marks.adjust_during_full_gc();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) time("Move Objects", NULL);
+    EpsilonMoveObjectsObjectClosure cl;
+    walk_bitmap(&cl);
+  }
+
+  // Epilogue: restore the marks, and release the bitmap
+  _space->set_top(new_top);
+  preserved_marks.restore();
+  COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::update_pointers());
+  BiasedLocking::restore_marks();
+
+  if (!os::uncommit_memory((char*) _bitmap_region.start(), _bitmap_region.byte_size())) {
+    log_warning(gc)("Could not uncommit native memory for marking bitmap");
+  }
+
+  size_t used_after = used();
+  _last_counter_update = used_after;
+  _last_heap_print = used_after;
   _monitoring_support->update_counters();
+
+  log_info(gc)("Marked " SIZE_FORMAT " objects, moved " SIZE_FORMAT " objects, "
+               "heap: " SIZE_FORMAT "%s -> " SIZE_FORMAT "%s",
+               live, moved,
+               byte_size_in_proper_unit(used_before), proper_unit_for_byte_size(used_before),
+               byte_size_in_proper_unit(used_after),  proper_unit_for_byte_size(used_after));
+}
+
+void EpsilonHeap::process_roots(OopClosure* cl, bool fix_relocations) {
+  CLDToOopClosure clds(cl, ClassLoaderData::_claim_none);
+  ClassLoaderDataGraph::cld_do(&clds);
+
+  Threads::oops_do(cl, NULL);
+
+  OopStorageSet::strong_oops_do(cl);
+  WeakProcessor::oops_do(cl);
+
+  CodeBlobToOopClosure blobs(cl, fix_relocations);
+  CodeCache::blobs_do(&blobs);
+
+#if INCLUDE_AOT
+  if (UseAOT) {
+    AOTLoader::oops_do(cl);
+  }
+#endif
+}
+
+void EpsilonHeap::walk_bitmap(ObjectClosure* cl) {
+  HeapWord* limit = _space->top();
+  HeapWord* addr = _bitmap.get_next_marked_addr(_space->bottom(), limit);
+  while (addr < limit) {
+    oop obj = oop(addr);
+    assert(_bitmap.is_marked(obj), "sanity");
+    cl->do_object(obj);
+    addr += 1;
+    if (addr < limit) {
+      addr = _bitmap.get_next_marked_addr(addr, limit);
+    }
+  }
 }
 
 void EpsilonHeap::do_full_collection(bool clear_all_soft_refs) {
@@ -26,6 +26,7 @@
 #define SHARE_GC_EPSILON_EPSILONHEAP_HPP
 
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/markBitMap.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/space.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
@@ -47,6 +48,9 @@ private:
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  size_t _gc_trigger_capacity;
+  MemRegion _bitmap_region;
+  MarkBitMap _bitmap;
 
 public:
   static EpsilonHeap* heap();
@@ -88,7 +92,7 @@ public:
   }
 
   // Allocation
-  HeapWord* allocate_work(size_t size);
+  HeapWord* allocate_work(size_t size, size_t expand_limit);
   virtual HeapWord* mem_allocate(size_t size, bool* gc_overhead_limit_was_exceeded);
   virtual HeapWord* allocate_new_tlab(size_t min_size,
                                       size_t requested_size,
@@ -103,14 +107,23 @@ public:
   virtual void collect(GCCause::Cause cause);
   virtual void do_full_collection(bool clear_all_soft_refs);
 
+  // Sliding mark-compact collection, see EpsilonSlidingGC
+  void vmentry_collect(GCCause::Cause cause);
+  void entry_collect(GCCause::Cause cause);
+
   // Heap walking support
   virtual void object_iterate(ObjectClosure* cl);
 
-  // Object pinning support: every object is implicitly pinned
-  virtual bool supports_object_pinning() const           { return true; }
+  // Object pinning support: every object is implicitly pinned,
+  // unless the sliding GC can move it
+  virtual bool supports_object_pinning() const           { return !EpsilonSlidingGC; }
   virtual oop pin_object(JavaThread* thread, oop obj)    { return obj; }
   virtual void unpin_object(JavaThread* thread, oop obj) { }
 
+  // Archived heap objects can be loaded for the same reason
+  virtual bool can_load_archived_objects() const { return !EpsilonSlidingGC; }
+  virtual HeapWord* allocate_loaded_archive_space(size_t size);
+
   // No support for block parsing.
   HeapWord* block_start(const void* addr) const { return NULL;  }
   bool block_is_obj(const HeapWord* addr) const { return false; }
@@ -136,6 +149,11 @@ public:
   virtual bool print_location(outputStream* st, void* addr) const;
 
 private:
+  HeapWord* allocate_or_collect_work(size_t size);
+
+  void process_roots(OopClosure* cl, bool fix_relocations);
+  void walk_bitmap(ObjectClosure* cl);
+
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
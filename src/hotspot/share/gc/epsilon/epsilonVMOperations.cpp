@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, Red Hat, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -22,15 +22,13 @@
  *
  */
 
-#ifndef SHARE_GC_G1_SPARSEPRT_INLINE_HPP
-#define SHARE_GC_G1_SPARSEPRT_INLINE_HPP
+#include "precompiled.hpp"
+#include "gc/epsilon/epsilonHeap.hpp"
+#include "gc/epsilon/epsilonVMOperations.hpp"
+#include "gc/shared/gcCause.hpp"
 
-#include "gc/g1/g1CollectedHeap.hpp"
-#include "gc/g1/sparsePRT.hpp"
-
-inline bool SparsePRT::contains_card(RegionIdx_t region_id, CardIdx_t card_index) const {
-  return _table->contains_card(region_id, card_index);
+void VM_EpsilonCollect::doit() {
+  EpsilonHeap* heap = EpsilonHeap::heap();
+  GCCauseSetter gccs(heap, _gc_cause);
+  heap->entry_collect(_gc_cause);
 }
-
-
-#endif // SHARE_GC_G1_SPARSEPRT_INLINE_HPP
@@ -86,7 +86,20 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonSlidingGC, false, EXPERIMENTAL,                      \
+          "Reclaim memory with a single-threaded, stop-the-world sliding "  \
+          "mark-compact collection when the heap is about to expand past "  \
+          "EpsilonSlidingGCOccupancy, on allocation failure, and on "       \
+          "explicit GC requests. Allocation paths and barriers are not "    \
+          "affected.")                                                      \
+                                                                            \
+  product(uintx, EpsilonSlidingGCOccupancy, 100, EXPERIMENTAL,              \
+          "With EpsilonSlidingGC, collect before expanding the heap past "  \
+          "this percentage of the maximum heap size. The heap still "       \
+          "expands past it if the collection does not free enough space.") \
+          range(1, 100)
 
 // end of GC_EPSILON_FLAGS
 
@@ -457,28 +457,38 @@ void G1BarrierSetC2::post_barrier(GraphKit* kit,
     // Node* region_size = __ ConI(1 << HeapRegion::LogOfHRGrainBytes);
     Node* xor_res =  __ URShiftX ( __ XorX( cast,  __ CastPX(__ ctrl(), val)), __ ConI(HeapRegion::LogOfHRGrainBytes));
 
+    // Only emit the NULL check if the value is not already known to be
+    // non-NULL, e.g. after an earlier null check or for a new object. The
+    // IdealKit transforms are delayed, so this keeps the check out of the
+    // graph from the start rather than leaving it to IGVN.
+    bool val_maybe_null = !kit->gvn().type(val)->higher_equal(TypePtr::NOTNULL);
+
     // if (xor_res == 0) same region so skip
     __ if_then(xor_res, BoolTest::ne, zeroX, likely); {
 
       // No barrier if we are storing a NULL
-      __ if_then(val, BoolTest::ne, kit->null(), likely); {
+      if (val_maybe_null) {
+        __ if_then(val, BoolTest::ne, kit->null(), likely);
+      }
 
-        // Ok must mark the card if not already dirty
+      // Ok must mark the card if not already dirty
 
-        // load the original value of the card
-        Node* card_val = __ load(__ ctrl(), card_adr, TypeInt::INT, T_BYTE, Compile::AliasIdxRaw);
+      // load the original value of the card
+      Node* card_val = __ load(__ ctrl(), card_adr, TypeInt::INT, T_BYTE, Compile::AliasIdxRaw);
 
-        __ if_then(card_val, BoolTest::ne, young_card, unlikely); {
-          kit->sync_kit(ideal);
-          kit->insert_mem_bar(Op_MemBarVolatile, oop_store);
-          __ sync_kit(kit);
+      __ if_then(card_val, BoolTest::ne, young_card, unlikely); {
+        kit->sync_kit(ideal);
+        kit->insert_mem_bar(Op_MemBarVolatile, oop_store);
+        __ sync_kit(kit);
 
-          Node* card_val_reload = __ load(__ ctrl(), card_adr, TypeInt::INT, T_BYTE, Compile::AliasIdxRaw);
-          __ if_then(card_val_reload, BoolTest::ne, dirty_card); {
-            g1_mark_card(kit, ideal, card_adr, oop_store, alias_idx, index, index_adr, buffer, tf);
-          } __ end_if();
+        Node* card_val_reload = __ load(__ ctrl(), card_adr, TypeInt::INT, T_BYTE, Compile::AliasIdxRaw);
+        __ if_then(card_val_reload, BoolTest::ne, dirty_card); {
+          g1_mark_card(kit, ideal, card_adr, oop_store, alias_idx, index, index_adr, buffer, tf);
         } __ end_if();
       } __ end_if();
+      if (val_maybe_null) {
+        __ end_if();
+      }
     } __ end_if();
   } else {
     // The Object.clone() intrinsic uses this path if !ReduceInitialCardMarks.
@@ -68,14 +68,31 @@ void G1BarrierSet::enqueue(oop pre_val) {
   G1ThreadLocalData::satb_mark_queue(Thread::current()).enqueue(pre_val);
 }
 
+// Enqueue the old values of a reference array range. Large arraycopies
+// during marking would otherwise push every element through enqueue(),
+// only for most of them to be dropped again by the buffer filter. So look
+// up the queue once and apply the filter's checks here, caching the
+// region of the previous element.
 template <class T> void
 G1BarrierSet::write_ref_array_pre_work(T* dst, size_t count) {
   if (!_satb_mark_queue_set.is_active()) return;
+  SATBMarkQueue& queue = G1ThreadLocalData::satb_mark_queue(Thread::current());
+  if (!queue.is_active()) return;
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  HeapRegion* region = NULL;
   T* elem_ptr = dst;
   for (size_t i = 0; i < count; i++, elem_ptr++) {
     T heap_oop = RawAccess<>::oop_load(elem_ptr);
     if (!CompressedOops::is_null(heap_oop)) {
-      enqueue(CompressedOops::decode_not_null(heap_oop));
+      oop obj = CompressedOops::decode_not_null(heap_oop);
+      if (region == NULL || !region->is_in_reserved(obj)) {
+        region = g1h->heap_region_containing(obj);
+      }
+      if (cast_from_oop<HeapWord*>(obj) < region->next_top_at_mark_start() &&
+          !g1h->is_marked_next(obj)) {
+        assert(oopDesc::is_oop(obj, true), "Error");
+        queue.enqueue_known_active(obj);
+      }
     }
   }
 }
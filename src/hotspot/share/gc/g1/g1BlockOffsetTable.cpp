@@ -248,6 +248,29 @@ HeapWord* G1BlockOffsetTablePart::forward_to_block_containing_addr_slow(HeapWord
 //       ( ^    ]
 //         block-start
 //
+void G1BlockOffsetTablePart::update_for_block(HeapWord* blk_start, HeapWord* blk_end) {
+  size_t index = _bot->index_for(blk_start);
+  HeapWord* threshold = _bot->address_for_index_raw(index);
+  if (threshold < blk_start) {
+    index++;
+    threshold += BOTConstants::N_words;
+  }
+  if (blk_end > threshold) {
+    alloc_block_work(&threshold, &index, blk_start, blk_end);
+  }
+}
+
+void G1BlockOffsetTablePart::set_threshold(HeapWord* addr) {
+  size_t index = _bot->index_for_raw(addr);
+  HeapWord* threshold = _bot->address_for_index_raw(index);
+  if (threshold < addr) {
+    index++;
+    threshold += BOTConstants::N_words;
+  }
+  _next_offset_index = index;
+  _next_offset_threshold = threshold;
+}
+
 void G1BlockOffsetTablePart::alloc_block_work(HeapWord** threshold_, size_t* index_,
                                               HeapWord* blk_start, HeapWord* blk_end) {
   // For efficiency, do copy-in/copy-out.
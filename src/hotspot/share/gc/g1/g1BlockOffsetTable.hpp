@@ -223,6 +223,14 @@ public:
     alloc_block(blk, blk+size);
   }
 
+  // Record the block [blk_start, blk_end) independently of the allocation
+  // threshold. Only the entries for the cards starting within the block are
+  // written, so disjoint blocks may be recorded in parallel.
+  void update_for_block(HeapWord* blk_start, HeapWord* blk_end);
+  // Set the allocation threshold to the first card boundary at or above addr,
+  // after all blocks below addr have been recorded with update_for_block().
+  void set_threshold(HeapWord* addr);
+
   void set_for_starts_humongous(HeapWord* obj_top, size_t fill_size);
   void set_object_can_span(bool can_span) NOT_DEBUG_RETURN;
 
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSet.inline.hpp"
+#include "gc/g1/g1CardSetContainers.inline.hpp"
+#include "gc/g1/g1CardSetMemory.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+
+uint G1CardSetConfiguration::_inline_ptr_bits_per_card = 0;
+uint G1CardSetConfiguration::_num_cards_in_inline_ptr = 0;
+uint G1CardSetConfiguration::_num_cards_in_array = 0;
+uint G1CardSetConfiguration::_num_cards_in_bitmap = 0;
+uint G1CardSetConfiguration::_bitmap_coarsen_threshold = 0;
+
+void G1CardSetConfiguration::initialize() {
+  _inline_ptr_bits_per_card = (uint)HeapRegion::LogCardsPerRegion;
+  _num_cards_in_inline_ptr = G1CardSetInlinePtr::max_cards_in_inline_ptr(_inline_ptr_bits_per_card);
+  // The array container must be able to take all cards of a full inline pointer
+  // plus the one that caused the overflow.
+  _num_cards_in_array = MAX2((uint)G1RemSetArrayOfCardsEntries, _num_cards_in_inline_ptr + 1);
+  _num_cards_in_bitmap = (uint)HeapRegion::CardsPerRegion;
+  _bitmap_coarsen_threshold = MAX2(_num_cards_in_bitmap * (uint)G1RemSetCoarsenBitmapToFullPercent / 100, 1u);
+
+  G1CardSetMemoryManager::initialize((uint)array_size_in_bytes(), (uint)bitmap_size_in_bytes());
+
+  log_debug(gc, remset)("Card Set container configuration: "
+                          "InlinePtr #cards %u size " SIZE_FORMAT " "
+                          "ArrayOfCards #cards %u size " SIZE_FORMAT " "
+                          "BitMap #cards %u size " SIZE_FORMAT " coarsen threshold %u",
+                          _num_cards_in_inline_ptr, sizeof(void*),
+                          _num_cards_in_array, array_size_in_bytes(),
+                          _num_cards_in_bitmap, bitmap_size_in_bytes(), _bitmap_coarsen_threshold);
+}
+
+size_t G1CardSetConfiguration::array_size_in_bytes() {
+  return align_up(G1CardSetArray::size_in_bytes(_num_cards_in_array), BytesPerWord);
+}
+
+size_t G1CardSetConfiguration::bitmap_size_in_bytes() {
+  return align_up(G1CardSetBitMap::size_in_bytes(_num_cards_in_bitmap), BytesPerWord);
+}
+
+G1CardSet::CardSetPtr const G1CardSet::FullCardSet = (G1CardSet::CardSetPtr)G1CardSet::CardSetFull;
+
+size_t volatile G1CardSet::_num_coarsenings = 0;
+
+// Initial and maximum (log2) sizes of the card set hash tables, and the
+// average bucket length after which a table should be grown.
+static const size_t InitialLogTableSize = 2;
+static const size_t MaxLogTableSize = 24;
+static const size_t GrowthHint = 4;
+
+class G1CardSetHashTableLookUp : public StackObj {
+  uint _region_idx;
+public:
+  explicit G1CardSetHashTableLookUp(uint region_idx) : _region_idx(region_idx) { }
+
+  uintx get_hash() const { return _region_idx * 0x9E3779B9u; }
+
+  bool equals(G1CardSetHashTableValue* value, bool* is_dead) {
+    *is_dead = false;
+    return value->_region_idx == _region_idx;
+  }
+};
+
+class G1CardSetHashTableFound : public StackObj {
+  G1CardSetHashTableValue* _value;
+public:
+  G1CardSetHashTableFound() : _value(NULL) { }
+
+  void operator()(G1CardSetHashTableValue* value) {
+    _value = value;
+  }
+
+  G1CardSetHashTableValue* value() const { return _value; }
+};
+
+G1CardSet::G1CardSet(Mutex* m) :
+  _m(m),
+  _table(new G1CardSetHashTable(InitialLogTableSize, MaxLogTableSize, GrowthHint)),
+  _mm(),
+  _num_occupied(0),
+  _num_containers(0) {
+}
+
+G1CardSet::~G1CardSet() {
+  delete _table;
+  _mm.flush();
+}
+
+G1CardSetHashTableValue* G1CardSet::get_card_set(uint card_region) {
+  G1CardSetHashTableLookUp lookup(card_region);
+  G1CardSetHashTableFound found;
+  _table->get(Thread::current(), lookup, found);
+  return found.value();
+}
+
+G1CardSetHashTableValue* G1CardSet::get_or_add_card_set(uint card_region) {
+  Thread* const thread = Thread::current();
+  G1CardSetHashTableLookUp lookup(card_region);
+  G1CardSetHashTableFound found;
+  bool should_grow = false;
+
+  while (!_table->get(thread, lookup, found, &should_grow)) {
+    G1CardSetHashTableValue value(card_region, (CardSetPtr)CardSetInlinePtr);
+    if (_table->insert(thread, lookup, value, &should_grow)) {
+      Atomic::inc(&_num_containers, memory_order_relaxed);
+    }
+  }
+  if (should_grow) {
+    _table->grow(thread);
+  }
+  return found.value();
+}
+
+size_t G1CardSet::buckets_per_iteration_part() {
+  size_t log_table_size = _table->get_size_log2(Thread::current());
+  return (size_t)1 << MIN2(log_table_size, LogBucketsPerIterationPart);
+}
+
+uint G1CardSet::num_iteration_parts() {
+  assert_at_safepoint();
+  size_t log_table_size = _table->get_size_log2(Thread::current());
+  return (uint)(((size_t)1 << log_table_size) / buckets_per_iteration_part());
+}
+
+G1CardSet::CardSetPtr G1CardSet::create_array(CardSetPtr inline_ptr, uint card_in_region) {
+  assert(_m->owned_by_self(), "must be");
+  G1CardSetArray* array = ::new (_mm.allocate_array()) G1CardSetArray(card_in_region, G1CardSetConfiguration::num_cards_in_array());
+
+  class AddToArray : public StackObj {
+    G1CardSetArray* _array;
+  public:
+    AddToArray(G1CardSetArray* array) : _array(array) { }
+    void operator()(uint card_idx) {
+      G1AddCardResult res = _array->add(card_idx);
+      assert(res == Added, "Adding card %u from inline pointer must succeed", card_idx);
+    }
+  } cl(array);
+  G1CardSetInlinePtr ptr(inline_ptr);
+  ptr.iterate(cl, G1CardSetConfiguration::inline_ptr_bits_per_card());
+
+  return make_card_set_ptr(array, CardSetArrayOfCards);
+}
+
+G1CardSet::CardSetPtr G1CardSet::create_bitmap(CardSetPtr array_ptr, uint card_in_region) {
+  assert(_m->owned_by_self(), "must be");
+  uint const size_in_bits = G1CardSetConfiguration::num_cards_in_bitmap();
+  G1CardSetBitMap* bitmap = ::new (_mm.allocate_bitmap()) G1CardSetBitMap(card_in_region, size_in_bits);
+
+  class AddToBitMap : public StackObj {
+    G1CardSetBitMap* _bitmap;
+    uint _size_in_bits;
+  public:
+    AddToBitMap(G1CardSetBitMap* bitmap, uint size_in_bits) : _bitmap(bitmap), _size_in_bits(size_in_bits) { }
+    void operator()(uint card_idx) {
+      uint dummy;
+      G1AddCardResult res = _bitmap->add(card_idx, _size_in_bits, &dummy);
+      assert(res == Added, "Adding card %u from array must succeed", card_idx);
+    }
+  } cl(bitmap, size_in_bits);
+  card_set_ptr<G1CardSetArray>(array_ptr)->iterate(cl);
+
+  return make_card_set_ptr(bitmap, CardSetBitMap);
+}
+
+G1AddCardResult G1CardSet::add_to_bitmap(G1CardSetHashTableValue* table_entry, CardSetPtr card_set, uint card_in_region) {
+  G1CardSetBitMap* bitmap = card_set_ptr<G1CardSetBitMap>(card_set);
+  uint num_bits_set;
+  G1AddCardResult result = bitmap->add(card_in_region, G1CardSetConfiguration::num_cards_in_bitmap(), &num_bits_set);
+  if (result != Added) {
+    return result;
+  }
+
+  uint const threshold = G1CardSetConfiguration::bitmap_coarsen_threshold();
+  if (num_bits_set < threshold) {
+    Atomic::inc(&_num_occupied, memory_order_relaxed);
+  } else if (num_bits_set == threshold) {
+    // Exactly one thread reaches the threshold; it replaces the bitmap by the
+    // full marker and accounts for all remaining cards of the region. Cards
+    // added concurrently after reaching the threshold are covered by that.
+    // The bitmap itself is kept until the card set is cleared as other threads
+    // might still be adding to it.
+    Atomic::release_store(&table_entry->_card_set, FullCardSet);
+    Atomic::add(&_num_occupied, (size_t)(G1CardSetConfiguration::num_cards_in_bitmap() - threshold + 1), memory_order_relaxed);
+    Atomic::inc(&_num_coarsenings, memory_order_relaxed);
+  }
+  return Added;
+}
+
+G1AddCardResult G1CardSet::add_card_locked(G1CardSetHashTableValue* table_entry, uint card_in_region) {
+  MutexLocker x(_m, Mutex::_no_safepoint_check_flag);
+
+  while (true) {
+    CardSetPtr card_set = Atomic::load_acquire(&table_entry->_card_set);
+    switch (card_set_type(card_set)) {
+      case CardSetInlinePtr: {
+        G1CardSetInlinePtr ptr(&table_entry->_card_set, card_set);
+        G1AddCardResult result = ptr.add(card_in_region,
+                                         G1CardSetConfiguration::inline_ptr_bits_per_card(),
+                                         G1CardSetConfiguration::num_cards_in_inline_ptr());
+        if (result != Overflow) {
+          if (result == Added) {
+            Atomic::inc(&_num_occupied, memory_order_relaxed);
+          }
+          return result;
+        }
+        CardSetPtr cur = ptr;
+        if (card_set_type(cur) != CardSetInlinePtr) {
+          // Concurrently changed; retry.
+          continue;
+        }
+        // The inline pointer is full, move its cards into an array. Other
+        // threads may still add cards to the inline pointer lock-free, so
+        // only install the array if nothing changed in the meantime.
+        CardSetPtr array = create_array(cur, card_in_region);
+        if (Atomic::cmpxchg(&table_entry->_card_set, cur, array) == cur) {
+          Atomic::inc(&_num_occupied, memory_order_relaxed);
+          return Added;
+        }
+        _mm.free_array(card_set_ptr<G1CardSetArray>(array));
+        break;
+      }
+      case CardSetArrayOfCards: {
+        G1CardSetArray* array = card_set_ptr<G1CardSetArray>(card_set);
+        G1AddCardResult result = array->add(card_in_region);
+        if (result != Overflow) {
+          if (result == Added) {
+            Atomic::inc(&_num_occupied, memory_order_relaxed);
+          }
+          return result;
+        }
+        // Arrays are only modified under the lock, so it is safe to replace
+        // and free it right away.
+        CardSetPtr bitmap = create_bitmap(card_set, card_in_region);
+        Atomic::release_store(&table_entry->_card_set, bitmap);
+        _mm.free_array(array);
+        Atomic::inc(&_num_occupied, memory_order_relaxed);
+        return Added;
+      }
+      case CardSetBitMap: {
+        return add_to_bitmap(table_entry, card_set, card_in_region);
+      }
+      case CardSetFull: {
+        return Found;
+      }
+    }
+  }
+}
+
+G1AddCardResult G1CardSet::add_card(uint card_region, uint card_in_region) {
+  assert(card_in_region < G1CardSetConfiguration::num_cards_in_bitmap(),
+         "Card %u is beyond max %u", card_in_region, G1CardSetConfiguration::num_cards_in_bitmap());
+
+  G1CardSetHashTableValue* table_entry = get_or_add_card_set(card_region);
+  CardSetPtr card_set = Atomic::load_acquire(&table_entry->_card_set);
+
+  switch (card_set_type(card_set)) {
+    case CardSetInlinePtr: {
+      G1CardSetInlinePtr ptr(&table_entry->_card_set, card_set);
+      G1AddCardResult result = ptr.add(card_in_region,
+                                       G1CardSetConfiguration::inline_ptr_bits_per_card(),
+                                       G1CardSetConfiguration::num_cards_in_inline_ptr());
+      if (result == Added) {
+        Atomic::inc(&_num_occupied, memory_order_relaxed);
+      }
+      if (result != Overflow) {
+        return result;
+      }
+      break;
+    }
+    case CardSetBitMap: {
+      return add_to_bitmap(table_entry, card_set, card_in_region);
+    }
+    case CardSetFull: {
+      return Found;
+    }
+    default:
+      break;
+  }
+  return add_card_locked(table_entry, card_in_region);
+}
+
+bool G1CardSet::contains_card(uint card_region, uint card_in_region) {
+  assert(card_in_region < G1CardSetConfiguration::num_cards_in_bitmap(),
+         "Card %u is beyond max %u", card_in_region, G1CardSetConfiguration::num_cards_in_bitmap());
+
+  G1CardSetHashTableValue* table_entry = get_card_set(card_region);
+  if (table_entry == NULL) {
+    return false;
+  }
+
+  CardSetPtr card_set = Atomic::load_acquire(&table_entry->_card_set);
+  switch (card_set_type(card_set)) {
+    case CardSetInlinePtr: {
+      G1CardSetInlinePtr ptr(card_set);
+      return ptr.contains(card_in_region, G1CardSetConfiguration::inline_ptr_bits_per_card());
+    }
+    case CardSetArrayOfCards:
+      return card_set_ptr<G1CardSetArray>(card_set)->contains(card_in_region);
+    case CardSetBitMap:
+      return card_set_ptr<G1CardSetBitMap>(card_set)->contains(card_in_region, G1CardSetConfiguration::num_cards_in_bitmap());
+    case CardSetFull:
+      return true;
+  }
+  ShouldNotReachHere();
+  return false;
+}
+
+void G1CardSet::clear() {
+  _table->unsafe_reset(InitialLogTableSize);
+  _mm.flush();
+  _num_occupied = 0;
+  _num_containers = 0;
+}
+
+size_t G1CardSet::mem_size() const {
+  size_t table_size = ((size_t)1 << _table->get_size_log2(Thread::current())) * sizeof(void*);
+  return sizeof(*this) +
+         sizeof(G1CardSetHashTable) +
+         table_size +
+         num_containers() * _table->get_node_size() +
+         _mm.mem_size();
+}
+
+size_t G1CardSet::wasted_mem_size() const {
+  return _mm.wasted_mem_size();
+}
+
+size_t G1CardSet::free_mem_size() {
+  return G1CardSetMemoryManager::free_pool_mem_size();
+}
+
+size_t G1CardSet::static_mem_size() {
+  return sizeof(FullCardSet) + sizeof(_num_coarsenings);
+}
+
+void G1CardSet::print(outputStream* os) {
+  os->print_cr("Card Set " PTR_FORMAT ": occupied " SIZE_FORMAT " containers " SIZE_FORMAT,
+               p2i(this), occupied(), num_containers());
+  _mm.print(os);
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSET_HPP
+#define SHARE_GC_G1_G1CARDSET_HPP
+
+#include "gc/g1/g1CardSetMemory.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/concurrentHashTable.hpp"
+
+class G1CardSetHashTableConfig;
+class G1CardSetHashTableValue;
+class Mutex;
+class outputStream;
+
+typedef ConcurrentHashTable<G1CardSetHashTableConfig, mtGC> G1CardSetHashTable;
+
+// Result of an attempt to add a card to a card set container.
+enum G1AddCardResult {
+  Overflow,  // The card could not be added because the container is full.
+  Found,     // The card is already in the container.
+  Added      // The card has been added to the container.
+};
+
+// Static sizing information for the card set containers, derived from the
+// heap region size and the G1RemSet* flags during heap initialization.
+class G1CardSetConfiguration : public AllStatic {
+  friend class G1CardSet;
+
+  static uint _inline_ptr_bits_per_card;
+  static uint _num_cards_in_inline_ptr;
+  static uint _num_cards_in_array;
+  static uint _num_cards_in_bitmap;
+  static uint _bitmap_coarsen_threshold;
+
+public:
+  static void initialize();
+
+  // Number of bits needed to encode a card index within a region.
+  static uint inline_ptr_bits_per_card() { return _inline_ptr_bits_per_card; }
+  // Maximum number of cards that fit into an inline pointer container.
+  static uint num_cards_in_inline_ptr() { return _num_cards_in_inline_ptr; }
+  // Maximum number of cards that fit into an array container.
+  static uint num_cards_in_array() { return _num_cards_in_array; }
+  // Number of bits in a bitmap container, i.e. the number of cards per region.
+  static uint num_cards_in_bitmap() { return _num_cards_in_bitmap; }
+  // Number of cards set in a bitmap container after which the container is
+  // considered to cover the whole region.
+  static uint bitmap_coarsen_threshold() { return _bitmap_coarsen_threshold; }
+
+  static size_t array_size_in_bytes();
+  static size_t bitmap_size_in_bytes();
+};
+
+// The card set records, for a single target region, the set of cards in other
+// regions that may contain references into that target region.
+//
+// Cards are grouped by the region they are located in. For every such region
+// the card set keeps a container whose representation adapts to the number
+// of cards recorded from it:
+//
+//  - Inline pointer: up to a few card indices are encoded directly in the bits
+//    of the container pointer itself, without needing any memory.
+//  - Array of cards: a small array of 16 bit card indices.
+//  - Bitmap: one bit per card of the region.
+//  - Full: a marker that the whole region needs to be scanned.
+//
+// The containers are found through a ConcurrentHashTable keyed by region
+// index, so that lookups never need to take a lock. Array and bitmap
+// containers are allocated from a per-card set G1CardSetMemoryManager that
+// releases all memory in bulk when the card set is cleared.
+//
+// Concurrency: additions to inline pointer and bitmap containers and the
+// transition from bitmap to full are lock-free. Additions to array containers
+// and transitions from inline pointer to array and from array to bitmap
+// are done while holding the card set's mutex, which is the mutex of the
+// owning HeapRegionRemSet. Bitmap containers are therefore never freed before
+// the card set is cleared, as concurrent lock-free writers might still access
+// them after they have been replaced by the full marker.
+class G1CardSet : public CHeapObj<mtGC> {
+  friend class G1CardSetTest;
+
+public:
+  // Tagged pointer to a card set container. The lower CardSetPtrHeaderSize
+  // bits contain the container type.
+  typedef void* CardSetPtr;
+
+  static const uintptr_t CardSetInlinePtr     = 0x0;
+  static const uintptr_t CardSetArrayOfCards  = 0x1;
+  static const uintptr_t CardSetBitMap        = 0x2;
+  static const uintptr_t CardSetFull          = 0x3;
+
+  static const uint CardSetPtrHeaderSize = 2;
+  static const uintptr_t CardSetPtrTypeMask = ((uintptr_t)1 << CardSetPtrHeaderSize) - 1;
+
+  static CardSetPtr const FullCardSet;
+
+  static uintptr_t card_set_type(CardSetPtr ptr) { return (uintptr_t)ptr & CardSetPtrTypeMask; }
+
+  template <class T>
+  static T* card_set_ptr(CardSetPtr ptr) {
+    return (T*)((uintptr_t)ptr & ~CardSetPtrTypeMask);
+  }
+
+  static CardSetPtr make_card_set_ptr(void* value, uintptr_t type) {
+    assert(card_set_type(value) == 0, "Given ptr " PTR_FORMAT " already has type bits set", p2i(value));
+    return (CardSetPtr)((uintptr_t)value | type);
+  }
+
+private:
+  Mutex* _m;
+  G1CardSetHashTable* _table;
+  G1CardSetMemoryManager _mm;
+
+  // Total number of cards in this card set. Full containers count with all
+  // cards of their region.
+  size_t volatile _num_occupied;
+  size_t volatile _num_containers;
+
+  static size_t volatile _num_coarsenings;
+
+  // Log2 of the number of hash table buckets in a part of the card set
+  // for parallel iteration.
+  static const size_t LogBucketsPerIterationPart = 6;
+
+  size_t buckets_per_iteration_part();
+
+  // Returns the hash table entry for the given region, adding an empty one if
+  // there is none yet.
+  G1CardSetHashTableValue* get_or_add_card_set(uint card_region);
+  G1CardSetHashTableValue* get_card_set(uint card_region);
+
+  G1AddCardResult add_to_bitmap(G1CardSetHashTableValue* table_entry, CardSetPtr card_set, uint card_in_region);
+  // Slow path: adds the card while holding _m, transitioning the container
+  // to the next larger one if needed.
+  G1AddCardResult add_card_locked(G1CardSetHashTableValue* table_entry, uint card_in_region);
+
+  CardSetPtr create_array(CardSetPtr inline_ptr, uint card_in_region);
+  CardSetPtr create_bitmap(CardSetPtr array_ptr, uint card_in_region);
+
+public:
+  G1CardSet(Mutex* m);
+  ~G1CardSet();
+
+  // Adds the given card to the card set. Returns whether the card has been
+  // newly added.
+  G1AddCardResult add_card(uint card_region, uint card_in_region);
+
+  // Returns whether the given card is contained in the card set. Must be
+  // called at a safepoint or while holding _m.
+  bool contains_card(uint card_region, uint card_in_region);
+
+  // Number of cards in this card set.
+  size_t occupied() const { return Atomic::load(&_num_occupied); }
+  bool is_empty() const { return occupied() == 0; }
+
+  // Number of regions with a card set container.
+  size_t num_containers() const { return Atomic::load(&_num_containers); }
+
+  static size_t num_coarsenings() { return Atomic::load(&_num_coarsenings); }
+
+  // Clears the card set, returning all container memory. Must not be called
+  // concurrently with any other operation on this card set.
+  void clear();
+
+  // Memory used by this card set including its containers.
+  size_t mem_size() const;
+  // Memory used by the card set containers that are unused.
+  size_t wasted_mem_size() const;
+  // Memory held by the global free pools of the card set containers.
+  static size_t free_mem_size();
+  static size_t static_mem_size();
+
+  // Iterates over all cards in the card set, grouped by region. The visitor
+  // must provide the following methods:
+  //
+  //   // Called once per region before visiting its cards. Returns whether
+  //   // the cards of that region should be visited. The container type tag is
+  //   // one of the CardSet* container type constants.
+  //   bool start_iterate(uint container_type, uint region_idx);
+  //   // Visits a single card in the region.
+  //   void operator()(uint card_in_region);
+  //   // Visits a range of length cards starting at card_in_region.
+  //   void operator()(uint card_in_region, uint length);
+  //
+  // Must be called at a safepoint, or while no other thread modifies the
+  // card set.
+  template <class CardOrRangeVisitor>
+  void iterate_cards_or_ranges(CardOrRangeVisitor& found);
+
+  // Number of parts the card set can be split into for parallel iteration
+  // using iterate_cards_or_ranges_in_part(). Must be called at a safepoint.
+  uint num_iteration_parts();
+
+  // Iterates over the cards in the given part of the card set like
+  // iterate_cards_or_ranges(). Multiple threads may iterate over different
+  // parts in parallel. Must be called at a safepoint.
+  template <class CardOrRangeVisitor>
+  void iterate_cards_or_ranges_in_part(CardOrRangeVisitor& found, uint part);
+
+  // Iterates over the cards of a single inline pointer, array or bitmap
+  // container, calling found(uint card_in_region) for every card.
+  template <class CardVisitor>
+  static void iterate_cards_in_container(CardSetPtr card_set, CardVisitor& found);
+
+  void print(outputStream* os);
+};
+
+#endif // SHARE_GC_G1_G1CARDSET_HPP
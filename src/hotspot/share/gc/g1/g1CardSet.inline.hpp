@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSET_INLINE_HPP
+#define SHARE_GC_G1_G1CARDSET_INLINE_HPP
+
+#include "gc/g1/g1CardSet.hpp"
+#include "gc/g1/g1CardSetContainers.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+
+// Entry of the card set hash table: the container for the cards of a single
+// region.
+class G1CardSetHashTableValue {
+public:
+  typedef G1CardSet::CardSetPtr CardSetPtr;
+
+  const uint _region_idx;
+  CardSetPtr volatile _card_set;
+
+  G1CardSetHashTableValue(uint region_idx, CardSetPtr card_set) : _region_idx(region_idx), _card_set(card_set) { }
+};
+
+class G1CardSetHashTableConfig : public StackObj {
+public:
+  typedef G1CardSetHashTableValue Value;
+
+  static uintx get_hash(Value const& value, bool* is_dead) {
+    *is_dead = false;
+    return value._region_idx * 0x9E3779B9u;
+  }
+  static void* allocate_node(size_t size, Value const& value) {
+    return AllocateHeap(size, mtGC);
+  }
+  static void free_node(void* memory, Value const& value) {
+    FreeHeap(memory);
+  }
+};
+
+template <class CardVisitor>
+inline void G1CardSet::iterate_cards_in_container(CardSetPtr const card_set, CardVisitor& found) {
+  switch (card_set_type(card_set)) {
+    case CardSetInlinePtr: {
+      G1CardSetInlinePtr ptr(card_set);
+      ptr.iterate(found, G1CardSetConfiguration::inline_ptr_bits_per_card());
+      return;
+    }
+    case CardSetArrayOfCards : {
+      card_set_ptr<G1CardSetArray>(card_set)->iterate(found);
+      return;
+    }
+    case CardSetBitMap: {
+      card_set_ptr<G1CardSetBitMap>(card_set)->iterate(found, G1CardSetConfiguration::num_cards_in_bitmap());
+      return;
+    }
+    case CardSetFull: {
+      ShouldNotReachHere();
+      return;
+    }
+  }
+  ShouldNotReachHere();
+}
+
+template <class CardOrRangeVisitor>
+class G1CardSetContainersClosure : public StackObj {
+  CardOrRangeVisitor& _cl;
+
+public:
+  G1CardSetContainersClosure(CardOrRangeVisitor& cl) : _cl(cl) { }
+
+  bool operator()(G1CardSetHashTableValue* value) {
+    G1CardSet::CardSetPtr card_set = Atomic::load_acquire(&value->_card_set);
+    uintptr_t type = G1CardSet::card_set_type(card_set);
+    if (!_cl.start_iterate((uint)type, value->_region_idx)) {
+      return true;
+    }
+    if (card_set == G1CardSet::FullCardSet) {
+      _cl(0, G1CardSetConfiguration::num_cards_in_bitmap());
+    } else {
+      G1CardSet::iterate_cards_in_container(card_set, _cl);
+    }
+    return true;
+  }
+};
+
+template <class CardOrRangeVisitor>
+inline void G1CardSet::iterate_cards_or_ranges(CardOrRangeVisitor& found) {
+  G1CardSetContainersClosure<CardOrRangeVisitor> cl(found);
+  if (SafepointSynchronize::is_at_safepoint()) {
+    _table->do_safepoint_scan(cl);
+  } else {
+    _table->do_scan(Thread::current(), cl);
+  }
+}
+
+template <class CardOrRangeVisitor>
+inline void G1CardSet::iterate_cards_or_ranges_in_part(CardOrRangeVisitor& found, uint part) {
+  assert_at_safepoint();
+  G1CardSetContainersClosure<CardOrRangeVisitor> cl(found);
+  size_t part_size = buckets_per_iteration_part();
+  size_t start = part * part_size;
+  _table->do_safepoint_scan(cl, start, start + part_size);
+}
+
+#endif // SHARE_GC_G1_G1CARDSET_INLINE_HPP
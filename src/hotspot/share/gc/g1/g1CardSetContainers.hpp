@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
+#define SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
+
+#include "gc/g1/g1CardSet.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/bitMap.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// A card set container that encodes up to a few card indices directly in the
+// bits of the card set pointer.
+//
+// Layout of the pointer, starting at the least significant bit:
+//
+//   [ type tag (2 bits) | number of cards (3 bits) | card 0 | card 1 | ... ]
+//
+// where every card index takes G1CardSetConfiguration::inline_ptr_bits_per_card()
+// bits. An inline pointer with no cards is the NULL pointer.
+//
+// Cards are added using a CAS on the location the pointer is stored at, so
+// adding cards is lock-free.
+class G1CardSetInlinePtr : public StackObj {
+  typedef G1CardSet::CardSetPtr CardSetPtr;
+
+  CardSetPtr volatile * _value_addr;
+  CardSetPtr _value;
+
+  static const uint SizeFieldLen = 3;
+  static const uint SizeFieldPos = G1CardSet::CardSetPtrHeaderSize;
+  static const uint HeaderSize = G1CardSet::CardSetPtrHeaderSize + SizeFieldLen;
+
+  static const uint BitsInValue = sizeof(CardSetPtr) * BitsPerByte;
+
+  static const uintptr_t SizeFieldMask = (((uint)1 << SizeFieldLen) - 1) << SizeFieldPos;
+
+  static uint card_pos_for(uint const idx, uint const bits_per_card) {
+    return (idx * bits_per_card + HeaderSize);
+  }
+
+  static CardSetPtr merge(CardSetPtr orig_value, uint card_in_region, uint idx, uint bits_per_card);
+
+  static uint card_at(CardSetPtr value, uint const idx, uint const bits_per_card) {
+    uint8_t card_pos = card_pos_for(idx, bits_per_card);
+    uint result = ((uintptr_t)value >> card_pos) & (((uintptr_t)1 << bits_per_card) - 1);
+    return result;
+  }
+
+  bool find(uint const card_idx, uint const bits_per_card, uint start_at, uint num_cards);
+
+public:
+  G1CardSetInlinePtr() : _value_addr(NULL), _value((CardSetPtr)G1CardSet::CardSetInlinePtr) { }
+
+  G1CardSetInlinePtr(CardSetPtr value) : _value_addr(NULL), _value(value) {
+    assert(G1CardSet::card_set_type(_value) == G1CardSet::CardSetInlinePtr, "Value " PTR_FORMAT " is not a valid G1CardSetInlinePtr.", p2i(_value));
+  }
+
+  G1CardSetInlinePtr(CardSetPtr volatile* value_addr, CardSetPtr value) : _value_addr(value_addr), _value(value) {
+    assert(G1CardSet::card_set_type(_value) == G1CardSet::CardSetInlinePtr, "Value " PTR_FORMAT " is not a valid G1CardSetInlinePtr.", p2i(_value));
+  }
+
+  // Tries to add the given card. Returns Overflow if the inline pointer is
+  // full or has been concurrently replaced by another container type.
+  G1AddCardResult add(uint const card_idx, uint const bits_per_card, uint const max_cards_in_inline_ptr);
+
+  bool contains(uint const card_idx, uint const bits_per_card);
+
+  template <class CardVisitor>
+  void iterate(CardVisitor& found, uint const bits_per_card);
+
+  operator CardSetPtr () { return _value; }
+
+  static uint max_cards_in_inline_ptr(uint bits_per_card) {
+    return MIN2((BitsInValue - HeaderSize) / bits_per_card, ((uint)1 << SizeFieldLen) - 1);
+  }
+
+  static uint num_cards_in(CardSetPtr value) {
+    return ((uintptr_t)value & SizeFieldMask) >> SizeFieldPos;
+  }
+};
+
+// A card set container storing card indices in a fixed size array. Must only
+// be modified while holding the card set's lock.
+class G1CardSetArray {
+public:
+  typedef uint16_t EntryDataType;
+  typedef uint EntryCountType;
+
+private:
+  EntryCountType _size;
+  EntryCountType _num_entries;
+  EntryDataType _data[2];
+
+public:
+  G1CardSetArray(uint const card_in_region, EntryCountType num_elems);
+
+  // Adds the given card. Returns Overflow if the array is full.
+  G1AddCardResult add(uint card_idx);
+
+  bool contains(uint card_idx);
+
+  template <class CardVisitor>
+  void iterate(CardVisitor& found);
+
+  EntryCountType num_entries() const { return _num_entries; }
+
+  static size_t size_in_bytes(size_t num_cards) {
+    return offset_of(G1CardSetArray, _data) + num_cards * sizeof(EntryDataType);
+  }
+};
+
+// A card set container storing cards as a bitmap covering the whole region.
+// Cards are added lock-free.
+class G1CardSetBitMap {
+  uint volatile _num_bits_set;
+  BitMap::bm_word_t _bits[1];
+
+public:
+  G1CardSetBitMap(uint const card_in_region, uint const size_in_bits);
+
+  // Adds the given card. On success returns Added and sets num_bits_set to the
+  // number of bits set in the bitmap including the one just added.
+  G1AddCardResult add(uint card_idx, uint size_in_bits, uint* num_bits_set);
+
+  bool contains(uint card_idx, uint size_in_bits) {
+    BitMapView bm(_bits, size_in_bits);
+    return bm.at(card_idx);
+  }
+
+  uint num_bits_set() const { return Atomic::load(&_num_bits_set); }
+
+  template <class CardVisitor>
+  void iterate(CardVisitor& found, size_t const size_in_bits);
+
+  static size_t size_in_bytes(size_t size_in_bits) {
+    return offset_of(G1CardSetBitMap, _bits) + BitMap::calc_size_in_words(size_in_bits) * BytesPerWord;
+  }
+};
+
+#endif // SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSETCONTAINERS_INLINE_HPP
+#define SHARE_GC_G1_G1CARDSETCONTAINERS_INLINE_HPP
+
+#include "gc/g1/g1CardSetContainers.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/bitMap.inline.hpp"
+
+inline G1CardSetInlinePtr::CardSetPtr G1CardSetInlinePtr::merge(CardSetPtr orig_value, uint card_in_region, uint idx, uint bits_per_card) {
+  assert((idx & (SizeFieldMask >> SizeFieldPos)) == idx, "Index %u too large to fit into size field", idx);
+  assert(card_in_region < ((uint)1 << bits_per_card), "Card %u too large to fit into card value field", card_in_region);
+
+  uint card_pos = card_pos_for(idx, bits_per_card);
+  assert(card_pos + bits_per_card <= BitsInValue, "Putting card at pos %u with %u bits would extend beyond pointer", card_pos, bits_per_card);
+
+  // Check that we do not touch any fields we do not own.
+  uintptr_t mask = ((((uintptr_t)1 << bits_per_card) - 1) << card_pos);
+  assert(((uintptr_t)orig_value & mask) == 0, "The bits in the new range should be empty; orig_value " PTR_FORMAT " mask " PTR_FORMAT, p2i(orig_value), mask);
+
+  uintptr_t value = ((uintptr_t)(idx + 1) << SizeFieldPos) | ((uintptr_t)card_in_region << card_pos);
+  uintptr_t res = (((uintptr_t)orig_value & ~SizeFieldMask) | value);
+  return (CardSetPtr)res;
+}
+
+inline G1AddCardResult G1CardSetInlinePtr::add(uint card_idx, uint bits_per_card, uint max_cards_in_inline_ptr) {
+  assert(_value_addr != NULL, "No value address available, cannot add to set.");
+
+  uint cur_idx = 0;
+  while (true) {
+    uint num_cards = num_cards_in(_value);
+    if (num_cards > cur_idx) {
+      if (find(card_idx, bits_per_card, cur_idx, num_cards)) {
+        return Found;
+      }
+      cur_idx = num_cards;
+    }
+    // Check if the card can be added at all.
+    if (num_cards >= max_cards_in_inline_ptr) {
+      return Overflow;
+    }
+    CardSetPtr new_value = merge(_value, card_idx, num_cards, bits_per_card);
+    CardSetPtr old_value = Atomic::cmpxchg(_value_addr, _value, new_value, memory_order_relaxed);
+    if (_value == old_value) {
+      return Added;
+    }
+    // Update values and retry.
+    _value = old_value;
+    // The value of the pointer may have been changed to a different container
+    // type concurrently. Let the caller retry with the new container.
+    if (G1CardSet::card_set_type(_value) != G1CardSet::CardSetInlinePtr) {
+      return Overflow;
+    }
+  }
+}
+
+inline bool G1CardSetInlinePtr::find(uint card_idx, uint bits_per_card, uint start_at, uint num_cards) {
+  assert(start_at < num_cards, "Precondition!");
+
+  uintptr_t const card_mask = (((uintptr_t)1 << bits_per_card) - 1);
+  uintptr_t value = ((uintptr_t)_value) >> card_pos_for(start_at, bits_per_card);
+
+  // Check if the card is already stored in the pointer.
+  for (uint cur_idx = start_at; cur_idx < num_cards; cur_idx++) {
+    if ((value & card_mask) == card_idx) {
+      return true;
+    }
+    value >>= bits_per_card;
+  }
+  return false;
+}
+
+inline bool G1CardSetInlinePtr::contains(uint card_idx, uint bits_per_card) {
+  uint num_cards = num_cards_in(_value);
+  if (num_cards == 0) {
+    return false;
+  }
+  return find(card_idx, bits_per_card, 0, num_cards);
+}
+
+template <class CardVisitor>
+inline void G1CardSetInlinePtr::iterate(CardVisitor& found, uint bits_per_card) {
+  uint const num_cards = num_cards_in(_value);
+  uintptr_t const card_mask = (((uintptr_t)1 << bits_per_card) - 1);
+
+  uintptr_t value = ((uintptr_t)_value) >> card_pos_for(0, bits_per_card);
+  for (uint cur_idx = 0; cur_idx < num_cards; cur_idx++) {
+    found(value & card_mask);
+    value >>= bits_per_card;
+  }
+}
+
+inline G1CardSetArray::G1CardSetArray(uint card_in_region, EntryCountType num_elems) :
+  _size(num_elems),
+  _num_entries(1) {
+  assert(_size > 0, "CardSetArray of size 0 not supported.");
+  assert(_size < ((uint)1 << (sizeof(EntryDataType) * BitsPerByte)), "CardSetArray size %u too large", _size);
+  _data[0] = (EntryDataType)card_in_region;
+}
+
+inline G1AddCardResult G1CardSetArray::add(uint card_idx) {
+  assert(card_idx < ((uint)1 << (sizeof(EntryDataType) * BitsPerByte)),
+         "Card index %u does not fit card element.", card_idx);
+  for (EntryCountType i = 0; i < _num_entries; i++) {
+    if (_data[i] == card_idx) {
+      return Found;
+    }
+  }
+  if (_num_entries == _size) {
+    return Overflow;
+  }
+  _data[_num_entries++] = (EntryDataType)card_idx;
+  return Added;
+}
+
+inline bool G1CardSetArray::contains(uint card_idx) {
+  for (EntryCountType i = 0; i < _num_entries; i++) {
+    if (_data[i] == card_idx) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <class CardVisitor>
+inline void G1CardSetArray::iterate(CardVisitor& found) {
+  for (EntryCountType i = 0; i < _num_entries; i++) {
+    found(_data[i]);
+  }
+}
+
+inline G1CardSetBitMap::G1CardSetBitMap(uint card_in_region, uint size_in_bits) :
+  _num_bits_set(1) {
+  BitMapView bm(_bits, size_in_bits);
+  bm.clear();
+  bm.set_bit(card_in_region);
+}
+
+inline G1AddCardResult G1CardSetBitMap::add(uint card_idx, uint size_in_bits, uint* num_bits_set) {
+  BitMapView bm(_bits, size_in_bits);
+  if (bm.at(card_idx) || !bm.par_set_bit(card_idx, memory_order_relaxed)) {
+    return Found;
+  }
+  *num_bits_set = Atomic::add(&_num_bits_set, 1u, memory_order_relaxed);
+  return Added;
+}
+
+template <class CardVisitor>
+inline void G1CardSetBitMap::iterate(CardVisitor& found, size_t size_in_bits) {
+  BitMapView bm(_bits, size_in_bits);
+  BitMap::idx_t idx = bm.get_next_one_offset(0);
+  while (idx != size_in_bits) {
+    found((uint)idx);
+    idx = bm.get_next_one_offset(idx + 1);
+  }
+}
+
+#endif // SHARE_GC_G1_G1CARDSETCONTAINERS_INLINE_HPP
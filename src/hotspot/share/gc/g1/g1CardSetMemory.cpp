@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSetMemory.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/ostream.hpp"
+
+G1CardSetBuffer::G1CardSetBuffer(uint elem_size, uint num_elems, G1CardSetBuffer* next) :
+  _elem_size(elem_size),
+  _num_elems(num_elems),
+  _next(next),
+  _next_allocate(0) {
+  _buffer = NEW_C_HEAP_ARRAY(char, (size_t)elem_size * num_elems, mtGC);
+}
+
+G1CardSetBuffer::~G1CardSetBuffer() {
+  FREE_C_HEAP_ARRAY(mtGC, _buffer);
+}
+
+G1CardSetFreePool::G1CardSetFreePool(uint elem_size) :
+  _elem_size(elem_size),
+  _first(NULL),
+  _num_buffers(0),
+  _mem_size(0) {
+}
+
+G1CardSetFreePool::~G1CardSetFreePool() {
+  clear();
+}
+
+G1CardSetBuffer* G1CardSetFreePool::get(uint num_elems) {
+  MutexLocker x(G1CardSetFreePool_lock, Mutex::_no_safepoint_check_flag);
+  G1CardSetBuffer* prev = NULL;
+  G1CardSetBuffer* cur = _first;
+  while (cur != NULL) {
+    if (cur->num_elems() >= num_elems) {
+      if (prev == NULL) {
+        _first = cur->next();
+      } else {
+        prev->set_next(cur->next());
+      }
+      _num_buffers--;
+      _mem_size -= cur->mem_size();
+      return cur;
+    }
+    prev = cur;
+    cur = cur->next();
+  }
+  return NULL;
+}
+
+void G1CardSetFreePool::bulk_add(G1CardSetBuffer* first, G1CardSetBuffer* last, size_t num_buffers, size_t mem_size) {
+  assert(first != NULL && last != NULL, "must be");
+  MutexLocker x(G1CardSetFreePool_lock, Mutex::_no_safepoint_check_flag);
+  last->set_next(_first);
+  _first = first;
+  _num_buffers += num_buffers;
+  _mem_size += mem_size;
+}
+
+void G1CardSetFreePool::clear() {
+  MutexLocker x(G1CardSetFreePool_lock, Mutex::_no_safepoint_check_flag);
+  G1CardSetBuffer* cur = _first;
+  while (cur != NULL) {
+    G1CardSetBuffer* next = cur->next();
+    delete cur;
+    cur = next;
+  }
+  _first = NULL;
+  _num_buffers = 0;
+  _mem_size = 0;
+}
+
+G1CardSetAllocator::G1CardSetAllocator(G1CardSetFreePool* free_pool,
+                                       uint initial_buffer_elems,
+                                       uint max_buffer_elems) :
+  _free_pool(free_pool),
+  _initial_buffer_elems(initial_buffer_elems),
+  _max_buffer_elems(max_buffer_elems),
+  _first(NULL),
+  _last(NULL),
+  _free_list(NULL),
+  _num_buffers(0),
+  _num_buffer_elems(0),
+  _num_free_elems(0),
+  _mem_size(0) {
+  assert(initial_buffer_elems > 0 && initial_buffer_elems <= max_buffer_elems,
+         "Invalid buffer sizes %u %u", initial_buffer_elems, max_buffer_elems);
+}
+
+uint G1CardSetAllocator::next_buffer_elems() const {
+  if (_first == NULL) {
+    return _initial_buffer_elems;
+  }
+  return MIN2(_first->num_elems() * 2, _max_buffer_elems);
+}
+
+void* G1CardSetAllocator::allocate() {
+  assert(_free_pool != NULL, "Allocator not initialized");
+  if (_free_list != NULL) {
+    FreeElem* result = _free_list;
+    _free_list = result->_next;
+    _num_free_elems--;
+    return result;
+  }
+
+  void* result = (_first != NULL) ? _first->get_new_buffer_elem() : NULL;
+  if (result == NULL) {
+    uint num_elems = next_buffer_elems();
+    G1CardSetBuffer* buffer = _free_pool->get(num_elems);
+    if (buffer != NULL) {
+      buffer->reset(_first);
+    } else {
+      buffer = new G1CardSetBuffer(elem_size(), num_elems, _first);
+    }
+    if (_first == NULL) {
+      _last = buffer;
+    }
+    _first = buffer;
+    _num_buffers++;
+    _num_buffer_elems += buffer->num_elems();
+    _mem_size += buffer->mem_size();
+    result = buffer->get_new_buffer_elem();
+  }
+  assert(result != NULL, "must be");
+  return result;
+}
+
+void G1CardSetAllocator::free(void* elem) {
+  assert(elem != NULL, "precondition");
+  FreeElem* e = (FreeElem*)elem;
+  e->_next = _free_list;
+  _free_list = e;
+  _num_free_elems++;
+}
+
+void G1CardSetAllocator::drop_all() {
+  if (_first != NULL) {
+    _free_pool->bulk_add(_first, _last, _num_buffers, _mem_size);
+  }
+  _first = NULL;
+  _last = NULL;
+  _free_list = NULL;
+  _num_buffers = 0;
+  _num_buffer_elems = 0;
+  _num_free_elems = 0;
+  _mem_size = 0;
+}
+
+size_t G1CardSetAllocator::wasted_mem_size() const {
+  size_t num_allocated = (_first != NULL) ? (_num_buffer_elems - _first->num_elems() + _first->num_allocated()) : 0;
+  return (_num_buffer_elems - num_allocated + _num_free_elems) * elem_size();
+}
+
+void G1CardSetAllocator::print(outputStream* os) {
+  os->print("MA " PTR_FORMAT ": " SIZE_FORMAT " elems " SIZE_FORMAT " buffers " SIZE_FORMAT " free elems " SIZE_FORMAT "B mem used",
+            p2i(this), _num_buffer_elems, _num_buffers, _num_free_elems, _mem_size);
+}
+
+G1CardSetFreePool* G1CardSetMemoryManager::_array_free_pool = NULL;
+G1CardSetFreePool* G1CardSetMemoryManager::_bitmap_free_pool = NULL;
+
+G1CardSetMemoryManager::G1CardSetMemoryManager() :
+  _array_allocator(_array_free_pool, 2, 256),
+  _bitmap_allocator(_bitmap_free_pool, 1, 16) {
+}
+
+void G1CardSetMemoryManager::initialize(uint array_elem_size, uint bitmap_elem_size) {
+  assert(_array_free_pool == NULL && _bitmap_free_pool == NULL, "Already initialized");
+  _array_free_pool = new G1CardSetFreePool(array_elem_size);
+  _bitmap_free_pool = new G1CardSetFreePool(bitmap_elem_size);
+}
+
+void G1CardSetMemoryManager::flush() {
+  _array_allocator.drop_all();
+  _bitmap_allocator.drop_all();
+}
+
+size_t G1CardSetMemoryManager::mem_size() const {
+  return sizeof(*this) + _array_allocator.mem_size() + _bitmap_allocator.mem_size();
+}
+
+size_t G1CardSetMemoryManager::wasted_mem_size() const {
+  return _array_allocator.wasted_mem_size() + _bitmap_allocator.wasted_mem_size();
+}
+
+size_t G1CardSetMemoryManager::free_pool_mem_size() {
+  if (_array_free_pool == NULL) {
+    return 0;
+  }
+  return _array_free_pool->mem_size() + _bitmap_free_pool->mem_size();
+}
+
+void G1CardSetMemoryManager::print(outputStream* os) {
+  os->print("Array: ");
+  _array_allocator.print(os);
+  os->cr();
+  os->print("BitMap: ");
+  _bitmap_allocator.print(os);
+  os->cr();
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSETMEMORY_HPP
+#define SHARE_GC_G1_G1CARDSETMEMORY_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// A contiguous piece of memory handed out element by element by a
+// G1CardSetAllocator. All elements of a buffer have the same size.
+class G1CardSetBuffer : public CHeapObj<mtGC> {
+  uint _elem_size;
+  uint _num_elems;
+
+  G1CardSetBuffer* _next;
+
+  // Index of the next element to hand out.
+  uint _next_allocate;
+
+  char* _buffer;
+
+public:
+  G1CardSetBuffer(uint elem_size, uint num_elems, G1CardSetBuffer* next);
+  ~G1CardSetBuffer();
+
+  G1CardSetBuffer* next() const { return _next; }
+  void set_next(G1CardSetBuffer* next) { _next = next; }
+
+  void reset(G1CardSetBuffer* next) {
+    _next_allocate = 0;
+    _next = next;
+  }
+
+  uint num_elems() const { return _num_elems; }
+  uint num_allocated() const { return _next_allocate; }
+  bool is_full() const { return _next_allocate == _num_elems; }
+
+  // Returns a new element, or NULL if the buffer is full.
+  void* get_new_buffer_elem() {
+    if (is_full()) {
+      return NULL;
+    }
+    return _buffer + (size_t)_next_allocate++ * _elem_size;
+  }
+
+  size_t mem_size() const { return sizeof(*this) + (size_t)_elem_size * _num_elems; }
+};
+
+// Global pool of free G1CardSetBuffers for a given element size. Card set
+// allocators return all of their buffers to this pool when their card set
+// is cleared, and take buffers from it before allocating new ones.
+class G1CardSetFreePool {
+  const uint _elem_size;
+
+  G1CardSetBuffer* _first;
+  size_t _num_buffers;
+  size_t _mem_size;
+
+public:
+  G1CardSetFreePool(uint elem_size);
+  ~G1CardSetFreePool();
+
+  uint elem_size() const { return _elem_size; }
+
+  // Returns a free buffer with at least num_elems elements, or NULL.
+  G1CardSetBuffer* get(uint num_elems);
+  // Adds the list of buffers from first to last to this pool.
+  void bulk_add(G1CardSetBuffer* first, G1CardSetBuffer* last, size_t num_buffers, size_t mem_size);
+
+  size_t num_buffers() const { return _num_buffers; }
+  size_t mem_size() const { return _mem_size; }
+
+  // Frees all buffers in the pool.
+  void clear();
+};
+
+// Arena style allocator for card set containers of a single size.
+//
+// Elements are carved out of G1CardSetBuffers of exponentially increasing
+// size. Freed elements are kept in a free list for reuse by the same
+// allocator; all memory is returned to the corresponding global free pool
+// when the allocator is dropped.
+//
+// Not thread-safe: callers must make sure that only a single thread uses an
+// allocator at the same time.
+class G1CardSetAllocator {
+  // Free elements are linked together through their first word.
+  struct FreeElem {
+    FreeElem* _next;
+  };
+
+  G1CardSetFreePool* _free_pool;
+
+  const uint _initial_buffer_elems;
+  const uint _max_buffer_elems;
+
+  G1CardSetBuffer* _first;
+  G1CardSetBuffer* _last;
+
+  FreeElem* _free_list;
+
+  size_t _num_buffers;
+  size_t _num_buffer_elems;
+  size_t _num_free_elems;
+  size_t _mem_size;
+
+  uint next_buffer_elems() const;
+
+public:
+  G1CardSetAllocator(G1CardSetFreePool* free_pool, uint initial_buffer_elems, uint max_buffer_elems);
+  ~G1CardSetAllocator() { drop_all(); }
+
+  uint elem_size() const { return _free_pool->elem_size(); }
+
+  void* allocate();
+  void free(void* elem);
+
+  // Returns all buffers to the free pool.
+  void drop_all();
+
+  size_t mem_size() const { return _mem_size; }
+  // Memory of elements that have not been handed out or have been freed again.
+  size_t wasted_mem_size() const;
+
+  void print(outputStream* os);
+};
+
+// Manages the allocators for the different card set container types of a
+// single card set.
+class G1CardSetMemoryManager {
+  G1CardSetAllocator _array_allocator;
+  G1CardSetAllocator _bitmap_allocator;
+
+  static G1CardSetFreePool* _array_free_pool;
+  static G1CardSetFreePool* _bitmap_free_pool;
+
+public:
+  G1CardSetMemoryManager();
+
+  static void initialize(uint array_elem_size, uint bitmap_elem_size);
+
+  void* allocate_array() { return _array_allocator.allocate(); }
+  void free_array(void* value) { _array_allocator.free(value); }
+
+  void* allocate_bitmap() { return _bitmap_allocator.allocate(); }
+  void free_bitmap(void* value) { _bitmap_allocator.free(value); }
+
+  void flush();
+
+  size_t mem_size() const;
+  size_t wasted_mem_size() const;
+
+  static size_t free_pool_mem_size();
+
+  void print(outputStream* os);
+};
+
+#endif // SHARE_GC_G1_G1CARDSETMEMORY_HPP
@@ -35,6 +35,7 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1CollectorState.hpp"
+#include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
 #include "gc/g1/g1ConcurrentMarkThread.inline.hpp"
@@ -267,6 +268,9 @@ G1CollectedHeap::humongous_obj_allocate_initialize_regions(HeapRegion* first_hr,
 
   if (word_fill_size >= min_fill_size()) {
     fill_with_objects(obj_top, word_fill_size);
+    if (_release_humongous_tails) {
+      release_humongous_tail(obj_top, obj_top + word_fill_size);
+    }
   } else if (word_fill_size > 0) {
     // We have space to fill, but we cannot fit an object there.
     words_not_fillable = word_fill_size;
@@ -335,6 +339,27 @@ size_t G1CollectedHeap::humongous_obj_size_in_regions(size_t word_size) {
   return align_up(word_size, HeapRegion::GrainWords) / HeapRegion::GrainWords;
 }
 
+// Give the memory backing the filler objects in [start, end) at the end of
+// the last region of a humongous object back to the operating system.
+void G1CollectedHeap::release_humongous_tail(HeapWord* start, HeapWord* end) {
+  // The filler objects are never read beyond their headers, so their contents
+  // need no backing memory until the region is reused.
+  size_t page_size = os::vm_page_size();
+  HeapWord* cur = start;
+  while (cur < end) {
+    HeapWord* filler_end = cur + oop(cur)->size();
+    char* release_start = align_up((char*)cur + arrayOopDesc::base_offset_in_bytes(T_INT), page_size);
+    char* release_end = align_down((char*)filler_end, page_size);
+    if (release_start < release_end) {
+      os::free_memory(release_start, pointer_delta(release_end, release_start, 1), page_size);
+      log_trace(gc, humongous)("Released humongous tail memory [" PTR_FORMAT ", " PTR_FORMAT ")",
+                               p2i(release_start), p2i(release_end));
+    }
+    cur = filler_end;
+  }
+  assert(cur == end, "Filler objects must cover the tail exactly");
+}
+
 // If could fit into free regions w/o expansion, try.
 // Otherwise, if can expand, do so.
 // Otherwise, if using ex regions might help, try with ex given back.
@@ -810,6 +835,7 @@ void G1CollectedHeap::dealloc_archive_regions(MemRegion* ranges, size_t count) {
   if (uncommitted_regions != 0) {
     log_debug(gc, ergo, heap)("Attempt heap shrinking (uncommitted archive regions). Total size: " SIZE_FORMAT "B",
                               HeapRegion::GrainWords * HeapWordSize * uncommitted_regions);
+    schedule_uncommit();
   }
   decrease_used(size_used);
 }
@@ -1331,11 +1357,27 @@ void G1CollectedHeap::shrink_helper(size_t shrink_bytes) {
                             shrink_bytes, aligned_shrink_bytes, shrunk_bytes);
   if (num_regions_removed > 0) {
     policy()->record_new_heap_size(num_regions());
+    schedule_uncommit();
   } else {
     log_debug(gc, ergo, heap)("Did not expand the heap (heap shrinking operation failed)");
   }
 }
 
+void G1CollectedHeap::schedule_uncommit() {
+  // The service thread picks up any regions removed before it was started.
+  if (_service_thread != NULL && _hrm->has_inactive_regions()) {
+    _service_thread->schedule_uncommit(G1UncommitDelayMillis / 1000.0);
+  }
+}
+
+uint G1CollectedHeap::uncommit_regions(uint limit) {
+  return _hrm->uncommit_inactive_regions(limit);
+}
+
+bool G1CollectedHeap::has_uncommittable_regions() const {
+  return _hrm->has_inactive_regions();
+}
+
 void G1CollectedHeap::shrink(size_t shrink_bytes) {
   _verifier->verify_region_sets_optional();
 
@@ -1430,6 +1472,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _bot(NULL),
   _listener(),
   _numa(G1NUMA::create()),
+  _release_humongous_tails(false),
   _hrm(NULL),
   _allocator(NULL),
   _verifier(NULL),
@@ -1552,7 +1595,7 @@ G1RegionToSpaceMapper* G1CollectedHeap::create_aux_memory_mapper(const char* des
 
 jint G1CollectedHeap::initialize_concurrent_refinement() {
   jint ecode = JNI_OK;
-  _cr = G1ConcurrentRefine::create(&ecode);
+  _cr = G1ConcurrentRefine::create(_policy, &ecode);
   return ecode;
 }
 
@@ -1644,6 +1687,17 @@ jint G1CollectedHeap::initialize() {
                        heap_rs.size());
   heap_storage->set_mapping_changed_listener(&_listener);
 
+  // Releasing memory replaces the mapping, so only do so for anonymous memory
+  // using small pages without any explicit placement.
+  _release_humongous_tails = G1ReleaseHumongousTails &&
+                             page_size == (size_t)os::vm_page_size() &&
+                             !UseTransparentHugePages &&
+                             !AlwaysPreTouch &&
+                             !_numa->is_enabled() &&
+                             !heap_rs.special() &&
+                             AllocateHeapAt == NULL &&
+                             !is_heterogeneous_heap();
+
   // Create storage for the BOT, card table, card counts table (hot card cache) and the bitmaps.
   G1RegionToSpaceMapper* bot_storage =
     create_aux_memory_mapper("Block Offset Table",
@@ -1737,12 +1791,6 @@ jint G1CollectedHeap::initialize() {
     return ecode;
   }
 
-  {
-    G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
-    dcqs.set_process_cards_threshold(concurrent_refine()->yellow_zone());
-    dcqs.set_max_cards(concurrent_refine()->red_zone());
-  }
-
   // Here we allocate the dummy HeapRegion that is required by the
   // G1AllocRegion class.
   HeapRegion* dummy_region = _hrm->get_dummy_region();
@@ -2407,6 +2455,15 @@ void G1CollectedHeap::verify(VerifyOption vo) {
   _verifier->verify(vo);
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 bool G1CollectedHeap::supports_concurrent_gc_breakpoints() const {
   return true;
 }
@@ -2730,7 +2787,7 @@ bool G1CollectedHeap::is_potential_eager_reclaim_candidate(HeapRegion* r) const
   HeapRegionRemSet* rem_set = r->rem_set();
 
   return G1EagerReclaimHumongousObjectsWithStaleRefs ?
-         rem_set->occupancy_less_or_equal_than(G1RSetSparseRegionEntries) :
+         rem_set->occupancy_less_or_equal_than(G1RemSetArrayOfCardsEntries) :
          G1EagerReclaimHumongousObjects && rem_set->is_empty();
 }
 
@@ -2849,6 +2906,7 @@ void G1CollectedHeap::start_new_collection_set() {
 void G1CollectedHeap::calculate_collection_set(G1EvacuationInfo& evacuation_info, double target_pause_time_ms) {
 
   _collection_set.finalize_initial_collection_set(target_pause_time_ms, &_survivor);
+  policy()->record_initial_collection_set_finalized();
   evacuation_info.set_collectionset_regions(collection_set()->region_length() +
                                             collection_set()->optional_region_length());
 
@@ -3122,7 +3180,7 @@ void G1CollectedHeap::do_collection_pause_at_safepoint_helper(double target_paus
 
 void G1CollectedHeap::remove_self_forwarding_pointers(G1RedirtyCardsQueueSet* rdcqs) {
   G1ParRemoveSelfForwardPtrsTask rsfp_task(rdcqs);
-  workers()->run_task(&rsfp_task);
+  rsfp_task.run(workers());
 }
 
 void G1CollectedHeap::restore_after_evac_failure(G1RedirtyCardsQueueSet* rdcqs) {
@@ -3141,6 +3199,10 @@ void G1CollectedHeap::preserve_mark_during_evac_failure(uint worker_id, oop obj,
 
   _evacuation_failed_info_array[worker_id].register_copy_failure(obj->size());
   _preserved_marks_set.get(worker_id)->push_if_necessary(obj, m);
+  // Record the object in the prev bitmap so that removing the self-forwards
+  // can find failed objects without walking the regions. Objects that were
+  // already marked there from the last marking are found anyway.
+  _cm->par_mark_in_prev_bitmap(obj);
 }
 
 bool G1ParEvacuateFollowersClosure::offer_termination() {
@@ -3608,7 +3670,9 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
 
+      // Objects pinned by JNI critical sections must not be reclaimed.
       return obj->is_typeArray() &&
+             !region->has_pinned_objects() &&
              _g1h->is_potential_eager_reclaim_candidate(region);
     }
 
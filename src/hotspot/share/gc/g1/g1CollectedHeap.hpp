@@ -199,6 +199,10 @@ private:
   // Handle G1 NUMA support.
   G1NUMA* _numa;
 
+  // Whether the memory backing the unused tail of the last region of a
+  // humongous object may be released to the operating system.
+  bool _release_humongous_tails;
+
   // The sequence of all heap regions in the heap.
   HeapRegionManager* _hrm;
 
@@ -416,6 +420,10 @@ private:
                                                       uint num_regions,
                                                       size_t word_size);
 
+  // Release the memory backing the contents of the filler objects in
+  // [start, end) to the operating system. The filler headers stay intact.
+  void release_humongous_tail(HeapWord* start, HeapWord* end);
+
   // Attempt to allocate a humongous object of the given size. Return
   // NULL if unsuccessful.
   HeapWord* humongous_obj_allocate(size_t word_size);
@@ -549,6 +557,14 @@ private:
 public:
   G1ServiceThread* service_thread() const { return _service_thread; }
 
+  // Ask the service thread to uncommit the memory of regions removed by
+  // shrinking after G1UncommitDelayMillis.
+  void schedule_uncommit();
+  // Uncommit the memory of at most limit regions removed by shrinking.
+  // Returns the number of regions uncommitted.
+  uint uncommit_regions(uint limit);
+  bool has_uncommittable_regions() const;
+
   WorkGang* workers() const { return _workers; }
 
   // Runs the given AbstractGangTask with the current active workers,
@@ -738,6 +754,7 @@ private:
   // Shrink the garbage-first heap by at most the given size (in bytes!).
   // (Rounds down to a HeapRegion boundary.)
   void shrink(size_t shrink_bytes);
+
   void shrink_helper(size_t expand_bytes);
 
   #if TASKQUEUE_STATS
@@ -1423,6 +1440,12 @@ public:
   // full GC.
   void verify(VerifyOption vo);
 
+  // JNI critical sections pin the regions containing the accessed objects
+  // instead of locking out garbage collection.
+  virtual bool supports_object_pinning() const { return true; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // WhiteBox testing support.
   virtual bool supports_concurrent_gc_breakpoints() const;
   bool is_heterogeneous_heap() const;
@@ -507,6 +507,15 @@ void G1CollectionSet::move_candidates_to_collection_set(uint num_old_candidate_r
     // This potentially optional candidate region is going to be an actual collection
     // set region. Clear cset marker.
     _g1h->clear_region_attr(r);
+    if (r->has_pinned_objects()) {
+      // Objects in regions pinned by JNI critical sections can not be moved, so
+      // leave the region out of the collection set. It will be reconsidered
+      // after the next marking.
+      log_debug(gc, ergo, cset)("Skipping old region %u with %u pinned objects", r->hrm_index(), r->pinned_object_count());
+      r->clear_index_in_opt_cset();
+      _g1h->register_region_with_region_attr(r);
+      continue;
+    }
     add_old_region(r);
   }
   candidates()->remove(num_old_candidate_regions);
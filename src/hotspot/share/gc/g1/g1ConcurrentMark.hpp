@@ -567,6 +567,9 @@ public:
   // Mark in the previous bitmap. Caution: the prev bitmap is usually read-only, so use
   // this carefully.
   inline void mark_in_prev_bitmap(oop p);
+  // Mark the given object in the prev bitmap, returning whether this call
+  // set the mark. May be called concurrently.
+  inline bool par_mark_in_prev_bitmap(oop p);
 
   // Clears marks for all objects in the given range, for the prev or
   // next bitmaps.  Caution: the previous bitmap is usually
@@ -272,6 +272,10 @@ inline void G1ConcurrentMark::mark_in_prev_bitmap(oop p) {
  _prev_mark_bitmap->mark(p);
 }
 
+inline bool G1ConcurrentMark::par_mark_in_prev_bitmap(oop p) {
+  return _prev_mark_bitmap->par_mark(p);
+}
+
 bool G1ConcurrentMark::is_marked_in_prev_bitmap(oop p) const {
   assert(p != NULL && oopDesc::is_oop(p), "expected an oop");
   return _prev_mark_bitmap->is_marked(cast_from_oop<HeapWord*>(p));
@@ -35,7 +35,7 @@
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
-#include "utilities/pair.hpp"
+#include "utilities/ticks.hpp"
 #include <math.h>
 
 G1ConcurrentRefineThread* G1ConcurrentRefineThreadControl::create_refinement_thread(uint worker_id, bool initializing) {
@@ -131,166 +131,60 @@ void G1ConcurrentRefineThreadControl::stop() {
   }
 }
 
-// Arbitrary but large limits, to simplify some of the zone calculations.
+// Arbitrary but large limit, to simplify some of the target calculations.
 // The general idea is to allow expressions like
-//   MIN2(x OP y, max_XXX_zone)
+//   MIN2(x OP y, max_pending_cards_target)
 // without needing to check for overflow in "x OP y", because the
 // ranges for x and y have been restricted.
 STATIC_ASSERT(sizeof(LP64_ONLY(jint) NOT_LP64(jshort)) <= (sizeof(size_t)/2));
-const size_t max_yellow_zone = LP64_ONLY(max_jint) NOT_LP64(max_jshort);
-const size_t max_green_zone = max_yellow_zone / 2;
-const size_t max_red_zone = INT_MAX; // For dcqs.set_max_cards.
-STATIC_ASSERT(max_yellow_zone <= max_red_zone);
-
-// Range check assertions for green zone values.
-#define assert_zone_constraints_g(green)                        \
-  do {                                                          \
-    size_t azc_g_green = (green);                               \
-    assert(azc_g_green <= max_green_zone,                       \
-           "green exceeds max: " SIZE_FORMAT, azc_g_green);     \
-  } while (0)
-
-// Range check assertions for green and yellow zone values.
-#define assert_zone_constraints_gy(green, yellow)                       \
-  do {                                                                  \
-    size_t azc_gy_green = (green);                                      \
-    size_t azc_gy_yellow = (yellow);                                    \
-    assert_zone_constraints_g(azc_gy_green);                            \
-    assert(azc_gy_yellow <= max_yellow_zone,                            \
-           "yellow exceeds max: " SIZE_FORMAT, azc_gy_yellow);          \
-    assert(azc_gy_green <= azc_gy_yellow,                               \
-           "green (" SIZE_FORMAT ") exceeds yellow (" SIZE_FORMAT ")",  \
-           azc_gy_green, azc_gy_yellow);                                \
-  } while (0)
-
-// Range check assertions for green, yellow, and red zone values.
-#define assert_zone_constraints_gyr(green, yellow, red)                 \
-  do {                                                                  \
-    size_t azc_gyr_green = (green);                                     \
-    size_t azc_gyr_yellow = (yellow);                                   \
-    size_t azc_gyr_red = (red);                                         \
-    assert_zone_constraints_gy(azc_gyr_green, azc_gyr_yellow);          \
-    assert(azc_gyr_red <= max_red_zone,                                 \
-           "red exceeds max: " SIZE_FORMAT, azc_gyr_red);               \
-    assert(azc_gyr_yellow <= azc_gyr_red,                               \
-           "yellow (" SIZE_FORMAT ") exceeds red (" SIZE_FORMAT ")",    \
-           azc_gyr_yellow, azc_gyr_red);                                \
-  } while (0)
+const size_t max_pending_cards_target = LP64_ONLY(max_jint) NOT_LP64(max_jshort);
+STATIC_ASSERT(max_pending_cards_target <= INT_MAX); // For dcqs.set_max_cards.
 
 // Logging tag sequence for refinement control updates.
 #define CTRL_TAGS gc, ergo, refine
 
-// For logging zone values, ensuring consistency of level and tags.
-#define LOG_ZONES(...) log_debug( CTRL_TAGS )(__VA_ARGS__)
+// Period between updates of the number of wanted refinement threads by
+// the active primary refinement thread.
+const double adjust_threads_period_ms = 5.0;
 
 static size_t buffers_to_cards(size_t value) {
   return value * G1UpdateBufferSize;
 }
 
-// Package for pair of refinement thread activation and deactivation
-// thresholds.  The activation and deactivation levels are resp. the first
-// and second values of the pair.
-typedef Pair<size_t, size_t> Thresholds;
-inline size_t activation_level(const Thresholds& t) { return t.first; }
-inline size_t deactivation_level(const Thresholds& t) { return t.second; }
-
-static Thresholds calc_thresholds(size_t green_zone,
-                                  size_t yellow_zone,
-                                  uint worker_id) {
-  double yellow_size = yellow_zone - green_zone;
-  double step = yellow_size / G1ConcurrentRefine::max_num_threads();
-  if (worker_id == 0) {
-    // Potentially activate worker 0 more aggressively, to keep
-    // available buffers near green_zone value.  When yellow_size is
-    // large we don't want to allow a full step to accumulate before
-    // doing any processing, as that might lead to significantly more
-    // than green_zone buffers to be processed during pause.  So limit
-    // to an extra half buffer per pause-time processing thread.
-    step = MIN2(step, buffers_to_cards(ParallelGCThreads) / 2.0);
+static size_t calc_init_pending_cards_target() {
+  size_t target = G1ConcRefinementGreenZone;
+  if (FLAG_IS_DEFAULT(G1ConcRefinementGreenZone)) {
+    target = ParallelGCThreads;
   }
-  size_t activate_offset = static_cast<size_t>(ceil(step * (worker_id + 1)));
-  size_t deactivate_offset = static_cast<size_t>(floor(step * worker_id));
-  return Thresholds(green_zone + activate_offset,
-                    green_zone + deactivate_offset);
+  target = buffers_to_cards(target);
+  return MIN2(target, max_pending_cards_target);
 }
 
-G1ConcurrentRefine::G1ConcurrentRefine(size_t green_zone,
-                                       size_t yellow_zone,
-                                       size_t red_zone,
-                                       size_t min_yellow_zone_size) :
-  _thread_control(),
-  _green_zone(green_zone),
-  _yellow_zone(yellow_zone),
-  _red_zone(red_zone),
-  _min_yellow_zone_size(min_yellow_zone_size)
-{
-  assert_zone_constraints_gyr(green_zone, yellow_zone, red_zone);
-}
+G1ConcurrentRefine::G1ConcurrentRefine(G1Policy* policy) :
+  _policy(policy),
+  _threads_wanted(0),
+  _pending_cards_target(calc_init_pending_cards_target()),
+  _last_adjust(),
+  _threads_needed(policy, adjust_threads_period_ms),
+  _thread_control()
+{}
 
 jint G1ConcurrentRefine::initialize() {
-  return _thread_control.initialize(this, max_num_threads());
-}
-
-static size_t calc_min_yellow_zone_size() {
-  size_t step = buffers_to_cards(G1ConcRefinementThresholdStep);
-  uint n_workers = G1ConcurrentRefine::max_num_threads();
-  if ((max_yellow_zone / step) < n_workers) {
-    return max_yellow_zone;
-  } else {
-    return step * n_workers;
+  jint result = _thread_control.initialize(this, max_num_threads());
+  if (result != JNI_OK) {
+    return result;
   }
-}
-
-static size_t calc_init_green_zone() {
-  size_t green = G1ConcRefinementGreenZone;
-  if (FLAG_IS_DEFAULT(G1ConcRefinementGreenZone)) {
-    green = ParallelGCThreads;
-  }
-  green = buffers_to_cards(green);
-  return MIN2(green, max_green_zone);
-}
 
-static size_t calc_init_yellow_zone(size_t green, size_t min_size) {
-  size_t config = buffers_to_cards(G1ConcRefinementYellowZone);
-  size_t size = 0;
-  if (FLAG_IS_DEFAULT(G1ConcRefinementYellowZone)) {
-    size = green * 2;
-  } else if (green < config) {
-    size = config - green;
-  }
-  size = MAX2(size, min_size);
-  size = MIN2(size, max_yellow_zone);
-  return MIN2(green + size, max_yellow_zone);
-}
-
-static size_t calc_init_red_zone(size_t green, size_t yellow) {
-  size_t size = yellow - green;
-  if (!FLAG_IS_DEFAULT(G1ConcRefinementRedZone)) {
-    size_t config = buffers_to_cards(G1ConcRefinementRedZone);
-    if (yellow < config) {
-      size = MAX2(size, config - yellow);
-    }
-  }
-  return MIN2(yellow + size, max_red_zone);
+  G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
+  dcqs.set_process_cards_threshold(primary_activation_threshold());
+  dcqs.set_max_cards(mutator_refinement_threshold());
+  return JNI_OK;
 }
 
-G1ConcurrentRefine* G1ConcurrentRefine::create(jint* ecode) {
-  size_t min_yellow_zone_size = calc_min_yellow_zone_size();
-  size_t green_zone = calc_init_green_zone();
-  size_t yellow_zone = calc_init_yellow_zone(green_zone, min_yellow_zone_size);
-  size_t red_zone = calc_init_red_zone(green_zone, yellow_zone);
-
-  LOG_ZONES("Initial Refinement Zones: "
-            "green: " SIZE_FORMAT ", "
-            "yellow: " SIZE_FORMAT ", "
-            "red: " SIZE_FORMAT ", "
-            "min yellow size: " SIZE_FORMAT,
-            green_zone, yellow_zone, red_zone, min_yellow_zone_size);
-
-  G1ConcurrentRefine* cr = new G1ConcurrentRefine(green_zone,
-                                                  yellow_zone,
-                                                  red_zone,
-                                                  min_yellow_zone_size);
+G1ConcurrentRefine* G1ConcurrentRefine::create(G1Policy* policy, jint* ecode) {
+  G1ConcurrentRefine* cr = new G1ConcurrentRefine(policy);
+  log_debug( CTRL_TAGS )("Initial pending cards target: " SIZE_FORMAT,
+                         cr->pending_cards_target());
   *ecode = cr->initialize();
   return cr;
 }
@@ -310,39 +204,70 @@ uint G1ConcurrentRefine::max_num_threads() {
   return G1ConcRefinementThreads;
 }
 
-static size_t calc_new_green_zone(size_t green,
-                                  double logged_cards_scan_time,
-                                  size_t processed_logged_cards,
-                                  double goal_ms) {
-  // Adjust green zone based on whether we're meeting the time goal.
-  // Limit to max_green_zone.
-  const double inc_k = 1.1, dec_k = 0.9;
-  if (logged_cards_scan_time > goal_ms) {
-    if (green > 0) {
-      green = static_cast<size_t>(green * dec_k);
-    }
-  } else if (logged_cards_scan_time < goal_ms &&
-             processed_logged_cards > green) {
-    green = static_cast<size_t>(MAX2(green * inc_k, green + 1.0));
-    green = MIN2(green, max_green_zone);
+size_t G1ConcurrentRefine::primary_activation_threshold() const {
+  if (max_num_threads() == 0) {
+    // Disable dcqs notification when there are no threads to notify.
+    return G1DirtyCardQueueSet::ProcessCardsThresholdNever;
+  } else if (_threads_wanted > 0) {
+    // Refinement is already wanted; activate on any new buffer.
+    return 0;
+  } else {
+    // Without any refinement, the number of cards at the next GC is
+    // predicted to stay below the target as long as the current number of
+    // cards does not exceed the target less the predicted incoming cards.
+    // Activate the primary when that no longer holds.
+    size_t incoming = _threads_needed.predicted_incoming_cards();
+    return (_pending_cards_target > incoming) ? (_pending_cards_target - incoming) : 0;
+  }
+}
+
+size_t G1ConcurrentRefine::mutator_refinement_threshold() const {
+  if (!FLAG_IS_DEFAULT(G1ConcRefinementRedZone)) {
+    return MIN2(buffers_to_cards(G1ConcRefinementRedZone), max_pending_cards_target);
+  } else if (_threads_needed.threads_needed() > max_num_threads()) {
+    // The dedicated threads alone are predicted to not be able to keep up,
+    // so let the mutator threads help with any cards above the target.
+    return _pending_cards_target;
+  } else {
+    return G1DirtyCardQueueSet::MaxCardsUnlimited;
   }
-  return green;
 }
 
-static size_t calc_new_yellow_zone(size_t green, size_t min_yellow_size) {
-  size_t size = green * 2;
-  size = MAX2(size, min_yellow_size);
-  return MIN2(green + size, max_yellow_zone);
+void G1ConcurrentRefine::update_threads_wanted(Tickspan time_since_last_update) {
+  G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
+  size_t num_cards = dcqs.num_cards();
+
+  _threads_needed.update(_threads_wanted, num_cards, _pending_cards_target);
+  uint new_wanted = MIN2(_threads_needed.threads_needed(), max_num_threads());
+  Atomic::store(&_threads_wanted, new_wanted);
+
+  dcqs.set_process_cards_threshold(primary_activation_threshold());
+  dcqs.set_max_cards(mutator_refinement_threshold());
+
+  log_trace( CTRL_TAGS )("Concurrent refinement: wanted %u, needed %u, "
+                         "cards: " SIZE_FORMAT ", "
+                         "predicted: " SIZE_FORMAT ", "
+                         "target: " SIZE_FORMAT ", "
+                         "time until GC: %1.2fms, "
+                         "time since last update: %1.2fms",
+                         new_wanted, _threads_needed.threads_needed(),
+                         num_cards,
+                         _threads_needed.predicted_cards_at_next_gc(),
+                         _pending_cards_target,
+                         _threads_needed.predicted_time_until_next_gc_ms(),
+                         time_since_last_update.seconds() * MILLIUNITS);
 }
 
-static size_t calc_new_red_zone(size_t green, size_t yellow) {
-  return MIN2(yellow + (yellow - green), max_red_zone);
+void G1ConcurrentRefine::adjust_threads_wanted() {
+  Ticks now = Ticks::now();
+  update_threads_wanted(now - _last_adjust);
+  _last_adjust = now;
 }
 
-void G1ConcurrentRefine::update_zones(double logged_cards_scan_time,
-                                      size_t processed_logged_cards,
-                                      double goal_ms) {
-  log_trace( CTRL_TAGS )("Updating Refinement Zones: "
+void G1ConcurrentRefine::update_pending_cards_target(double logged_cards_scan_time,
+                                                     size_t processed_logged_cards,
+                                                     double goal_ms) {
+  log_trace( CTRL_TAGS )("Updating Pending Cards Target: "
                          "logged cards scan time: %.3fms, "
                          "processed cards: " SIZE_FORMAT ", "
                          "goal time: %.3fms",
@@ -350,45 +275,42 @@ void G1ConcurrentRefine::update_zones(double logged_cards_scan_time,
                          processed_logged_cards,
                          goal_ms);
 
-  _green_zone = calc_new_green_zone(_green_zone,
-                                    logged_cards_scan_time,
-                                    processed_logged_cards,
-                                    goal_ms);
-  _yellow_zone = calc_new_yellow_zone(_green_zone, _min_yellow_zone_size);
-  _red_zone = calc_new_red_zone(_green_zone, _yellow_zone);
-
-  assert_zone_constraints_gyr(_green_zone, _yellow_zone, _red_zone);
-  LOG_ZONES("Updated Refinement Zones: "
-            "green: " SIZE_FORMAT ", "
-            "yellow: " SIZE_FORMAT ", "
-            "red: " SIZE_FORMAT,
-            _green_zone, _yellow_zone, _red_zone);
+  // Don't update the target from an empty or unusably short sample; the
+  // cost per card would be dominated by noise.
+  if ((processed_logged_cards == 0) || (logged_cards_scan_time <= 0.0)) {
+    return;
+  }
+  if (goal_ms <= 0.0) {
+    _pending_cards_target = 0;
+  } else {
+    // The number of cards that can be processed within the goal time,
+    // using the cost per card of the last pause.
+    double rate = processed_logged_cards / logged_cards_scan_time;
+    double target = MIN2(goal_ms * rate, (double)max_pending_cards_target);
+    _pending_cards_target = static_cast<size_t>(target);
+  }
+
+  log_debug( CTRL_TAGS )("Updated pending cards target: " SIZE_FORMAT,
+                         _pending_cards_target);
 }
 
 void G1ConcurrentRefine::adjust(double logged_cards_scan_time,
                                 size_t processed_logged_cards,
                                 double goal_ms) {
+  assert_at_safepoint();
   G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
 
   if (G1UseAdaptiveConcRefinement) {
-    update_zones(logged_cards_scan_time, processed_logged_cards, goal_ms);
-
-    // Change the barrier params
-    if (max_num_threads() == 0) {
-      // Disable dcqs notification when there are no threads to notify.
-      dcqs.set_process_cards_threshold(G1DirtyCardQueueSet::ProcessCardsThresholdNever);
-    } else {
-      // Worker 0 is the primary; wakeup is via dcqs notification.
-      STATIC_ASSERT(max_yellow_zone <= INT_MAX);
-      size_t activate = activation_threshold(0);
-      dcqs.set_process_cards_threshold(activate);
-    }
-    dcqs.set_max_cards(red_zone());
+    update_pending_cards_target(logged_cards_scan_time, processed_logged_cards, goal_ms);
   }
 
+  adjust_threads_wanted();
+
+  // Avoid mutator refinement right after the pause for cards that were
+  // pending at its end.
   size_t curr_queue_size = dcqs.num_cards();
   if ((dcqs.max_cards() > 0) &&
-      (curr_queue_size >= yellow_zone())) {
+      (curr_queue_size >= dcqs.max_cards())) {
     dcqs.set_max_cards_padding(curr_queue_size);
   } else {
     dcqs.set_max_cards_padding(0);
@@ -396,6 +318,17 @@ void G1ConcurrentRefine::adjust(double logged_cards_scan_time,
   dcqs.notify_if_necessary();
 }
 
+void G1ConcurrentRefine::log_pending_cards_at_gc_start(size_t num_cards) const {
+  size_t target = _pending_cards_target;
+  double deviation_percent = (target == 0) ? 0.0 : percent_of(num_cards, target) - 100.0;
+  log_debug( CTRL_TAGS )("Pending cards at GC start: " SIZE_FORMAT ", "
+                         "target: " SIZE_FORMAT ", "
+                         "deviation: " SSIZE_FORMAT " (%1.2f%%)",
+                         num_cards, target,
+                         (ssize_t)num_cards - (ssize_t)target,
+                         deviation_percent);
+}
+
 G1ConcurrentRefineStats G1ConcurrentRefine::get_and_reset_refinement_stats() {
   struct CollectStats : public ThreadClosure {
     G1ConcurrentRefineStats _total_stats;
@@ -410,41 +343,44 @@ G1ConcurrentRefineStats G1ConcurrentRefine::get_and_reset_refinement_stats() {
   return collector._total_stats;
 }
 
-size_t G1ConcurrentRefine::activation_threshold(uint worker_id) const {
-  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, worker_id);
-  return activation_level(thresholds);
-}
-
-size_t G1ConcurrentRefine::deactivation_threshold(uint worker_id) const {
-  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, worker_id);
-  return deactivation_level(thresholds);
-}
-
 uint G1ConcurrentRefine::worker_id_offset() {
   return G1DirtyCardQueueSet::num_par_ids();
 }
 
-void G1ConcurrentRefine::maybe_activate_more_threads(uint worker_id, size_t num_cur_cards) {
-  if (num_cur_cards > activation_threshold(worker_id + 1)) {
+void G1ConcurrentRefine::maybe_activate_more_threads(uint worker_id) {
+  if ((worker_id + 1) < threads_wanted()) {
     _thread_control.maybe_activate_next(worker_id);
   }
 }
 
 bool G1ConcurrentRefine::do_refinement_step(uint worker_id,
                                             G1ConcurrentRefineStats* stats) {
-  G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
+  if (worker_id == 0) {
+    // The primary thread periodically re-evaluates the number of threads
+    // wanted.
+    Tickspan since_last = Ticks::now() - _last_adjust;
+    if (since_last.seconds() * MILLIUNITS >= adjust_threads_period_ms) {
+      adjust_threads_wanted();
+    }
+  }
 
-  size_t curr_cards = dcqs.num_cards();
-  // If the number of the cards falls down into the yellow zone,
-  // that means that the transition period after the evacuation pause has ended.
-  if (curr_cards <= yellow_zone()) {
+  if (worker_id >= threads_wanted()) {
+    // Not wanted any more, deactivate.
+    return false;
+  }
+
+  G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
+  // If the number of the cards falls below the target, the transition
+  // period after the evacuation pause has ended.
+  if (dcqs.num_cards() <= _pending_cards_target) {
     dcqs.discard_max_cards_padding();
   }
 
-  maybe_activate_more_threads(worker_id, curr_cards);
+  maybe_activate_more_threads(worker_id);
 
-  // Process the next buffer, if there are enough left.
+  // Process the next buffer.  Threads keep refining until the control
+  // system finds the target can be met without them.
   return dcqs.refine_completed_buffer_concurrently(worker_id + worker_id_offset(),
-                                                   deactivation_threshold(worker_id),
+                                                   0,
                                                    stats);
 }
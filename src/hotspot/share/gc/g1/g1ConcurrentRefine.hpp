@@ -26,13 +26,16 @@
 #define SHARE_GC_G1_G1CONCURRENTREFINE_HPP
 
 #include "gc/g1/g1ConcurrentRefineStats.hpp"
+#include "gc/g1/g1ConcurrentRefineThreadsNeeded.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ticks.hpp"
 
 // Forward decl
 class G1ConcurrentRefine;
 class G1ConcurrentRefineThread;
+class G1Policy;
 class outputStream;
 class ThreadClosure;
 
@@ -61,50 +64,68 @@ public:
   void stop();
 };
 
-// Controls refinement threads and their activation based on the number of
-// cards currently available in the global dirty card queue.
-// Refinement threads obtain work from the queue (a buffer at a time) based
-// on these thresholds. They are activated gradually based on the amount of
-// work to do.
-// Refinement thread n activates thread n+1 if the instance of this class determines there
-// is enough work available. Threads deactivate themselves if the current amount of
-// available cards falls below their individual threshold.
+// Controls concurrent refinement.
+//
+// Mutator threads produce dirty cards, which need to be examined for updates
+// to the remembered sets (refinement).  There is a pause-time budget for
+// processing these dirty cards (see -XX:G1RSetUpdatingPauseTimePercent).  The
+// purpose of concurrent refinement is to (attempt to) ensure the number of
+// pending dirty cards at the start of a GC can be processed within that time
+// budget.
+//
+// Concurrent refinement is performed by a combination of dedicated threads
+// and by mutator threads as they produce dirty cards.  If configured to not
+// have any dedicated threads (-XX:G1ConcRefinementThreads=0) then all
+// concurrent refinement work is performed by mutator threads.  When there are
+// dedicated threads, they generally do most of the concurrent refinement
+// work, to minimize throughput impact of refinement work on mutator threads.
+//
+// This class determines the target number of dirty cards pending for the next
+// GC.  It also owns the dedicated refinement threads and controls their
+// activation in order to achieve that target.
+//
+// There are two kinds of dedicated refinement threads, a single primary
+// thread and some number of secondary threads.  When active, all refinement
+// threads take buffers of dirty cards from the dirty card queue and process
+// them.  Between buffers they query this owning object to find out whether
+// they should continue running, deactivating themselves if not.
+//
+// The primary thread drives the control system that determines how many
+// refinement threads should be active.  If inactive, it is activated through
+// dirty card queue notification once the number of pending cards reaches a
+// threshold computed by the control system.  Once active, the primary thread
+// periodically recalculates the number of threads wanted, and activates
+// secondary threads as needed.  Threads beyond the wanted number deactivate
+// themselves.
 class G1ConcurrentRefine : public CHeapObj<mtGC> {
+  G1Policy* _policy;
+  volatile uint _threads_wanted;
+  size_t _pending_cards_target;
+  Ticks _last_adjust;
+  G1ConcurrentRefineThreadsNeeded _threads_needed;
   G1ConcurrentRefineThreadControl _thread_control;
-  /*
-   * The value of the completed dirty card queue length falls into one of 3 zones:
-   * green, yellow, red. If the value is in [0, green) nothing is
-   * done, the buffered cards are left unprocessed to enable the caching effect of the
-   * dirtied cards. In the yellow zone [green, yellow) the concurrent refinement
-   * threads are gradually activated. In [yellow, red) all threads are
-   * running. If the length becomes red (max queue length) the mutators start
-   * processing cards too.
-   *
-   * There are some interesting cases (when G1UseAdaptiveConcRefinement
-   * is turned off):
-   * 1) green = yellow = red = 0. In this case the mutator will process all
-   *    cards. Except for those that are created by the deferred updates
-   *    machinery during a collection.
-   * 2) green = 0. Means no caching. Can be a good way to minimize the
-   *    amount of time spent updating remembered sets during a collection.
-   */
-  size_t _green_zone;
-  size_t _yellow_zone;
-  size_t _red_zone;
-  size_t _min_yellow_zone_size;
-
-  G1ConcurrentRefine(size_t green_zone,
-                     size_t yellow_zone,
-                     size_t red_zone,
-                     size_t min_yellow_zone_size);
-
-  // Update green/yellow/red zone values based on how well goals are being met.
-  void update_zones(double logged_cards_scan_time,
-                    size_t processed_logged_cards,
-                    double goal_ms);
+
+  G1ConcurrentRefine(G1Policy* policy);
+
+  // Update the pending cards target based on how well goals are being met.
+  void update_pending_cards_target(double logged_cards_scan_time,
+                                   size_t processed_logged_cards,
+                                   double goal_ms);
+
+  // Recalculate the number of threads wanted and the thresholds derived
+  // from it.
+  void update_threads_wanted(Tickspan time_since_last_update);
+
+  // Threshold for the number of pending cards at which the primary
+  // refinement thread is activated.
+  size_t primary_activation_threshold() const;
+
+  // Threshold for the number of pending cards above which mutator threads
+  // also perform refinement.
+  size_t mutator_refinement_threshold() const;
 
   static uint worker_id_offset();
-  void maybe_activate_more_threads(uint worker_id, size_t num_cur_cards);
+  void maybe_activate_more_threads(uint worker_id);
 
   jint initialize();
 public:
@@ -112,20 +133,32 @@ public:
 
   // Returns a G1ConcurrentRefine instance if succeeded to create/initialize the
   // G1ConcurrentRefine instance. Otherwise, returns NULL with error code.
-  static G1ConcurrentRefine* create(jint* ecode);
+  static G1ConcurrentRefine* create(G1Policy* policy, jint* ecode);
 
   void stop();
 
-  // Adjust refinement thresholds based on work done during the pause and the goal time.
+  // Adjust the pending cards target based on work done during the pause and
+  // the goal time, and recalculate the number of threads wanted.
   void adjust(double logged_cards_scan_time, size_t processed_logged_cards, double goal_ms);
 
   // Return total of concurrent refinement stats for the
   // ConcurrentRefineThreads.  Also reset the stats for the threads.
   G1ConcurrentRefineStats get_and_reset_refinement_stats();
 
-  // Cards in the dirty card queue set.
-  size_t activation_threshold(uint worker_id) const;
-  size_t deactivation_threshold(uint worker_id) const;
+  // Recalculate the number of refinement threads wanted.  Called by the
+  // primary refinement thread when it is activated and periodically while
+  // it is active, or at a safepoint.
+  void adjust_threads_wanted();
+
+  // Number of refinement threads currently wanted by the control system.
+  uint threads_wanted() const { return Atomic::load(&_threads_wanted); }
+
+  // Target number of pending cards at the start of the next GC.
+  size_t pending_cards_target() const { return _pending_cards_target; }
+
+  // Log the difference between the pending cards target and the given
+  // number of pending cards found at the start of a GC.
+  void log_pending_cards_at_gc_start(size_t num_cards) const;
 
   // Perform a single refinement step; called by the refinement
   // threads.  Returns true if there was refinement work available.
@@ -137,11 +170,6 @@ public:
 
   // Maximum number of refinement threads.
   static uint max_num_threads();
-
-  // Cards in the dirty card queue set.
-  size_t green_zone() const      { return _green_zone;  }
-  size_t yellow_zone() const     { return _yellow_zone; }
-  size_t red_zone() const        { return _red_zone;    }
 };
 
 #endif // SHARE_GC_G1_G1CONCURRENTREFINE_HPP
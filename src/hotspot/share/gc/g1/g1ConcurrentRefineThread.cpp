@@ -104,8 +104,8 @@ void G1ConcurrentRefineThread::run_service() {
       break;
     }
 
-    log_debug(gc, refine)("Activated worker %d, on threshold: " SIZE_FORMAT ", current: " SIZE_FORMAT,
-                          _worker_id, _cr->activation_threshold(_worker_id),
+    log_debug(gc, refine)("Activated worker %d, wanted: %u, current: " SIZE_FORMAT,
+                          _worker_id, _cr->threads_wanted(),
                           G1BarrierSet::dirty_card_queue_set().num_cards());
 
     // For logging.
@@ -115,6 +115,13 @@ void G1ConcurrentRefineThread::run_service() {
     {
       SuspendibleThreadSetJoiner sts_join;
 
+      if (_worker_id == 0) {
+        // The primary thread was activated because the number of pending
+        // cards reached the threshold derived from the last update.
+        // Recalculate how many threads are wanted now.
+        _cr->adjust_threads_wanted();
+      }
+
       while (!should_terminate()) {
         if (sts_join.should_yield()) {
           // Accumulate changed stats before possible GC that resets stats.
@@ -131,10 +138,10 @@ void G1ConcurrentRefineThread::run_service() {
     }
 
     total_stats += *_refinement_stats - start_stats;
-    log_debug(gc, refine)("Deactivated worker %d, off threshold: " SIZE_FORMAT
+    log_debug(gc, refine)("Deactivated worker %d, wanted: %u"
                           ", current: " SIZE_FORMAT
                           ", refined cards: " SIZE_FORMAT,
-                          _worker_id, _cr->deactivation_threshold(_worker_id),
+                          _worker_id, _cr->threads_wanted(),
                           G1BarrierSet::dirty_card_queue_set().num_cards(),
                           total_stats.refined_cards());
 
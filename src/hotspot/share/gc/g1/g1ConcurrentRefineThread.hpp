@@ -49,10 +49,10 @@ class G1ConcurrentRefineThread: public ConcurrentGCThread {
   // notification mechanism.  The owning concurrent refinement thread is the
   // single reader. The writers are (other) threads that call activate() on
   // the thread.  The i-th concurrent refinement thread is responsible for
-  // activating thread i+1 if the number of buffers in the queue exceeds a
-  // threshold for that i+1th thread.  The 0th (primary) thread is activated
-  // by threads that add cards to the dirty card queue set when the primary
-  // thread's threshold is exceeded.  activate() is also used to wake up the
+  // activating thread i+1 if the refinement control system wants more than
+  // i+1 threads running.  The 0th (primary) thread is activated by threads
+  // that add cards to the dirty card queue set when the primary thread's
+  // threshold is exceeded.  activate() is also used to wake up the
   // threads during termination, so even the non-primary thread case is
   // multi-writer.
   Semaphore* _notifier;
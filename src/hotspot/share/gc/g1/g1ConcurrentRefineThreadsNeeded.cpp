@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1Analytics.hpp"
+#include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1ConcurrentRefineThreadsNeeded.hpp"
+#include "gc/g1/g1Policy.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include <math.h>
+
+G1ConcurrentRefineThreadsNeeded::G1ConcurrentRefineThreadsNeeded(G1Policy* policy,
+                                                                 double update_period_ms) :
+  _policy(policy),
+  _update_period_ms(update_period_ms),
+  _predicted_time_until_next_gc_ms(0.0),
+  _predicted_cards_at_next_gc(0),
+  _predicted_incoming_cards(0),
+  _threads_needed(0)
+{}
+
+size_t G1ConcurrentRefineThreadsNeeded::available_young_bytes() const {
+  // Racy reads; this is only an estimate.
+  uint target_length = _policy->young_list_target_length();
+  uint used_length = G1CollectedHeap::heap()->young_regions_count();
+  if (target_length <= used_length) {
+    return 0;
+  }
+  return (target_length - used_length) * HeapRegion::GrainBytes;
+}
+
+void G1ConcurrentRefineThreadsNeeded::update_predicted_time_until_next_gc(const G1Analytics* analytics) {
+  // The allocation rate is in regions per ms.
+  double alloc_bytes_rate = analytics->predict_alloc_rate_ms() * HeapRegion::GrainBytes;
+  if (alloc_bytes_rate == 0.0) {
+    // A zero rate indicates there is no data yet to base predictions on.
+    // Without any idea about how long until the next GC, assume it is
+    // imminent.
+    _predicted_time_until_next_gc_ms = 0.0;
+  } else {
+    // A large young generation combined with a low allocation rate can
+    // result in very large predictions, which could cause overflows in the
+    // calculations below.  Limit the prediction to one hour, which is still
+    // very long in this context.
+    const double one_hour_ms = 60.0 * 60.0 * MILLIUNITS;
+    double raw_time_ms = available_young_bytes() / alloc_bytes_rate;
+    _predicted_time_until_next_gc_ms = MIN2(raw_time_ms, one_hour_ms);
+  }
+}
+
+void G1ConcurrentRefineThreadsNeeded::update(uint active_threads,
+                                             size_t num_cards,
+                                             size_t target_num_cards) {
+  const G1Analytics* analytics = _policy->analytics();
+
+  update_predicted_time_until_next_gc(analytics);
+
+  // Estimate the number of cards at the start of the next GC, assuming no
+  // further refinement.
+  double incoming_rate = analytics->predict_dirtied_cards_rate_ms();
+  double raw_incoming = incoming_rate * _predicted_time_until_next_gc_ms;
+  _predicted_incoming_cards = static_cast<size_t>(raw_incoming);
+  _predicted_cards_at_next_gc = num_cards + _predicted_incoming_cards;
+
+  if (_predicted_cards_at_next_gc <= target_num_cards) {
+    // No refinement needed to reach the target.
+    _threads_needed = 0;
+    return;
+  }
+  size_t excess_cards = _predicted_cards_at_next_gc - target_num_cards;
+
+  double refine_rate = analytics->predict_concurrent_refine_rate_ms();
+  if (refine_rate == 0.0) {
+    // No refinement rate data yet.  Add another thread to those already
+    // running, to make progress on the excess and collect data.
+    _threads_needed = active_threads + 1;
+    return;
+  }
+
+  // Spread the work over the time until the next GC, but at least over the
+  // period until the next update.  If the GC is closer than that, this
+  // update is the last chance to make progress anyway.
+  double time_ms = MAX2(_predicted_time_until_next_gc_ms, _update_period_ms);
+  double nthreads = excess_cards / (refine_rate * time_ms);
+  // Limit the value, so converting it is well defined.
+  _threads_needed = static_cast<uint>(MIN2(ceil(nthreads), (double)max_juint));
+}
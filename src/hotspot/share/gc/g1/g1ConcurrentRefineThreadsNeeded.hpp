@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CONCURRENTREFINETHREADSNEEDED_HPP
+#define SHARE_GC_G1_G1CONCURRENTREFINETHREADSNEEDED_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class G1Analytics;
+class G1Policy;
+
+// Used to compute the number of refinement threads that need to be running
+// in order to have the number of pending cards below a target by the time
+// the next GC is predicted to start.  The arrival rate of new cards, the
+// allocation rate and the per-thread refinement rate come from the
+// policy's analytics.
+class G1ConcurrentRefineThreadsNeeded : public CHeapObj<mtGC> {
+  G1Policy* _policy;
+  double _update_period_ms;
+  double _predicted_time_until_next_gc_ms;
+  size_t _predicted_cards_at_next_gc;
+  // Number of cards the mutators are predicted to dirty until the next GC.
+  size_t _predicted_incoming_cards;
+  uint _threads_needed;
+
+  // Bytes that can still be allocated in the young generation before the
+  // next GC, based on the current young target length.
+  size_t available_young_bytes() const;
+
+  void update_predicted_time_until_next_gc(const G1Analytics* analytics);
+
+public:
+  G1ConcurrentRefineThreadsNeeded(G1Policy* policy, double update_period_ms);
+
+  // Update the number of running refinement threads needed to reach the
+  // target before the next GC, given the current number of pending cards.
+  void update(uint active_threads, size_t num_cards, size_t target_num_cards);
+
+  // Estimate of the number of active refinement threads needed to reach
+  // the target before the next GC.
+  uint threads_needed() const { return _threads_needed; }
+
+  // Estimate of the time until the next GC, in milliseconds.
+  double predicted_time_until_next_gc_ms() const {
+    return _predicted_time_until_next_gc_ms;
+  }
+
+  // Estimate of the number of pending cards at the next GC if no further
+  // refinement is performed.
+  size_t predicted_cards_at_next_gc() const {
+    return _predicted_cards_at_next_gc;
+  }
+
+  // Estimate of the number of cards that will be added until the next GC.
+  size_t predicted_incoming_cards() const {
+    return _predicted_incoming_cards;
+  }
+};
+
+#endif // SHARE_GC_G1_G1CONCURRENTREFINETHREADSNEEDED_HPP
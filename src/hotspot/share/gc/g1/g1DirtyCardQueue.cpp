@@ -686,17 +686,17 @@ void G1DirtyCardQueueSet::record_detached_refinement_stats(G1ConcurrentRefineSta
 }
 
 size_t G1DirtyCardQueueSet::max_cards() const {
-  return _max_cards;
+  return Atomic::load(&_max_cards);
 }
 
 void G1DirtyCardQueueSet::set_max_cards(size_t value) {
-  _max_cards = value;
+  Atomic::store(&_max_cards, value);
   Atomic::store(&_padded_max_cards, value);
 }
 
 void G1DirtyCardQueueSet::set_max_cards_padding(size_t padding) {
   // Compute sum, clipping to max.
-  size_t limit = _max_cards + padding;
+  size_t limit = max_cards() + padding;
   if (limit < padding) {        // Check for overflow.
     limit = MaxCardsUnlimited;
   }
@@ -705,7 +705,8 @@ void G1DirtyCardQueueSet::set_max_cards_padding(size_t padding) {
 
 void G1DirtyCardQueueSet::discard_max_cards_padding() {
   // Being racy here is okay, since all threads store the same value.
-  if (_max_cards != Atomic::load(&_padded_max_cards)) {
-    Atomic::store(&_padded_max_cards, _max_cards);
+  size_t limit = max_cards();
+  if (limit != Atomic::load(&_padded_max_cards)) {
+    Atomic::store(&_padded_max_cards, limit);
   }
 }
@@ -31,6 +31,7 @@
 #include "gc/shared/ptrQueue.hpp"
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
+#include "runtime/atomic.hpp"
 
 class G1ConcurrentRefineThread;
 class G1DirtyCardQueueSet;
@@ -217,14 +218,14 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
 
   G1FreeIdSet _free_ids;
 
-  // Activation threshold for the primary refinement thread.
-  size_t _process_cards_threshold;
+  // Activation threshold for the primary refinement thread.  May be
+  // updated concurrently by the primary refinement thread.
+  volatile size_t _process_cards_threshold;
 
   // If the queue contains more cards than configured here, the
   // mutator must start doing some of the concurrent refinement work.
-  size_t _max_cards;
+  volatile size_t _max_cards;
   volatile size_t _padded_max_cards;
-  static const size_t MaxCardsUnlimited = SIZE_MAX;
 
   G1ConcurrentRefineStats _detached_refinement_stats;
 
@@ -288,10 +289,10 @@ public:
   // Log processing should be done when the number of cards exceeds the
   // threshold.
   void set_process_cards_threshold(size_t sz) {
-    _process_cards_threshold = sz;
+    Atomic::store(&_process_cards_threshold, sz);
   }
   size_t process_cards_threshold() const {
-    return _process_cards_threshold;
+    return Atomic::load(&_process_cards_threshold);
   }
   static const size_t ProcessCardsThresholdNever = SIZE_MAX;
 
@@ -342,6 +343,7 @@ public:
   // Threshold for mutator threads to also do refinement when there
   // are concurrent refinement threads.
   size_t max_cards() const;
+  static const size_t MaxCardsUnlimited = SIZE_MAX;
 
   // Set threshold for mutator threads to also do refinement.
   void set_max_cards(size_t value);
@@ -73,110 +73,76 @@ public:
   }
 };
 
-class RemoveSelfForwardPtrObjClosure: public ObjectClosure {
-  G1CollectedHeap* _g1h;
+static bool is_self_forwarded(oop obj) {
+  return obj->is_forwarded() && obj->forwardee() == obj;
+}
+
+// Processes the failed objects in the chunks claimed by a single worker.
+class RemoveSelfForwardPtrChunkClosure : public StackObj {
   G1ConcurrentMark* _cm;
-  HeapRegion* _hr;
-  size_t _marked_bytes;
+  const G1CMBitMap* _bitmap;
   UpdateLogBuffersDeferred* _log_buffer_cl;
   bool _during_concurrent_start;
   uint _worker_id;
-  HeapWord* _last_forwarded_object_end;
 
-public:
-  RemoveSelfForwardPtrObjClosure(HeapRegion* hr,
-                                 UpdateLogBuffersDeferred* log_buffer_cl,
-                                 bool during_concurrent_start,
-                                 uint worker_id) :
-    _g1h(G1CollectedHeap::heap()),
-    _cm(_g1h->concurrent_mark()),
-    _hr(hr),
-    _marked_bytes(0),
-    _log_buffer_cl(log_buffer_cl),
-    _during_concurrent_start(during_concurrent_start),
-    _worker_id(worker_id),
-    _last_forwarded_object_end(hr->bottom()) { }
-
-  size_t marked_bytes() { return _marked_bytes; }
-
-  // Iterate over the live objects in the region to find self-forwarded objects
-  // that need to be kept live. We need to update the remembered sets of these
-  // objects. Further update the BOT and marks.
-  // We can coalesce and overwrite the remaining heap contents with dummy objects
-  // as they have either been dead or evacuated (which are unreferenced now, i.e.
-  // dead too) already.
-  void do_object(oop obj) {
+  void process_object(HeapRegion* hr, oop obj, size_t obj_size) {
     HeapWord* obj_addr = cast_from_oop<HeapWord*>(obj);
-    assert(_hr->is_in(obj_addr), "sanity");
-
-    if (obj->is_forwarded() && obj->forwardee() == obj) {
-      // The object failed to move.
-
-      zap_dead_objects(_last_forwarded_object_end, obj_addr);
-      // We consider all objects that we find self-forwarded to be
-      // live. What we'll do is that we'll update the prev marking
-      // info so that they are all under PTAMS and explicitly marked.
-      if (!_cm->is_marked_in_prev_bitmap(obj)) {
-        _cm->mark_in_prev_bitmap(obj);
-      }
-      if (_during_concurrent_start) {
-        // For the next marking info we'll only mark the
-        // self-forwarded objects explicitly if we are during
-        // concurrent start (since, normally, we only mark objects pointed
-        // to by roots if we succeed in copying them). By marking all
-        // self-forwarded objects we ensure that we mark any that are
-        // still pointed to be roots. During concurrent marking, and
-        // after concurrent start, we don't need to mark any objects
-        // explicitly and all objects in the CSet are considered
-        // (implicitly) live. So, we won't mark them explicitly and
-        // we'll leave them over NTAMS.
-        _cm->mark_in_next_bitmap(_worker_id, _hr, obj);
-      }
-      size_t obj_size = obj->size();
-
-      _marked_bytes += (obj_size * HeapWordSize);
-      PreservedMarks::init_forwarded_mark(obj);
-
-      // While we were processing RSet buffers during the collection,
-      // we actually didn't scan any cards on the collection set,
-      // since we didn't want to update remembered sets with entries
-      // that point into the collection set, given that live objects
-      // from the collection set are about to move and such entries
-      // will be stale very soon.
-      // This change also dealt with a reliability issue which
-      // involved scanning a card in the collection set and coming
-      // across an array that was being chunked and looking malformed.
-      // The problem is that, if evacuation fails, we might have
-      // remembered set entries missing given that we skipped cards on
-      // the collection set. So, we'll recreate such entries now.
-      obj->oop_iterate(_log_buffer_cl);
-
-      HeapWord* obj_end = obj_addr + obj_size;
-      _last_forwarded_object_end = obj_end;
-      _hr->cross_threshold(obj_addr, obj_end);
+    // We consider all objects that we find self-forwarded to be
+    // live. They have already been marked in the prev bitmap during
+    // evacuation, and the region will have all of them below PTAMS.
+    assert(_cm->is_marked_in_prev_bitmap(obj), "Self-forwarded object " PTR_FORMAT " must be marked", p2i(obj_addr));
+    if (_during_concurrent_start) {
+      // For the next marking info we'll only mark the
+      // self-forwarded objects explicitly if we are during
+      // concurrent start (since, normally, we only mark objects pointed
+      // to by roots if we succeed in copying them). By marking all
+      // self-forwarded objects we ensure that we mark any that are
+      // still pointed to be roots. During concurrent marking, and
+      // after concurrent start, we don't need to mark any objects
+      // explicitly and all objects in the CSet are considered
+      // (implicitly) live. So, we won't mark them explicitly and
+      // we'll leave them over NTAMS.
+      _cm->mark_in_next_bitmap(_worker_id, hr, obj);
     }
+
+    PreservedMarks::init_forwarded_mark(obj);
+
+    // While we were processing RSet buffers during the collection,
+    // we actually didn't scan any cards on the collection set,
+    // since we didn't want to update remembered sets with entries
+    // that point into the collection set, given that live objects
+    // from the collection set are about to move and such entries
+    // will be stale very soon.
+    // This change also dealt with a reliability issue which
+    // involved scanning a card in the collection set and coming
+    // across an array that was being chunked and looking malformed.
+    // The problem is that, if evacuation fails, we might have
+    // remembered set entries missing given that we skipped cards on
+    // the collection set. So, we'll recreate such entries now.
+    obj->oop_iterate(_log_buffer_cl);
+
+    hr->update_bot_for_block(obj_addr, obj_addr + obj_size);
   }
 
   // Fill the memory area from start to end with filler objects, and update the BOT
-  // and the mark bitmap accordingly.
-  void zap_dead_objects(HeapWord* start, HeapWord* end) {
+  // accordingly. There are no marks in that area any more.
+  void zap_dead_objects(HeapRegion* hr, HeapWord* start, HeapWord* end) {
     if (start == end) {
       return;
     }
 
     size_t gap_size = pointer_delta(end, start);
-    MemRegion mr(start, gap_size);
     if (gap_size >= CollectedHeap::min_fill_size()) {
       CollectedHeap::fill_with_objects(start, gap_size);
 
       HeapWord* end_first_obj = start + ((oop)start)->size();
-      _hr->cross_threshold(start, end_first_obj);
+      hr->update_bot_for_block(start, end_first_obj);
       // Fill_with_objects() may have created multiple (i.e. two)
       // objects, as the max_fill_size() is half a region.
       // After updating the BOT for the first object, also update the
       // BOT for the second object to make the BOT complete.
       if (end_first_obj != end) {
-        _hr->cross_threshold(end_first_obj, end);
+        hr->update_bot_for_block(end_first_obj, end);
 #ifdef ASSERT
         size_t size_second_obj = ((oop)end_first_obj)->size();
         HeapWord* end_of_second_obj = end_first_obj + size_second_obj;
@@ -187,82 +153,218 @@ public:
 #endif
       }
     }
-    _cm->clear_range_in_prev_bitmap(mr);
   }
 
-  void zap_remainder() {
-    zap_dead_objects(_last_forwarded_object_end, _hr->top());
+public:
+  RemoveSelfForwardPtrChunkClosure(UpdateLogBuffersDeferred* log_buffer_cl,
+                                   bool during_concurrent_start,
+                                   uint worker_id) :
+    _cm(G1CollectedHeap::heap()->concurrent_mark()),
+    _bitmap(_cm->prev_mark_bitmap()),
+    _log_buffer_cl(log_buffer_cl),
+    _during_concurrent_start(during_concurrent_start),
+    _worker_id(worker_id) { }
+
+  // Process the failed objects starting in [chunk_start, chunk_end) of the given
+  // region, including the dead space following each of them. The chunk at the
+  // bottom of the region also zaps the dead space in front of the first failed
+  // object. Returns the number of bytes of failed objects found.
+  size_t process_chunk(HeapRegion* hr, HeapWord* chunk_start, HeapWord* chunk_end) {
+    HeapWord* const top = hr->top();
+    HeapWord* obj_addr = _bitmap->get_next_marked_addr(chunk_start, top);
+
+    if (chunk_start == hr->bottom()) {
+      zap_dead_objects(hr, chunk_start, obj_addr);
+    }
+
+    size_t marked_bytes = 0;
+    while (obj_addr < chunk_end) {
+      oop obj = oop(obj_addr);
+      assert(is_self_forwarded(obj), "Only failed objects may be marked at " PTR_FORMAT, p2i(obj_addr));
+      size_t obj_size = obj->size();
+      process_object(hr, obj, obj_size);
+      marked_bytes += obj_size * HeapWordSize;
+
+      HeapWord* obj_end = obj_addr + obj_size;
+      HeapWord* next_obj_addr = _bitmap->get_next_marked_addr(obj_end, top);
+      zap_dead_objects(hr, obj_end, next_obj_addr);
+      obj_addr = next_obj_addr;
+    }
+    return marked_bytes;
   }
 };
 
-class RemoveSelfForwardPtrHRClosure: public HeapRegionClosure {
-  G1CollectedHeap* _g1h;
-  uint _worker_id;
-
-  G1RedirtyCardsQueue _rdcq;
-  UpdateLogBuffersDeferred _log_buffer_cl;
+class G1CountEvacFailedRegionsClosure : public HeapRegionClosure {
+  HeapRegion** _regions;
+  uint _num_regions;
 
 public:
-  RemoveSelfForwardPtrHRClosure(G1RedirtyCardsQueueSet* rdcqs, uint worker_id) :
-    _g1h(G1CollectedHeap::heap()),
-    _worker_id(worker_id),
-    _rdcq(rdcqs),
-    _log_buffer_cl(&_rdcq) {
-  }
-
-  size_t remove_self_forward_ptr_by_walking_hr(HeapRegion* hr,
-                                               bool during_concurrent_start) {
-    RemoveSelfForwardPtrObjClosure rspc(hr,
-                                        &_log_buffer_cl,
-                                        during_concurrent_start,
-                                        _worker_id);
-    hr->object_iterate(&rspc);
-    // Need to zap the remainder area of the processed region.
-    rspc.zap_remainder();
-
-    return rspc.marked_bytes();
-  }
+  G1CountEvacFailedRegionsClosure(HeapRegion** regions) :
+    HeapRegionClosure(), _regions(regions), _num_regions(0) { }
 
-  bool do_heap_region(HeapRegion *hr) {
+  bool do_heap_region(HeapRegion* hr) {
     assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
     assert(hr->in_collection_set(), "bad CS");
 
     if (hr->evacuation_failed()) {
-      hr->clear_index_in_opt_cset();
-
-      bool during_concurrent_start = _g1h->collector_state()->in_concurrent_start_gc();
-      bool during_concurrent_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
-
-      hr->note_self_forwarding_removal_start(during_concurrent_start,
-                                             during_concurrent_mark);
-      _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
-
-      hr->reset_bot();
-
-      size_t live_bytes = remove_self_forward_ptr_by_walking_hr(hr, during_concurrent_start);
-
-      hr->rem_set()->clean_strong_code_roots(hr);
-      hr->rem_set()->clear_locked(true);
-
-      hr->note_self_forwarding_removal_end(live_bytes);
+      if (_regions != NULL) {
+        _regions[_num_regions] = hr;
+      }
+      _num_regions++;
     }
     return false;
   }
+
+  uint num_regions() const { return _num_regions; }
 };
 
+// Chunks should be small enough to balance the work within a single region,
+// but large enough to keep the claiming overhead low.
+static const size_t RemoveSelfForwardsChunkSizeBytes = 256 * K;
+
 G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1RedirtyCardsQueueSet* rdcqs) :
   AbstractGangTask("G1 Remove Self-forwarding Pointers"),
   _g1h(G1CollectedHeap::heap()),
   _rdcqs(rdcqs),
-  _hrclaimer(_g1h->workers()->active_workers()) { }
-
-void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
-  RemoveSelfForwardPtrHRClosure rsfp_cl(_rdcqs, worker_id);
+  _regions(NULL),
+  _live_bytes(NULL),
+  _num_regions(0),
+  _chunks_per_region(MAX2((uint)(HeapRegion::GrainBytes / RemoveSelfForwardsChunkSizeBytes), 1u)),
+  _chunk_size(HeapRegion::GrainWords / _chunks_per_region),
+  _next_chunk(0),
+  _clearing_stale_marks(false) {
 
   // We need to check all collection set regions whether they need self forward
   // removals, not only the last collection set increment. The reason is that
   // reference processing (e.g. finalizers) can make it necessary to resurrect an
   // otherwise unreachable object at the very end of the collection. That object
   // might cause an evacuation failure in any region in the collection set.
-  _g1h->collection_set_par_iterate_all(&rsfp_cl, &_hrclaimer, worker_id);
+  G1CountEvacFailedRegionsClosure count_cl(NULL);
+  _g1h->collection_set_iterate_all(&count_cl);
+
+  _num_regions = count_cl.num_regions();
+  _regions = NEW_C_HEAP_ARRAY(HeapRegion*, _num_regions, mtGC);
+  _live_bytes = NEW_C_HEAP_ARRAY(size_t, _num_regions, mtGC);
+
+  G1CountEvacFailedRegionsClosure collect_cl(_regions);
+  _g1h->collection_set_iterate_all(&collect_cl);
+  assert(collect_cl.num_regions() == _num_regions, "must be");
+}
+
+G1ParRemoveSelfForwardPtrsTask::~G1ParRemoveSelfForwardPtrsTask() {
+  FREE_C_HEAP_ARRAY(HeapRegion*, _regions);
+  FREE_C_HEAP_ARRAY(size_t, _live_bytes);
+}
+
+bool G1ParRemoveSelfForwardPtrsTask::claim_chunk(uint& chunk_idx) {
+  if (Atomic::load(&_next_chunk) >= _num_regions * _chunks_per_region) {
+    return false;
+  }
+  chunk_idx = Atomic::fetch_and_add(&_next_chunk, 1u);
+  return chunk_idx < _num_regions * _chunks_per_region;
+}
+
+void G1ParRemoveSelfForwardPtrsTask::prepare_regions() {
+  bool during_concurrent_start = _g1h->collector_state()->in_concurrent_start_gc();
+  bool during_concurrent_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
+
+  for (uint i = 0; i < _num_regions; i++) {
+    HeapRegion* hr = _regions[i];
+    hr->clear_index_in_opt_cset();
+    hr->note_self_forwarding_removal_start(during_concurrent_start,
+                                           during_concurrent_mark);
+    _live_bytes[i] = 0;
+  }
+}
+
+void G1ParRemoveSelfForwardPtrsTask::clear_stale_marks_in_chunk(uint chunk_idx) {
+  HeapRegion* hr = _regions[chunk_idx / _chunks_per_region];
+  HeapWord* chunk_start = hr->bottom() + (chunk_idx % _chunks_per_region) * _chunk_size;
+  // Marks from the last marking are only below PTAMS; young regions
+  // have no such marks.
+  HeapWord* limit = MIN2(chunk_start + _chunk_size, hr->prev_top_at_mark_start());
+
+  G1ConcurrentMark* cm = _g1h->concurrent_mark();
+  const G1CMBitMap* bitmap = cm->prev_mark_bitmap();
+  HeapWord* addr = chunk_start;
+  while (addr < limit) {
+    addr = bitmap->get_next_marked_addr(addr, limit);
+    if (addr >= limit) {
+      break;
+    }
+    if (!is_self_forwarded(oop(addr))) {
+      // The object has either been evacuated or is dead. Chunks cover whole
+      // bitmap words, so clearing does not interfere with other chunks.
+      cm->clear_range_in_prev_bitmap(MemRegion(addr, 1));
+    }
+    addr++;
+  }
+}
+
+void G1ParRemoveSelfForwardPtrsTask::complete_regions() {
+  for (uint i = 0; i < _num_regions; i++) {
+    HeapRegion* hr = _regions[i];
+    hr->note_self_forwarding_removal_end(_live_bytes[i]);
+    // The failed objects are marked in the prev bitmap above the old PTAMS
+    // until now, so only check afterwards.
+    _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
+  }
+}
+
+void G1ParRemoveSelfForwardPtrsTask::run(WorkGang* workers) {
+  if (_num_regions == 0) {
+    return;
+  }
+  prepare_regions();
+
+  // Processing the failed objects writes filler objects into the dead space
+  // of the regions, so the marks left over from the last marking must be
+  // gone completely before starting. Otherwise the walk could encounter
+  // such a mark within a filler object another worker is just writing.
+  _clearing_stale_marks = true;
+  workers->run_task(this);
+
+  _clearing_stale_marks = false;
+  Atomic::store(&_next_chunk, 0u);
+  workers->run_task(this);
+
+  complete_regions();
+}
+
+void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
+  uint chunk_idx;
+  if (_clearing_stale_marks) {
+    while (claim_chunk(chunk_idx)) {
+      clear_stale_marks_in_chunk(chunk_idx);
+    }
+    return;
+  }
+
+  G1RedirtyCardsQueue rdcq(_rdcqs);
+  UpdateLogBuffersDeferred log_buffer_cl(&rdcq);
+  RemoveSelfForwardPtrChunkClosure chunk_cl(&log_buffer_cl,
+                                            _g1h->collector_state()->in_concurrent_start_gc(),
+                                            worker_id);
+
+  while (claim_chunk(chunk_idx)) {
+    uint region_idx = chunk_idx / _chunks_per_region;
+    uint chunk_in_region = chunk_idx % _chunks_per_region;
+    HeapRegion* hr = _regions[region_idx];
+
+    if (chunk_in_region == 0) {
+      // The claimer of the first chunk also does the per-region work.
+      hr->rem_set()->clean_strong_code_roots(hr);
+      hr->rem_set()->clear_locked(true);
+    }
+
+    HeapWord* chunk_start = hr->bottom() + chunk_in_region * _chunk_size;
+    if (chunk_start >= hr->top()) {
+      continue;
+    }
+    HeapWord* chunk_end = MIN2(chunk_start + _chunk_size, hr->top());
+    size_t marked_bytes = chunk_cl.process_chunk(hr, chunk_start, chunk_end);
+    if (marked_bytes > 0) {
+      Atomic::add(&_live_bytes[region_idx], marked_bytes);
+    }
+  }
 }
@@ -26,23 +26,57 @@
 #define SHARE_GC_G1_G1EVACFAILURE_HPP
 
 #include "gc/g1/g1OopClosures.hpp"
-#include "gc/g1/heapRegionManager.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class G1CollectedHeap;
 class G1RedirtyCardsQueueSet;
+class HeapRegion;
 
 // Task to fixup self-forwarding pointers
 // installed as a result of an evacuation failure.
+//
+// Objects that failed evacuation are marked in the prev bitmap when they are
+// self-forwarded. The regions that failed evacuation are split into fixed size
+// chunks that workers claim individually, using the marks to find the failed
+// objects instead of walking all objects, so that even the work on a single
+// region is spread across all workers.
+//
+// This takes two passes over the chunks: the first clears marks left over
+// from the last marking for objects that did not fail evacuation, and the
+// second processes each failed object starting in a chunk, together with the
+// dead space following it up to the next failed object.
 class G1ParRemoveSelfForwardPtrsTask: public AbstractGangTask {
 protected:
   G1CollectedHeap* _g1h;
   G1RedirtyCardsQueueSet* _rdcqs;
-  HeapRegionClaimer _hrclaimer;
+
+  // The regions that failed evacuation, and the number of bytes of failed
+  // objects found in each of them.
+  HeapRegion** _regions;
+  size_t volatile* _live_bytes;
+  uint _num_regions;
+
+  uint _chunks_per_region;
+  size_t _chunk_size;
+  // Index of the next chunk to claim, counting over all chunks of all
+  // regions in _regions.
+  uint volatile _next_chunk;
+
+  bool _clearing_stale_marks;
+
+  bool claim_chunk(uint& chunk_idx);
+
+  void prepare_regions();
+  void clear_stale_marks_in_chunk(uint chunk_idx);
+  void complete_regions();
 
 public:
   G1ParRemoveSelfForwardPtrsTask(G1RedirtyCardsQueueSet* rdcqs);
+  ~G1ParRemoveSelfForwardPtrsTask();
+
+  // Remove the self-forwarding pointers using the given workers.
+  void run(WorkGang* workers);
 
   void work(uint worker_id);
 };
@@ -24,7 +24,7 @@
 
 #include "precompiled.hpp"
 #include "code/codeCache.hpp"
-#include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1FullCollector.hpp"
 #include "gc/g1/g1FullGCAdjustTask.hpp"
 #include "gc/g1/g1FullGCCompactTask.hpp"
@@ -126,6 +126,13 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap, bool explicit_gc, bool c
     _oop_queue_set.register_queue(i, marker(i)->oop_stack());
     _array_queue_set.register_queue(i, marker(i)->objarray_stack());
   }
+
+  // Humongous and archive regions are never compacted anyway.
+  _region_has_pinned_objects = NEW_C_HEAP_ARRAY(bool, heap->max_reserved_regions(), mtGC);
+  for (uint i = 0; i < heap->max_reserved_regions(); i++) {
+    HeapRegion* hr = heap->region_at_or_null(i);
+    _region_has_pinned_objects[i] = hr != NULL && !hr->is_pinned() && hr->has_pinned_objects();
+  }
 }
 
 G1FullCollector::~G1FullCollector() {
@@ -135,6 +142,7 @@ G1FullCollector::~G1FullCollector() {
   }
   FREE_C_HEAP_ARRAY(G1FullGCMarker*, _markers);
   FREE_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _compaction_points);
+  FREE_C_HEAP_ARRAY(bool, _region_has_pinned_objects);
 }
 
 void G1FullCollector::prepare_collection() {
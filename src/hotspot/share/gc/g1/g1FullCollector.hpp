@@ -71,6 +71,11 @@ class G1FullCollector : StackObj {
   G1FullGCSubjectToDiscoveryClosure _always_subject_to_discovery;
   ReferenceProcessorSubjectToDiscoveryMutator _is_subject_mutator;
 
+  // Per region flag whether that region contained objects pinned by JNI
+  // critical sections at the start of the collection. These regions are
+  // not compacted.
+  bool*                     _region_has_pinned_objects;
+
 public:
   G1FullCollector(G1CollectedHeap* heap, bool explicit_gc, bool clear_soft_refs);
   ~G1FullCollector();
@@ -90,6 +95,8 @@ public:
   G1CMBitMap*              mark_bitmap();
   ReferenceProcessor*      reference_processor();
 
+  bool region_has_pinned_objects(uint region_idx) const { return _region_has_pinned_objects[region_idx]; }
+
 private:
   void phase1_mark_live_objects();
   void phase2_prepare_compaction();
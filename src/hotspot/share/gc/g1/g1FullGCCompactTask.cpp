@@ -34,12 +34,14 @@
 #include "oops/oop.inline.hpp"
 #include "utilities/ticks.hpp"
 
-class G1ResetHumongousClosure : public HeapRegionClosure {
+class G1ResetPinnedClosure : public HeapRegionClosure {
+  G1FullCollector* _collector;
   G1CMBitMap* _bitmap;
 
 public:
-  G1ResetHumongousClosure(G1CMBitMap* bitmap) :
-      _bitmap(bitmap) { }
+  G1ResetPinnedClosure(G1FullCollector* collector) :
+      _collector(collector),
+      _bitmap(collector->mark_bitmap()) { }
 
   bool do_heap_region(HeapRegion* current) {
     if (current->is_humongous()) {
@@ -54,6 +56,11 @@ public:
         }
       }
       current->reset_humongous_during_compaction();
+    } else if (_collector->region_has_pinned_objects(current->hrm_index())) {
+      // Objects in regions with pinned objects did not move. Clear the
+      // liveness information and finish the region like a compacted one.
+      _bitmap->clear_region(current);
+      current->complete_compaction();
     }
     return false;
   }
@@ -96,7 +103,7 @@ void G1FullGCCompactTask::work(uint worker_id) {
     compact_region(*it);
   }
 
-  G1ResetHumongousClosure hc(collector()->mark_bitmap());
+  G1ResetPinnedClosure hc(collector());
   G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&hc, &_claimer, worker_id);
   log_task("Compaction task", worker_id, start);
 }
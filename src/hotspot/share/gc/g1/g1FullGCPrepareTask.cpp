@@ -49,6 +49,8 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
     } else {
       free_humongous_region(hr);
     }
+  } else if (_collector->region_has_pinned_objects(hr->hrm_index())) {
+    prepare_pinned_region(hr);
   } else if (!hr->is_pinned()) {
     prepare_for_compaction(hr);
   }
@@ -78,7 +80,7 @@ bool G1FullGCPrepareTask::has_freed_regions() {
 void G1FullGCPrepareTask::work(uint worker_id) {
   Ticks start = Ticks::now();
   G1FullGCCompactionPoint* compaction_point = collector()->compaction_point(worker_id);
-  G1CalculatePointersClosure closure(collector()->mark_bitmap(), compaction_point);
+  G1CalculatePointersClosure closure(collector(), compaction_point);
   G1CollectedHeap::heap()->heap_region_par_iterate_from_start(&closure, &_hrclaimer);
 
   // Update humongous region sets
@@ -92,10 +94,11 @@ void G1FullGCPrepareTask::work(uint worker_id) {
   log_task("Prepare compaction task", worker_id, start);
 }
 
-G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1CMBitMap* bitmap,
+G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1FullCollector* collector,
                                                                             G1FullGCCompactionPoint* cp) :
     _g1h(G1CollectedHeap::heap()),
-    _bitmap(bitmap),
+    _collector(collector),
+    _bitmap(collector->mark_bitmap()),
     _cp(cp),
     _humongous_regions_removed(0) { }
 
@@ -110,6 +113,49 @@ void G1FullGCPrepareTask::G1CalculatePointersClosure::free_humongous_region(Heap
   dummy_free_list.remove_all();
 }
 
+void G1FullGCPrepareTask::G1CalculatePointersClosure::fill_dead_range(HeapRegion* hr, HeapWord* start, HeapWord* end) {
+  CollectedHeap::fill_with_objects(start, pointer_delta(end, start));
+  // Filling may have created multiple objects, update the BOT for all of them.
+  HeapWord* cur = start;
+  while (cur < end) {
+    HeapWord* next = cur + oop(cur)->size();
+    hr->cross_threshold(cur, next);
+    cur = next;
+  }
+}
+
+void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_pinned_region(HeapRegion* hr) {
+  // Objects in this region must not move. Keep all live objects in place,
+  // overwrite the dead ones with filler objects so that the region stays
+  // parsable after class unloading, and rebuild the BOT as the region
+  // might have been a young region without one.
+  hr->set_compaction_top(hr->top());
+  hr->reset_bot();
+
+  HeapWord* cur = hr->bottom();
+  HeapWord* const limit = hr->top();
+  while (cur < limit) {
+    HeapWord* next_live = _bitmap->get_next_marked_addr(cur, limit);
+    if (next_live > cur) {
+      fill_dead_range(hr, cur, next_live);
+    }
+    if (next_live == limit) {
+      break;
+    }
+
+    oop obj = oop(next_live);
+    if (obj->forwardee() != NULL) {
+      // See G1FullGCCompactionPoint::forward(): the object does not move, but
+      // its mark word looks like a forwarding pointer. It is restored from the
+      // preserved marks.
+      obj->init_mark();
+    }
+    HeapWord* obj_end = next_live + obj->size();
+    hr->cross_threshold(next_live, obj_end);
+    cur = obj_end;
+  }
+}
+
 void G1FullGCPrepareTask::G1CalculatePointersClosure::reset_region_metadata(HeapRegion* hr) {
   hr->rem_set()->clear();
   hr->clear_cardtable();
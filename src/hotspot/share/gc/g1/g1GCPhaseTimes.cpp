@@ -74,15 +74,17 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
   _gc_par_phases[MergeER] = new WorkerDataArray<double>("MergeER", "Eager Reclaim (ms):", max_gc_threads);
 
   _gc_par_phases[MergeRS] = new WorkerDataArray<double>("MergeRS", "Remembered Sets (ms):", max_gc_threads);
-  _gc_par_phases[MergeRS]->create_thread_work_items("Merged Sparse:", MergeRSMergedSparse);
-  _gc_par_phases[MergeRS]->create_thread_work_items("Merged Fine:", MergeRSMergedFine);
-  _gc_par_phases[MergeRS]->create_thread_work_items("Merged Coarse:", MergeRSMergedCoarse);
+  _gc_par_phases[MergeRS]->create_thread_work_items("Merged Inline:", MergeRSMergedInline);
+  _gc_par_phases[MergeRS]->create_thread_work_items("Merged ArrayOfCards:", MergeRSMergedArrayOfCards);
+  _gc_par_phases[MergeRS]->create_thread_work_items("Merged BitMap:", MergeRSMergedBitmap);
+  _gc_par_phases[MergeRS]->create_thread_work_items("Merged Full:", MergeRSMergedFull);
   _gc_par_phases[MergeRS]->create_thread_work_items("Dirty Cards:", MergeRSDirtyCards);
 
   _gc_par_phases[OptMergeRS] = new WorkerDataArray<double>("OptMergeRS", "Optional Remembered Sets (ms):", max_gc_threads);
-  _gc_par_phases[OptMergeRS]->create_thread_work_items("Merged Sparse:", MergeRSMergedSparse);
-  _gc_par_phases[OptMergeRS]->create_thread_work_items("Merged Fine:", MergeRSMergedFine);
-  _gc_par_phases[OptMergeRS]->create_thread_work_items("Merged Coarse:", MergeRSMergedCoarse);
+  _gc_par_phases[OptMergeRS]->create_thread_work_items("Merged Inline:", MergeRSMergedInline);
+  _gc_par_phases[OptMergeRS]->create_thread_work_items("Merged ArrayOfCards:", MergeRSMergedArrayOfCards);
+  _gc_par_phases[OptMergeRS]->create_thread_work_items("Merged BitMap:", MergeRSMergedBitmap);
+  _gc_par_phases[OptMergeRS]->create_thread_work_items("Merged Full:", MergeRSMergedFull);
   _gc_par_phases[OptMergeRS]->create_thread_work_items("Dirty Cards:", MergeRSDirtyCards);
 
   _gc_par_phases[MergeLB] = new WorkerDataArray<double>("MergeLB", "Log Buffers (ms):", max_gc_threads);
@@ -85,10 +85,12 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   static const GCParPhases ExtRootScanSubPhasesLast = GCParPhases(MergeER - 1);
 
   enum GCMergeRSWorkTimes {
-    MergeRSMergedSparse,
-    MergeRSMergedFine,
-    MergeRSMergedCoarse,
-    MergeRSDirtyCards
+    MergeRSMergedInline = 0,
+    MergeRSMergedArrayOfCards,
+    MergeRSMergedBitmap,
+    MergeRSMergedFull,
+    MergeRSContainersSentinel,
+    MergeRSDirtyCards = MergeRSContainersSentinel
   };
 
   enum GCScanHRWorkItems {
@@ -24,9 +24,14 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1HeterogeneousHeapPolicy.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
+#include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/g1/heterogeneousHeapRegionManager.hpp"
+#include "logging/log.hpp"
 
 G1HeterogeneousHeapPolicy::G1HeterogeneousHeapPolicy(STWGCTimer* gc_timer) :
   G1Policy(gc_timer), _manager(NULL) {}
@@ -41,6 +46,7 @@ void G1HeterogeneousHeapPolicy::init(G1CollectedHeap* g1h, G1CollectionSet* coll
 // After a collection pause, young list target length is updated. So we need to make sure we have enough regions in dram for young gen.
 void G1HeterogeneousHeapPolicy::record_collection_pause_end(double pause_time_ms, bool concurrent_operation_is_full_mark) {
   G1Policy::record_collection_pause_end(pause_time_ms, concurrent_operation_is_full_mark);
+  _manager->set_old_gc_alloc_in_dram(false);
   _manager->adjust_dram_regions((uint)young_list_target_length(), G1CollectedHeap::heap()->workers());
 }
 
@@ -56,3 +62,47 @@ bool G1HeterogeneousHeapPolicy::force_upgrade_to_full() {
   }
   return false;
 }
+
+// Sums remembered set entries (incoming references from other regions) and
+// live bytes from the last marking over old regions, as a measure of how often
+// these regions are reached from the rest of the heap.
+class G1OldRegionRefDensityClosure : public HeapRegionClosure {
+  size_t _rs_entries;
+  size_t _live_bytes;
+public:
+  G1OldRegionRefDensityClosure() : _rs_entries(0), _live_bytes(0) { }
+
+  virtual bool do_heap_region(HeapRegion* r) {
+    if (r->is_old()) {
+      _rs_entries += r->rem_set()->occupied();
+      _live_bytes += r->live_bytes();
+    }
+    return false;
+  }
+
+  double density() const {
+    return (double)_rs_entries / MAX2(_live_bytes, (size_t)1);
+  }
+};
+
+bool G1HeterogeneousHeapPolicy::old_collection_set_is_hot() {
+  G1CollectionSet* cset = G1CollectedHeap::heap()->collection_set();
+
+  G1OldRegionRefDensityClosure cset_cl;
+  cset->iterate(&cset_cl);
+
+  G1OldRegionRefDensityClosure candidates_cl;
+  cset->candidates()->iterate(&candidates_cl);
+
+  log_debug(gc, ergo, heap)("Old collection set reference density: %1.3f per KB live, remaining candidates: %1.3f per KB live",
+                            cset_cl.density() * K, candidates_cl.density() * K);
+  return cset_cl.density() > candidates_cl.density();
+}
+
+// Survivors of hot old regions are copied into dram during mixed collections.
+void G1HeterogeneousHeapPolicy::record_initial_collection_set_finalized() {
+  bool hot = G1HeteroHotOldDramPercent > 0 &&
+             collector_state()->in_mixed_phase() &&
+             old_collection_set_is_hot();
+  _manager->set_old_gc_alloc_in_dram(hot);
+}
@@ -32,6 +32,10 @@ class G1HeterogeneousHeapPolicy : public G1Policy {
   // Stash a pointer to the hrm.
   HeterogeneousHeapRegionManager* _manager;
 
+  // Are the old regions of the collection set referenced more densely than the
+  // remaining collection set candidates?
+  bool old_collection_set_is_hot();
+
 public:
   G1HeterogeneousHeapPolicy(STWGCTimer* gc_timer);
 
@@ -43,5 +47,7 @@ public:
   virtual void record_full_collection_end();
 
   virtual bool force_upgrade_to_full();
+
+  virtual void record_initial_collection_set_finalized();
 };
 #endif // SHARE_GC_G1_G1HETEROGENEOUSHEAPPOLICY_HPP
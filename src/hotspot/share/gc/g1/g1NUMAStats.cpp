@@ -156,7 +156,9 @@ static const char* phase_to_explanatory_string(G1NUMAStats::NodeDataItems phase)
     case G1NUMAStats::NewRegionAlloc:
       return "Placement match ratio";
     case G1NUMAStats::LocalObjProcessAtCopyToSurv:
-      return "Worker task locality match ratio";
+      return "Worker task locality match ratio (survivor)";
+    case G1NUMAStats::LocalObjProcessAtCopyToOld:
+      return "Worker task locality match ratio (old)";
     default:
       return "";
   }
@@ -227,4 +229,5 @@ void G1NUMAStats::print_statistics() {
   print_mutator_alloc_stat_debug();
 
   print_info(LocalObjProcessAtCopyToSurv);
+  print_info(LocalObjProcessAtCopyToOld);
 }
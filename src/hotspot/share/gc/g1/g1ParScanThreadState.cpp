@@ -76,9 +76,12 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _partial_objarray_chunk_size(ParGCArrayScanChunk),
     _partial_array_stepper(n_workers),
     _num_optional_regions(optional_cset_length),
-    _numa(g1h->numa()),
-    _obj_alloc_stat(NULL)
+    _numa(g1h->numa())
 {
+  for (uint i = 0; i < G1HeapRegionAttr::Num; i++) {
+    _obj_alloc_stat[i] = NULL;
+  }
+
   // We allocate number of young gen regions in the collection set plus one
   // entries, since entry 0 keeps track of surviving bytes for non-young regions.
   // We also add a few elements at the beginning and at the end in
@@ -124,7 +127,9 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   delete _closures;
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
-  FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  for (uint i = 0; i < G1HeapRegionAttr::Num; i++) {
+    FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat[i]);
+  }
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -400,7 +405,7 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
     }
   }
   if (obj_ptr != NULL) {
-    update_numa_stats(node_index);
+    update_numa_stats(*dest_attr, node_index);
     if (_g1h->_gc_tracer_stw->should_report_promotion_events()) {
       // The events are checked individually as part of the actual commit
       report_promotion_event(*dest_attr, old, word_sz, age, obj_ptr, node_index);
@@ -434,6 +439,12 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
+  if (from_region->has_pinned_objects()) {
+    // Regions with objects pinned by JNI critical sections must not move any
+    // object. Treat them like an evacuation failure, retaining the region
+    // in place as old region.
+    return handle_evacuation_failure_par(old, old_mark);
+  }
   uint node_index = from_region->node_index();
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
@@ -637,22 +648,25 @@ void G1ParScanThreadState::initialize_numa_stats() {
     if (lt.is_enabled()) {
       uint num_nodes = _numa->num_active_nodes();
       // Record only if there are multiple active nodes.
-      _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
-      memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      for (uint i = 0; i < G1HeapRegionAttr::Num; i++) {
+        _obj_alloc_stat[i] = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
+        memset(_obj_alloc_stat[i], 0, sizeof(size_t) * num_nodes);
+      }
     }
   }
 }
 
 void G1ParScanThreadState::flush_numa_stats() {
-  if (_obj_alloc_stat != NULL) {
+  if (_obj_alloc_stat[G1HeapRegionAttr::Young] != NULL) {
     uint node_index = _numa->index_of_current_thread();
-    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat[G1HeapRegionAttr::Young]);
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToOld, node_index, _obj_alloc_stat[G1HeapRegionAttr::Old]);
   }
 }
 
-void G1ParScanThreadState::update_numa_stats(uint node_index) {
-  if (_obj_alloc_stat != NULL) {
-    _obj_alloc_stat[node_index]++;
+void G1ParScanThreadState::update_numa_stats(G1HeapRegionAttr dest_attr, uint node_index) {
+  if (_obj_alloc_stat[dest_attr.type()] != NULL) {
+    _obj_alloc_stat[dest_attr.type()][node_index]++;
   }
 }
 
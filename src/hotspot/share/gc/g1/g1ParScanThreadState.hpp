@@ -100,10 +100,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
 
   G1NUMA* _numa;
 
-  // Records how many object allocations happened at each node during copy to survivor.
+  // Records how many object allocations happened at each node during copy to
+  // survivor and old respectively.
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
-  size_t* _obj_alloc_stat;
+  size_t* _obj_alloc_stat[G1HeapRegionAttr::Num];
 
 public:
   G1ParScanThreadState(G1CollectedHeap* g1h,
@@ -208,7 +209,7 @@ private:
   // NUMA statistics related methods.
   void initialize_numa_stats();
   void flush_numa_stats();
-  inline void update_numa_stats(uint node_index);
+  inline void update_numa_stats(G1HeapRegionAttr dest_attr, uint node_index);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
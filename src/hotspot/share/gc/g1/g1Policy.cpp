@@ -490,6 +490,7 @@ void G1Policy::record_concurrent_refinement_stats() {
 
   // Collect specialized concurrent refinement thread stats.
   G1ConcurrentRefine* cr = _g1h->concurrent_refine();
+  cr->log_pending_cards_at_gc_start(_pending_cards_at_gc_start);
   G1ConcurrentRefineStats cr_stats = cr->get_and_reset_refinement_stats();
 
   G1ConcurrentRefineStats total_stats = mut_stats + cr_stats;
@@ -963,6 +964,14 @@ double G1Policy::predict_region_total_time_ms(HeapRegion* hr, bool for_young_gc)
   return predict_region_non_copy_time_ms(hr, for_young_gc) + predict_region_copy_time_ms(hr);
 }
 
+double G1Policy::predict_candidate_time_ms(HeapRegion* hr) const {
+  assert(hr->is_old(), "Region %u is not a candidate", hr->hrm_index());
+  double non_copy_time_ms = predict_region_non_copy_time_ms(hr, false /* for_young_gc */);
+  log_trace(gc, ergo, cset)("Candidate region %u predicted time copy %1.3fms non-copy %1.3fms",
+                            hr->hrm_index(), hr->predicted_copy_time_ms(), non_copy_time_ms);
+  return hr->predicted_copy_time_ms() + non_copy_time_ms;
+}
+
 bool G1Policy::should_allocate_mutator_region() const {
   uint young_list_length = _g1h->young_regions_count();
   uint young_list_target_length = _young_list_target_length;
@@ -1346,7 +1355,6 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
   num_optional_regions = 0;
   uint num_expensive_regions = 0;
 
-  double predicted_old_time_ms = 0.0;
   double predicted_initial_time_ms = 0.0;
   double predicted_optional_time_ms = 0.0;
 
@@ -1373,11 +1381,11 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
       break;
     }
 
-    double predicted_time_ms = predict_region_total_time_ms(hr, false);
+    double predicted_time_ms = predict_candidate_time_ms(hr);
     time_remaining_ms = MAX2(time_remaining_ms - predicted_time_ms, 0.0);
     // Add regions to old set until we reach the minimum amount
     if (num_initial_regions < min_old_cset_length) {
-      predicted_old_time_ms += predicted_time_ms;
+      predicted_initial_time_ms += predicted_time_ms;
       num_initial_regions++;
       // Record the number of regions added with no time remaining
       if (time_remaining_ms == 0.0) {
@@ -1391,7 +1399,7 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
     } else {
       // Keep adding regions to old set until we reach the optional threshold
       if (time_remaining_ms > optional_threshold_ms) {
-        predicted_old_time_ms += predicted_time_ms;
+        predicted_initial_time_ms += predicted_time_ms;
         num_initial_regions++;
       } else if (time_remaining_ms > 0) {
         // Keep adding optional regions until time is up.
@@ -1415,7 +1423,7 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
   }
 
   log_debug(gc, ergo, cset)("Finish choosing collection set old regions. Initial: %u, optional: %u, "
-                            "predicted old time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2f",
+                            "predicted initial time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2f",
                             num_initial_regions, num_optional_regions,
                             predicted_initial_time_ms, predicted_optional_time_ms, time_remaining_ms);
 }
@@ -1433,16 +1441,17 @@ void G1Policy::calculate_optional_collection_set_regions(G1CollectionSetCandidat
   HeapRegion* r = candidates->at(candidate_idx);
   while (num_optional_regions < max_optional_regions) {
     assert(r != NULL, "Region must exist");
-    prediction_ms += predict_region_total_time_ms(r, false);
+    double region_prediction_ms = predict_candidate_time_ms(r);
 
-    if (prediction_ms > time_remaining_ms) {
+    if (region_prediction_ms > time_remaining_ms) {
       log_debug(gc, ergo, cset)("Prediction %.3fms for region %u does not fit remaining time: %.3fms.",
-                                prediction_ms, r->hrm_index(), time_remaining_ms);
+                                region_prediction_ms, r->hrm_index(), time_remaining_ms);
       break;
     }
     // This region will be included in the next optional evacuation.
 
-    time_remaining_ms -= prediction_ms;
+    prediction_ms += region_prediction_ms;
+    time_remaining_ms -= region_prediction_ms;
     num_optional_regions++;
     r = candidates->at(++candidate_idx);
   }
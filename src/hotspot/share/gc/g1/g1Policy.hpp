@@ -139,13 +139,17 @@ public:
 private:
   double predict_base_elapsed_time_ms(size_t num_pending_cards, size_t rs_length) const;
 
-  double predict_region_copy_time_ms(HeapRegion* hr) const;
-
 public:
+  double predict_region_copy_time_ms(HeapRegion* hr) const;
 
   double predict_eden_copy_time_ms(uint count, size_t* bytes_to_copy = NULL) const;
   double predict_region_non_copy_time_ms(HeapRegion* hr, bool for_young_gc) const;
   double predict_region_total_time_ms(HeapRegion* hr, bool for_young_gc) const;
+  // Predicted time to evacuate the given old collection set candidate during
+  // a mixed gc. Combines the copy time recorded when the region became a
+  // candidate with a fresh prediction of the remembered set merge and scan
+  // time, as the remembered set keeps growing during the mixed phase.
+  double predict_candidate_time_ms(HeapRegion* hr) const;
 
   void cset_regions_freed() {
     bool update = should_update_surv_rate_group_predictors();
@@ -453,6 +457,10 @@ public:
   virtual bool force_upgrade_to_full() {
     return false;
   }
+
+  // Called after the initial collection set of an evacuation pause has been
+  // chosen, before any region is allocated for evacuation.
+  virtual void record_initial_collection_set_finalized() { }
 };
 
 #endif // SHARE_GC_G1_G1POLICY_HPP
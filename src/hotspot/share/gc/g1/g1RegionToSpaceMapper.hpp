@@ -72,6 +72,12 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
   virtual void commit_regions(uint start_idx, size_t num_regions = 1, WorkGang* pretouch_workers = NULL) = 0;
   virtual void uncommit_regions(uint start_idx, size_t num_regions = 1) = 0;
 
+  // Notify the listener that the given committed regions are being reused,
+  // so that it can reinitialize the corresponding data.
+  void signal_mapping_changed(uint start_idx, size_t num_regions) {
+    fire_on_commit(start_idx, num_regions, false);
+  }
+
   // Creates an appropriate G1RegionToSpaceMapper for the given parameters.
   // The actual space to be used within the given reservation is given by actual_size.
   // This is because some OSes need to round up the reservation size to guarantee
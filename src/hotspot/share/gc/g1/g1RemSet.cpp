@@ -42,7 +42,6 @@
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionManager.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
-#include "gc/g1/sparsePRT.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/ptrQueue.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
@@ -94,6 +93,11 @@ class G1RemSetScanState : public CHeapObj<mtGC> {
 
   G1RemsetIterState volatile* _collection_set_iter_state;
 
+  // Number of parts of the remembered set of each collection set region claimed
+  // for merging so far. Remembered sets are split into parts so that workers
+  // may share the work of merging large remembered sets.
+  uint volatile* _merge_claims;
+
   // Card table iteration claim for each heap region, from 0 (completely unscanned)
   // to (>=) HeapRegion::CardsPerRegion (completely scanned).
   uint volatile* _card_table_scan_state;
@@ -285,6 +289,7 @@ public:
   G1RemSetScanState() :
     _max_reserved_regions(0),
     _collection_set_iter_state(NULL),
+    _merge_claims(NULL),
     _card_table_scan_state(NULL),
     _scan_chunks_per_region(get_chunks_per_region(HeapRegion::LogOfHRGrainBytes)),
     _log_scan_chunks_per_region(log2_uint(_scan_chunks_per_region)),
@@ -298,6 +303,7 @@ public:
 
   ~G1RemSetScanState() {
     FREE_C_HEAP_ARRAY(G1RemsetIterState, _collection_set_iter_state);
+    FREE_C_HEAP_ARRAY(uint, _merge_claims);
     FREE_C_HEAP_ARRAY(uint, _card_table_scan_state);
     FREE_C_HEAP_ARRAY(bool, _region_scan_chunks);
     FREE_C_HEAP_ARRAY(HeapWord*, _scan_top);
@@ -307,6 +313,7 @@ public:
     assert(_collection_set_iter_state == NULL, "Must not be initialized twice");
     _max_reserved_regions = max_reserved_regions;
     _collection_set_iter_state = NEW_C_HEAP_ARRAY(G1RemsetIterState, max_reserved_regions, mtGC);
+    _merge_claims = NEW_C_HEAP_ARRAY(uint, max_reserved_regions, mtGC);
     _card_table_scan_state = NEW_C_HEAP_ARRAY(uint, max_reserved_regions, mtGC);
     _num_total_scan_chunks = max_reserved_regions * _scan_chunks_per_region;
     _region_scan_chunks = NEW_C_HEAP_ARRAY(bool, _num_total_scan_chunks, mtGC);
@@ -334,6 +341,7 @@ public:
 
     for (size_t i = 0; i < _max_reserved_regions; i++) {
       _card_table_scan_state[i] = 0;
+      _merge_claims[i] = 0;
     }
 
     ::memset(_region_scan_chunks, false, _num_total_scan_chunks * sizeof(*_region_scan_chunks));
@@ -437,6 +445,17 @@ public:
     return !Atomic::cmpxchg(&_collection_set_iter_state[region], false, true);
   }
 
+  // Claim the next part of the remembered set of the given collection set
+  // region for merging. Returns a value >= num_parts if all parts have
+  // already been claimed.
+  uint claim_merge_part(uint region, uint num_parts) {
+    assert(region < _max_reserved_regions, "Tried to access invalid region %u", region);
+    if (Atomic::load(&_merge_claims[region]) >= num_parts) {
+      return num_parts;
+    }
+    return Atomic::fetch_and_add(&_merge_claims[region], 1u);
+  }
+
   bool has_cards_to_scan(uint region) {
     assert(region < _max_reserved_regions, "Tried to access invalid region %u", region);
     return _card_table_scan_state[region] < HeapRegion::CardsPerRegion;
@@ -941,12 +960,13 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
     G1RemSetScanState* _scan_state;
     G1CardTable* _ct;
 
-    uint _merged_sparse;
-    uint _merged_fine;
-    uint _merged_coarse;
+    size_t _merged[G1GCPhaseTimes::MergeRSContainersSentinel];
 
     size_t _cards_dirty;
 
+    // The card index of the first card of the region currently iterated over.
+    size_t _region_base_idx;
+
     // Returns if the region contains cards we need to scan. If so, remember that
     // region in the current set of dirty regions.
     bool remember_if_interesting(uint const region_idx) {
@@ -960,52 +980,37 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
     G1MergeCardSetClosure(G1RemSetScanState* scan_state) :
       _scan_state(scan_state),
       _ct(G1CollectedHeap::heap()->card_table()),
-      _merged_sparse(0),
-      _merged_fine(0),
-      _merged_coarse(0),
-      _cards_dirty(0) { }
-
-    void next_coarse_prt(uint const region_idx) {
-      if (!remember_if_interesting(region_idx)) {
-        return;
+      _cards_dirty(0),
+      _region_base_idx(0) {
+      for (uint i = 0; i < G1GCPhaseTimes::MergeRSContainersSentinel; i++) {
+        _merged[i] = 0;
       }
-
-      _merged_coarse++;
-
-      size_t region_base_idx = (size_t)region_idx << HeapRegion::LogCardsPerRegion;
-      _cards_dirty += _ct->mark_region_dirty(region_base_idx, HeapRegion::CardsPerRegion);
-      _scan_state->set_chunk_region_dirty(region_base_idx);
     }
 
-    void next_fine_prt(uint const region_idx, BitMap* bm) {
+    // Called by the card set iteration before visiting the container of the
+    // given region; returns whether its cards should be visited.
+    bool start_iterate(uint const container_type, uint const region_idx) {
+      assert(container_type < G1GCPhaseTimes::MergeRSContainersSentinel, "must be");
       if (!remember_if_interesting(region_idx)) {
-        return;
+        return false;
       }
 
-      _merged_fine++;
-
-      size_t const region_base_idx = (size_t)region_idx << HeapRegion::LogCardsPerRegion;
-      BitMap::idx_t cur = bm->get_next_one_offset(0);
-      while (cur != bm->size()) {
-        _cards_dirty += _ct->mark_clean_as_dirty(region_base_idx + cur);
-        _scan_state->set_chunk_dirty(region_base_idx + cur);
-        cur = bm->get_next_one_offset(cur + 1);
-      }
+      _merged[container_type]++;
+      _region_base_idx = (size_t)region_idx << HeapRegion::LogCardsPerRegion;
+      return true;
     }
 
-    void next_sparse_prt(uint const region_idx, SparsePRTEntry::card_elem_t* cards, uint const num_cards) {
-      if (!remember_if_interesting(region_idx)) {
-        return;
-      }
-
-      _merged_sparse++;
+    void operator()(uint const card_idx) {
+      size_t const card = _region_base_idx + card_idx;
+      _cards_dirty += _ct->mark_clean_as_dirty(card);
+      _scan_state->set_chunk_dirty(card);
+    }
 
-      size_t const region_base_idx = (size_t)region_idx << HeapRegion::LogCardsPerRegion;
-      for (uint i = 0; i < num_cards; i++) {
-        size_t card_idx = region_base_idx + cards[i];
-        _cards_dirty += _ct->mark_clean_as_dirty(card_idx);
-        _scan_state->set_chunk_dirty(card_idx);
-      }
+    void operator()(uint const card_idx, uint const length) {
+      assert(card_idx == 0 && length == HeapRegion::CardsPerRegion,
+             "Only full regions can be merged as ranges, but got %u, %u", card_idx, length);
+      _cards_dirty += _ct->mark_region_dirty(_region_base_idx, length);
+      _scan_state->set_chunk_region_dirty(_region_base_idx);
     }
 
     // Helper to put the remembered set cards for these regions onto the card
@@ -1027,22 +1032,35 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
 
       HeapRegionRemSet* rem_set = r->rem_set();
       if (!rem_set->is_empty()) {
-        rem_set->iterate_prts(*this);
+        rem_set->iterate_for_merge(*this);
       }
     }
 
+    // Merges the remembered set of the given collection set region in parts,
+    // claiming parts until all of them have been claimed. Every worker visits
+    // every collection set region, so that workers share the work on large
+    // remembered sets.
     virtual bool do_heap_region(HeapRegion* r) {
       assert(r->in_collection_set(), "must be");
 
-      _scan_state->add_all_dirty_region(r->hrm_index());
-      dump_rem_set_for_region(r);
+      uint const region_idx = r->hrm_index();
+      HeapRegionRemSet* rem_set = r->rem_set();
+      bool const is_empty = rem_set->is_empty();
+      uint const num_parts = is_empty ? 1 : rem_set->num_merge_parts();
 
+      uint part;
+      while ((part = _scan_state->claim_merge_part(region_idx, num_parts)) < num_parts) {
+        if (part == 0) {
+          _scan_state->add_all_dirty_region(region_idx);
+        }
+        if (!is_empty) {
+          rem_set->iterate_for_merge(*this, part);
+        }
+      }
       return false;
     }
 
-    size_t merged_sparse() const { return _merged_sparse; }
-    size_t merged_fine() const { return _merged_fine; }
-    size_t merged_coarse() const { return _merged_coarse; }
+    size_t merged(uint i) const { return _merged[i]; }
 
     size_t cards_dirty() const { return _cards_dirty; }
   };
@@ -1064,7 +1082,7 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
         return false;
       }
 
-      guarantee(r->rem_set()->occupancy_less_or_equal_than(G1RSetSparseRegionEntries),
+      guarantee(r->rem_set()->occupancy_less_or_equal_than(G1RemSetArrayOfCardsEntries),
                 "Found a not-small remembered set here. This is inconsistent with previous assumptions.");
 
       _cl.dump_rem_set_for_region(r);
@@ -1087,9 +1105,7 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
       return false;
     }
 
-    size_t merged_sparse() const { return _cl.merged_sparse(); }
-    size_t merged_fine() const { return _cl.merged_fine(); }
-    size_t merged_coarse() const { return _cl.merged_coarse(); }
+    size_t merged(uint i) const { return _cl.merged(i); }
 
     size_t cards_dirty() const { return _cl.cards_dirty(); }
   };
@@ -1141,8 +1157,6 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
   BufferNode::Stack _dirty_card_buffers;
   bool _initial_evacuation;
 
-  volatile bool _fast_reclaim_handled;
-
   void apply_closure_to_dirty_card_buffers(G1MergeLogBufferCardsClosure* cl, uint worker_id) {
     G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
     size_t buffer_size = dcqs.buffer_size();
@@ -1158,8 +1172,7 @@ public:
     _hr_claimer(num_workers),
     _scan_state(scan_state),
     _dirty_card_buffers(),
-    _initial_evacuation(initial_evacuation),
-    _fast_reclaim_handled(false)
+    _initial_evacuation(initial_evacuation)
   {
     if (initial_evacuation) {
       G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
@@ -1178,21 +1191,19 @@ public:
                                                      G1GCPhaseTimes::MergeRS :
                                                      G1GCPhaseTimes::OptMergeRS;
 
-    // We schedule flushing the remembered sets of humongous fast reclaim candidates
-    // onto the card table first to allow the remaining parallelized tasks hide it.
+    // Flush the remembered sets of humongous fast reclaim candidates onto the
+    // card table first. All workers share this work, claiming regions.
     if (_initial_evacuation &&
-        p->fast_reclaim_humongous_candidates() > 0 &&
-        !_fast_reclaim_handled &&
-        !Atomic::cmpxchg(&_fast_reclaim_handled, false, true)) {
+        p->fast_reclaim_humongous_candidates() > 0) {
 
       G1GCParPhaseTimesTracker x(p, G1GCPhaseTimes::MergeER, worker_id);
 
       G1FlushHumongousCandidateRemSets cl(_scan_state);
-      g1h->heap_region_iterate(&cl);
+      g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
 
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_sparse(), G1GCPhaseTimes::MergeRSMergedSparse);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_fine(), G1GCPhaseTimes::MergeRSMergedFine);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_coarse(), G1GCPhaseTimes::MergeRSMergedCoarse);
+      for (uint i = 0; i < G1GCPhaseTimes::MergeRSContainersSentinel; i++) {
+        p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged(i), i);
+      }
       p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.cards_dirty(), G1GCPhaseTimes::MergeRSDirtyCards);
     }
 
@@ -1200,11 +1211,11 @@ public:
     {
       G1GCParPhaseTimesTracker x(p, merge_remset_phase, worker_id, _initial_evacuation /* must_record */);
       G1MergeCardSetClosure cl(_scan_state);
-      g1h->collection_set_iterate_increment_from(&cl, &_hr_claimer, worker_id);
+      g1h->collection_set_iterate_increment_from(&cl, worker_id);
 
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_sparse(), G1GCPhaseTimes::MergeRSMergedSparse);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_fine(), G1GCPhaseTimes::MergeRSMergedFine);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_coarse(), G1GCPhaseTimes::MergeRSMergedCoarse);
+      for (uint i = 0; i < G1GCPhaseTimes::MergeRSContainersSentinel; i++) {
+        p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged(i), i);
+      }
       p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.cards_dirty(), G1GCPhaseTimes::MergeRSDirtyCards);
     }
 
@@ -1250,6 +1261,23 @@ void G1RemSet::print_merge_heap_roots_stats() {
                        percent_of(num_visited_cards, total_old_region_cards));
 }
 
+// Counts the parts of the remembered sets of the current collection set
+// increment that can be merged in parallel.
+class G1CountMergePartsClosure : public HeapRegionClosure {
+  size_t _num_parts;
+
+public:
+  G1CountMergePartsClosure() : _num_parts(0) { }
+
+  virtual bool do_heap_region(HeapRegion* r) {
+    HeapRegionRemSet* rem_set = r->rem_set();
+    _num_parts += rem_set->is_empty() ? 1 : rem_set->num_merge_parts();
+    return false;
+  }
+
+  size_t num_parts() const { return _num_parts; }
+};
+
 void G1RemSet::merge_heap_roots(bool initial_evacuation) {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
@@ -1269,8 +1297,14 @@ void G1RemSet::merge_heap_roots(bool initial_evacuation) {
   WorkGang* workers = g1h->workers();
   size_t const increment_length = g1h->collection_set()->increment_length();
 
-  uint const num_workers = initial_evacuation ? workers->active_workers() :
-                                                MIN2(workers->active_workers(), (uint)increment_length);
+  uint num_workers = workers->active_workers();
+  if (!initial_evacuation) {
+    // Optional increments are typically small, but may contain regions with
+    // large remembered sets that several workers can merge in parallel.
+    G1CountMergePartsClosure cl;
+    g1h->collection_set_iterate_increment_from(&cl, 0);
+    num_workers = (uint)MIN2((size_t)num_workers, cl.num_parts());
+  }
 
   {
     G1MergeHeapRootsTask cl(_scan_state, num_workers, initial_evacuation);
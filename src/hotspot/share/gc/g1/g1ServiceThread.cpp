@@ -43,6 +43,8 @@ G1ServiceThread::G1ServiceThread() :
              true,
              Monitor::_safepoint_check_never),
     _last_periodic_gc_attempt_s(os::elapsedTime()),
+    _next_regular_work_s(0.0),
+    _uncommit_due_s(0.0),
     _vtime_accum(0) {
   set_name("G1 Service");
   create_and_start();
@@ -51,11 +53,69 @@ G1ServiceThread::G1ServiceThread() :
 void G1ServiceThread::sleep_before_next_cycle() {
   MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
   if (!should_terminate()) {
-    uintx waitms = G1ConcRefinementServiceIntervalMillis;
+    double wakeup_s = _next_regular_work_s;
+    if (_uncommit_due_s != 0.0) {
+      wakeup_s = MIN2(wakeup_s, _uncommit_due_s);
+    }
+    // Wait at least a millisecond; zero would mean waiting indefinitely.
+    jlong waitms = MAX2((jlong)1, (jlong)ceil((wakeup_s - os::elapsedTime()) * MILLIUNITS));
     ml.wait(waitms);
   }
 }
 
+void G1ServiceThread::schedule_uncommit(double delay_s) {
+  MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+  _uncommit_due_s = os::elapsedTime() + delay_s;
+  ml.notify();
+}
+
+bool G1ServiceThread::claim_uncommit() {
+  MutexLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+  if (_uncommit_due_s == 0.0 || _uncommit_due_s > os::elapsedTime()) {
+    return false;
+  }
+  _uncommit_due_s = 0.0;
+  return true;
+}
+
+// Maximum amount of memory uncommitted at once, and the time budget of a
+// single uncommit step. Keeping both small keeps the Uncommit_lock hold time
+// short for concurrent heap expansion, and lets pauses start promptly.
+static const size_t UncommitChunkBytes = 32 * M;
+static const double UncommitStepBudgetS = 0.010;
+// Delay between uncommit steps while regions remain to be uncommitted.
+static const double UncommitStepDelayS = 0.010;
+
+void G1ServiceThread::uncommit_regions() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  uint const chunk = MAX2((uint)(UncommitChunkBytes / HeapRegion::GrainBytes), 1u);
+
+  double start_s = os::elapsedTime();
+  uint num_uncommitted = 0;
+  {
+    SuspendibleThreadSetJoiner sts;
+    while (g1h->has_uncommittable_regions()) {
+      num_uncommitted += g1h->uncommit_regions(chunk);
+      if (sts.should_yield() || (os::elapsedTime() - start_s) >= UncommitStepBudgetS) {
+        break;
+      }
+    }
+  }
+
+  log_debug(gc, heap)("Concurrent uncommit: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                      byte_size_in_proper_unit(num_uncommitted * HeapRegion::GrainBytes),
+                      proper_unit_for_byte_size(num_uncommitted * HeapRegion::GrainBytes),
+                      num_uncommitted, (os::elapsedTime() - start_s) * MILLIUNITS);
+
+  if (g1h->has_uncommittable_regions()) {
+    MutexLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+    // A shrink in the meantime already rescheduled the uncommit.
+    if (_uncommit_due_s == 0.0) {
+      _uncommit_due_s = os::elapsedTime() + UncommitStepDelayS;
+    }
+  }
+}
+
 bool G1ServiceThread::should_start_periodic_gc() {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
   // If we are currently in a concurrent mark we are going to uncommit memory soon.
@@ -103,16 +163,29 @@ void G1ServiceThread::check_for_periodic_gc(){
 void G1ServiceThread::run_service() {
   double vtime_start = os::elapsedVTime();
 
+  // Pick up regions removed by shrinking before this thread started.
+  if (G1CollectedHeap::heap()->has_uncommittable_regions()) {
+    schedule_uncommit(G1UncommitDelayMillis / 1000.0);
+  }
+
   while (!should_terminate()) {
-    sample_young_list_rs_length();
+    if (os::elapsedTime() >= _next_regular_work_s) {
+      sample_young_list_rs_length();
+
+      if (os::supports_vtime()) {
+        _vtime_accum = (os::elapsedVTime() - vtime_start);
+      } else {
+        _vtime_accum = 0.0;
+      }
+
+      check_for_periodic_gc();
 
-    if (os::supports_vtime()) {
-      _vtime_accum = (os::elapsedVTime() - vtime_start);
-    } else {
-      _vtime_accum = 0.0;
+      _next_regular_work_s = os::elapsedTime() + G1ConcRefinementServiceIntervalMillis / 1000.0;
     }
 
-    check_for_periodic_gc();
+    if (claim_uncommit()) {
+      uncommit_regions();
+    }
 
     sleep_before_next_cycle();
   }
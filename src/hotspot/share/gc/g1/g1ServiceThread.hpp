@@ -32,12 +32,19 @@
 //   - re-assess the validity of the prediction for the
 //     remembered set lengths of the young generation.
 //   - check if a periodic GC should be scheduled.
+//   - uncommit the memory of regions removed from the heap by shrinking.
 class G1ServiceThread: public ConcurrentGCThread {
 private:
   Monitor _monitor;
 
   double _last_periodic_gc_attempt_s;
 
+  // Time at which the next sampling and periodic GC check is due.
+  double _next_regular_work_s;
+  // Time at which uncommitting is due, or 0.0 if none is scheduled.
+  // Guarded by _monitor.
+  double _uncommit_due_s;
+
   double _vtime_accum;  // Accumulated virtual time.
 
   // Sample the current length of remembered sets for young.
@@ -58,6 +65,12 @@ private:
 
   void stop_service();
 
+  // Uncommit regions removed by shrinking in chunks until the time budget
+  // for a single step is used up, rescheduling itself if work remains.
+  void uncommit_regions();
+  // Returns whether uncommitting is due and, if so, unschedules it.
+  bool claim_uncommit();
+
   void sleep_before_next_cycle();
 
   bool should_start_periodic_gc();
@@ -65,6 +78,10 @@ private:
 public:
   G1ServiceThread();
   double vtime_accum() { return _vtime_accum; }
+
+  // Schedule uncommitting regions removed by shrinking after delay_s seconds,
+  // postponing any already scheduled uncommit.
+  void schedule_uncommit(double delay_s);
 };
 
 #endif // SHARE_GC_G1_G1SERVICETHREAD_HPP
@@ -106,12 +106,6 @@
           "Size of an update buffer")                                       \
           range(1, NOT_LP64(32*M) LP64_ONLY(1*G))                           \
                                                                             \
-  product(size_t, G1ConcRefinementYellowZone, 0,                            \
-          "Number of enqueued update buffers that will "                    \
-          "trigger concurrent processing. Will be selected ergonomically "  \
-          "by default.")                                                    \
-          range(0, max_intx)                                                \
-                                                                            \
   product(size_t, G1ConcRefinementRedZone, 0,                               \
           "Maximum number of enqueued update buffers before mutator "       \
           "threads start processing new ones instead of enqueueing them. "  \
@@ -119,8 +113,8 @@
           range(0, max_intx)                                                \
                                                                             \
   product(size_t, G1ConcRefinementGreenZone, 0,                             \
-          "The number of update buffers that are left in the queue by the " \
-          "concurrent processing threads. Will be selected ergonomically "  \
+          "The initial target number of update buffers pending at the "    \
+          "start of a garbage collection. Will be selected ergonomically "  \
           "by default.")                                                    \
           range(0, max_intx)                                                \
                                                                             \
@@ -129,20 +123,13 @@
           "milliseconds to do miscellaneous work.")                         \
           range(0, max_jint)                                                \
                                                                             \
-  product(size_t, G1ConcRefinementThresholdStep, 2,                         \
-          "Each time the rset update queue increases by this amount "       \
-          "activate the next refinement thread if available. "              \
-          "The actual step size will be selected ergonomically by "         \
-          "default, with this value used to determine a lower bound.")      \
-          range(1, SIZE_MAX)                                                \
-                                                                            \
   product(intx, G1RSetUpdatingPauseTimePercent, 10,                         \
           "A target percentage of time that is allowed to be spend on "     \
           "process RS update buffers during the collection pause.")         \
           range(0, 100)                                                     \
                                                                             \
   product(bool, G1UseAdaptiveConcRefinement, true,                          \
-          "Select green, yellow and red zones adaptively to meet the "      \
+          "Select the target number of pending cards adaptively to meet "   \
           "the pause requirements.")                                        \
                                                                             \
   product(size_t, G1ConcRSLogCacheSize, 10,                                 \
@@ -153,26 +140,22 @@
           "The threshold that defines (>=) a hot card.")                    \
           range(0, max_jubyte)                                              \
                                                                             \
-  develop(intx, G1RSetRegionEntriesBase, 256,                               \
-          "Max number of regions in a fine-grain table per MB.")            \
-          range(1, max_jint/wordSize)                                       \
-                                                                            \
-  product(intx, G1RSetRegionEntries, 0,                                     \
-          "Max number of regions for which we keep bitmaps."                \
-          "Will be set ergonomically by default")                           \
-          range(0, max_jint/wordSize)                                       \
-          constraint(G1RSetRegionEntriesConstraintFunc,AfterErgo)           \
+  develop(uint, G1RemSetArrayOfCardsEntriesBase, 4,                        \
+          "Maximum number of entries per region in the Array of Cards "     \
+          "card set container per MB of a heap region.")                    \
+          range(1, 65536)                                                   \
                                                                             \
-  develop(intx, G1RSetSparseRegionEntriesBase, 4,                           \
-          "Max number of entries per region in a sparse table "             \
-          "per MB.")                                                        \
-          range(1, max_jint/wordSize)                                       \
+  product(uint, G1RemSetArrayOfCardsEntries, 0,                             \
+          "Maximum number of entries per card set container of the Array "  \
+          "of Cards type. Will be set ergonomically by default.")           \
+          range(0, 65535)                                                   \
+          constraint(G1RemSetArrayOfCardsEntriesConstraintFunc,AfterErgo)   \
                                                                             \
-  product(intx, G1RSetSparseRegionEntries, 0,                               \
-          "Max number of entries per region in a sparse table."             \
-          "Will be set ergonomically by default.")                          \
-          range(0, max_jint/wordSize)                                       \
-          constraint(G1RSetSparseRegionEntriesConstraintFunc,AfterErgo)     \
+  product(uint, G1RemSetCoarsenBitmapToFullPercent, 90, EXPERIMENTAL,       \
+          "Percentage of cards of a region that must be recorded in a "     \
+          "BitMap card set container before the container is changed to "  \
+          "cover the whole region.")                                        \
+          range(1, 100)                                                     \
                                                                             \
   develop(intx, G1MaxVerifyFailures, -1,                                    \
           "The maximum number of verification failures to print.  "         \
@@ -236,6 +219,11 @@
   product(bool, G1EagerReclaimHumongousObjects, true, EXPERIMENTAL,         \
           "Try to reclaim dead large objects at every young GC.")           \
                                                                             \
+  product(bool, G1ReleaseHumongousTails, false, EXPERIMENTAL,               \
+          "Release the memory backing the unused tail of the last region "  \
+          "of humongous objects to the operating system. Only applies to "  \
+          "heaps using small pages.")                                       \
+                                                                            \
   product(bool, G1EagerReclaimHumongousObjectsWithStaleRefs, true, EXPERIMENTAL, \
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
@@ -304,6 +292,12 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(uintx, G1UncommitDelayMillis, 100, EXPERIMENTAL,                  \
+          "Number of milliseconds after shrinking the heap before the "     \
+          "memory of the removed regions is uncommitted concurrently, "     \
+          "giving the application a chance to reuse it cheaply.")           \
+          range(0, max_jint)                                                \
+                                                                            \
   product(uintx, G1YoungExpansionBufferPercent, 10, EXPERIMENTAL,           \
                "When heterogenous heap is enabled by AllocateOldGenAt "     \
                "option, after every GC, young gen is re-sized which "       \
@@ -311,7 +305,16 @@
                "reduce these calls, we keep a buffer of extra regions to "  \
                "absorb small changes in young gen length. This flag takes " \
                "the buffer size as an percentage of young gen length")      \
-               range(0, 100)
+               range(0, 100)                                                \
+                                                                            \
+  product(uintx, G1HeteroHotOldDramPercent, 0, EXPERIMENTAL,                \
+               "When heterogenous heap is enabled by AllocateOldGenAt "     \
+               "option, mixed collections whose old regions are more "      \
+               "referenced than the remaining candidates copy their "       \
+               "survivors into dram instead of nv-dimm. This flag limits "  \
+               "the old regions kept in dram as a percentage of the "       \
+               "maximum heap regions. 0 disables hot region placement.")    \
+               range(0, 50)
 
 // end of GC_G1_FLAGS
 
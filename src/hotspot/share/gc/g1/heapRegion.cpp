@@ -123,6 +123,8 @@ void HeapRegion::hr_clear(bool clear_space) {
          "we should have already filtered out humongous regions");
   assert(!in_collection_set(),
          "Should not clear heap region %u in the collection set", hrm_index());
+  assert(!has_pinned_objects(),
+         "Should not clear heap region %u with %u pinned objects", hrm_index(), pinned_object_count());
 
   clear_young_index_in_cset();
   clear_index_in_opt_cset();
@@ -139,6 +141,7 @@ void HeapRegion::hr_clear(bool clear_space) {
 
   _evacuation_failed = false;
   _gc_efficiency = 0.0;
+  _predicted_copy_time_ms = 0.0;
 }
 
 void HeapRegion::clear_cardtable() {
@@ -154,7 +157,9 @@ void HeapRegion::calc_gc_efficiency() {
   // Retrieve a prediction of the elapsed time for this region for
   // a mixed gc because the region will only be evacuated during a
   // mixed gc.
-  double region_elapsed_time_ms = policy->predict_region_total_time_ms(this, false /* for_young_gc */);
+  _predicted_copy_time_ms = policy->predict_region_copy_time_ms(this);
+  double region_elapsed_time_ms = _predicted_copy_time_ms +
+                                  policy->predict_region_non_copy_time_ms(this, false /* for_young_gc */);
   _gc_efficiency = (double) reclaimable_bytes() / region_elapsed_time_ms;
 }
 
@@ -246,6 +251,7 @@ HeapRegion::HeapRegion(uint hrm_index,
   _type(),
   _humongous_start_region(NULL),
   _evacuation_failed(false),
+  _pinned_object_count(0),
   _index_in_opt_cset(InvalidCSetIndex),
   _next(NULL), _prev(NULL),
 #ifdef ASSERT
@@ -255,6 +261,7 @@ HeapRegion::HeapRegion(uint hrm_index,
   _prev_marked_bytes(0), _next_marked_bytes(0),
   _young_index_in_cset(-1),
   _surv_rate_group(NULL), _age_index(G1SurvRateGroup::InvalidAgeIndex), _gc_efficiency(0.0),
+  _predicted_copy_time_ms(0.0),
   _node_index(G1NUMA::UnknownNodeIndex)
 {
   assert(Universe::on_page_boundary(mr.start()) && Universe::on_page_boundary(mr.end()),
@@ -313,6 +320,9 @@ void HeapRegion::note_self_forwarding_removal_end(size_t marked_bytes) {
          "marked: " SIZE_FORMAT " used: " SIZE_FORMAT, marked_bytes, used());
   _prev_top_at_mark_start = top();
   _prev_marked_bytes = marked_bytes;
+  // All blocks have been recorded in the BOT explicitly; allocation based
+  // updates continue from top.
+  _bot_part.set_threshold(top());
 }
 
 // Code roots support
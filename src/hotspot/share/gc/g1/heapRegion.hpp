@@ -33,6 +33,7 @@
 #include "gc/shared/ageTable.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "gc/shared/verifyOption.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "utilities/macros.hpp"
 
@@ -191,6 +192,11 @@ public:
   template<typename ApplyToMarkedClosure>
   inline void apply_to_marked_objects(G1CMBitMap* bitmap, ApplyToMarkedClosure* closure);
 
+  // Record the given block in the BOT; see G1BlockOffsetTablePart::update_for_block().
+  void update_bot_for_block(HeapWord* start, HeapWord* end) {
+    _bot_part.update_for_block(start, end);
+  }
+
   void reset_bot() {
     _bot_part.reset_bot();
   }
@@ -210,6 +216,10 @@ private:
   // True iff an attempt to evacuate an object in the region failed.
   bool _evacuation_failed;
 
+  // Number of objects in this region currently pinned by JNI critical
+  // sections. Objects in regions with pinned objects are never moved.
+  volatile uint _pinned_object_count;
+
   static const uint InvalidCSetIndex = UINT_MAX;
 
   // The index in the optional regions array, if this region
@@ -253,6 +263,10 @@ private:
 
   // The calculated GC efficiency of the region.
   double _gc_efficiency;
+  // The predicted time to copy the live objects of the region, recorded
+  // together with the GC efficiency. Live data of a collection set candidate
+  // does not change after marking, so this part of the cost stays valid.
+  double _predicted_copy_time_ms;
 
   uint _node_index;
 
@@ -509,6 +523,13 @@ public:
     }
   }
 
+  // Pinned object support. Objects are pinned and unpinned by mutator threads
+  // while the region is in use, so these must be safe to call concurrently.
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+  uint pinned_object_count() const { return Atomic::load(&_pinned_object_count); }
+  bool has_pinned_objects() const { return pinned_object_count() > 0; }
+
   // Notify the region that we are about to start processing
   // self-forwarded objects during evac failure handling.
   void note_self_forwarding_removal_start(bool during_concurrent_start,
@@ -528,6 +549,7 @@ public:
 
   void calc_gc_efficiency(void);
   double gc_efficiency() const { return _gc_efficiency;}
+  double predicted_copy_time_ms() const { return _predicted_copy_time_ms; }
 
   uint  young_index_in_cset() const { return _young_index_in_cset; }
   void clear_young_index_in_cset() { _young_index_in_cset = 0; }
@@ -418,4 +418,13 @@ inline void HeapRegion::record_surv_words_in_group(size_t words_survived) {
   _surv_rate_group->record_surviving_words(age_in_group, words_survived);
 }
 
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "Region %u does not have pinned objects", hrm_index());
+  Atomic::dec(&_pinned_object_count, memory_order_relaxed);
+}
+
 #endif // SHARE_GC_G1_HEAPREGION_INLINE_HPP
@@ -35,6 +35,7 @@
 #include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -69,6 +70,8 @@ HeapRegionManager::HeapRegionManager() :
   _cardtable_mapper(NULL),
   _card_counts_mapper(NULL),
   _available_map(mtGC),
+  _inactive_map(mtGC),
+  _num_inactive(0),
   _num_committed(0),
   _allocated_heapregions_length(0),
   _regions(), _heap_mapper(NULL),
@@ -105,6 +108,7 @@ void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
   _regions.initialize(heap_storage->reserved(), HeapRegion::GrainBytes);
 
   _available_map.initialize(_regions.length());
+  _inactive_map.initialize(_regions.length());
 }
 
 bool HeapRegionManager::is_available(uint region) const {
@@ -187,8 +191,27 @@ void HeapRegionManager::commit_regions(uint index, size_t num_regions, WorkGang*
   guarantee(num_regions <= available(),
             "Cannot commit more than the maximum amount of regions");
 
+  MutexLocker ml(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
   _num_committed += (uint)num_regions;
 
+  // Inactive regions are still committed and only need to be reactivated.
+  uint const end = index + (uint)num_regions;
+  uint cur = index;
+  while (cur < end) {
+    bool const inactive = _inactive_map.at(cur);
+    uint const next = inactive ? (uint)_inactive_map.get_next_zero_offset(cur, end) :
+                                 (uint)_inactive_map.get_next_one_offset(cur, end);
+    if (inactive) {
+      reactivate_regions(cur, next - cur);
+    } else {
+      commit_memory(cur, next - cur, pretouch_gang);
+    }
+    cur = next;
+  }
+}
+
+void HeapRegionManager::commit_memory(uint index, size_t num_regions, WorkGang* pretouch_gang) {
   _heap_mapper->commit_regions(index, num_regions, pretouch_gang);
 
   // Also commit auxiliary data
@@ -201,10 +224,83 @@ void HeapRegionManager::commit_regions(uint index, size_t num_regions, WorkGang*
   _card_counts_mapper->commit_regions(index, num_regions, pretouch_gang);
 }
 
+void HeapRegionManager::reactivate_regions(uint start, size_t num_regions) {
+  assert_lock_strong(Uncommit_lock);
+  _inactive_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+  Atomic::sub(&_num_inactive, (uint)num_regions);
+
+  // The memory stayed committed, but the data structures covering these
+  // regions must be reinitialized as if newly committed.
+  _heap_mapper->signal_mapping_changed(start, num_regions);
+  _prev_bitmap_mapper->signal_mapping_changed(start, num_regions);
+  _next_bitmap_mapper->signal_mapping_changed(start, num_regions);
+  _bot_mapper->signal_mapping_changed(start, num_regions);
+  _cardtable_mapper->signal_mapping_changed(start, num_regions);
+  _card_counts_mapper->signal_mapping_changed(start, num_regions);
+}
+
+void HeapRegionManager::deactivate_regions(uint start, size_t num_regions) {
+  guarantee(num_regions >= 1, "Need to specify at least one region to deactivate, tried to deactivate zero regions at %u", start);
+  guarantee(_num_committed >= num_regions, "pre-condition");
+
+  MutexLocker ml(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  _num_committed -= (uint)num_regions;
+
+  _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+  _inactive_map.par_set_range(start, start + num_regions, BitMap::unknown_range);
+  Atomic::add(&_num_inactive, (uint)num_regions);
+}
+
+uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
+  assert(limit > 0, "Need to specify at least one region to uncommit");
+
+  MutexLocker ml(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  // Uncommit from the top of the heap, which is where shrinking removes
+  // regions from.
+  uint uncommitted = 0;
+  uint end = reserved_length();
+  while (uncommitted < limit && Atomic::load(&_num_inactive) > 0) {
+    // Find the last inactive region below end.
+    uint last = end;
+    while (last > 0 && !_inactive_map.at(last - 1)) {
+      last--;
+    }
+    if (last == 0) {
+      break;
+    }
+    uint first = last - 1;
+    while (first > 0 && _inactive_map.at(first - 1) && (last - first) < (limit - uncommitted)) {
+      first--;
+    }
+
+    uint const num_regions = last - first;
+    _inactive_map.par_clear_range(first, last, BitMap::unknown_range);
+    Atomic::sub(&_num_inactive, num_regions);
+    uncommit_memory(first, num_regions);
+
+    uncommitted += num_regions;
+    end = first;
+  }
+  return uncommitted;
+}
+
 void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   guarantee(num_regions >= 1, "Need to specify at least one region to uncommit, tried to uncommit zero regions at %u", start);
   guarantee(_num_committed >= num_regions, "pre-condition");
 
+  MutexLocker ml(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  _num_committed -= (uint)num_regions;
+
+  _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+  uncommit_memory(start, num_regions);
+}
+
+void HeapRegionManager::uncommit_memory(uint start, size_t num_regions) {
+  assert_lock_strong(Uncommit_lock);
+
   // Reset node index to distinguish with committed regions.
   for (uint i = start; i < start + num_regions; i++) {
     at(i)->set_node_index(G1NUMA::UnknownNodeIndex);
@@ -218,9 +314,6 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
     }
   }
 
-  _num_committed -= (uint)num_regions;
-
-  _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
   _heap_mapper->uncommit_regions(start, num_regions);
 
   // Also uncommit auxiliary data
@@ -586,7 +679,7 @@ void HeapRegionManager::shrink_at(uint index, size_t num_regions) {
     assert(at(i)->is_free(), "Expected free region at index %u", i);
   }
 #endif
-  uncommit_regions(index, num_regions);
+  deactivate_regions(index, num_regions);
 }
 
 uint HeapRegionManager::find_empty_from_idx_reverse(uint start_idx, uint* res_idx) const {
@@ -659,6 +752,15 @@ void HeapRegionManager::verify() {
   }
 
   guarantee(num_committed == _num_committed, "Found %u committed regions, but should be %u", num_committed, _num_committed);
+
+  {
+    MutexLocker ml(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+    guarantee(_inactive_map.count_one_bits() == _num_inactive,
+              "Found " SIZE_FORMAT " inactive regions, but should be %u", _inactive_map.count_one_bits(), _num_inactive);
+    for (uint i = 0; i < reserved_length(); i++) {
+      guarantee(!_inactive_map.at(i) || !is_available(i), "Inactive region %u must not be available", i);
+    }
+  }
   _free_list.verify();
 }
 
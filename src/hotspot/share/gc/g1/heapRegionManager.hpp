@@ -29,6 +29,7 @@
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "gc/g1/heapRegionSet.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "services/memoryUsage.hpp"
 
 class HeapRegion;
@@ -95,6 +96,16 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // for allocation.
   CHeapBitMap _available_map;
 
+  // Each bit in this bitmap indicates that the corresponding region has been
+  // removed from the heap by shrinking, but its memory is still committed.
+  // The memory of these inactive regions is uncommitted concurrently by the
+  // G1ServiceThread unless the regions are reused before that. Protected by
+  // the Uncommit_lock.
+  CHeapBitMap _inactive_map;
+
+  // The number of inactive regions.
+  volatile uint _num_inactive;
+
   // The number of regions committed in the heap.
   uint _num_committed;
 
@@ -107,9 +118,21 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Pass down commit calls to the VirtualSpace.
   void commit_regions(uint index, size_t num_regions = 1, WorkGang* pretouch_gang = NULL);
 
+  // Commit the memory of the given regions.
+  void commit_memory(uint index, size_t num_regions, WorkGang* pretouch_gang);
+
   // Notify other data structures about change in the heap layout.
   void update_committed_space(HeapWord* old_end, HeapWord* new_end);
 
+  // Uncommit the memory of the given regions, which must not be available.
+  void uncommit_memory(uint start, size_t num_regions);
+
+  // Make the given regions inactive. Their memory is uncommitted later by
+  // uncommit_inactive_regions().
+  void deactivate_regions(uint start, size_t num_regions);
+  // Reuse the given inactive regions, reinitializing their auxiliary data.
+  void reactivate_regions(uint start, size_t num_regions);
+
   // Find a contiguous set of empty or uncommitted regions of length num_regions and return
   // the index of the first region or G1_NO_HRM_INDEX if the search was unsuccessful.
   // Start and end defines the range to seek in, policy is first-fit.
@@ -294,9 +317,17 @@ public:
   virtual uint shrink_by(uint num_regions_to_remove);
 
   // Uncommit a number of regions starting at the specified index, which must be available,
-  // empty, and free.
+  // empty, and free. The memory of these regions is uncommitted concurrently; see
+  // uncommit_inactive_regions().
   void shrink_at(uint index, size_t num_regions);
 
+  // Returns whether there are inactive regions whose memory may be uncommitted.
+  bool has_inactive_regions() const { return Atomic::load(&_num_inactive) > 0; }
+
+  // Uncommit the memory of at most limit inactive regions. Returns the number
+  // of regions uncommitted. Called concurrently by the G1ServiceThread.
+  uint uncommit_inactive_regions(uint limit);
+
   virtual void verify();
 
   // Do some sanity checking.
@@ -53,6 +53,8 @@ void HeterogeneousHeapRegionManager::initialize(G1RegionToSpaceMapper* heap_stor
   // This allows regions to be un-committed while concurrent-marking threads are accessing the bitmap concurrently.
   _prev_bitmap_mapper->commit_and_set_special();
   _next_bitmap_mapper->commit_and_set_special();
+
+  _max_old_in_dram = (uint)((size_t)_max_regions * G1HeteroHotOldDramPercent / 100);
 }
 
 // expand_by() is called to grow the heap. We grow into nvdimm now.
@@ -274,6 +276,13 @@ HeapRegion* HeterogeneousHeapRegionManager::allocate_free_region(HeapRegionType
     }
   }
 
+  if (type.is_old() && _old_gc_alloc_in_dram) {
+    HeapRegion* hr = allocate_old_in_dram();
+    if (hr != NULL) {
+      return hr;
+    }
+  }
+
   // old and humongous regions are allocated from nv-dimm; eden and survivor regions are allocated from dram
   // assumption: dram regions take higher indexes
   bool from_nvdimm = (type.is_old() || type.is_humongous()) ? true : false;
@@ -528,6 +537,43 @@ HeapRegion* HeterogeneousHeapRegionManager::borrow_old_region_for_gc() {
   return hr;
 }
 
+// The free dram regions are provisioned for eden and survivors, so a hot old region takes the place of a free nv-dimm
+// region instead. Total committed regions stay the same.
+HeapRegion* HeterogeneousHeapRegionManager::allocate_old_in_dram() {
+  if (_num_old_in_dram >= _max_old_in_dram) {
+    _old_gc_alloc_in_dram = false;
+    return NULL;
+  }
+  if (shrink_nvdimm(1) != 1) {
+    return NULL;
+  }
+  uint ret = expand_dram(1, NULL);
+  assert(ret == 1, "We should be able to commit one region");
+  // dram regions take higher indexes
+  HeapRegion* hr = _free_list.remove_region(false /*from_head*/);
+  assert(hr != NULL && is_in_dram(hr->hrm_index()), "allocated region should be in dram");
+  _num_old_in_dram++;
+  return hr;
+}
+
+uint HeterogeneousHeapRegionManager::num_old_in_dram() const {
+  uint count = 0;
+  for (uint i = start_index_of_dram(); i <= end_index_of_dram(); i++) {
+    if (is_available(i) && at(i)->is_old()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void HeterogeneousHeapRegionManager::set_old_gc_alloc_in_dram(bool value) {
+  if (value) {
+    _num_old_in_dram = num_old_in_dram();
+    value = _num_old_in_dram < _max_old_in_dram;
+  }
+  _old_gc_alloc_in_dram = value;
+}
+
 bool HeterogeneousHeapRegionManager::has_borrowed_regions() const {
   return _no_borrowed_regions > 0;
 }
@@ -37,6 +37,8 @@
 //      3a. If more dram regions are needed (young generation expansion), corresponding number of regions in nv-dimm are un-committed.
 //      3b. When old generation or humongous set grows, and new regions need to be committed to nv-dimm, corresponding number of regions
 //            are un-committed in dram.
+// With G1HeteroHotOldDramPercent, a mixed collection whose old regions are hot may copy their survivors into old regions
+// in dram, up to that many old regions; such regions go back to nv-dimm when a later mixed collection that is not hot evacuates them.
 class HeterogeneousHeapRegionManager : public HeapRegionManager {
   const uint _max_regions;
   uint _max_dram_regions;
@@ -44,6 +46,9 @@ class HeterogeneousHeapRegionManager : public HeapRegionManager {
   uint _start_index_of_nvdimm;
   uint _total_commited_before_full_gc;
   uint _no_borrowed_regions;
+  uint _max_old_in_dram;
+  uint _num_old_in_dram;
+  bool _old_gc_alloc_in_dram;
 
   uint total_regions_committed() const;
   uint num_committed_dram() const;
@@ -80,6 +85,11 @@ class HeterogeneousHeapRegionManager : public HeapRegionManager {
   // It borrows a region from the set of unavailable regions in nv-dimm for GC purpose.
   HeapRegion* borrow_old_region_for_gc();
 
+  // Allocate an old region for GC in dram, in exchange for a free nv-dimm region.
+  HeapRegion* allocate_old_in_dram();
+
+  uint num_old_in_dram() const;
+
   uint free_list_dram_length() const;
   uint free_list_nvdimm_length() const;
 
@@ -92,7 +102,8 @@ public:
   // Empty constructor, we'll initialize it with the initialize() method.
   HeterogeneousHeapRegionManager(uint num_regions) : _max_regions(num_regions), _max_dram_regions(0),
                                                      _max_nvdimm_regions(0), _start_index_of_nvdimm(0),
-                                                     _total_commited_before_full_gc(0), _no_borrowed_regions(0)
+                                                     _total_commited_before_full_gc(0), _no_borrowed_regions(0),
+                                                     _max_old_in_dram(0), _num_old_in_dram(0), _old_gc_alloc_in_dram(false)
   {}
 
   static HeterogeneousHeapRegionManager* manager();
@@ -115,6 +126,9 @@ public:
   // Adjust dram_set to provision 'expected_num_regions' regions.
   void adjust_dram_regions(uint expected_num_regions, WorkGang* pretouch_workers);
 
+  // Place old regions allocated by the current collection pause in dram (while within budget) or in nv-dimm.
+  void set_old_gc_alloc_in_dram(bool value);
+
   // Prepare heap regions before and after full collection.
   void prepare_for_full_collection_start();
   void prepare_for_full_collection_end();
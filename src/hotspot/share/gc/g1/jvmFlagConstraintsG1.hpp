@@ -31,8 +31,7 @@
 #define G1_GC_CONSTRAINTS(f)                          \
                                                       \
   /* G1 Flag Constraints */                           \
-  f(intx,   G1RSetRegionEntriesConstraintFunc)        \
-  f(intx,   G1RSetSparseRegionEntriesConstraintFunc)  \
+  f(uint,   G1RemSetArrayOfCardsEntriesConstraintFunc) \
   f(size_t, G1HeapRegionSizeConstraintFunc)           \
   f(uintx,  G1NewSizePercentConstraintFunc)           \
   f(uintx,  G1MaxNewSizePercentConstraintFunc)        \
@@ -81,6 +81,13 @@ void ParallelArguments::initialize() {
     }
   }
 
+  // Reference processing scales its worker count by ReferencesPerThread,
+  // so enabling parallel processing costs little when there are few
+  // discovered references, and shortens pauses when there are many.
+  if (FLAG_IS_DEFAULT(ParallelRefProcEnabled) && ParallelGCThreads > 1) {
+    FLAG_SET_DEFAULT(ParallelRefProcEnabled, true);
+  }
+
   // Par compact uses lower default values since they are treated as
   // minimums.  These are different defaults because of the different
   // interpretation and are not ergonomically set.
@@ -59,7 +59,12 @@
           "Delay in scheduling GC workers (in milliseconds)")               \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, PSNUMALocalPromotion, false, EXPERIMENTAL,                  \
+          "With UseNUMA, promote objects into larger old gen LABs that "    \
+          "are placed on the NUMA node of the promoting GC thread, "       \
+          "instead of the interleaved old gen memory")
 
 // end of GC_PARALLEL_FLAGS
 
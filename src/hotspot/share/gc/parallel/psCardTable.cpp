@@ -186,6 +186,13 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     if (worker_end_card > end_card)
       worker_end_card = end_card;
 
+    // Start fetching the cards of our stripe in the next slice.
+    CardValue* next_start_card = worker_start_card + slice_width;
+    CardValue* next_end_card = MIN2(next_start_card + ssize, end_card);
+    for (CardValue* p = next_start_card; p < next_end_card; p += DEFAULT_CACHE_LINE_SIZE) {
+      Prefetch::read(p, 0);
+    }
+
     // We do not want to scan objects more than once. In order to accomplish
     // this, we assert that any object with an object head inside our 'slice'
     // belongs to us. We may need to extend the range of scanned cards if the
@@ -205,6 +212,25 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     }
 #endif
 
+    // If all cards of the slice are clean, only the tail of the last object
+    // starting in the slice may have unclean cards, in the next slice.  Skip the
+    // slice without any other object start lookups if that tail is clean too.
+    if (find_first_card_not_equal(worker_start_card, worker_end_card, clean_card) == worker_end_card) {
+      if (slice_end >= (HeapWord*)sp_top) {
+        continue;
+      }
+      HeapWord* last_object = start_array->object_start(slice_end - 1);
+      if (last_object < slice_start) {
+        // No object starts within the slice.
+        continue;
+      }
+      CardValue* tail_end_card = MIN2(byte_for(last_object + oop(last_object)->size()) + 1, end_card);
+      if (tail_end_card <= worker_end_card ||
+          find_first_card_not_equal(worker_end_card, tail_end_card, clean_card) == tail_end_card) {
+        continue;
+      }
+    }
+
     // If there are not objects starting within the chunk, skip it.
     if (!start_array->object_starts_in_range(slice_start, slice_end)) {
       continue;
@@ -242,16 +268,12 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     CardValue* current_card = worker_start_card;
     while (current_card < worker_end_card) {
       // Find an unclean card.
-      while (current_card < worker_end_card && card_is_clean(*current_card)) {
-        current_card++;
-      }
+      current_card = find_first_card_not_equal(current_card, worker_end_card, clean_card);
       CardValue* first_unclean_card = current_card;
 
       // Find the end of a run of contiguous unclean cards
       while (current_card < worker_end_card && !card_is_clean(*current_card)) {
-        while (current_card < worker_end_card && !card_is_clean(*current_card)) {
-          current_card++;
-        }
+        current_card = find_first_card_equal(current_card, worker_end_card, clean_card);
 
         if (current_card < worker_end_card) {
           // Some objects may be large enough to span several cards. If such
@@ -307,8 +329,8 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
         if (following_clean_card >= worker_end_card-1)
           following_clean_card = worker_end_card-1;
 
-        while (first_unclean_card < following_clean_card) {
-          *first_unclean_card++ = clean_card;
+        if (first_unclean_card < following_clean_card) {
+          fill_cards(first_unclean_card, following_clean_card, clean_card);
         }
 
         const int interval = PrefetchScanIntervalInBytes;
@@ -629,7 +651,9 @@ void PSCardTable::resize_update_card_table_entries(int changed_region,
   CardValue* end = byte_for(original_covered.start());
   // If _whole_heap starts at the original covered regions start,
   // this loop will not execute.
-  while (entry < end) { *entry++ = clean_card; }
+  if (entry < end) {
+    fill_cards(entry, end, clean_card);
+  }
 }
 
 void PSCardTable::resize_update_covered_table(int changed_region,
@@ -707,6 +707,10 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   size_t cur_region = addr_to_region_idx(source_beg);
   const size_t end_region = addr_to_region_idx(region_align_up(source_end));
 
+  if (summarize_par(split_info, cur_region, end_region, target_beg, target_end, target_next)) {
+    return true;
+  }
+
   HeapWord *dest_addr = target_beg;
   while (cur_region < end_region) {
     // The destination must be set even if the region has no data.
@@ -724,51 +728,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (region_offset(dest_addr) == 0) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+      summarize_region(split_info, cur_region, dest_addr);
       dest_addr += words;
     }
 
@@ -779,6 +739,172 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+void ParallelCompactData::summarize_region(const SplitInfo& split_info,
+                                           size_t cur_region,
+                                           HeapWord* dest_addr)
+{
+  const size_t words = _region_data[cur_region].data_size();
+
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (region_offset(dest_addr) == 0) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+  _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+}
+
+HeapWord* ParallelCompactData::summarize_regions(const SplitInfo& split_info,
+                                                 size_t beg_region,
+                                                 size_t end_region,
+                                                 HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    // The destination must be set even if the region has no data.
+    _region_data[cur_region].set_destination(dest_addr);
+
+    size_t words = _region_data[cur_region].data_size();
+    if (words > 0) {
+      summarize_region(split_info, cur_region, dest_addr);
+      dest_addr += words;
+    }
+  }
+
+  return dest_addr;
+}
+
+class ParallelCompactSummaryTask : public AbstractGangTask {
+  ParallelCompactData& _sd;
+  const SplitInfo&     _split_info;
+  const size_t         _beg_region;
+  const size_t         _end_region;
+  const size_t         _chunk_regions;
+  const uint           _nchunks;
+  size_t* const        _chunk_words;
+  HeapWord** const     _chunk_dest;
+  volatile uint        _claimed;
+
+public:
+  ParallelCompactSummaryTask(ParallelCompactData& sd, const SplitInfo& split_info,
+                             size_t beg_region, size_t end_region, uint nchunks,
+                             size_t* chunk_words, HeapWord** chunk_dest) :
+      AbstractGangTask(chunk_dest == NULL ? "Summary Count Task" : "Summary Task"),
+      _sd(sd),
+      _split_info(split_info),
+      _beg_region(beg_region),
+      _end_region(end_region),
+      _chunk_regions((end_region - beg_region + nchunks - 1) / nchunks),
+      _nchunks(nchunks),
+      _chunk_words(chunk_words),
+      _chunk_dest(chunk_dest),
+      _claimed(0) {}
+
+  virtual void work(uint worker_id) {
+    for (uint chunk = Atomic::fetch_and_add(&_claimed, 1u);
+         chunk < _nchunks;
+         chunk = Atomic::fetch_and_add(&_claimed, 1u)) {
+      const size_t beg = MIN2(_beg_region + chunk * _chunk_regions, _end_region);
+      const size_t end = MIN2(beg + _chunk_regions, _end_region);
+      if (_chunk_dest == NULL) {
+        // First pass, count the live words of the chunk
+        size_t words = 0;
+        for (size_t cur = beg; cur < end; ++cur) {
+          words += _sd.region(cur)->data_size();
+        }
+        _chunk_words[chunk] = words;
+      } else {
+        // Second pass, the destination of the chunk is known
+        _sd.summarize_regions(_split_info, beg, end, _chunk_dest[chunk]);
+      }
+    }
+  }
+};
+
+bool ParallelCompactData::summarize_par(const SplitInfo& split_info,
+                                        size_t beg_region, size_t end_region,
+                                        HeapWord* target_beg, HeapWord* target_end,
+                                        HeapWord** target_next)
+{
+  // Regions are summarized by a single thread below this count per worker
+  const size_t min_regions_per_worker = 256;
+
+  WorkGang& workers = ParallelScavengeHeap::heap()->workers();
+  const uint active_workers = workers.active_workers();
+  const size_t region_count = end_region - beg_region;
+  if (active_workers <= 1 ||
+      region_count < min_regions_per_worker * 2 ||
+      split_info.is_valid()) {
+    return false;
+  }
+
+  // Over-partition, to balance regions with different amounts of live data
+  const uint nworkers = (uint)MIN2((size_t)active_workers, region_count / min_regions_per_worker);
+  const uint nchunks = nworkers * 4;
+  size_t* const chunk_words = NEW_C_HEAP_ARRAY(size_t, nchunks, mtGC);
+  HeapWord** const chunk_dest = NEW_C_HEAP_ARRAY(HeapWord*, nchunks, mtGC);
+
+  ParallelCompactSummaryTask count_task(*this, split_info, beg_region, end_region,
+                                        nchunks, chunk_words, NULL);
+  workers.run_task(&count_task, nworkers);
+
+  // Prefix sum over the chunks gives the destination of each chunk
+  HeapWord* dest_addr = target_beg;
+  for (uint chunk = 0; chunk < nchunks; chunk++) {
+    chunk_dest[chunk] = dest_addr;
+    dest_addr += chunk_words[chunk];
+  }
+
+  const bool fits = dest_addr <= target_end;
+  if (fits) {
+    ParallelCompactSummaryTask task(*this, split_info, beg_region, end_region,
+                                    nchunks, chunk_words, chunk_dest);
+    workers.run_task(&task, nworkers);
+    *target_next = dest_addr;
+  }
+
+  FREE_C_HEAP_ARRAY(size_t, chunk_words);
+  FREE_C_HEAP_ARRAY(HeapWord*, chunk_dest);
+  return fits;
+}
+
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) {
   assert(addr != NULL, "Should detect NULL oop earlier");
   assert(ParallelScavengeHeap::heap()->is_in(addr), "not in heap");
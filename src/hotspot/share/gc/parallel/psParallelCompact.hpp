@@ -441,6 +441,14 @@ public:
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Compute the destination of each region in [beg_region, end_region) when
+  // the data of beg_region is copied to dest_addr, without checking for the
+  // end of the target space.  Returns the destination following the last
+  // region.  Used by the parallel summary, on disjoint ranges of regions.
+  HeapWord* summarize_regions(const SplitInfo& split_info,
+                              size_t beg_region, size_t end_region,
+                              HeapWord* dest_addr);
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
@@ -492,6 +500,19 @@ public:
 #endif  // #ifdef ASSERT
 
 private:
+  // Compute the destination data of a single region, whose data is copied to
+  // dest_addr.
+  void summarize_region(const SplitInfo& split_info, size_t cur_region,
+                        HeapWord* dest_addr);
+
+  // Summarize [beg_region, end_region) in parallel, if there are enough regions
+  // and all the data fits in the target.  Returns false if the caller should
+  // summarize serially.
+  bool summarize_par(const SplitInfo& split_info,
+                     size_t beg_region, size_t end_region,
+                     HeapWord* target_beg, HeapWord* target_end,
+                     HeapWord** target_next);
+
   bool initialize_block_data();
   bool initialize_region_data(size_t region_size);
   PSVirtualSpace* create_vspace(size_t count, size_t element_size);
@@ -295,6 +295,28 @@ void PSPromotionManager::flush_labs() {
   }
 }
 
+HeapWord* PSPromotionManager::allocate_old_lab(size_t* lab_size) {
+  if (UseNUMA && PSNUMALocalPromotion) {
+    HeapWord* const lab_base = old_gen()->cas_allocate(NUMAOldPLABSize);
+    if (lab_base != NULL) {
+      // The pages are not touched before the objects are copied into them,
+      // so they are placed on the preferred node, if it has free memory.
+      const size_t page_size = UseLargePages ? os::large_page_size() : os::vm_page_size();
+      char* const start = align_up((char*)lab_base, page_size);
+      char* const end = align_down((char*)(lab_base + NUMAOldPLABSize), page_size);
+      if (end > start) {
+        os::numa_make_local(start, pointer_delta(end, start, sizeof(char)), os::numa_get_group_id());
+      }
+      *lab_size = NUMAOldPLABSize;
+      return lab_base;
+    }
+    // Fall back to regular LABs when the old gen is close to full
+  }
+
+  *lab_size = OldPLABSize;
+  return old_gen()->cas_allocate(OldPLABSize);
+}
+
 template <class T> void PSPromotionManager::process_array_chunk_work(
                                                  oop obj,
                                                  int start, int end) {
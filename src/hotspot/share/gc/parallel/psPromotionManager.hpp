@@ -106,6 +106,14 @@ class PSPromotionManager {
 
   void push_depth(ScannerTask task);
 
+  // Size in words of the old gen LABs used with PSNUMALocalPromotion. These
+  // are larger than OldPLABSize to amortize the cost of placing the pages.
+  static const size_t NUMAOldPLABSize = 32 * K;
+
+  // Allocate the memory for a new old gen LAB, and return its size in words
+  // through lab_size.  Returns NULL if the old gen is full.
+  HeapWord* allocate_old_lab(size_t* lab_size);
+
   inline void promotion_trace_event(oop new_obj, oop old_obj, size_t obj_size,
                                     uint age, bool tenured,
                                     const PSPromotionLAB* lab);
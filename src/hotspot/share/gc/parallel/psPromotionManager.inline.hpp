@@ -202,7 +202,8 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
             // Flush and fill
             _old_lab.flush();
 
-            HeapWord* lab_base = old_gen()->cas_allocate(OldPLABSize);
+            size_t lab_size;
+            HeapWord* lab_base = allocate_old_lab(&lab_size);
             if(lab_base != NULL) {
 #ifdef ASSERT
               // Delay the initialization of the promotion lab (plab).
@@ -211,7 +212,7 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
                 os::naked_sleep(GCWorkerDelayMillis);
               }
 #endif
-              _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+              _old_lab.initialize(MemRegion(lab_base, lab_size));
               // Try the old lab allocation again.
               new_obj = (oop) _old_lab.allocate(new_obj_size);
               promotion_trace_event(new_obj, o, new_obj_size, age, true, &_old_lab);
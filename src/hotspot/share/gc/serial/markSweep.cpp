@@ -48,8 +48,7 @@ uint                    MarkSweep::_total_invocations = 0;
 Stack<oop, mtGC>              MarkSweep::_marking_stack;
 Stack<ObjArrayTask, mtGC>     MarkSweep::_objarray_stack;
 
-Stack<oop, mtGC>              MarkSweep::_preserved_oop_stack;
-Stack<markWord, mtGC>         MarkSweep::_preserved_mark_stack;
+Stack<PreservedMark, mtGC>    MarkSweep::_preserved_overflow_stack;
 size_t                  MarkSweep::_preserved_count = 0;
 size_t                  MarkSweep::_preserved_count_max = 0;
 PreservedMark*          MarkSweep::_preserved_marks = NULL;
@@ -158,12 +157,11 @@ void MarkSweep::preserve_mark(oop obj, markWord mark) {
   // We try to store preserved marks in the to space of the new generation since
   // this is storage which should be available.  Most of the time this should be
   // sufficient space for the marks we need to preserve but if it isn't we fall
-  // back to using Stacks to keep track of the overflow.
+  // back to using a Stack of (oop, mark) pairs to keep track of the overflow.
   if (_preserved_count < _preserved_count_max) {
     _preserved_marks[_preserved_count++].init(obj, mark);
   } else {
-    _preserved_mark_stack.push(mark);
-    _preserved_oop_stack.push(obj);
+    _preserved_overflow_stack.push(PreservedMark(obj, mark));
   }
 }
 
@@ -175,26 +173,20 @@ void MarkSweep::set_ref_processor(ReferenceProcessor* rp) {
 AdjustPointerClosure MarkSweep::adjust_pointer_closure;
 
 void MarkSweep::adjust_marks() {
-  assert( _preserved_oop_stack.size() == _preserved_mark_stack.size(),
-         "inconsistent preserved oop stacks");
-
   // adjust the oops we saved earlier
   for (size_t i = 0; i < _preserved_count; i++) {
     _preserved_marks[i].adjust_pointer();
   }
 
   // deal with the overflow stack
-  StackIterator<oop, mtGC> iter(_preserved_oop_stack);
+  StackIterator<PreservedMark, mtGC> iter(_preserved_overflow_stack);
   while (!iter.is_empty()) {
-    oop* p = iter.next_addr();
-    adjust_pointer(p);
+    iter.next_addr()->adjust_pointer();
   }
 }
 
 void MarkSweep::restore_marks() {
-  assert(_preserved_oop_stack.size() == _preserved_mark_stack.size(),
-         "inconsistent preserved oop stacks");
-  log_trace(gc)("Restoring " SIZE_FORMAT " marks", _preserved_count + _preserved_oop_stack.size());
+  log_trace(gc)("Restoring " SIZE_FORMAT " marks", _preserved_count + _preserved_overflow_stack.size());
 
   // restore the marks we saved earlier
   for (size_t i = 0; i < _preserved_count; i++) {
@@ -202,10 +194,8 @@ void MarkSweep::restore_marks() {
   }
 
   // deal with the overflow
-  while (!_preserved_oop_stack.is_empty()) {
-    oop obj       = _preserved_oop_stack.pop();
-    markWord mark = _preserved_mark_stack.pop();
-    obj->set_mark(mark);
+  while (!_preserved_overflow_stack.is_empty()) {
+    _preserved_overflow_stack.pop().restore();
   }
 }
 
@@ -100,8 +100,7 @@ class MarkSweep : AllStatic {
   static Stack<ObjArrayTask, mtGC>             _objarray_stack;
 
   // Space for storing/restoring mark word
-  static Stack<markWord, mtGC>                 _preserved_mark_stack;
-  static Stack<oop, mtGC>                      _preserved_oop_stack;
+  static Stack<PreservedMark, mtGC>            _preserved_overflow_stack;
   static size_t                          _preserved_count;
   static size_t                          _preserved_count_max;
   static PreservedMark*                  _preserved_marks;
@@ -202,6 +201,9 @@ private:
   markWord _mark;
 
 public:
+  PreservedMark() { }
+  PreservedMark(oop obj, markWord mark) : _obj(obj), _mark(mark) { }
+
   void init(oop obj, markWord mark) {
     _obj = obj;
     _mark = mark;
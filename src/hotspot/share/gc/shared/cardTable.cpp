@@ -337,10 +337,58 @@ void CardTable::dirty_MemRegion(MemRegion mr) {
   assert(align_up  (mr.end(),   HeapWordSize) == mr.end(),   "Unaligned end"  );
   CardValue* cur  = byte_for(mr.start());
   CardValue* last = byte_after(mr.last());
-  while (cur < last) {
-    *cur = dirty_card;
+  fill_cards(cur, last, dirty_card);
+}
+
+// A word with every card set to "val".
+static uintptr_t card_word(CardTable::CardValue val) {
+  return (~(uintptr_t)0 / max_jubyte) * val;
+}
+
+CardTable::CardValue* CardTable::find_first_card_equal(CardValue* start, CardValue* end, CardValue val) {
+  const uintptr_t val_word = card_word(val);
+  const uintptr_t low_bits = card_word(1);
+  const uintptr_t high_bits = low_bits << (BitsPerByte - 1);
+
+  CardValue* cur = start;
+  while (cur < end && !is_aligned(cur, sizeof(uintptr_t))) {
+    if (*cur == val) {
+      return cur;
+    }
+    cur++;
+  }
+  // A word contains a card equal to "val" iff the xor with val_word contains
+  // a zero byte.
+  while (cur + sizeof(uintptr_t) <= end) {
+    uintptr_t x = *(uintptr_t*)cur ^ val_word;
+    if (((x - low_bits) & ~x & high_bits) != 0) {
+      break;
+    }
+    cur += sizeof(uintptr_t);
+  }
+  while (cur < end && *cur != val) {
     cur++;
   }
+  return cur;
+}
+
+CardTable::CardValue* CardTable::find_first_card_not_equal(CardValue* start, CardValue* end, CardValue val) {
+  const uintptr_t val_word = card_word(val);
+
+  CardValue* cur = start;
+  while (cur < end && !is_aligned(cur, sizeof(uintptr_t))) {
+    if (*cur != val) {
+      return cur;
+    }
+    cur++;
+  }
+  while (cur + sizeof(uintptr_t) <= end && *(uintptr_t*)cur == val_word) {
+    cur += sizeof(uintptr_t);
+  }
+  while (cur < end && *cur == val) {
+    cur++;
+  }
+  return cur;
 }
 
 void CardTable::clear_MemRegion(MemRegion mr) {
@@ -376,21 +424,16 @@ void CardTable::dirty_card_iterate(MemRegion mr, MemRegionClosure* cl) {
   for (int i = 0; i < _cur_covered_regions; i++) {
     MemRegion mri = mr.intersection(_covered[i]);
     if (!mri.is_empty()) {
-      CardValue *cur_entry, *next_entry, *limit;
-      for (cur_entry = byte_for(mri.start()), limit = byte_for(mri.last());
-           cur_entry <= limit;
-           cur_entry  = next_entry) {
-        next_entry = cur_entry + 1;
-        if (*cur_entry == dirty_card) {
-          size_t dirty_cards;
-          // Accumulate maximal dirty card range, starting at cur_entry
-          for (dirty_cards = 1;
-               next_entry <= limit && *next_entry == dirty_card;
-               dirty_cards++, next_entry++);
-          MemRegion cur_cards(addr_for(cur_entry),
-                              dirty_cards*card_size_in_words);
-          cl->do_MemRegion(cur_cards);
-        }
+      CardValue* cur_entry = byte_for(mri.start());
+      CardValue* end = byte_after(mri.last());
+      while ((cur_entry = find_first_card_equal(cur_entry, end, dirty_card)) < end) {
+        // Accumulate maximal dirty card range, starting at cur_entry
+        CardValue* next_entry = find_first_card_not_equal(cur_entry + 1, end, dirty_card);
+        size_t dirty_cards = pointer_delta(next_entry, cur_entry, sizeof(CardValue));
+        MemRegion cur_cards(addr_for(cur_entry),
+                            dirty_cards*card_size_in_words);
+        cl->do_MemRegion(cur_cards);
+        cur_entry = next_entry;
       }
     }
   }
@@ -402,26 +445,18 @@ MemRegion CardTable::dirty_card_range_after_reset(MemRegion mr,
   for (int i = 0; i < _cur_covered_regions; i++) {
     MemRegion mri = mr.intersection(_covered[i]);
     if (!mri.is_empty()) {
-      CardValue* cur_entry, *next_entry, *limit;
-      for (cur_entry = byte_for(mri.start()), limit = byte_for(mri.last());
-           cur_entry <= limit;
-           cur_entry  = next_entry) {
-        next_entry = cur_entry + 1;
-        if (*cur_entry == dirty_card) {
-          size_t dirty_cards;
-          // Accumulate maximal dirty card range, starting at cur_entry
-          for (dirty_cards = 1;
-               next_entry <= limit && *next_entry == dirty_card;
-               dirty_cards++, next_entry++);
-          MemRegion cur_cards(addr_for(cur_entry),
-                              dirty_cards*card_size_in_words);
-          if (reset) {
-            for (size_t i = 0; i < dirty_cards; i++) {
-              cur_entry[i] = reset_val;
-            }
-          }
-          return cur_cards;
+      CardValue* end = byte_after(mri.last());
+      CardValue* cur_entry = find_first_card_equal(byte_for(mri.start()), end, dirty_card);
+      if (cur_entry < end) {
+        // Accumulate maximal dirty card range, starting at cur_entry
+        CardValue* next_entry = find_first_card_not_equal(cur_entry + 1, end, dirty_card);
+        size_t dirty_cards = pointer_delta(next_entry, cur_entry, sizeof(CardValue));
+        MemRegion cur_cards(addr_for(cur_entry),
+                            dirty_cards*card_size_in_words);
+        if (reset) {
+          fill_cards(cur_entry, next_entry, (CardValue)reset_val);
         }
+        return cur_cards;
       }
     }
   }
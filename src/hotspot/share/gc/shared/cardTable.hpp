@@ -146,6 +146,20 @@ public:
   // all of which must be covered.)
   void clear_MemRegion(MemRegion mr);
 
+  // Card range helpers. Runs of cards are examined a word at a time.
+
+  // Returns the first card in [start, end) equal to "val", or end if there
+  // is none.
+  static CardValue* find_first_card_equal(CardValue* start, CardValue* end, CardValue val);
+  // Returns the first card in [start, end) not equal to "val", or end if
+  // there is none.
+  static CardValue* find_first_card_not_equal(CardValue* start, CardValue* end, CardValue val);
+  // Sets all cards in [start, end) to "val".
+  static void fill_cards(CardValue* start, CardValue* end, CardValue val) {
+    assert(start <= end, "invalid range");
+    memset(start, val, pointer_delta(end, start, sizeof(CardValue)));
+  }
+
   // Return true if "p" is at the start of a card.
   bool is_card_aligned(HeapWord* p) {
     CardValue* pcard = byte_for(p);
@@ -599,6 +599,15 @@ void CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
   ShouldNotReachHere();
 }
 
+bool CollectedHeap::can_load_archived_objects() const {
+  return false;
+}
+
+HeapWord* CollectedHeap::allocate_loaded_archive_space(size_t size) {
+  ShouldNotReachHere();
+  return NULL;
+}
+
 void CollectedHeap::deduplicate_string(oop str) {
   // Do nothing, unless overridden in subclass.
 }
@@ -516,6 +516,13 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   virtual oop pin_object(JavaThread* thread, oop obj);
   virtual void unpin_object(JavaThread* thread, oop obj);
 
+  // Support for loading the CDS archived heap objects by copying them into
+  // the heap, for collectors that cannot map the archived heap regions. The
+  // loaded objects are referenced by raw narrow oops stored in the archived
+  // metadata, so the GC must guarantee that they never move.
+  virtual bool can_load_archived_objects() const;
+  virtual HeapWord* allocate_loaded_archive_space(size_t size);
+
   // Deduplicate the string, iff the GC supports string deduplication.
   virtual void deduplicate_string(oop str);
 
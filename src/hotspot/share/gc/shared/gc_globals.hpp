@@ -141,6 +141,12 @@
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
                                                                             \
+  product(uint, GCWorkerSpinIterations, 0, EXPERIMENTAL,                    \
+          "Number of times a work gang worker or coordinator polls for "    \
+          "a task to start or finish before blocking on a semaphore. "      \
+          "Zero disables spinning")                                         \
+          range(0, max_jint)                                                \
+                                                                            \
   product(size_t, HeapSizePerGCThread, ScaleForWordSize(32*M),              \
           "Size of heap (bytes) per GC thread used in calculating the "     \
           "number of GC threads")                                           \
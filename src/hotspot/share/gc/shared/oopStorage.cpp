@@ -46,6 +46,7 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/population_count.hpp"
 #include "utilities/powerOfTwo.hpp"
 
 OopStorage::AllocationListEntry::AllocationListEntry() : _prev(NULL), _next(NULL) {}
@@ -317,6 +318,17 @@ oop* OopStorage::Block::allocate() {
   }
 }
 
+// Claims all of the free entries in the block and returns the claimed
+// entries as a bitmask.  Must hold the owner's _allocation_mutex, so there
+// are no concurrent allocations.  Concurrent releases only clear bits that
+// are already set, so adding the free bits is equivalent to or'ing them in.
+uintx OopStorage::Block::allocate_all() {
+  uintx new_allocated = ~allocated_bitmask();
+  assert(new_allocated != 0, "attempt to allocate from full block");
+  Atomic::add(&_allocated_bitmask, new_allocated);
+  return new_allocated;
+}
+
 OopStorage::Block* OopStorage::Block::new_block(const OopStorage* owner) {
   // _data must be first member: aligning block => aligning _data.
   STATIC_ASSERT(_data_pos == 0);
@@ -436,6 +448,45 @@ oop* OopStorage::allocate() {
   return result;
 }
 
+size_t OopStorage::allocate(oop** ptrs, size_t size) {
+  assert(size > 0, "precondition");
+  Block* block;
+  uintx taken;
+  {
+    MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+    block = block_for_allocation();
+    if (block == NULL) return 0; // Block allocation failed.
+    if (block->is_empty()) {
+      // Transitioning from empty to not empty.
+      log_trace(oopstorage, blocks)("%s: block not empty " PTR_FORMAT, name(), p2i(block));
+    }
+    // Take all remaining entries, so the block is now full.  Remove it
+    // from consideration by future allocates.  Releasing the excess
+    // below makes a from-full transition, which relinks it as needed.
+    taken = block->allocate_all();
+    log_trace(oopstorage, blocks)("%s: block full " PTR_FORMAT, name(), p2i(block));
+    _allocation_list.unlink(*block);
+  }
+  size_t num_taken = population_count(taken);
+  Atomic::add(&_allocation_count, num_taken);
+  size_t limit = MIN2(num_taken, size);
+  for (size_t i = 0; i < limit; ++i) {
+    assert(taken != 0, "invariant");
+    unsigned index = count_trailing_zeros(taken);
+    taken ^= block->bitmask_for_index(index);
+    ptrs[i] = block->get_pointer(index);
+    log_trace(oopstorage, ref)("%s: allocated " PTR_FORMAT, name(), p2i(ptrs[i]));
+  }
+  // If more entries were taken than requested, release the remainder.
+  if (taken != 0) {
+    assert(size == limit, "invariant");
+    assert(num_taken == (limit + population_count(taken)), "invariant");
+    block->release_entries(taken, this);
+    Atomic::sub(&_allocation_count, num_taken - limit);
+  }
+  return limit;
+}
+
 bool OopStorage::try_add_block() {
   assert_lock_strong(_allocation_mutex);
   Block* block;
@@ -104,6 +104,18 @@ public:
   // postcondition: *result == NULL.
   oop* allocate();
 
+  // Allocates multiple entries, returning them in the ptrs buffer.  Takes
+  // _allocation_mutex once for the batch, so is faster than making repeated
+  // calls to allocate().  Returns the number of entries allocated, which may
+  // be less than requested, but all come from a single block, so never more
+  // than bulk_allocate_limit.  A result of zero indicates failure to allocate
+  // any entries.
+  // precondition: size > 0.
+  // postcondition: result <= size.
+  // postcondition: *ptrs[i] == NULL, for i in [0,result).
+  size_t allocate(oop** ptrs, size_t size);
+  static const size_t bulk_allocate_limit = BitsPerWord;
+
   // Deallocates ptr.  No locking.
   // precondition: ptr is a valid allocated entry.
   // precondition: *ptr == NULL.
@@ -118,25 +118,37 @@ public:
   }
 };
 
+// Restoring a mark is a single store, so starting a worker is only worth it
+// if it has at least this many marks to restore.
+static const size_t min_preserved_marks_per_worker = 4 * K;
+
 void PreservedMarksSet::restore(WorkGang* workers) {
   volatile size_t total_size = 0;
 
-#ifdef ASSERT
-  // This is to make sure the total_size we'll calculate below is correct.
+  // Size the restoration: at most one worker per non-empty stack, and
+  // serial restoration if there are only a few marks.
   size_t total_size_before = 0;
+  uint non_empty_stacks = 0;
   for (uint i = 0; i < _num; i += 1) {
-    total_size_before += get(i)->size();
+    size_t size = get(i)->size();
+    total_size_before += size;
+    non_empty_stacks += (size > 0) ? 1 : 0;
+  }
+
+  uint num_workers = 1;
+  if (workers != NULL) {
+    size_t wanted = MAX2<size_t>(1, total_size_before / min_preserved_marks_per_worker);
+    num_workers = (uint)MIN3<size_t>(wanted, non_empty_stacks, workers->active_workers());
   }
-#endif // def ASSERT
 
-  if (workers == NULL) {
+  if (num_workers <= 1) {
     for (uint i = 0; i < num(); i += 1) {
       total_size += get(i)->size();
       get(i)->restore();
     }
   } else {
-    ParRestoreTask task(workers->active_workers(), this, &total_size);
-    workers->run_task(&task);
+    ParRestoreTask task(num_workers, this, &total_size);
+    workers->run_task(&task, num_workers);
   }
 
   assert_empty();
@@ -145,7 +157,7 @@ void PreservedMarksSet::restore(WorkGang* workers) {
          "total_size = " SIZE_FORMAT " before = " SIZE_FORMAT,
          total_size, total_size_before);
 
-  log_trace(gc)("Restored " SIZE_FORMAT " marks", total_size);
+  log_trace(gc)("Restored " SIZE_FORMAT " marks with %u workers", total_size, num_workers);
 }
 
 void PreservedMarksSet::reclaim() {
@@ -27,18 +27,14 @@
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
+#include "utilities/align.hpp"
 
 PretouchTask::PretouchTask(const char* task_name, char* start_address, char* end_address, size_t page_size) :
     AbstractGangTask(task_name),
     _cur_addr(start_address),
     _start_addr(start_address),
     _end_addr(end_address),
-    _page_size(0) {
-#ifdef LINUX
-  _page_size = UseTransparentHugePages ? (size_t)os::vm_page_size(): page_size;
-#else
-  _page_size = page_size;
-#endif
+    _page_size(page_size) {
 }
 
 size_t PretouchTask::chunk_size() {
@@ -46,7 +42,8 @@ size_t PretouchTask::chunk_size() {
 }
 
 void PretouchTask::work(uint worker_id) {
-  size_t const actual_chunk_size = MAX2(chunk_size(), _page_size);
+  // Keep chunks page aligned so that a large page is never split across workers.
+  size_t const actual_chunk_size = align_up(MAX2(chunk_size(), _page_size), _page_size);
 
   while (true) {
     char* touch_addr = Atomic::fetch_and_add(&_cur_addr, actual_chunk_size);
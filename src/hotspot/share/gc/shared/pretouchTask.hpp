@@ -31,7 +31,7 @@ class PretouchTask : public AbstractGangTask {
   char* volatile _cur_addr;
   char* const _start_addr;
   char* const _end_addr;
-  size_t _page_size;
+  size_t const _page_size;
 
 public:
   PretouchTask(const char* task_name, char* start_address, char* end_address, size_t page_size);
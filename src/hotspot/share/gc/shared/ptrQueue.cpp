@@ -136,12 +136,22 @@ size_t BufferNode::Allocator::free_count() const {
   return Atomic::load(&_free_count);
 }
 
+BufferNode* BufferNode::Allocator::try_pop_free() {
+  // Protect against ABA; see release().
+  GlobalCounter::CriticalSection cs(Thread::current());
+  return _free_list.pop();
+}
+
 BufferNode* BufferNode::Allocator::allocate() {
-  BufferNode* node;
-  {
-    // Protect against ABA; see release().
-    GlobalCounter::CriticalSection cs(Thread::current());
-    node = _free_list.pop();
+  BufferNode* node = try_pop_free();
+  // If the free list is empty but released buffers are waiting on the
+  // pending list, make them available rather than going to the C heap.
+  // A transfer is cheaper than a new C heap buffer, and it keeps the pool
+  // from growing while the releases are short of a full transfer batch.
+  if ((node == NULL) &&
+      (Atomic::load(&_pending_count) != 0) &&
+      try_transfer_pending()) {
+    node = try_pop_free();
   }
   if (node == NULL) {
     node = BufferNode::allocate(_buffer_size);
@@ -171,15 +181,6 @@ void BufferNode::Allocator::release(BufferNode* node) {
   assert(node != NULL, "precondition");
   assert(node->next() == NULL, "precondition");
 
-  // Desired minimum transfer batch size.  There is relatively little
-  // importance to the specific number.  It shouldn't be too big, else
-  // we're wasting space when the release rate is low.  If the release
-  // rate is high, we might accumulate more than this before being
-  // able to start a new transfer, but that's okay.  Also note that
-  // the allocation rate and the release rate are going to be fairly
-  // similar, due to how the buffers are used.
-  const size_t trigger_transfer = 10;
-
   // Add to pending list. Update count first so no underflow in transfer.
   size_t pending_count = Atomic::add(&_pending_count, 1u);
   _pending_list.push(*node);
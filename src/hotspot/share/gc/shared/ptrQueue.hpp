@@ -270,7 +270,17 @@ class BufferNode::Allocator {
 
 #undef DECLARE_PADDED_MEMBER
 
+  // Desired minimum transfer batch size.  There is relatively little
+  // importance to the specific number.  It shouldn't be too big, else
+  // we're wasting space when the release rate is low.  If the release
+  // rate is high, we might accumulate more than this before being
+  // able to start a new transfer, but that's okay.  Also note that
+  // the allocation rate and the release rate are going to be fairly
+  // similar, due to how the buffers are used.
+  static const size_t trigger_transfer = 10;
+
   void delete_list(BufferNode* list);
+  BufferNode* try_pop_free();
   bool try_transfer_pending();
 
   NONCOPYABLE(Allocator);
@@ -393,21 +393,29 @@ bool StringDedupTable::is_rehashing() {
 StringDedupTable* StringDedupTable::prepare_resize() {
   size_t size = _table->_size;
 
-  // Check if the hashtable needs to be resized
-  if (_table->_entries > _table->_grow_threshold) {
-    // Grow table, double the size
-    size *= 2;
-    if (size > _max_size) {
+  // Check if the hashtable needs to be resized. Resize in one step to
+  // a size that fits the current number of entries, rather than one
+  // doubling or halving per GC, so a quickly growing or shrinking table
+  // doesn't get transferred repeatedly over several GCs.
+  uintx entries = _table->_entries;
+  if (entries > _table->_grow_threshold) {
+    if (size >= _max_size) {
       // Too big, don't resize
       return NULL;
     }
-  } else if (_table->_entries < _table->_shrink_threshold) {
-    // Shrink table, half the size
-    size /= 2;
-    if (size < _min_size) {
+    // Grow table, doubling the size until the load is below the threshold
+    do {
+      size *= 2;
+    } while (size < _max_size && entries > size * _grow_load_factor);
+  } else if (entries < _table->_shrink_threshold) {
+    if (size <= _min_size) {
       // Too small, don't resize
       return NULL;
     }
+    // Shrink table, halving the size until the load is above the threshold
+    do {
+      size /= 2;
+    } while (size > _min_size && entries < size * _shrink_load_factor);
   } else if (StringDeduplicationResizeALot) {
     // Force grow
     size *= 2;
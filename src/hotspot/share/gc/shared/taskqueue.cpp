@@ -34,7 +34,7 @@
 
 #if TASKQUEUE_STATS
 const char * const TaskQueueStats::_names[last_stat_id] = {
-  "qpush", "qpop", "qpop-s", "qattempt", "qsteal", "opush", "omax"
+  "qpush", "qpop", "qpop-s", "qattempt", "qsteal", "qcontend", "opush", "omax"
 };
 
 TaskQueueStats & TaskQueueStats::operator +=(const TaskQueueStats & addend)
@@ -92,9 +92,10 @@ void TaskQueueStats::verify() const
   assert(get(pop_slow) <= get(pop),
          "pop_slow=" SIZE_FORMAT " pop=" SIZE_FORMAT,
          get(pop_slow), get(pop));
-  assert(get(steal) <= get(steal_attempt),
-         "steal=" SIZE_FORMAT " steal_attempt=" SIZE_FORMAT,
-         get(steal), get(steal_attempt));
+  assert(get(steal) + get(steal_contended) <= get(steal_attempt),
+         "steal=" SIZE_FORMAT " steal_contended=" SIZE_FORMAT
+         " steal_attempt=" SIZE_FORMAT,
+         get(steal), get(steal_contended), get(steal_attempt));
   assert(get(overflow) == 0 || get(push) != 0,
          "overflow=" SIZE_FORMAT " push=" SIZE_FORMAT,
          get(overflow), get(push));
@@ -57,6 +57,7 @@ public:
     pop_slow,         // subset of taskqueue pops that were done slow-path
     steal_attempt,    // number of taskqueue steal attempts
     steal,            // number of taskqueue steals
+    steal_contended,  // number of failed steals from a non-empty victim
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -70,6 +71,7 @@ public:
   inline void record_pop_slow()      { record_pop(); ++_stats[pop_slow]; }
   inline void record_steal_attempt() { ++_stats[steal_attempt]; }
   inline void record_steal()         { ++_stats[steal]; }
+  inline void record_steal_contended() { ++_stats[steal_contended]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -301,6 +301,11 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
 
     if (suc) {
       local_queue->set_last_stolen_queue_id(sel_k);
+    } else if (MAX2(sz1, sz2) > 0) {
+      // The victim had work but another thief won the race for it. Stay
+      // with that victim; it is still the most likely place to find work.
+      TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_contended());
+      local_queue->set_last_stolen_queue_id(sel_k);
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
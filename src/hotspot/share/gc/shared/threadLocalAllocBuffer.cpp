@@ -32,6 +32,7 @@
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/copy.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 size_t       ThreadLocalAllocBuffer::_max_size = 0;
 int          ThreadLocalAllocBuffer::_reserve_for_allocation_prefetch = 0;
@@ -146,6 +147,29 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+// resize() only runs at GC, so a thread that allocates far more than its
+// share since the last GC refills many times with a TLAB sized for the old
+// rate.  Double the desired size each time the refill count reaches a
+// doubling of the target (2x, 4x, 8x, ...), so the refill count stays within
+// a small multiple of the target.  The next resize() recomputes the size from
+// the allocation history as usual.
+void ThreadLocalAllocBuffer::resize_if_refilling_fast() {
+  unsigned refills = _number_of_refills;
+  if ((refills < 2 * _target_refills) || (refills % _target_refills) != 0 ||
+      !is_power_of_2(refills / _target_refills) || desired_size() >= max_size()) {
+    return;
+  }
+  size_t new_size = align_object_size(MIN2(desired_size() * 2, max_size()));
+
+  log_trace(gc, tlab)("TLAB grow: thread: " INTPTR_FORMAT " [id: %2d]"
+                      " refills %u  desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                      p2i(thread()), thread()->osthread()->thread_id(),
+                      refills, desired_size(), new_size);
+
+  set_desired_size(new_size);
+  set_refill_waste_limit(initial_refill_waste_limit());
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
   _fast_refill_waste = 0;
@@ -161,6 +185,10 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   _number_of_refills++;
   _allocated_size += new_size;
   print_stats("fill");
+
+  if (ResizeTLAB) {
+    resize_if_refilling_fast();
+  }
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
   initialize(start, top, start + new_size - alignment_reserve());
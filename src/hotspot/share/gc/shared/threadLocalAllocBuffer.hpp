@@ -98,6 +98,9 @@ private:
 
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
 
+  // Grow the desired size if refilling much more often than targeted.
+  void resize_if_refilling_fast();
+
   void print_stats(const char* tag);
 
   Thread* thread();
@@ -109,11 +109,16 @@ void WeakProcessor::Task::work(uint worker_id,
     }
   }
 
-  for (Iterator it = WeakProcessorPhases::oopstorage_iterator(); !it.is_end(); ++it) {
-    WeakProcessorPhase phase = *it;
+  // Blocks are claimed dynamically within each storage.  Start each worker
+  // at a different storage, so that workers spread over the storages rather
+  // than all contending on the claim of the first one, and move on to the
+  // remaining storages until all blocks of all storages have been claimed.
+  const uint oopstorage_count = WeakProcessorPhases::oopstorage_phase_count;
+  for (uint i = 0; i < oopstorage_count; ++i) {
+    uint oopstorage_index = (worker_id + i) % oopstorage_count;
+    WeakProcessorPhase phase = WeakProcessorPhases::oopstorage_phase(oopstorage_index);
     CountingSkippedIsAliveClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive);
     WeakProcessorPhaseTimeTracker pt(_phase_times, phase, worker_id);
-    uint oopstorage_index = WeakProcessorPhases::oopstorage_index(phase);
     StorageState* cur_state = _storage_states.par_state(oopstorage_index);
     cur_state->oops_do(&cl);
     cur_state->increment_num_dead(cl.num_skipped() + cl.num_dead());
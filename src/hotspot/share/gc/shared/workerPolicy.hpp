@@ -34,6 +34,13 @@ class WorkerPolicy : public AllStatic {
   static bool _debug_perturbation;
   static uint _parallel_worker_threads;
   static bool _parallel_worker_threads_initialized;
+  static volatile uint _last_active_processor_count;
+
+  // Number of worker threads to use for ncpus processors.
+  static uint threads_for_processors(uint ncpus,
+                                     uint num,
+                                     uint den,
+                                     uint switch_pt);
 
   static uint nof_parallel_worker_threads(uint num,
                                           uint den,
@@ -50,6 +57,10 @@ public:
   // command line.
   static uint parallel_worker_threads();
 
+  // Upper bound on the number of active workers given the processors
+  // currently available, which may differ from those at startup.
+  static uint active_processor_worker_limit();
+
   // Return number default GC threads to use in the next GC.
   static uint calc_default_active_workers(uintx total_workers,
                                           const uintx min_workers,
@@ -105,6 +105,18 @@ static void run_foreground_task_if_needed(AbstractGangTask* task, uint num_worke
   }
 }
 
+// Spin on the semaphore for up to GCWorkerSpinIterations before blocking.
+// Short back-to-back phases then hand over without a park/unpark round trip.
+static void spin_then_wait(Semaphore* semaphore) {
+  for (uint i = 0; i < GCWorkerSpinIterations; i++) {
+    if (semaphore->trywait()) {
+      return;
+    }
+    SpinPause();
+  }
+  semaphore->wait();
+}
+
 // WorkGang dispatcher implemented with semaphores.
 //
 // Semaphores don't require the worker threads to re-claim the lock when they wake up.
@@ -150,7 +162,7 @@ public:
     run_foreground_task_if_needed(task, num_workers, add_foreground_work);
 
     // Wait for the last worker to signal the coordinator.
-    _end_semaphore->wait();
+    spin_then_wait(_end_semaphore);
 
     // No workers are allowed to read the state variables after the coordinator has been signaled.
     assert(_not_finished == 0, "%d not finished workers?", _not_finished);
@@ -165,7 +177,7 @@ public:
   // Returns when the worker has been assigned a task.
   WorkData worker_wait_for_task() {
     // Wait for the coordinator to dispatch a task.
-    _start_semaphore->wait();
+    spin_then_wait(_start_semaphore);
 
     uint num_started = Atomic::add(&_started, 1u);
 
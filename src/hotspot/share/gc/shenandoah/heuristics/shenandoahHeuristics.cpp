@@ -30,6 +30,7 @@
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "gc/shenandoah/mode/shenandoahMode.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
 #include "runtime/globals_extension.hpp"
@@ -94,6 +95,8 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
 
   ShenandoahMarkingContext* const ctx = heap->complete_marking_context();
 
+  const bool is_generational = heap->mode()->is_generational();
+
   for (size_t i = 0; i < num_regions; i++) {
     ShenandoahHeapRegion* region = heap->get_region(i);
 
@@ -109,7 +112,14 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         immediate_regions++;
         immediate_garbage += garbage;
         region->make_trash_immediate();
+      } else if (is_generational && !region->is_young()) {
+        // Old regions are not evacuated, only reclaimed when fully dead.
       } else {
+        if (is_generational) {
+          // Candidates that are not evacuated by this cycle age by one cycle,
+          // the evacuated ones are recycled and start over as free regions.
+          region->increment_age();
+        }
         // This is our candidate for later consideration.
         candidates[cand_idx]._region = region;
         candidates[cand_idx]._garbage = garbage;
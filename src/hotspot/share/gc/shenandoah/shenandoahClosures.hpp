@@ -84,6 +84,24 @@ private:
   inline void do_oop_work(T* p);
 };
 
+// Evacuates the frames of lazily processed thread stacks, see ShenandoahStackWatermark.
+// Since degenerated and full GC may finish the processing of a stack after
+// evacuation has been cancelled, it only updates references in that case.
+class ShenandoahEvacuateUpdateStackRootsClosure : public OopClosure {
+private:
+  ShenandoahHeap* const _heap;
+  Thread* const _thread;
+  const bool _evac_in_progress;
+public:
+  inline ShenandoahEvacuateUpdateStackRootsClosure();
+  inline void do_oop(oop* p);
+  inline void do_oop(narrowOop* p);
+
+private:
+  template <class T>
+  inline void do_oop_work(T* p);
+};
+
 class ShenandoahEvacUpdateOopStorageRootsClosure : public BasicOopIterateClosure {
 private:
   ShenandoahHeap* _heap;
@@ -116,6 +116,30 @@ void ShenandoahEvacuateUpdateRootsClosure<MO>::do_oop(narrowOop* p) {
   do_oop_work(p);
 }
 
+ShenandoahEvacuateUpdateStackRootsClosure::ShenandoahEvacuateUpdateStackRootsClosure() :
+  _heap(ShenandoahHeap::heap()),
+  _thread(Thread::current()),
+  _evac_in_progress(ShenandoahHeap::heap()->is_evacuation_in_progress()) {
+}
+
+template <class T>
+void ShenandoahEvacuateUpdateStackRootsClosure::do_oop_work(T* p) {
+  T o = RawAccess<>::oop_load(p);
+  if (!CompressedOops::is_null(o)) {
+    oop obj = CompressedOops::decode_not_null(o);
+    if (_heap->in_collection_set(obj)) {
+      oop resolved = ShenandoahBarrierSet::resolve_forwarded_not_null(obj);
+      if (resolved == obj && _evac_in_progress) {
+        resolved = _heap->evacuate_object(obj, _thread);
+      }
+      RawAccess<IS_NOT_NULL>::oop_store(p, resolved);
+    }
+  }
+}
+
+void ShenandoahEvacuateUpdateStackRootsClosure::do_oop(oop* p)       { do_oop_work(p); }
+void ShenandoahEvacuateUpdateStackRootsClosure::do_oop(narrowOop* p) { do_oop_work(p); }
+
 ShenandoahEvacUpdateOopStorageRootsClosure::ShenandoahEvacUpdateOopStorageRootsClosure() :
   _heap(ShenandoahHeap::heap()), _thread(Thread::current()) {
 }
@@ -56,6 +56,7 @@
 #include "gc/shenandoah/shenandoahPadding.hpp"
 #include "gc/shenandoah/shenandoahParallelCleaning.inline.hpp"
 #include "gc/shenandoah/shenandoahRootProcessor.inline.hpp"
+#include "gc/shenandoah/shenandoahStackWatermark.hpp"
 #include "gc/shenandoah/shenandoahStringDedup.hpp"
 #include "gc/shenandoah/shenandoahTaskqueue.hpp"
 #include "gc/shenandoah/shenandoahUtils.hpp"
@@ -64,6 +65,7 @@
 #include "gc/shenandoah/shenandoahVMOperations.hpp"
 #include "gc/shenandoah/shenandoahWorkGroup.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
+#include "gc/shenandoah/mode/shenandoahGenerationalMode.hpp"
 #include "gc/shenandoah/mode/shenandoahIUMode.hpp"
 #include "gc/shenandoah/mode/shenandoahPassiveMode.hpp"
 #include "gc/shenandoah/mode/shenandoahSATBMode.hpp"
@@ -407,6 +409,8 @@ void ShenandoahHeap::initialize_heuristics() {
       _gc_mode = new ShenandoahSATBMode();
     } else if (strcmp(ShenandoahGCMode, "iu") == 0) {
       _gc_mode = new ShenandoahIUMode();
+    } else if (strcmp(ShenandoahGCMode, "generational") == 0) {
+      _gc_mode = new ShenandoahGenerationalMode();
     } else if (strcmp(ShenandoahGCMode, "passive") == 0) {
       _gc_mode = new ShenandoahPassiveMode();
     } else {
@@ -1017,6 +1021,9 @@ void ShenandoahHeap::print_heap_regions_on(outputStream* st) const {
   st->print_cr("BTE=bottom/top/end, U=used, T=TLAB allocs, G=GCLAB allocs, S=shared allocs, L=live data");
   st->print_cr("R=root, CP=critical pins, TAMS=top-at-mark-start, UWM=update watermark");
   st->print_cr("SN=alloc sequence number");
+  if (mode()->is_generational()) {
+    st->print_cr("F=free, Y=young, O=old");
+  }
 
   for (size_t i = 0; i < num_regions(); i++) {
     get_region(i)->print_on(st);
@@ -1144,11 +1151,19 @@ void ShenandoahHeap::evacuate_and_update_roots() {
 #endif
   assert(ShenandoahSafepoint::is_at_shenandoah_safepoint(), "Only iterate roots while world is stopped");
   {
+    // Leave thread stacks to the stack watermarks if the concurrent strong roots
+    // phase is going to run, as it finishes whatever the threads have not done.
+    bool stw_thread_roots = !ShenandoahConcurrentStackProcessing || !is_concurrent_strong_root_in_progress();
+    if (!stw_thread_roots) {
+      ShenandoahStackWatermark::change_epoch_id();
+    }
+
     // Include concurrent roots if current cycle can not process those roots concurrently
     ShenandoahRootEvacuator rp(workers()->active_workers(),
                                ShenandoahPhaseTimings::init_evac,
                                !ShenandoahConcurrentRoots::should_do_concurrent_roots(),
-                               !ShenandoahConcurrentRoots::should_do_concurrent_class_unloading());
+                               !ShenandoahConcurrentRoots::should_do_concurrent_class_unloading(),
+                               stw_thread_roots);
     ShenandoahEvacuateUpdateRootsTask roots_task(&rp);
     workers()->run_task(&roots_task);
   }
@@ -1771,6 +1786,9 @@ void ShenandoahHeap::op_final_mark() {
           if (ShenandoahConcurrentRoots::should_do_concurrent_class_unloading()) {
             types = ShenandoahRootVerifier::combine(types, ShenandoahRootVerifier::CodeRoots);
           }
+          if (ShenandoahConcurrentStackProcessing && is_concurrent_strong_root_in_progress()) {
+            types = ShenandoahRootVerifier::combine(types, ShenandoahRootVerifier::ThreadRoots);
+          }
           verifier()->verify_roots_no_forwarded_except(types);
         }
         verifier()->verify_during_evacuation();
@@ -1852,12 +1870,14 @@ class ShenandoahConcurrentRootsEvacUpdateTask : public AbstractGangTask {
 private:
   ShenandoahVMRoots<true /*concurrent*/>        _vm_roots;
   ShenandoahClassLoaderDataRoots<true /*concurrent*/, false /*single threaded*/> _cld_roots;
+  ShenandoahConcurrentStackRoots                _stack_roots;
 
 public:
   ShenandoahConcurrentRootsEvacUpdateTask(ShenandoahPhaseTimings::Phase phase) :
     AbstractGangTask("Shenandoah Evacuate/Update Concurrent Strong Roots"),
     _vm_roots(phase),
-    _cld_roots(phase, ShenandoahHeap::heap()->workers()->active_workers()) {}
+    _cld_roots(phase, ShenandoahHeap::heap()->workers()->active_workers()),
+    _stack_roots(phase) {}
 
   void work(uint worker_id) {
     ShenandoahConcurrentWorkerSession worker_session(worker_id);
@@ -1874,6 +1894,10 @@ public:
       CLDToOopClosure clds(&cl, ClassLoaderData::_claim_strong);
       _cld_roots.cld_do(&clds, worker_id);
     }
+
+    if (ShenandoahConcurrentStackProcessing) {
+      _stack_roots.finish_processing(worker_id);
+    }
   }
 };
 
@@ -2627,14 +2651,14 @@ class ShenandoahUpdateHeapRefsTask : public AbstractGangTask {
 private:
   T cl;
   ShenandoahHeap* _heap;
-  ShenandoahRegionIterator* _regions;
+  ShenandoahRegionChunkIterator* _chunks;
   bool _concurrent;
 public:
-  ShenandoahUpdateHeapRefsTask(ShenandoahRegionIterator* regions, bool concurrent) :
+  ShenandoahUpdateHeapRefsTask(ShenandoahRegionChunkIterator* chunks, bool concurrent) :
     AbstractGangTask("Shenandoah Update References"),
     cl(T()),
     _heap(ShenandoahHeap::heap()),
-    _regions(regions),
+    _chunks(chunks),
     _concurrent(concurrent) {
   }
 
@@ -2651,21 +2675,25 @@ public:
 
 private:
   void do_work() {
-    ShenandoahHeapRegion* r = _regions->next();
-    ShenandoahMarkingContext* const ctx = _heap->complete_marking_context();
-    while (r != NULL) {
+    ShenandoahHeapRegion* r;
+    HeapWord* start;
+    HeapWord* end;
+    while (_chunks->next(&r, &start, &end)) {
       HeapWord* update_watermark = r->get_update_watermark();
       assert (update_watermark >= r->bottom(), "sanity");
+      if (start >= update_watermark) {
+        // Nothing to update in this chunk
+        continue;
+      }
       if (r->is_active() && !r->is_cset()) {
-        _heap->marked_object_oop_iterate(r, &cl, update_watermark);
+        _heap->marked_object_oop_iterate(r, &cl, start, end, update_watermark);
       }
       if (ShenandoahPacing) {
-        _heap->pacer()->report_updaterefs(pointer_delta(update_watermark, r->bottom()));
+        _heap->pacer()->report_updaterefs(pointer_delta(MIN2(end, update_watermark), start));
       }
       if (_heap->check_cancelled_gc_and_yield(_concurrent)) {
         return;
       }
-      r = _regions->next();
     }
   }
 };
@@ -3230,6 +3258,24 @@ bool ShenandoahRegionIterator::has_next() const {
   return _index < _heap->num_regions();
 }
 
+ShenandoahRegionChunkIterator::ShenandoahRegionChunkIterator(ShenandoahHeap* heap) :
+  _heap(heap),
+  _chunk_size_words(0),
+  _chunks_per_region_shift(0),
+  _index(0) {}
+
+void ShenandoahRegionChunkIterator::reset() {
+  // Region sizes are only known after heap initialization
+  const size_t region_shift = ShenandoahHeapRegion::region_size_bytes_shift();
+  _chunks_per_region_shift = region_shift - MIN2(region_shift, LogChunkSizeBytes);
+  _chunk_size_words = ShenandoahHeapRegion::region_size_words() >> _chunks_per_region_shift;
+  _index = 0;
+}
+
+bool ShenandoahRegionChunkIterator::has_next() const {
+  return (_index >> _chunks_per_region_shift) < _heap->num_regions();
+}
+
 char ShenandoahHeap::gc_state() const {
   return _gc_state.raw_value();
 }
@@ -102,6 +102,38 @@ public:
   bool has_next() const;
 };
 
+// Hands out heap regions in fixed-size chunks, so that the work in large
+// regions can be shared by several workers.
+class ShenandoahRegionChunkIterator : public StackObj {
+private:
+  static const size_t LogChunkSizeBytes = 20; // 1M
+
+  ShenandoahHeap* _heap;
+  size_t _chunk_size_words;
+  size_t _chunks_per_region_shift;
+
+  shenandoah_padding(0);
+  volatile size_t _index;
+  shenandoah_padding(1);
+
+  // No implicit copying: iterators should be passed by reference to capture the state
+  NONCOPYABLE(ShenandoahRegionChunkIterator);
+
+public:
+  ShenandoahRegionChunkIterator(ShenandoahHeap* heap);
+
+  // Reset iterator to default state
+  void reset();
+
+  // Claims the next chunk, and returns false if there are no more chunks.
+  // This is multi-thread-safe.
+  inline bool next(ShenandoahHeapRegion** region, HeapWord** start, HeapWord** end);
+
+  // This is *not* MT safe. However, in the absence of multithreaded access, it
+  // can be used to determine if there is more work to do.
+  bool has_next() const;
+};
+
 class ShenandoahHeapRegionClosure : public StackObj {
 public:
   virtual void heap_region_do(ShenandoahHeapRegion* r) = 0;
@@ -214,7 +246,7 @@ private:
   bool      _heap_region_special;
   size_t    _num_regions;
   ShenandoahHeapRegion** _regions;
-  ShenandoahRegionIterator _update_refs_iterator;
+  ShenandoahRegionChunkIterator _update_refs_iterator;
 
 public:
 
@@ -549,6 +581,9 @@ public:
   MemRegion reserved_region() const { return _reserved; }
   bool is_in_reserved(const void* addr) const { return _reserved.contains(addr); }
 
+  // Thread stacks are evacuated lazily with ShenandoahConcurrentStackProcessing
+  bool uses_stack_watermark_barrier() const { return ShenandoahConcurrentStackProcessing; }
+
   void collect(GCCause::Cause cause);
   void do_full_collection(bool clear_all_soft_refs);
 
@@ -653,8 +688,15 @@ public:
   template<class T>
   inline void marked_object_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* limit);
 
+  // Visit marked objects that start in [start, chunk_end) of the region, and, if the
+  // chunk contains the TAMS, all objects past the TAMS. Only objects below limit are visited.
+  template<class T>
+  inline void marked_object_iterate(ShenandoahHeapRegion* region, T* cl,
+                                    HeapWord* start, HeapWord* chunk_end, HeapWord* limit);
+
   template<class T>
-  inline void marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* limit);
+  inline void marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl,
+                                        HeapWord* start, HeapWord* chunk_end, HeapWord* limit);
 
   void reset_mark_bitmap();
 
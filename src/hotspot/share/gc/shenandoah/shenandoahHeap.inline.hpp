@@ -58,6 +58,19 @@ inline ShenandoahHeapRegion* ShenandoahRegionIterator::next() {
   return _heap->get_region(new_index - 1);
 }
 
+inline bool ShenandoahRegionChunkIterator::next(ShenandoahHeapRegion** region, HeapWord** start, HeapWord** end) {
+  size_t index = Atomic::add(&_index, (size_t) 1) - 1;
+  ShenandoahHeapRegion* r = _heap->get_region(index >> _chunks_per_region_shift);
+  if (r == NULL) {
+    return false;
+  }
+  size_t chunk = index & right_n_bits(_chunks_per_region_shift);
+  *region = r;
+  *start = r->bottom() + chunk * _chunk_size_words;
+  *end = *start + _chunk_size_words;
+  return true;
+}
+
 inline bool ShenandoahHeap::has_forwarded_objects() const {
   return _gc_state.is_set(HAS_FORWARDED);
 }
@@ -396,7 +409,14 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
 
 template<class T>
 inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* limit) {
+  marked_object_iterate(region, cl, region->bottom(), region->end(), limit);
+}
+
+template<class T>
+inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region, T* cl,
+                                                  HeapWord* start, HeapWord* chunk_end, HeapWord* limit) {
   assert(! region->is_humongous_continuation(), "no humongous continuation regions here");
+  assert(region->bottom() <= start && start <= chunk_end && chunk_end <= region->end(), "chunk should be within region");
 
   ShenandoahMarkingContext* const ctx = complete_marking_context();
   assert(ctx->is_complete(), "sanity");
@@ -405,11 +425,10 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
   HeapWord* tams = ctx->top_at_mark_start(region);
 
   size_t skip_bitmap_delta = 1;
-  HeapWord* start = region->bottom();
-  HeapWord* end = MIN2(tams, region->end());
+  HeapWord* end = MIN2(tams, chunk_end);
 
   // Step 1. Scan below the TAMS based on bitmap data.
-  HeapWord* limit_bitmap = MIN2(limit, tams);
+  HeapWord* limit_bitmap = MIN2(limit, end);
 
   // Try to scan the initial candidate. If the candidate is above the TAMS, it would
   // fail the subsequent "< limit_bitmap" checks, and fall through to Step 2.
@@ -470,7 +489,12 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
 
   // Step 2. Accurate size-based traversal, happens past the TAMS.
   // This restarts the scan at TAMS, which makes sure we traverse all objects,
-  // regardless of what happened at Step 1.
+  // regardless of what happened at Step 1. Object starts past the TAMS are
+  // only known by walking from the TAMS, so the whole walk up to the limit
+  // belongs to the chunk that contains the TAMS.
+  if (tams < start || tams >= chunk_end) {
+    return;
+  }
   HeapWord* cs = tams;
   while (cs < limit) {
     assert (cs >= tams, "only objects past TAMS here: "   PTR_FORMAT " (" PTR_FORMAT ")", p2i(cs), p2i(tams));
@@ -509,17 +533,23 @@ public:
 };
 
 template<class T>
-inline void ShenandoahHeap::marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* top) {
+inline void ShenandoahHeap::marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl,
+                                                      HeapWord* start, HeapWord* chunk_end, HeapWord* top) {
   if (region->is_humongous()) {
-    HeapWord* bottom = region->bottom();
+    HeapWord* bottom = start;
+    top = MIN2(top, chunk_end);
     if (top > bottom) {
       region = region->humongous_start_region();
+      if (oop(region->bottom())->is_typeArray()) {
+        // Primitive arrays have no references to visit
+        return;
+      }
       ShenandoahObjectToOopBoundedClosure<T> objs(cl, bottom, top);
       marked_object_iterate(region, &objs);
     }
   } else {
     ShenandoahObjectToOopClosure<T> objs(cl);
-    marked_object_iterate(region, &objs, top);
+    marked_object_iterate(region, &objs, start, chunk_end, top);
   }
 }
 
@@ -28,6 +28,7 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc/shenandoah/mode/shenandoahMode.hpp"
 #include "gc/shared/space.inline.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/iterator.inline.hpp"
@@ -60,6 +61,8 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _new_top(NULL),
   _empty_time(os::elapsedTime()),
   _state(committed ? _empty_committed : _empty_uncommitted),
+  _affiliation(FREE),
+  _age(0),
   _top(start),
   _tlab_allocs(0),
   _gclab_allocs(0),
@@ -90,6 +93,7 @@ void ShenandoahHeapRegion::make_regular_allocation() {
       do_commit();
     case _empty_committed:
       set_state(_regular);
+      set_affiliation(YOUNG_GENERATION);
     case _regular:
     case _pinned:
       return;
@@ -107,6 +111,7 @@ void ShenandoahHeapRegion::make_regular_bypass() {
     case _empty_uncommitted:
       do_commit();
     case _empty_committed:
+      set_affiliation(YOUNG_GENERATION);
     case _cset:
     case _humongous_start:
     case _humongous_cont:
@@ -130,6 +135,7 @@ void ShenandoahHeapRegion::make_humongous_start() {
       do_commit();
     case _empty_committed:
       set_state(_humongous_start);
+      set_affiliation(YOUNG_GENERATION);
       return;
     default:
       report_illegal_transition("humongous start allocation");
@@ -142,6 +148,7 @@ void ShenandoahHeapRegion::make_humongous_start_bypass() {
 
   switch (_state) {
     case _empty_committed:
+      set_affiliation(YOUNG_GENERATION);
     case _regular:
     case _humongous_start:
     case _humongous_cont:
@@ -159,6 +166,7 @@ void ShenandoahHeapRegion::make_humongous_cont() {
       do_commit();
     case _empty_committed:
      set_state(_humongous_cont);
+      set_affiliation(YOUNG_GENERATION);
       return;
     default:
       report_illegal_transition("humongous continuation allocation");
@@ -171,6 +179,7 @@ void ShenandoahHeapRegion::make_humongous_cont_bypass() {
 
   switch (_state) {
     case _empty_committed:
+      set_affiliation(YOUNG_GENERATION);
     case _regular:
     case _humongous_start:
     case _humongous_cont:
@@ -267,6 +276,7 @@ void ShenandoahHeapRegion::make_empty() {
   switch (_state) {
     case _trash:
       set_state(_empty_committed);
+      set_affiliation(FREE);
       _empty_time = os::elapsedTime();
       return;
     default:
@@ -360,6 +370,21 @@ void ShenandoahHeapRegion::print_on(outputStream* st) const {
     default:
       ShouldNotReachHere();
   }
+  if (ShenandoahHeap::heap()->mode()->is_generational()) {
+    switch (_affiliation) {
+      case FREE:
+        st->print("|F");
+        break;
+      case YOUNG_GENERATION:
+        st->print("|Y");
+        break;
+      case OLD_GENERATION:
+        st->print("|O");
+        break;
+      default:
+        ShouldNotReachHere();
+    }
+  }
   st->print("|BTE " INTPTR_FORMAT_W(12) ", " INTPTR_FORMAT_W(12) ", " INTPTR_FORMAT_W(12),
             p2i(bottom()), p2i(top()), p2i(end()));
   st->print("|TAMS " INTPTR_FORMAT_W(12),
@@ -637,6 +662,32 @@ void ShenandoahHeapRegion::do_uncommit() {
   heap->decrease_committed(ShenandoahHeapRegion::region_size_bytes());
 }
 
+const char* shenandoah_affiliation_name(ShenandoahRegionAffiliation type) {
+  switch (type) {
+    case FREE:
+      return "FREE";
+    case YOUNG_GENERATION:
+      return "YOUNG";
+    case OLD_GENERATION:
+      return "OLD";
+    default:
+      ShouldNotReachHere();
+      return NULL;
+  }
+}
+
+void ShenandoahHeapRegion::set_affiliation(ShenandoahRegionAffiliation affiliation) {
+  _affiliation = affiliation;
+  _age = 0;
+}
+
+void ShenandoahHeapRegion::increment_age() {
+  assert(is_young(), "Only young regions age");
+  if (++_age >= ShenandoahTenuredRegionAge) {
+    set_affiliation(OLD_GENERATION);
+  }
+}
+
 void ShenandoahHeapRegion::set_state(RegionState to) {
   EventShenandoahHeapRegionStateChange evt;
   if (evt.should_commit()){
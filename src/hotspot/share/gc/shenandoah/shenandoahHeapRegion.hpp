@@ -36,6 +36,14 @@
 class VMStructs;
 class ShenandoahHeapRegionStateConstant;
 
+enum ShenandoahRegionAffiliation {
+  FREE,
+  YOUNG_GENERATION,
+  OLD_GENERATION
+};
+
+const char* shenandoah_affiliation_name(ShenandoahRegionAffiliation type);
+
 class ShenandoahHeapRegion {
   friend class VMStructs;
   friend class ShenandoahHeapRegionStateConstant;
@@ -233,6 +241,8 @@ private:
 
   // Seldom updated fields
   RegionState _state;
+  ShenandoahRegionAffiliation _affiliation;
+  uint _age;
 
   // Frequently updated fields
   HeapWord* _top;
@@ -382,6 +392,15 @@ public:
   size_t get_tlab_allocs() const;
   size_t get_gclab_allocs() const;
 
+  ShenandoahRegionAffiliation affiliation() const { return _affiliation; }
+  bool is_young() const                           { return _affiliation == YOUNG_GENERATION; }
+  bool is_old() const                             { return _affiliation == OLD_GENERATION; }
+
+  // Count one more cycle survived by this region, and make it old once
+  // it has survived ShenandoahTenuredRegionAge cycles.
+  void increment_age();
+  uint age() const                                { return _age; }
+
   inline HeapWord* get_update_watermark() const;
   inline void set_update_watermark(HeapWord* w);
   inline void set_update_watermark_at_safepoint(HeapWord* w);
@@ -396,6 +415,7 @@ private:
   inline void internal_increase_live_data(size_t s);
 
   void set_state(RegionState to);
+  void set_affiliation(ShenandoahRegionAffiliation affiliation);
 };
 
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHHEAPREGION_HPP
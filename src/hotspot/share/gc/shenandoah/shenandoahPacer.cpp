@@ -28,6 +28,7 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 
@@ -191,6 +192,7 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_allocated, (intptr_t)0);
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -231,9 +233,23 @@ intptr_t ShenandoahPacer::epoch() {
   return Atomic::load(&_epoch);
 }
 
+bool ShenandoahPacer::is_below_fair_share(size_t thread_words) const {
+  // Compare against the average allocation of all threads in this phase
+  const size_t nthreads = MAX2(Threads::number_of_threads(), 1);
+  return thread_words * nthreads < (size_t)Atomic::load(&_allocated);
+}
+
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  JavaThread* const thread = JavaThread::current();
+
+  size_t thread_words = 0;
+  if (ShenandoahPacingFairShare) {
+    thread_words = ShenandoahThreadLocalData::add_paced_words(thread, epoch(), words);
+    Atomic::add(&_allocated, (intptr_t)words);
+  }
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc(words, false);
   if (claimed) {
@@ -250,10 +266,17 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Threads that are attaching should not block at all: they are not
   // fully initialized yet. Blocking them would be awkward.
   // This is probably the path that allocates the thread oop itself.
-  if (JavaThread::current()->is_attaching_via_jni()) {
+  if (thread->is_attaching_via_jni()) {
+    return;
+  }
+
+  // Threads that allocated less than their share in this phase do not wait.
+  // Their claim is repaid by the subsequent waits of heavier allocators.
+  if (ShenandoahPacingFairShare && is_below_fair_share(thread_words)) {
     return;
   }
 
+  EventShenandoahAllocationPacing event;
   double start = os::elapsedTime();
 
   size_t max_ms = ShenandoahPacingMaxDelay;
@@ -273,7 +296,12 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       //     Breaking out and allocating anyway, which may mean we outpace GC,
       //     and start Degenerated GC cycle.
       //  b) The budget had been replenished, which means our claim is satisfied.
-      ShenandoahThreadLocalData::add_paced_time(JavaThread::current(), end - start);
+      ShenandoahThreadLocalData::add_paced_time(thread, end - start);
+      if (event.should_commit()) {
+        event.set_size(words * HeapWordSize);
+        event.set_threadAllocated(thread_words * HeapWordSize);
+        event.commit();
+      }
       break;
     }
   }
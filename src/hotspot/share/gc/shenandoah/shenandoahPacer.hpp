@@ -39,6 +39,9 @@ class ShenandoahHeap;
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * With ShenandoahPacingFairShare, only threads that allocated more than the average
+ * per-thread share in the current phase stall, so heavy allocators pay for the
+ * credit spent by light ones.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -62,6 +65,11 @@ private:
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Heavily updated, protect from accidental false sharing
+  shenandoah_padding(4);
+  volatile intptr_t _allocated;
+  shenandoah_padding(5);
+
 public:
   ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -71,7 +79,8 @@ public:
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {}
+          _progress(PACING_PROGRESS_UNINIT),
+          _allocated(0) {}
 
   void setup_for_idle();
   void setup_for_mark();
@@ -107,6 +116,8 @@ private:
 
   size_t update_and_get_progress_history();
 
+  bool is_below_fair_share(size_t thread_words) const;
+
   void wait(size_t time_ms);
 };
 
@@ -34,6 +34,8 @@
 #include "gc/shenandoah/shenandoahStringDedup.hpp"
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/stackWatermarkSet.inline.hpp"
 #include "runtime/thread.hpp"
 
 ShenandoahWeakSerialRoot::ShenandoahWeakSerialRoot(ShenandoahWeakSerialRoot::WeakOopsDo weak_oops_do,
@@ -84,6 +86,21 @@ ShenandoahThreadRoots::~ShenandoahThreadRoots() {
   Threads::assert_all_threads_claimed();
 }
 
+ShenandoahConcurrentStackRoots::ShenandoahConcurrentStackRoots(ShenandoahPhaseTimings::Phase phase) :
+  _threads(), _claimed(0), _phase(phase) {
+}
+
+uint ShenandoahConcurrentStackRoots::claim() {
+  return Atomic::fetch_and_add(&_claimed, 1u);
+}
+
+void ShenandoahConcurrentStackRoots::finish_processing(uint worker_id) {
+  ShenandoahWorkerTimingsTracker timer(_phase, ShenandoahPhaseTimings::ThreadRoots, worker_id);
+  for (uint i = claim(); i < _threads.length(); i = claim()) {
+    StackWatermarkSet::finish_processing(_threads.thread_at(i), NULL /* context */, StackWatermarkKind::gc);
+  }
+}
+
 ShenandoahStringDedupRoots::ShenandoahStringDedupRoots(ShenandoahPhaseTimings::Phase phase) : _phase(phase) {
   if (ShenandoahStringDedup::is_enabled()) {
     StringDedup::gc_prologue(false);
@@ -180,10 +197,20 @@ void ShenandoahRootScanner::roots_do(uint worker_id, OopClosure* oops, CodeBlobC
   _thread_roots.threads_do(&tc_cl, worker_id);
 }
 
+class ShenandoahStartStackProcessingClosure : public ThreadClosure {
+public:
+  void do_thread(Thread* thread) {
+    if (thread->is_Java_thread()) {
+      StackWatermarkSet::start_processing(thread->as_Java_thread(), StackWatermarkKind::gc);
+    }
+  }
+};
+
 ShenandoahRootEvacuator::ShenandoahRootEvacuator(uint n_workers,
                                                  ShenandoahPhaseTimings::Phase phase,
                                                  bool stw_roots_processing,
-                                                 bool stw_class_unloading) :
+                                                 bool stw_class_unloading,
+                                                 bool stw_thread_roots) :
   ShenandoahRootProcessor(phase),
   _vm_roots(phase),
   _cld_roots(phase, n_workers),
@@ -193,7 +220,8 @@ ShenandoahRootEvacuator::ShenandoahRootEvacuator(uint n_workers,
   _dedup_roots(phase),
   _code_roots(phase),
   _stw_roots_processing(stw_roots_processing),
-  _stw_class_unloading(stw_class_unloading) {
+  _stw_class_unloading(stw_class_unloading),
+  _stw_thread_roots(stw_thread_roots) {
 }
 
 void ShenandoahRootEvacuator::roots_do(uint worker_id, OopClosure* oops) {
@@ -221,6 +249,14 @@ void ShenandoahRootEvacuator::roots_do(uint worker_id, OopClosure* oops) {
   // Process heavy-weight/fully parallel roots the last
   if (_stw_class_unloading) {
     _code_roots.code_blobs_do(codes_cl, worker_id);
+  }
+  if (!_stw_thread_roots) {
+    // Only process the thread-local roots and the top frames now, the stack
+    // watermarks take care of the rest of each stack, including the nmethods
+    // found on it.
+    ShenandoahStartStackProcessingClosure tc;
+    _thread_roots.threads_do(&tc, worker_id);
+  } else if (_stw_class_unloading) {
     _thread_roots.oops_do(oops, NULL, worker_id);
   } else {
     _thread_roots.oops_do(oops, codes_cl, worker_id);
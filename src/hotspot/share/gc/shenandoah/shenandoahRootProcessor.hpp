@@ -33,6 +33,7 @@
 #include "gc/shenandoah/shenandoahSharedVariables.hpp"
 #include "gc/shenandoah/shenandoahUtils.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/threadSMR.hpp"
 
 class ShenandoahWeakSerialRoot {
   typedef void (*WeakOopsDo)(BoolObjectClosure*, OopClosure*);
@@ -110,6 +111,21 @@ public:
   void threads_do(ThreadClosure* tc, uint worker_id);
 };
 
+// Finishes the lazy stack processing that the final mark pause has started
+// for every Java thread, see ShenandoahStackWatermark.
+class ShenandoahConcurrentStackRoots {
+private:
+  ThreadsListHandle             _threads;
+  volatile uint                 _claimed;
+  ShenandoahPhaseTimings::Phase _phase;
+
+  uint claim();
+public:
+  ShenandoahConcurrentStackRoots(ShenandoahPhaseTimings::Phase phase);
+
+  void finish_processing(uint worker_id);
+};
+
 class ShenandoahStringDedupRoots {
 private:
   ShenandoahPhaseTimings::Phase _phase;
@@ -237,9 +253,11 @@ private:
   ShenandoahCodeCacheRoots                                  _code_roots;
   bool                                                      _stw_roots_processing;
   bool                                                      _stw_class_unloading;
+  bool                                                      _stw_thread_roots;
 public:
   ShenandoahRootEvacuator(uint n_workers, ShenandoahPhaseTimings::Phase phase,
-                          bool stw_roots_processing, bool stw_class_unloading);
+                          bool stw_roots_processing, bool stw_class_unloading,
+                          bool stw_thread_roots);
 
   void roots_do(uint worker_id, OopClosure* oops);
 };
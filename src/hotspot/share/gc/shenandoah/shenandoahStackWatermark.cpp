@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020, Red Hat, Inc. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shenandoah/shenandoahClosures.inline.hpp"
+#include "gc/shenandoah/shenandoahEvacOOMHandler.inline.hpp"
+#include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahStackWatermark.hpp"
+#include "gc/shenandoah/shenandoahUtils.hpp"
+#include "runtime/frame.inline.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.hpp"
+
+uint32_t ShenandoahStackWatermark::_epoch_id = 1;
+
+ShenandoahOnStackCodeBlobClosure::ShenandoahOnStackCodeBlobClosure() :
+    _bs_nm(BarrierSet::barrier_set()->barrier_set_nmethod()) {}
+
+void ShenandoahOnStackCodeBlobClosure::do_code_blob(CodeBlob* cb) {
+  nmethod* const nm = cb->as_nmethod_or_null();
+  if (nm != NULL && _bs_nm != NULL) {
+    const bool result = _bs_nm->nmethod_entry_barrier(nm);
+    assert(result, "NMethod on-stack must be alive");
+  }
+}
+
+ShenandoahStackWatermark::ShenandoahStackWatermark(JavaThread* jt) :
+  StackWatermark(jt, StackWatermarkKind::gc, _epoch_id),
+  _cb_cl() {}
+
+uint32_t ShenandoahStackWatermark::epoch_id() const {
+  return _epoch_id;
+}
+
+void ShenandoahStackWatermark::change_epoch_id() {
+  assert(ShenandoahSafepoint::is_at_shenandoah_safepoint(), "Must be at a safepoint");
+  _epoch_id++;
+}
+
+void ShenandoahStackWatermark::start_processing_impl(void* context) {
+  // The processing may be done by the thread itself, by a GC worker or by a
+  // thread walking this stack, so the closure is set up for the current thread.
+  ShenandoahEvacOOMScope oom_evac_scope;
+  ShenandoahEvacuateUpdateStackRootsClosure cl;
+
+  // Process the non-frame part of the thread
+  _jt->oops_do_no_frames(&cl, &_cb_cl);
+
+  // Publishes the processing start to concurrent threads
+  StackWatermark::start_processing_impl(context);
+}
+
+void ShenandoahStackWatermark::process(const frame& fr, RegisterMap& register_map, void* context) {
+  ShenandoahEvacOOMScope oom_evac_scope;
+  ShenandoahEvacuateUpdateStackRootsClosure cl;
+  fr.oops_do(&cl, &_cb_cl, &register_map, DerivedPointerIterationMode::_directly);
+}
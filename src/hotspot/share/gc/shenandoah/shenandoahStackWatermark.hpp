@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020, Red Hat, Inc. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHENANDOAH_SHENANDOAHSTACKWATERMARK_HPP
+#define SHARE_GC_SHENANDOAH_SHENANDOAHSTACKWATERMARK_HPP
+
+#include "gc/shared/barrierSetNMethod.hpp"
+#include "memory/allocation.hpp"
+#include "memory/iterator.hpp"
+#include "runtime/stackWatermark.hpp"
+
+class frame;
+class JavaThread;
+
+class ShenandoahOnStackCodeBlobClosure : public CodeBlobClosure {
+private:
+  BarrierSetNMethod* _bs_nm;
+
+  virtual void do_code_blob(CodeBlob* cb);
+
+public:
+  ShenandoahOnStackCodeBlobClosure();
+};
+
+// With ShenandoahConcurrentStackProcessing, final mark does not evacuate the
+// thread stacks. It only processes the thread-local roots and the top frames
+// of each thread, and the rest of each stack is evacuated by the thread when
+// it returns into those frames, or by GC workers in the concurrent strong
+// roots phase, whichever comes first.
+class ShenandoahStackWatermark : public StackWatermark {
+private:
+  static uint32_t _epoch_id;
+
+  ShenandoahOnStackCodeBlobClosure _cb_cl;
+
+  virtual uint32_t epoch_id() const;
+  virtual void start_processing_impl(void* context);
+  virtual void process(const frame& fr, RegisterMap& register_map, void* context);
+
+public:
+  ShenandoahStackWatermark(JavaThread* jt);
+
+  // Starts a new lazy snapshot of all thread stacks. Called at a Shenandoah safepoint.
+  static void change_epoch_id();
+};
+
+#endif // SHARE_GC_SHENANDOAH_SHENANDOAHSTACKWATERMARK_HPP
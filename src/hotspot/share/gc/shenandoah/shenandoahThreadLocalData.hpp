@@ -50,6 +50,8 @@ private:
   bool _force_satb_flush;
   int  _disarmed_value;
   double _paced_time;
+  intptr_t _paced_epoch;
+  size_t _paced_words;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -61,7 +63,9 @@ private:
     _worker_id(INVALID_WORKER_ID),
     _force_satb_flush(false),
     _disarmed_value(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _paced_epoch(0),
+    _paced_words(0) {
 
     // At least on x86_64, nmethod entry barrier encodes _disarmed_value offset
     // in instruction as disp8 immed
@@ -153,6 +157,18 @@ public:
     data(thread)->_paced_time = 0;
   }
 
+  // Accumulates the words allocated by the thread in the given pacing epoch,
+  // and returns the total for that epoch.
+  static size_t add_paced_words(Thread* thread, intptr_t epoch, size_t words) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    if (d->_paced_epoch != epoch) {
+      d->_paced_epoch = epoch;
+      d->_paced_words = 0;
+    }
+    d->_paced_words += words;
+    return d->_paced_words;
+  }
+
   static void set_disarmed_value(Thread* thread, int value) {
     data(thread)->_disarmed_value = value;
   }
@@ -62,6 +62,7 @@
           "barriers are in in use. Possible values are:"                    \
           " satb - snapshot-at-the-beginning concurrent GC (three pass mark-evac-update);"  \
           " iu - incremental-update concurrent GC (three pass mark-evac-update);"  \
+          " generational - satb with young and old region affiliation;"    \
           " passive - stop the world GC only (either degenerated or full)") \
                                                                             \
   product(ccstr, ShenandoahGCHeuristics, "adaptive",                        \
@@ -96,6 +97,12 @@
           "collector accepts. In percents of heap region size.")            \
           range(0,100)                                                      \
                                                                             \
+  product(uintx, ShenandoahTenuredRegionAge, 4, EXPERIMENTAL,               \
+          "In generational mode, how many cycles a young region has to "    \
+          "survive without being collected before it becomes old. Old "     \
+          "regions are only reclaimed when they contain no live data.")     \
+          range(1,255)                                                      \
+                                                                            \
   product(uintx, ShenandoahInitFreeThreshold, 70, EXPERIMENTAL,             \
           "How much heap should be free before some heuristics trigger the "\
           "initial (learning) cycles. Affects cycle frequency on startup "  \
@@ -234,6 +241,12 @@
           "GC effectively stall the threads indefinitely instead of going " \
           "to degenerated or Full GC.")                                     \
                                                                             \
+  product(bool, ShenandoahPacingFairShare, true, EXPERIMENTAL,              \
+          "Only stall the threads that allocated more than the average "    \
+          "per-thread share during the current GC phase. Threads below "    \
+          "it still spend the pacing budget, which makes the heavier "      \
+          "allocators wait longer instead.")                                \
+                                                                            \
   product(uintx, ShenandoahPacingIdleSlack, 2, EXPERIMENTAL,                \
           "How much of heap counted as non-taxable allocations during idle "\
           "phases. Larger value makes the pacing milder when collector is " \
@@ -321,6 +334,12 @@
   product(bool, ShenandoahSuspendibleWorkers, false, EXPERIMENTAL,          \
           "Suspend concurrent GC worker threads at safepoints")             \
                                                                             \
+  product(bool, ShenandoahConcurrentStackProcessing, false, EXPERIMENTAL,   \
+          "Evacuate thread stacks lazily and concurrently instead of in "   \
+          "the final mark pause. The pause only processes the top frames "  \
+          "of each thread, the rest is done by the threads themselves "     \
+          "and by the concurrent strong roots phase.")                      \
+                                                                            \
   product(bool, ShenandoahSATBBarrier, true, DIAGNOSTIC,                    \
           "Turn on/off SATB barriers in Shenandoah")                        \
                                                                             \
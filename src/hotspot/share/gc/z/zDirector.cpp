@@ -26,6 +26,7 @@
 #include "gc/z/zDirector.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zStat.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 
 const double ZDirector::one_in_1000 = 3.290527;
@@ -41,10 +42,69 @@ void ZDirector::sample_allocation_rate() const {
   // below to estimate the time we have until we run out of memory.
   const double bytes_per_second = ZStatAllocRate::sample_and_reset();
 
-  log_debug(gc, alloc)("Allocation Rate: %.3fMB/s, Avg: %.3f(+/-%.3f)MB/s",
+  log_debug(gc, alloc)("Allocation Rate: %.3fMB/s, Avg: %.3f(+/-%.3f)MB/s, Predicted: %.3fMB/s",
                        bytes_per_second / M,
                        ZStatAllocRate::avg() / M,
-                       ZStatAllocRate::avg_sd() / M);
+                       ZStatAllocRate::avg_sd() / M,
+                       ZStatAllocRate::predict() / M);
+}
+
+size_t ZDirector::free_memory() const {
+  // Calculate amount of free memory available to Java threads. Note that
+  // the heap reserve is not available to Java threads and is therefore not
+  // considered part of the free memory.
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t max_reserve = ZHeap::heap()->max_reserve();
+  const size_t used = ZHeap::heap()->used();
+  const size_t free_with_reserve = soft_max_capacity - MIN2(soft_max_capacity, used);
+  return free_with_reserve - MIN2(free_with_reserve, max_reserve);
+}
+
+double ZDirector::max_alloc_rate() const {
+  // The allocation rate is the larger of the moving average and the linear
+  // prediction of the sampled allocation rate, where the prediction reacts
+  // faster to a rising allocation rate. We multiply that with an allocation
+  // spike tolerance factor to guard against unforeseen phase changes in the
+  // allocate rate. We then add ~3.3 sigma to account for the allocation rate
+  // variance, which means the probability is 1 in 1000 that a sample is
+  // outside of the confidence interval.
+  const double alloc_rate = MAX2(ZStatAllocRate::avg(), ZStatAllocRate::predict());
+  const double max_alloc_rate = (alloc_rate * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
+
+  // If the latest sample is above even that, an allocation burst is in
+  // progress. Assume it continues at the current rate.
+  return MAX2(max_alloc_rate, ZStatAllocRate::last());
+}
+
+uint ZDirector::select_nconcurrent_workers() const {
+  const uint max_nworkers = ZHeap::heap()->nconcurrent_no_boost_worker_threads();
+  if (!UseDynamicNumberOfGCThreads || !ZStatCycle::is_normalized_duration_trustable()) {
+    // Use all concurrent workers
+    return max_nworkers;
+  }
+
+  // Select the smallest number of workers that is expected to complete a GC
+  // cycle within the time we have until we run out of memory. The normalized
+  // GC duration is the duration when using all concurrent workers, and we
+  // assume the duration scales inversely with the number of workers. Only
+  // half of the available time is targeted, to leave room for the cycle
+  // starting late and for the workers not scaling perfectly.
+  const double time_until_oom = free_memory() / (max_alloc_rate() + 1.0); // Plus 1.0B/s to avoid division by zero
+  const AbsSeq& duration_of_gc = ZStatCycle::normalized_duration();
+  const double max_duration_of_gc = duration_of_gc.davg() + (duration_of_gc.dsd() * one_in_1000);
+  const double sample_interval = 1.0 / ZStatAllocRate::sample_hz;
+  const double available_time = (time_until_oom - sample_interval) * 0.5;
+
+  uint nworkers = max_nworkers;
+  if (available_time > 0.0) {
+    const double needed = ceil(max_duration_of_gc * max_nworkers / available_time);
+    nworkers = (uint)clamp(needed, 1.0, (double)max_nworkers);
+  }
+
+  log_debug(gc, director)("Concurrent Workers: %u, TimeUntilOOM: %.3fs, MaxDurationOfGC: %.3fs",
+                          nworkers, time_until_oom, max_duration_of_gc);
+
+  return nworkers;
 }
 
 bool ZDirector::rule_timer() const {
@@ -91,26 +151,13 @@ bool ZDirector::rule_allocation_rate() const {
 
   // Perform GC if the estimated max allocation rate indicates that we
   // will run out of memory. The estimated max allocation rate is based
-  // on the moving average of the sampled allocation rate plus a safety
-  // margin based on variations in the allocation rate and unforeseen
-  // allocation spikes.
-
-  // Calculate amount of free memory available to Java threads. Note that
-  // the heap reserve is not available to Java threads and is therefore not
-  // considered part of the free memory.
-  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
-  const size_t max_reserve = ZHeap::heap()->max_reserve();
-  const size_t used = ZHeap::heap()->used();
-  const size_t free_with_reserve = soft_max_capacity - MIN2(soft_max_capacity, used);
-  const size_t free = free_with_reserve - MIN2(free_with_reserve, max_reserve);
+  // on the sampled allocation rate plus a safety margin based on
+  // variations in the allocation rate and unforeseen allocation spikes.
+  const size_t free = free_memory();
 
   // Calculate time until OOM given the max allocation rate and the amount
-  // of free memory. The allocation rate is a moving average and we multiply
-  // that with an allocation spike tolerance factor to guard against unforeseen
-  // phase changes in the allocate rate. We then add ~3.3 sigma to account for
-  // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
-  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
+  // of free memory.
+  const double max_alloc_rate = ZDirector::max_alloc_rate();
   const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
 
   // Calculate max duration of a GC cycle. The duration of GC is a moving
@@ -225,12 +272,26 @@ GCCause::Cause ZDirector::make_gc_decision() const {
   return GCCause::_no_gc;
 }
 
+void ZDirector::send_decision_event(GCCause::Cause cause) const {
+  EventZDirectorDecision e;
+  if (e.should_commit()) {
+    e.set_cause((u2)cause);
+    e.set_allocationRate(ZStatAllocRate::avg());
+    e.set_maxAllocationRate(max_alloc_rate());
+    e.set_free(free_memory());
+    e.set_gcDuration(ZStatCycle::normalized_duration().davg());
+    e.commit();
+  }
+}
+
 void ZDirector::run_service() {
   // Main loop
   while (_metronome.wait_for_tick()) {
     sample_allocation_rate();
+    ZHeap::heap()->request_nconcurrent_worker_threads(select_nconcurrent_workers());
     const GCCause::Cause cause = make_gc_decision();
     if (cause != GCCause::_no_gc) {
+      send_decision_event(cause);
       ZCollectedHeap::heap()->collect(cause);
     }
   }
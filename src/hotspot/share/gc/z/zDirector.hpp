@@ -36,6 +36,12 @@ private:
 
   void sample_allocation_rate() const;
 
+  size_t free_memory() const;
+  double max_alloc_rate() const;
+  void send_decision_event(GCCause::Cause cause) const;
+
+  uint select_nconcurrent_workers() const;
+
   bool rule_timer() const;
   bool rule_warmup() const;
   bool rule_allocation_rate() const;
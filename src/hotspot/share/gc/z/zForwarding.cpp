@@ -23,7 +23,10 @@
 
 #include "precompiled.hpp"
 #include "gc/z/zForwarding.inline.hpp"
+#include "gc/z/zHeap.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/powerOfTwo.hpp"
 
@@ -38,6 +41,7 @@ ZForwarding* ZForwarding::create(ZPage* page) {
 }
 
 void ZForwarding::destroy(ZForwarding* forwarding) {
+  forwarding->~ZForwarding();
   AttachedArray::free(forwarding);
 }
 
@@ -47,10 +51,113 @@ ZForwarding::ZForwarding(ZPage* page, size_t nentries) :
     _entries(nentries),
     _page(page),
     _refcount(1),
-    _pinned(false) {}
+    _refcount_lock(),
+    _in_place(false) {}
+
+// The reference count has three states. A positive count is the number
+// of threads using the page, including the relocating worker. Zero means
+// the page has been released. A negative count means a worker has claimed
+// the page for in-place relocation, and its magnitude is the number of
+// threads still using the page. Other threads are not allowed to retain a
+// claimed page, and instead wait until it has been released.
+
+bool ZForwarding::retain_page() {
+  for (;;) {
+    const int32_t refcount = Atomic::load_acquire(&_refcount);
+
+    if (refcount == 0) {
+      // Released
+      return false;
+    }
+
+    if (refcount < 0) {
+      // Claimed for in-place relocation
+      wait_page_released();
+      return false;
+    }
+
+    if (Atomic::cmpxchg(&_refcount, refcount, refcount + 1) == refcount) {
+      // Retained
+      return true;
+    }
+  }
+}
+
+void ZForwarding::release_page() {
+  for (;;) {
+    const int32_t refcount = Atomic::load(&_refcount);
+    assert(refcount != 0, "Invalid state");
+
+    if (refcount > 0) {
+      // Decrement reference count
+      if (Atomic::cmpxchg(&_refcount, refcount, refcount - 1) != refcount) {
+        continue;
+      }
+
+      if (refcount == 1) {
+        // Page released, free it and wake up waiting threads
+        ZHeap::heap()->free_page(_page, true /* reclaimed */);
+        _page = NULL;
+
+        ZLocker<ZConditionLock> locker(&_refcount_lock);
+        _refcount_lock.notify_all();
+      }
+    } else {
+      // Claimed for in-place relocation. The reference count moves towards
+      // -1, where only the claiming worker remains. When the claiming worker
+      // releases its reference, the page has been relocated in place and is
+      // kept, since it now holds the relocated objects.
+      const int32_t new_refcount = (refcount == -1) ? 0 : refcount + 1;
+      if (Atomic::cmpxchg(&_refcount, refcount, new_refcount) != refcount) {
+        continue;
+      }
+
+      if (new_refcount == -1 || new_refcount == 0) {
+        ZLocker<ZConditionLock> locker(&_refcount_lock);
+        _refcount_lock.notify_all();
+      }
+    }
+
+    return;
+  }
+}
+
+void ZForwarding::wait_page_released() {
+  if (!is_page_released()) {
+    ZLocker<ZConditionLock> locker(&_refcount_lock);
+    while (!is_page_released()) {
+      _refcount_lock.wait();
+    }
+  }
+}
+
+void ZForwarding::in_place_relocation_claim_page() {
+  for (;;) {
+    const int32_t refcount = Atomic::load(&_refcount);
+    assert(refcount > 0, "Invalid state");
+
+    // Invert reference count
+    if (Atomic::cmpxchg(&_refcount, refcount, -refcount) != refcount) {
+      continue;
+    }
+
+    // If the previous reference count was 1, then only the claiming worker
+    // used the page. Otherwise, wait until all other threads have released
+    // their references and the reference count has reached -1.
+    if (refcount != 1) {
+      ZLocker<ZConditionLock> locker(&_refcount_lock);
+      while (Atomic::load_acquire(&_refcount) != -1) {
+        _refcount_lock.wait();
+      }
+    }
+
+    _in_place = true;
+    return;
+  }
+}
 
 void ZForwarding::verify() const {
-  guarantee(_refcount > 0, "Invalid refcount");
+  guarantee(_refcount != 0, "Invalid refcount");
   guarantee(_page != NULL, "Invalid page");
 
   size_t live_objects = 0;
@@ -26,6 +26,7 @@
 
 #include "gc/z/zAttachedArray.hpp"
 #include "gc/z/zForwardingEntry.hpp"
+#include "gc/z/zLock.hpp"
 #include "gc/z/zVirtualMemory.hpp"
 
 class ZPage;
@@ -43,11 +44,9 @@ private:
   const size_t         _object_alignment_shift;
   const AttachedArray  _entries;
   ZPage*               _page;
-  volatile uint32_t    _refcount;
-  volatile bool        _pinned;
-
-  bool inc_refcount();
-  bool dec_refcount();
+  volatile int32_t     _refcount;
+  ZConditionLock       _refcount_lock;
+  bool                 _in_place;
 
   ZForwardingEntry* entries() const;
   ZForwardingEntry at(ZForwardingCursor* cursor) const;
@@ -65,11 +64,13 @@ public:
   size_t object_alignment_shift() const;
   ZPage* page() const;
 
-  bool is_pinned() const;
-  void set_pinned();
-
   bool retain_page();
   void release_page();
+  bool is_page_released() const;
+  void wait_page_released();
+
+  void in_place_relocation_claim_page();
+  bool in_place_relocation() const;
 
   ZForwardingEntry find(uintptr_t from_index) const;
   ZForwardingEntry find(uintptr_t from_index, ZForwardingCursor* cursor) const;
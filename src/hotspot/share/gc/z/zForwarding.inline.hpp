@@ -27,7 +27,6 @@
 #include "gc/z/zAttachedArray.inline.hpp"
 #include "gc/z/zForwarding.hpp"
 #include "gc/z/zHash.inline.hpp"
-#include "gc/z/zHeap.hpp"
 #include "gc/z/zVirtualMemory.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
@@ -48,45 +47,12 @@ inline ZPage* ZForwarding::page() const {
   return _page;
 }
 
-inline bool ZForwarding::is_pinned() const {
-  return Atomic::load(&_pinned);
+inline bool ZForwarding::is_page_released() const {
+  return Atomic::load_acquire(&_refcount) == 0;
 }
 
-inline void ZForwarding::set_pinned() {
-  Atomic::store(&_pinned, true);
-}
-
-inline bool ZForwarding::inc_refcount() {
-  uint32_t refcount = Atomic::load(&_refcount);
-
-  while (refcount > 0) {
-    const uint32_t old_refcount = refcount;
-    const uint32_t new_refcount = old_refcount + 1;
-    const uint32_t prev_refcount = Atomic::cmpxchg(&_refcount, old_refcount, new_refcount);
-    if (prev_refcount == old_refcount) {
-      return true;
-    }
-
-    refcount = prev_refcount;
-  }
-
-  return false;
-}
-
-inline bool ZForwarding::dec_refcount() {
-  assert(_refcount > 0, "Invalid state");
-  return Atomic::sub(&_refcount, 1u) == 0u;
-}
-
-inline bool ZForwarding::retain_page() {
-  return inc_refcount();
-}
-
-inline void ZForwarding::release_page() {
-  if (dec_refcount()) {
-    ZHeap::heap()->free_page(_page, true /* reclaimed */);
-    _page = NULL;
-  }
+inline bool ZForwarding::in_place_relocation() const {
+  return _in_place;
 }
 
 inline ZForwardingEntry* ZForwarding::entries() const {
@@ -141,6 +141,9 @@ const size_t      ZMarkStripeShift              = ZGranuleSizeShift;
 // Max number of mark stripes
 const size_t      ZMarkStripesMax               = 16; // Must be a power of two
 
+// Min number of expected live bytes per mark stripe
+const size_t      ZMarkStripeLiveMin            = (size_t)1 << 25; // 32M
+
 // Mark cache size
 const size_t      ZMarkCacheSize                = 1024; // Must be a power of two
 
@@ -178,6 +178,11 @@ uint ZHeap::nconcurrent_no_boost_worker_threads() const {
 
 void ZHeap::set_boost_worker_threads(bool boost) {
   _workers.set_boost(boost);
+  _workers.update_nconcurrent();
+}
+
+void ZHeap::request_nconcurrent_worker_threads(uint nworkers) {
+  _workers.request_nconcurrent(nworkers);
 }
 
 void ZHeap::threads_do(ThreadClosure* tc) const {
@@ -411,6 +416,9 @@ void ZHeap::relocate_start() {
   // Flip address view
   flip_to_remapped();
 
+  // Update number of concurrent workers
+  _workers.update_nconcurrent();
+
   // Enter relocate phase
   ZGlobalPhase = ZPhaseRelocate;
 
@@ -424,11 +432,11 @@ void ZHeap::relocate_start() {
 
 void ZHeap::relocate() {
   // Relocate relocation set
-  const bool success = _relocate.relocate(&_relocation_set);
+  const size_t in_place_count = _relocate.relocate(&_relocation_set);
 
   // Update statistics
   ZStatSample(ZSamplerHeapUsedAfterRelocation, used());
-  ZStatRelocation::set_at_relocate_end(success);
+  ZStatRelocation::set_at_relocate_end(in_place_count);
   ZStatHeap::set_at_relocate_end(capacity(), allocated(), reclaimed(),
                                  used(), used_high(), used_low());
 }
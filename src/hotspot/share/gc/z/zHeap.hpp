@@ -97,6 +97,7 @@ public:
   uint nconcurrent_worker_threads() const;
   uint nconcurrent_no_boost_worker_threads() const;
   void set_boost_worker_threads(bool boost);
+  void request_nconcurrent_worker_threads(uint nworkers);
   void threads_do(ThreadClosure* tc) const;
 
   // Reference processing
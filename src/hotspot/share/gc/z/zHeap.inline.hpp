@@ -101,13 +101,7 @@ inline uintptr_t ZHeap::relocate_object(uintptr_t addr) {
   }
 
   // Relocate object
-  const bool retained = forwarding->retain_page();
-  const uintptr_t new_addr = _relocate.relocate_object(forwarding, addr);
-  if (retained) {
-    forwarding->release_page();
-  }
-
-  return new_addr;
+  return _relocate.relocate_object(forwarding, addr);
 }
 
 inline uintptr_t ZHeap::remap_object(uintptr_t addr) {
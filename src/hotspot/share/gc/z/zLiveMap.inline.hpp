@@ -143,13 +143,15 @@ inline void ZLiveMap::iterate_segment(ObjectClosure* cl, BitMap::idx_t segment,
     // Calculate object address
     const uintptr_t addr = page_start + ((index / 2) << page_object_alignment_shift);
 
-    // Apply closure
-    cl->do_object(ZOop::from_address(addr));
-
-    // Find next bit after this object
+    // Find next bit after this object. This is done before applying
+    // the closure, since in-place relocation can overwrite the object.
     const size_t size = ZUtils::object_size(addr);
     const uintptr_t next_addr = align_up(addr + size, 1 << page_object_alignment_shift);
     const BitMap::idx_t next_index = ((next_addr - page_start) >> page_object_alignment_shift) * 2;
+
+    // Apply closure
+    cl->do_object(ZOop::from_address(addr));
+
     if (next_index >= end_index) {
       // End of live map
       break;
@@ -51,6 +51,7 @@
 #include "runtime/stackWatermark.hpp"
 #include "runtime/stackWatermarkSet.inline.hpp"
 #include "runtime/thread.hpp"
+#include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
@@ -81,12 +82,21 @@ bool ZMark::is_initialized() const {
   return _allocator.is_initialized();
 }
 
-size_t ZMark::calculate_nstripes(uint nworkers) const {
+size_t ZMark::calculate_nstripes(uint nworkers, size_t live) const {
   // Calculate the number of stripes from the number of workers we use,
   // where the number of stripes must be a power of two and we want to
   // have at least one worker per stripe.
-  const size_t nstripes = round_down_power_of_2(nworkers);
-  return MIN2(nstripes, ZMarkStripesMax);
+  size_t nstripes = MIN2((size_t)round_down_power_of_2(nworkers), ZMarkStripesMax);
+
+  // Limit the number of stripes by the live set of the previous cycle.
+  // With a small live set, many stripes only cause workers to spend
+  // time stealing from other stripes and delay mark termination.
+  if (live > 0) {
+    const size_t nstripes_live = round_down_power_of_2(MAX2(live / ZMarkStripeLiveMin, (size_t)1));
+    nstripes = MIN2(nstripes, nstripes_live);
+  }
+
+  return nstripes;
 }
 
 void ZMark::prepare_mark() {
@@ -103,9 +113,9 @@ void ZMark::prepare_mark() {
   // Set number of workers to use
   _nworkers = _workers->nconcurrent();
 
-  // Set number of mark stripes to use, based on number
-  // of workers we will use in the concurrent mark phase.
-  const size_t nstripes = calculate_nstripes(_nworkers);
+  // Set number of mark stripes to use, based on number of workers
+  // we will use in the concurrent mark phase and the expected live set.
+  const size_t nstripes = calculate_nstripes(_nworkers, ZStatHeap::live_at_mark_end());
   _stripes.set_nstripes(nstripes);
 
   // Update statistics
@@ -396,10 +406,29 @@ bool ZMark::flush(bool at_safepoint) {
   return cl.flushed() || !_stripes.is_empty();
 }
 
+bool ZMark::has_java_thread_stacks() const {
+  // This check is racy, since Java threads can install new stacks at any
+  // time. That is fine, since a concurrent flush is only an attempt to find
+  // more work, and mark end flushes all threads at a safepoint anyway.
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* const thread = jtiwh.next(); ) {
+    if (!ZThreadLocalData::stacks(thread)->is_empty(&_stripes)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 bool ZMark::try_flush(volatile size_t* nflush) {
   Atomic::inc(nflush);
 
   ZStatTimer timer(ZSubPhaseConcurrentMarkTryFlush);
+
+  if (!has_java_thread_stacks()) {
+    // No Java thread has anything to flush, skip the handshake
+    return !_stripes.is_empty();
+  }
+
   return flush(false /* at_safepoint */);
 }
 
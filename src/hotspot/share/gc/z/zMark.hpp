@@ -54,7 +54,7 @@ private:
   size_t              _ncontinue;
   uint                _nworkers;
 
-  size_t calculate_nstripes(uint nworkers) const;
+  size_t calculate_nstripes(uint nworkers, size_t live) const;
   void prepare_mark();
 
   bool is_array(uintptr_t addr) const;
@@ -78,6 +78,7 @@ private:
                                              T* timeout);
   bool try_steal(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks);
   void idle() const;
+  bool has_java_thread_stacks() const;
   bool flush(bool at_safepoint);
   bool try_proactive_flush();
   bool try_flush(volatile size_t* nflush);
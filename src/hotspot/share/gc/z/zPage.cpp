@@ -63,6 +63,16 @@ void ZPage::reset() {
   _last_used = 0;
 }
 
+void ZPage::reset_for_in_place_relocation(uintptr_t top) {
+  assert(top >= start() && top <= end(), "Invalid top");
+
+  // The page now only contains objects that have been relocated
+  // during this cycle. Treat them as allocated in this cycle, which
+  // makes all of them implicitly live until the next mark start.
+  _seqnum = ZGlobalSeqNum;
+  _top = top;
+}
+
 ZPage* ZPage::retype(uint8_t type) {
   assert(_type != type, "Invalid retype");
   _type = type;
@@ -77,11 +77,13 @@ public:
 
   bool is_allocating() const;
   bool is_relocatable() const;
+  bool is_young() const;
 
   uint64_t last_used() const;
   void set_last_used();
 
   void reset();
+  void reset_for_in_place_relocation(uintptr_t top);
 
   ZPage* retype(uint8_t type);
   ZPage* split(size_t size);
@@ -152,6 +152,12 @@ inline bool ZPage::is_relocatable() const {
   return _seqnum < ZGlobalSeqNum;
 }
 
+inline bool ZPage::is_young() const {
+  // Allocated after the previous mark start, i.e. the
+  // page has not yet been part of a completed cycle.
+  return _seqnum == ZGlobalSeqNum - 1;
+}
+
 inline uint64_t ZPage::last_used() const {
   return _last_used;
 }
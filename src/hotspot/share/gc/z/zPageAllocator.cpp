@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/gcLogPrecious.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zFuture.inline.hpp"
 #include "gc/z/zGlobals.hpp"
@@ -389,6 +390,48 @@ void ZPageAllocator::unmap_page(const ZPage* page) const {
   _physical.unmap(page->start(), page->size());
 }
 
+static int compare_page_start(ZPage** page1, ZPage** page2) {
+  const uintptr_t start1 = (*page1)->start();
+  const uintptr_t start2 = (*page2)->start();
+  return (start1 < start2) ? -1 : ((start1 > start2) ? 1 : 0);
+}
+
+size_t ZPageAllocator::unmap_pages(ZArray<ZPage*>* pages) const {
+  // Sort pages by address, so that adjacent pages can be unmapped
+  // using a single operation. Returns the number of unmapped ranges.
+  pages->sort(compare_page_start);
+
+  size_t nranges = 0;
+  uintptr_t start = 0;
+  size_t size = 0;
+
+  ZArrayIterator<ZPage*> iter(pages);
+  for (ZPage* page; iter.next(&page);) {
+    if (size > 0 && page->start() == start + size) {
+      // Coalesce with current range
+      size += page->size();
+      continue;
+    }
+
+    if (size > 0) {
+      // Unmap current range
+      _physical.unmap(start, size);
+      nranges++;
+    }
+
+    start = page->start();
+    size = page->size();
+  }
+
+  if (size > 0) {
+    // Unmap last range
+    _physical.unmap(start, size);
+    nranges++;
+  }
+
+  return nranges;
+}
+
 void ZPageAllocator::destroy_page(ZPage* page) {
   // Free virtual memory
   _virtual.free(page->virtual_memory());
@@ -783,9 +826,16 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   }
 
   // Unmap, uncommit, and destroy flushed pages
+  ZArray<ZPage*> unmap;
   ZListRemoveIterator<ZPage> iter(&pages);
   for (ZPage* page; iter.next(&page);) {
-    unmap_page(page);
+    unmap.append(page);
+  }
+
+  unmap_pages(&unmap);
+
+  ZArrayIterator<ZPage*> unmap_iter(&unmap);
+  for (ZPage* page; unmap_iter.next(&page);) {
     uncommit_page(page);
     destroy_page(page);
   }
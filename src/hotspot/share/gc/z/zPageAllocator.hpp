@@ -25,6 +25,7 @@
 #define SHARE_GC_Z_ZPAGEALLOCATOR_HPP
 
 #include "gc/z/zAllocationFlags.hpp"
+#include "gc/z/zArray.hpp"
 #include "gc/z/zList.hpp"
 #include "gc/z/zLock.hpp"
 #include "gc/z/zPageCache.hpp"
@@ -79,6 +80,7 @@ private:
 
   void map_page(const ZPage* page) const;
   void unmap_page(const ZPage* page) const;
+  size_t unmap_pages(ZArray<ZPage*>* pages) const;
 
   void destroy_page(ZPage* page);
 
@@ -36,6 +36,8 @@
 #include "gc/z/zThread.inline.hpp"
 #include "gc/z/zWorkers.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
 
 static const ZStatCounter ZCounterRelocationContention("Contention", "Relocation Contention", ZStatUnitOpsPerSecond);
 
@@ -89,18 +91,13 @@ uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t fr
 
   assert(ZHeap::heap()->is_object_live(ZAddress::good(from_offset)), "Should be live");
 
-  if (forwarding->is_pinned()) {
-    // In-place forward
-    return forwarding->insert(from_index, from_offset, &cursor);
-  }
-
   // Allocate object
   const uintptr_t from_good = ZAddress::good(from_offset);
   const size_t size = ZUtils::object_size(from_good);
   const uintptr_t to_good = ZHeap::heap()->alloc_object_for_relocation(size);
   if (to_good == 0) {
-    // Failed, in-place forward
-    return forwarding->insert(from_index, from_offset, &cursor);
+    // Failed
+    return 0;
   }
 
   // Copy object
@@ -126,17 +123,62 @@ uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t fr
   return to_offset_final;
 }
 
-uintptr_t ZRelocate::relocate_object(ZForwarding* forwarding, uintptr_t from_addr) const {
+uintptr_t ZRelocate::relocate_object_in_place(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset, uintptr_t top) const {
+  assert(forwarding->in_place_relocation(), "Page not claimed");
+
+  ZForwardingCursor cursor;
+
+  // Lookup forwarding entry
+  const ZForwardingEntry entry = forwarding->find(from_index, &cursor);
+  if (entry.populated() && entry.from_index() == from_index) {
+    // Already relocated, top is unchanged
+    return top;
+  }
+
+  assert(ZHeap::heap()->is_object_live(ZAddress::good(from_offset)), "Should be live");
+  assert(top <= from_offset, "Invalid top");
+
+  // Slide object down to top. All objects below this object have
+  // already been relocated, so the destination only overlaps memory
+  // that is free or belongs to this object itself.
+  const uintptr_t from_good = ZAddress::good(from_offset);
+  const size_t size = ZUtils::object_size(from_good);
+  ZUtils::object_copy_conjoint(from_good, ZAddress::good(top), size);
+
+  // Insert forwarding entry. The page has been claimed, so no other
+  // thread can insert an entry for this object.
+  const uintptr_t to_offset_final = forwarding->insert(from_index, top, &cursor);
+  assert(to_offset_final == top, "Invalid forwarding");
+
+  return top + align_up(size, forwarding->page()->object_alignment());
+}
+
+uintptr_t ZRelocate::relocate_object(ZForwarding* forwarding, uintptr_t from_addr) {
   const uintptr_t from_offset = ZAddress::offset(from_addr);
   const uintptr_t from_index = (from_offset - forwarding->start()) >> forwarding->object_alignment_shift();
-  const uintptr_t to_offset = relocate_object_inner(forwarding, from_index, from_offset);
 
-  if (from_offset == to_offset) {
-    // In-place forwarding, pin page
-    forwarding->set_pinned();
+  // Relocate object
+  if (forwarding->retain_page()) {
+    const uintptr_t to_offset = relocate_object_inner(forwarding, from_index, from_offset);
+    forwarding->release_page();
+
+    if (to_offset != 0) {
+      return ZAddress::good(to_offset);
+    }
+
+    // Failed to relocate object. A worker thread will relocate the rest of
+    // this page in place. Wait for that to complete, and then forward the
+    // object. In a pause there are no concurrent workers, so relocate the
+    // page here instead.
+    if (SafepointSynchronize::is_at_safepoint()) {
+      relocate_page(forwarding);
+    } else {
+      forwarding->wait_page_released();
+    }
   }
 
-  return ZAddress::good(to_offset);
+  // Forward object
+  return forward_object(forwarding, from_addr);
 }
 
 uintptr_t ZRelocate::forward_object(ZForwarding* forwarding, uintptr_t from_addr) const {
@@ -152,70 +194,110 @@ uintptr_t ZRelocate::forward_object(ZForwarding* forwarding, uintptr_t from_addr
 
 class ZRelocateObjectClosure : public ObjectClosure {
 private:
-  ZRelocate* const   _relocate;
-  ZForwarding* const _forwarding;
+  const ZRelocate* const _relocate;
+  ZForwarding* const     _forwarding;
+  uintptr_t              _in_place_top;
 
 public:
-  ZRelocateObjectClosure(ZRelocate* relocate, ZForwarding* forwarding) :
+  ZRelocateObjectClosure(const ZRelocate* relocate, ZForwarding* forwarding) :
       _relocate(relocate),
-      _forwarding(forwarding) {}
+      _forwarding(forwarding),
+      _in_place_top(0) {}
 
   virtual void do_object(oop o) {
-    _relocate->relocate_object(_forwarding, ZOop::to_address(o));
+    const uintptr_t from_offset = ZAddress::offset(ZOop::to_address(o));
+    const uintptr_t from_index = (from_offset - _forwarding->start()) >> _forwarding->object_alignment_shift();
+
+    if (!_forwarding->in_place_relocation()) {
+      if (!ZStressRelocateInPlace &&
+          _relocate->relocate_object_inner(_forwarding, from_index, from_offset) != 0) {
+        // Relocated
+        return;
+      }
+
+      // Failed to allocate a target, relocate the rest of the page in
+      // place, starting from the bottom of the page.
+      _forwarding->in_place_relocation_claim_page();
+      _in_place_top = _forwarding->start();
+    }
+
+    _in_place_top = _relocate->relocate_object_in_place(_forwarding, from_index, from_offset, _in_place_top);
+  }
+
+  uintptr_t in_place_top() const {
+    return _in_place_top;
   }
 };
 
-bool ZRelocate::work(ZRelocationSetParallelIterator* iter) {
-  bool success = true;
+bool ZRelocate::relocate_page(ZForwarding* forwarding) {
+  if (forwarding->is_page_released()) {
+    // Already relocated
+    return false;
+  }
 
-  // Relocate pages in the relocation set
-  for (ZForwarding* forwarding; iter->next(&forwarding);) {
-    // Relocate objects in page
-    ZRelocateObjectClosure cl(this, forwarding);
-    forwarding->page()->object_iterate(&cl);
+  // Relocate objects in page
+  ZRelocateObjectClosure cl(this, forwarding);
+  forwarding->page()->object_iterate(&cl);
 
-    if (ZVerifyForwarding) {
-      forwarding->verify();
-    }
+  if (ZVerifyForwarding) {
+    forwarding->verify();
+  }
 
-    if (forwarding->is_pinned()) {
-      // Relocation failed, page is now pinned
-      success = false;
-    } else {
-      // Relocation succeeded, release page
-      forwarding->release_page();
+  const bool in_place = forwarding->in_place_relocation();
+  if (in_place) {
+    // Page relocated in place, keep it
+    forwarding->page()->reset_for_in_place_relocation(cl.in_place_top());
+    log_debug(gc, reloc)("In-place relocation of %s page " PTR_FORMAT,
+                         forwarding->page()->type() == ZPageTypeSmall ? "small" : "medium",
+                         forwarding->start());
+  }
+
+  // Release page
+  forwarding->release_page();
+
+  return in_place;
+}
+
+size_t ZRelocate::work(ZRelocationSetParallelIterator* iter) {
+  size_t in_place_count = 0;
+
+  // Relocate pages in the relocation set
+  for (ZForwarding* forwarding; iter->next(&forwarding);) {
+    if (relocate_page(forwarding)) {
+      in_place_count++;
     }
   }
 
-  return success;
+  return in_place_count;
 }
 
 class ZRelocateTask : public ZTask {
 private:
   ZRelocate* const               _relocate;
   ZRelocationSetParallelIterator _iter;
-  bool                           _failed;
+  volatile size_t                _in_place_count;
 
 public:
   ZRelocateTask(ZRelocate* relocate, ZRelocationSet* relocation_set) :
       ZTask("ZRelocateTask"),
       _relocate(relocate),
       _iter(relocation_set),
-      _failed(false) {}
+      _in_place_count(0) {}
 
   virtual void work() {
-    if (!_relocate->work(&_iter)) {
-      _failed = true;
+    const size_t in_place_count = _relocate->work(&_iter);
+    if (in_place_count > 0) {
+      Atomic::add(&_in_place_count, in_place_count);
     }
   }
 
-  bool failed() const {
-    return _failed;
+  size_t in_place_count() const {
+    return _in_place_count;
   }
 };
 
-bool ZRelocate::relocate(ZRelocationSet* relocation_set) {
+size_t ZRelocate::relocate(ZRelocationSet* relocation_set) {
   ZRelocateTask task(this, relocation_set);
   _workers->run_concurrent(&task);
-  return !task.failed();
+  return task.in_place_count();
 }
@@ -30,6 +30,7 @@ class ZRelocationSetParallelIterator;
 class ZWorkers;
 
 class ZRelocate {
+  friend class ZRelocateObjectClosure;
   friend class ZRelocateTask;
 
 private:
@@ -37,16 +38,18 @@ private:
 
   ZForwarding* forwarding_for_page(ZPage* page) const;
   uintptr_t relocate_object_inner(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset) const;
-  bool work(ZRelocationSetParallelIterator* iter);
+  uintptr_t relocate_object_in_place(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset, uintptr_t top) const;
+  bool relocate_page(ZForwarding* forwarding);
+  size_t work(ZRelocationSetParallelIterator* iter);
 
 public:
   ZRelocate(ZWorkers* workers);
 
-  uintptr_t relocate_object(ZForwarding* forwarding, uintptr_t from_addr) const;
+  uintptr_t relocate_object(ZForwarding* forwarding, uintptr_t from_addr);
   uintptr_t forward_object(ZForwarding* forwarding, uintptr_t from_addr) const;
 
   void start();
-  bool relocate(ZRelocationSet* relocation_set);
+  size_t relocate(ZRelocationSet* relocation_set);
 };
 
 #endif // SHARE_GC_Z_ZRELOCATE_HPP
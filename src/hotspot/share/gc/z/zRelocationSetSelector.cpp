@@ -39,7 +39,9 @@ ZRelocationSetSelectorGroupStats::ZRelocationSetSelectorGroupStats() :
     _garbage(0),
     _empty(0),
     _compacting_from(0),
-    _compacting_to(0) {}
+    _compacting_to(0),
+    _young_total(0),
+    _young_garbage(0) {}
 
 ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
                                                          uint8_t page_type,
@@ -73,6 +75,11 @@ void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
   _stats._total += size;
   _stats._live += live;
   _stats._garbage += garbage;
+
+  if (page->is_young()) {
+    _stats._young_total += size;
+    _stats._young_garbage += garbage;
+  }
 }
 
 void ZRelocationSetSelectorGroup::register_garbage_page(ZPage* page) {
@@ -82,6 +89,11 @@ void ZRelocationSetSelectorGroup::register_garbage_page(ZPage* page) {
   _stats._total += size;
   _stats._garbage += size;
   _stats._empty += size;
+
+  if (page->is_young()) {
+    _stats._young_total += size;
+    _stats._young_garbage += size;
+  }
 }
 
 bool ZRelocationSetSelectorGroup::is_disabled() {
@@ -41,6 +41,8 @@ private:
   size_t _empty;
   size_t _compacting_from;
   size_t _compacting_to;
+  size_t _young_total;
+  size_t _young_garbage;
 
 public:
   ZRelocationSetSelectorGroupStats();
@@ -52,6 +54,8 @@ public:
   size_t empty() const;
   size_t compacting_from() const;
   size_t compacting_to() const;
+  size_t young_total() const;
+  size_t young_garbage() const;
 };
 
 class ZRelocationSetSelectorStats {
@@ -54,6 +54,14 @@ inline size_t ZRelocationSetSelectorGroupStats::compacting_to() const {
   return _compacting_to;
 }
 
+inline size_t ZRelocationSetSelectorGroupStats::young_total() const {
+  return _young_total;
+}
+
+inline size_t ZRelocationSetSelectorGroupStats::young_garbage() const {
+  return _young_garbage;
+}
+
 inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::small() const {
   return _small;
 }
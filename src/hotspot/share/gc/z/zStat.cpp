@@ -829,6 +829,10 @@ uint64_t ZStatAllocRate::sample_and_reset() {
   return bytes_per_second;
 }
 
+double ZStatAllocRate::last() {
+  return _rate.num() > 0 ? _rate.last() : 0.0;
+}
+
 double ZStatAllocRate::avg() {
   return _rate.avg();
 }
@@ -837,6 +841,12 @@ double ZStatAllocRate::avg_sd() {
   return _rate_avg.sd();
 }
 
+double ZStatAllocRate::predict() {
+  // Linear prediction of the next sample, which follows trends
+  // in the allocation rate faster than the moving average.
+  return MAX2(_rate.predict_next(), 0.0);
+}
+
 //
 // Stat thread
 //
@@ -1140,14 +1150,14 @@ void ZStatMark::print() {
 // Stat relocation
 //
 ZRelocationSetSelectorStats ZStatRelocation::_stats;
-bool                        ZStatRelocation::_success;
+size_t                      ZStatRelocation::_in_place_count;
 
 void ZStatRelocation::set_at_select_relocation_set(const ZRelocationSetSelectorStats& stats) {
   _stats = stats;
 }
 
-void ZStatRelocation::set_at_relocate_end(bool success) {
-  _success = success;
+void ZStatRelocation::set_at_relocate_end(size_t in_place_count) {
+  _in_place_count = in_place_count;
 }
 
 void ZStatRelocation::print(const char* name, const ZRelocationSetSelectorGroupStats& group) {
@@ -1160,6 +1170,11 @@ void ZStatRelocation::print(const char* name, const ZRelocationSetSelectorGroupS
                       ZSIZE_ARGS_WITH_MAX(group.empty(), total),
                       ZSIZE_ARGS_WITH_MAX(group.compacting_from(), total),
                       ZSIZE_ARGS_WITH_MAX(group.compacting_to(), total));
+
+  log_debug(gc, reloc)("%s Pages: Young " ZSIZE_FMT ", Young Garbage " ZSIZE_FMT,
+                       name,
+                       ZSIZE_ARGS_WITH_MAX(group.young_total(), total),
+                       ZSIZE_ARGS_WITH_MAX(group.young_garbage(), group.young_total()));
 }
 
 void ZStatRelocation::print() {
@@ -1169,7 +1184,7 @@ void ZStatRelocation::print() {
   }
   print("Large", _stats.large());
 
-  log_info(gc, reloc)("Relocation: %s", _success ? "Successful" : "Incomplete");
+  log_info(gc, reloc)("Relocation: Successful, In-Place: " SIZE_FORMAT, _in_place_count);
 }
 
 //
@@ -1361,6 +1376,10 @@ size_t ZStatHeap::used_at_relocate_end() {
   return _at_relocate_end.used;
 }
 
+size_t ZStatHeap::live_at_mark_end() {
+  return _at_mark_end.live;
+}
+
 void ZStatHeap::print() {
   log_info(gc, heap)("Min Capacity: "
                      ZSIZE_FMT, ZSIZE_ARGS(_at_initialize.min_capacity));
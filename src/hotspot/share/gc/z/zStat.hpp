@@ -340,8 +340,10 @@ public:
   static const ZStatUnsampledCounter& counter();
   static uint64_t sample_and_reset();
 
+  static double last();
   static double avg();
   static double avg_sd();
+  static double predict();
 };
 
 //
@@ -423,13 +425,13 @@ public:
 class ZStatRelocation : public AllStatic {
 private:
   static ZRelocationSetSelectorStats _stats;
-  static bool                        _success;
+  static size_t                      _in_place_count;
 
   static void print(const char* name, const ZRelocationSetSelectorGroupStats& group);
 
 public:
   static void set_at_select_relocation_set(const ZRelocationSetSelectorStats& stats);
-  static void set_at_relocate_end(bool success);
+  static void set_at_relocate_end(size_t in_place_count);
 
   static void print();
 };
@@ -561,6 +563,7 @@ public:
   static size_t max_capacity();
   static size_t used_at_mark_start();
   static size_t used_at_relocate_end();
+  static size_t live_at_mark_end();
 
   static void print();
 };
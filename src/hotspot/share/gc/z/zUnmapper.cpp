@@ -22,12 +22,14 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zList.inline.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zUnmapper.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "logging/log.hpp"
 #include "runtime/globals.hpp"
 
 ZUnmapper::ZUnmapper(ZPageAllocator* page_allocator) :
@@ -39,30 +41,47 @@ ZUnmapper::ZUnmapper(ZPageAllocator* page_allocator) :
   create_and_start();
 }
 
-ZPage* ZUnmapper::dequeue() {
+bool ZUnmapper::dequeue(ZArray<ZPage*>* pages) {
   ZLocker<ZConditionLock> locker(&_lock);
 
   for (;;) {
     if (_stop) {
-      return NULL;
+      return false;
     }
 
-    ZPage* const page = _queue.remove_first();
-    if (page != NULL) {
-      return page;
+    // Dequeue all pages, to unmap them as one batch
+    for (ZPage* page; (page = _queue.remove_first()) != NULL;) {
+      pages->append(page);
+    }
+
+    if (pages->length() > 0) {
+      return true;
     }
 
     _lock.wait();
   }
 }
 
-void ZUnmapper::do_unmap_and_destroy_page(ZPage* page) const {
+void ZUnmapper::do_unmap_and_destroy_pages(ZArray<ZPage*>* pages) const {
   EventZUnmap event;
-  const size_t unmapped = page->size();
+  size_t unmapped = 0;
 
-  // Unmap and destroy
-  _page_allocator->unmap_page(page);
-  _page_allocator->destroy_page(page);
+  ZArrayIterator<ZPage*> iter1(pages);
+  for (ZPage* page; iter1.next(&page);) {
+    unmapped += page->size();
+  }
+
+  // Unmap, coalescing adjacent pages
+  const size_t nranges = _page_allocator->unmap_pages(pages);
+
+  // Destroy
+  ZArrayIterator<ZPage*> iter2(pages);
+  for (ZPage* page; iter2.next(&page);) {
+    _page_allocator->destroy_page(page);
+  }
+
+  log_trace(gc, heap)("Unmapped: " SIZE_FORMAT "M, %d pages, " SIZE_FORMAT " ranges",
+                      unmapped / M, pages->length(), nranges);
 
   // Send event
   event.commit(unmapped);
@@ -72,7 +91,9 @@ void ZUnmapper::unmap_and_destroy_page(ZPage* page) {
   // Asynchronous unmap and destroy is not supported with ZVerifyViews
   if (ZVerifyViews) {
     // Immediately unmap and destroy
-    do_unmap_and_destroy_page(page);
+    ZArray<ZPage*> pages;
+    pages.append(page);
+    do_unmap_and_destroy_pages(&pages);
   } else {
     // Enqueue for asynchronous unmap and destroy
     ZLocker<ZConditionLock> locker(&_lock);
@@ -82,14 +103,11 @@ void ZUnmapper::unmap_and_destroy_page(ZPage* page) {
 }
 
 void ZUnmapper::run_service() {
-  for (;;) {
-    ZPage* const page = dequeue();
-    if (page == NULL) {
-      // Stop
-      return;
-    }
+  ZArray<ZPage*> pages;
 
-    do_unmap_and_destroy_page(page);
+  while (dequeue(&pages)) {
+    do_unmap_and_destroy_pages(&pages);
+    pages.clear();
   }
 }
 
@@ -25,6 +25,7 @@
 #define SHARE_GC_Z_ZUNMAPPER_HPP
 
 #include "gc/shared/concurrentGCThread.hpp"
+#include "gc/z/zArray.hpp"
 #include "gc/z/zList.hpp"
 #include "gc/z/zLock.hpp"
 
@@ -38,8 +39,8 @@ private:
   ZList<ZPage>          _queue;
   bool                  _stop;
 
-  ZPage* dequeue();
-  void do_unmap_and_destroy_page(ZPage* page) const;
+  bool dequeue(ZArray<ZPage*>* pages);
+  void do_unmap_and_destroy_pages(ZArray<ZPage*>* pages) const;
 
 protected:
   virtual void run_service();
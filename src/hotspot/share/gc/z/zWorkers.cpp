@@ -26,9 +26,11 @@
 #include "gc/z/zTask.hpp"
 #include "gc/z/zThread.hpp"
 #include "gc/z/zWorkers.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
 
 class ZWorkersInitializeTask : public ZTask {
 private:
@@ -65,6 +67,8 @@ public:
 
 ZWorkers::ZWorkers() :
     _boost(false),
+    _nconcurrent(nconcurrent_no_boost()),
+    _nconcurrent_request(nconcurrent_no_boost()),
     _workers("ZWorker",
              nworkers(),
              true /* are_GC_task_threads */,
@@ -94,6 +98,21 @@ void ZWorkers::set_boost(bool boost) {
   _boost = boost;
 }
 
+void ZWorkers::request_nconcurrent(uint nworkers) {
+  // The request takes effect at the start of the next mark or relocate phase
+  Atomic::store(&_nconcurrent_request, clamp(nworkers, 1u, nconcurrent_no_boost()));
+}
+
+void ZWorkers::update_nconcurrent() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  const uint nconcurrent = Atomic::load(&_nconcurrent_request);
+  if (nconcurrent != _nconcurrent) {
+    log_debug(gc)("Concurrent workers: %u -> %u", _nconcurrent, nconcurrent);
+    _nconcurrent = nconcurrent;
+  }
+}
+
 void ZWorkers::run(ZTask* task, uint nworkers) {
   log_debug(gc, task)("Executing Task: %s, Active Workers: %u", task->name(), nworkers);
   _workers.update_active_workers(nworkers);
@@ -31,8 +31,10 @@ class ZTask;
 
 class ZWorkers {
 private:
-  bool     _boost;
-  WorkGang _workers;
+  bool          _boost;
+  uint          _nconcurrent;
+  volatile uint _nconcurrent_request;
+  WorkGang      _workers;
 
   void run(ZTask* task, uint nworkers);
 
@@ -47,6 +49,9 @@ public:
 
   void set_boost(bool boost);
 
+  void request_nconcurrent(uint nworkers);
+  void update_nconcurrent();
+
   void run_serial(ZTask* task);
   void run_parallel(ZTask* task);
   void run_concurrent(ZTask* task);
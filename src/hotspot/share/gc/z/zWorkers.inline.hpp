@@ -36,7 +36,7 @@ inline uint ZWorkers::nparallel_no_boost() const {
 }
 
 inline uint ZWorkers::nconcurrent() const {
-  return _boost ? nworkers() : nconcurrent_no_boost();
+  return _boost ? nworkers() : _nconcurrent;
 }
 
 inline uint ZWorkers::nconcurrent_no_boost() const {
@@ -36,6 +36,8 @@
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/vmThread.hpp"
 
@@ -290,3 +292,64 @@ void BootstrapInfo::print_msg_on(outputStream* st, const char* msg) {
     }
   }
 }
+
+//------------------------------------------------------------------------------------------------------------------------
+// Implementation of IndyBootstrapClaim
+
+ConstantPoolCacheEntry* IndyBootstrapClaim::_sites[IndyBootstrapClaim::max_claims] = { NULL };
+Thread* IndyBootstrapClaim::_owners[IndyBootstrapClaim::max_claims] = { NULL };
+
+IndyBootstrapClaim::IndyBootstrapClaim(ConstantPoolCacheEntry* site, Thread* thread)
+  : _slot(-1), _waited(false)
+{
+  MonitorLocker ml(InvokeDynamicClaim_lock);
+  jlong deadline = os::javaTimeNanos() + max_wait_millis * NANOSECS_PER_MILLISEC;
+  while (true) {
+    int free_slot = -1;
+    int owner_slot = -1;
+    for (int i = 0; i < max_claims; i++) {
+      if (_sites[i] == site) {
+        owner_slot = i;
+        break;
+      }
+      if (_sites[i] == NULL && free_slot == -1) {
+        free_slot = i;
+      }
+    }
+    if (owner_slot == -1) {
+      if (free_slot != -1) {
+        _sites[free_slot] = site;
+        _owners[free_slot] = thread;
+        _slot = free_slot;
+      }
+      return;
+    }
+    if (_owners[owner_slot] == thread) {
+      // Recursive bootstrap of the same site.
+      return;
+    }
+    jlong remaining_millis = (deadline - os::javaTimeNanos()) / NANOSECS_PER_MILLISEC;
+    if (remaining_millis <= 0) {
+      // The owner cannot release its slot while we hold the lock, so it is
+      // still alive.  Only a blocked owner can be waiting for us.
+      JavaThreadState state = _owners[owner_slot]->as_Java_thread()->thread_state();
+      if (state == _thread_blocked) {
+        log_debug(methodhandles, indy)("gave up waiting for the bootstrap of call site " PTR_FORMAT, p2i(site));
+        return;
+      }
+      deadline = os::javaTimeNanos() + max_wait_millis * NANOSECS_PER_MILLISEC;
+      remaining_millis = max_wait_millis;
+    }
+    _waited = true;
+    ml.wait(remaining_millis);
+  }
+}
+
+IndyBootstrapClaim::~IndyBootstrapClaim() {
+  if (_slot != -1) {
+    MonitorLocker ml(InvokeDynamicClaim_lock);
+    _sites[_slot] = NULL;
+    _owners[_slot] = NULL;
+    ml.notify_all();
+  }
+}
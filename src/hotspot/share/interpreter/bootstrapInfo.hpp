@@ -117,4 +117,37 @@ class BootstrapInfo : public StackObj {
   void print_msg_on(outputStream* st, const char* msg = NULL);
 };
 
+// IndyBootstrapClaim lets one thread at a time run the bootstrap method of an
+// invokedynamic call site.  Other threads resolving the same site wait for
+// the claim to be released and then use the linkage it produced, instead of
+// running the bootstrap method only to have their result discarded.
+// The wait is bounded: a bootstrap method that depends on a waiting thread,
+// for instance on a class that thread is initializing, must not deadlock, so
+// once the claiming thread has been blocked for max_wait_millis the waiter
+// goes on to bootstrap the site itself, as JVMS 5.4.3 allows.  A slow
+// bootstrap method that keeps running is waited for.  A thread re-entering a
+// site it has claimed does not wait, and if all slots are taken the site is
+// resolved without a claim.
+// The claim is released after the caller has bound the call site or recorded
+// its LinkageError.  Other errors are not recorded (see resolve_dynamic_call),
+// so waiters then run the bootstrap method themselves.
+class IndyBootstrapClaim : public StackObj {
+  static const int max_claims = 64;
+  static const jlong max_wait_millis = 100;
+
+  // Call sites being bootstrapped and their claiming threads, guarded by InvokeDynamicClaim_lock.
+  static ConstantPoolCacheEntry* _sites[max_claims];
+  static Thread* _owners[max_claims];
+
+  int  _slot;    // claimed slot, or -1
+  bool _waited;  // has this thread waited for another thread's claim?
+
+ public:
+  IndyBootstrapClaim(ConstantPoolCacheEntry* site, Thread* thread);
+  ~IndyBootstrapClaim();
+
+  // If true, the caller should check whether the site has been linked meanwhile.
+  bool waited() const { return _waited; }
+};
+
 #endif // SHARE_INTERPRETER_BOOTSTRAPINFO_HPP
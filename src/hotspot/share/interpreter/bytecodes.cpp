@@ -511,6 +511,10 @@ void Bytecodes::initialize() {
   def(_fast_iaccess_0      , "fast_iaccess_0"      , "b_JJ" , NULL    , T_INT    ,  1, true , _aload_0        );
   def(_fast_aaccess_0      , "fast_aaccess_0"      , "b_JJ" , NULL    , T_OBJECT ,  1, true , _aload_0        );
   def(_fast_faccess_0      , "fast_faccess_0"      , "b_JJ" , NULL    , T_OBJECT ,  1, true , _aload_0        );
+  // The getfield index can't be described next to the local index (mixed byte orders).
+  def(_fast_iaccess        , "fast_iaccess"        , "bi___", NULL    , T_INT    ,  1, true , _aload          );
+  def(_fast_aaccess        , "fast_aaccess"        , "bi___", NULL    , T_OBJECT ,  1, true , _aload          );
+  def(_fast_faccess        , "fast_faccess"        , "bi___", NULL    , T_FLOAT  ,  1, true , _aload          );
 
   def(_fast_iload          , "fast_iload"          , "bi"   , NULL    , T_INT    ,  1, false, _iload);
   def(_fast_iload2         , "fast_iload2"         , "bi_i" , NULL    , T_INT    ,  2, false, _iload);
@@ -269,6 +269,9 @@ class Bytecodes: AllStatic {
     _fast_iaccess_0       ,
     _fast_aaccess_0       ,
     _fast_faccess_0       ,
+    _fast_iaccess         ,
+    _fast_aaccess         ,
+    _fast_faccess         ,
 
     _fast_iload           ,
     _fast_iload2          ,
@@ -1751,6 +1751,13 @@ void LinkResolver::resolve_invokedynamic(CallInfo& result, const constantPoolHan
   // set the indy_rf flag since any subsequent invokedynamic instruction which shares
   // this bootstrap method will encounter the resolution of MethodHandleInError.
 
+  IndyBootstrapClaim claim(cpce, THREAD);
+  if (claim.waited()) {
+    // Another thread has bootstrapped this call site while we waited.
+    bool is_done = bootstrap_specifier.resolve_previously_linked_invokedynamic(result, CHECK);
+    if (is_done) return;
+  }
+
   resolve_dynamic_call(result, bootstrap_specifier, CHECK);
 
   LogTarget(Debug, methodhandles, indy) lt_indy;
@@ -1761,10 +1768,12 @@ void LinkResolver::resolve_invokedynamic(CallInfo& result, const constantPoolHan
 
   // The returned linkage result is provisional up to the moment
   // the interpreter or runtime performs a serialized check of
-  // the relevant CPCE::f1 field.  This is done by the caller
-  // of this method, via CPCE::set_dynamic_call, which uses
-  // an ObjectLocker to do the final serialization of updates
-  // to CPCE state, including f1.
+  // the relevant CPCE::f1 field.  This is done by CPCE::set_dynamic_call,
+  // which uses an ObjectLocker to do the final serialization of updates
+  // to CPCE state, including f1.  We bind the call site here, before the
+  // claim is released, so that threads waiting on the claim find it linked;
+  // the caller's own call to CPCE::set_dynamic_call then does nothing.
+  cpce->set_dynamic_call(pool, result);
 }
 
 void LinkResolver::resolve_dynamic_call(CallInfo& result,
@@ -433,7 +433,7 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
 
-OopMapCache::OopMapCache() {
+OopMapCache::OopMapCache() : _size(OopMapCacheSize) {
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = NULL;
 }
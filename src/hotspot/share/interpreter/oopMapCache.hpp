@@ -32,7 +32,8 @@
 // The memory management system uses the cache when locating object
 // references in an interpreted frame.
 //
-// OopMapCache's are allocated lazily per InstanceKlass.
+// OopMapCache's are allocated lazily per InstanceKlass, with
+// OopMapCacheSize entries each.
 
 // The oopMap (InterpreterOopMap) is stored as a bit mask. If the
 // bit_mask can fit into two words it is stored in
@@ -147,10 +148,10 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  enum { _size        = 32,     // Use fixed size for now
-         _probe_depth = 3       // probe depth in case of collisions
+  enum { _probe_depth = 3       // probe depth in case of collisions
   };
 
+  const int _size;              // OopMapCacheSize when created
   OopMapCacheEntry* volatile * _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
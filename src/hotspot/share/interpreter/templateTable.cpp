@@ -474,6 +474,16 @@ void TemplateTable::initialize() {
   def(Bytecodes::_fast_iaccess_0      , ubcp|____|____|____, vtos, itos, fast_xaccess        ,  itos        );
   def(Bytecodes::_fast_aaccess_0      , ubcp|____|____|____, vtos, atos, fast_xaccess        ,  atos        );
   def(Bytecodes::_fast_faccess_0      , ubcp|____|____|____, vtos, ftos, fast_xaccess        ,  ftos        );
+#if defined(X86) || defined(AARCH64)
+  def(Bytecodes::_fast_iaccess        , ubcp|____|____|____, vtos, itos, fast_aload_xaccess  ,  itos        );
+  def(Bytecodes::_fast_aaccess        , ubcp|____|____|____, vtos, atos, fast_aload_xaccess  ,  atos        );
+  def(Bytecodes::_fast_faccess        , ubcp|____|____|____, vtos, ftos, fast_aload_xaccess  ,  ftos        );
+#else
+  // Not generated by the aload template on this platform.
+  def(Bytecodes::_fast_iaccess        , ____|____|____|____, vtos, vtos, shouldnotreachhere  ,  _           );
+  def(Bytecodes::_fast_aaccess        , ____|____|____|____, vtos, vtos, shouldnotreachhere  ,  _           );
+  def(Bytecodes::_fast_faccess        , ____|____|____|____, vtos, vtos, shouldnotreachhere  ,  _           );
+#endif
 
   def(Bytecodes::_fast_iload          , ubcp|____|____|____, vtos, itos, fast_iload          ,  _       );
   def(Bytecodes::_fast_iload2         , ubcp|____|____|____, vtos, itos, fast_iload2         ,  _       );
@@ -309,6 +309,8 @@ class TemplateTable: AllStatic {
   static void multianewarray();
 
   static void fast_xaccess(TosState state);
+  static void fast_aload_xaccess(TosState state);
+  static void fast_xaccess_field(TosState state, int getfield_offset);
   static void fast_accessfield(TosState state);
   static void fast_storefield(TosState state);
 
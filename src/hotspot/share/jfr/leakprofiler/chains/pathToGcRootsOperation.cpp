@@ -53,11 +53,13 @@ PathToGcRootsOperation::PathToGcRootsOperation(ObjectSampler* sampler, EdgeStore
 /* The EdgeQueue is backed by directly managed virtual memory.
  * We will attempt to dimension an initial reservation
  * in proportion to the size of the heap (represented by heap_region).
- * Initial memory reservation: 5% of the heap OR at least 32 Mb
+ * Initial memory reservation: 5% of the heap OR at least 32 Mb,
+ * but no more than LeakProfilerEdgeQueueLimit; on very large heaps,
+ * a full queue makes the search continue depth-first (see BFSClosure).
  * Commit ratio: 1 : 10 (subject to allocation granularties)
  */
 static size_t edge_queue_memory_reservation() {
-  const size_t memory_reservation_bytes = MAX2(MaxHeapSize / 20, 32*M);
+  const size_t memory_reservation_bytes = MIN2(MAX2(MaxHeapSize / 20, 32*M), LeakProfilerEdgeQueueLimit);
   assert(memory_reservation_bytes >= (size_t)32*M, "invariant");
   return memory_reservation_bytes;
 }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/periodic/jfrNativeMemoryEvent.hpp"
+#include "services/mallocTracker.hpp"
+#include "services/memTracker.hpp"
+#include "services/nmtCommon.hpp"
+#include "services/virtualMemoryTracker.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+#if INCLUDE_NMT
+
+// Values reported by the previous round, to compute the deltas. Only
+// accessed by the JFR periodic thread.
+static size_t _last_reserved[mt_number_of_types];
+static size_t _last_committed[mt_number_of_types];
+
+void JfrNativeMemoryEvent::send_type_events() {
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return;
+  }
+
+  MallocMemorySnapshot malloc_snapshot;
+  MallocMemorySummary::snapshot(&malloc_snapshot);
+  // Copy the virtual memory counters directly. VirtualMemorySummary::snapshot()
+  // would first walk all thread stacks to refresh their committed sizes,
+  // which is too costly to do periodically; their last known values are used.
+  VirtualMemorySnapshot vm_snapshot;
+  VirtualMemorySummary::as_snapshot()->copy_to(&vm_snapshot);
+
+  for (int index = 0; index < mt_number_of_types; index++) {
+    MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    if (flag == mtNone) {
+      continue;
+    }
+    const MallocMemory* malloc_memory = malloc_snapshot.by_type(flag);
+    const VirtualMemory* virtual_memory = vm_snapshot.by_type(flag);
+    const size_t malloced = malloc_memory->malloc_size() + malloc_memory->arena_size();
+    const size_t reserved = malloced + virtual_memory->reserved();
+    const size_t committed = malloced + virtual_memory->committed();
+    if (reserved == 0 && _last_reserved[index] == 0) {
+      continue;
+    }
+
+    EventNativeMemoryUsage event(UNTIMED);
+    event.set_type(NMTUtil::flag_to_name(flag));
+    event.set_reserved(reserved);
+    event.set_committed(committed);
+    event.set_reservedDelta((s8)reserved - (s8)_last_reserved[index]);
+    event.set_committedDelta((s8)committed - (s8)_last_committed[index]);
+    event.commit();
+
+    _last_reserved[index] = reserved;
+    _last_committed[index] = committed;
+  }
+}
+
+#else
+
+void JfrNativeMemoryEvent::send_type_events() {}
+
+#endif // INCLUDE_NMT
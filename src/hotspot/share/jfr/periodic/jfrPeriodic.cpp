@@ -38,6 +38,7 @@
 #include "gc/shared/objectCountEventSender.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/periodic/jfrModuleEvent.hpp"
+#include "jfr/periodic/jfrNativeMemoryEvent.hpp"
 #include "jfr/periodic/jfrOSInterface.hpp"
 #include "jfr/periodic/jfrThreadCPULoadEvent.hpp"
 #include "jfr/periodic/jfrThreadDumpEvent.hpp"
@@ -54,6 +55,7 @@
 #include "runtime/arguments.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/mutexStatistics.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/os_perf.hpp"
@@ -203,6 +205,10 @@ TRACE_REQUEST_FUNC(NetworkUtilization) {
   JfrNetworkUtilization::send_events();
 }
 
+TRACE_REQUEST_FUNC(NativeMemoryUsage) {
+  JfrNativeMemoryEvent::send_type_events();
+}
+
 TRACE_REQUEST_FUNC(CPUTimeStampCounter) {
   EventCPUTimeStampCounter event;
   event.set_fastTimeEnabled(JfrTime::is_ft_enabled());
@@ -561,6 +567,26 @@ TRACE_REQUEST_FUNC(ProtectionDomainCacheTableStatistics) {
   emit_table_statistics<EventProtectionDomainCacheTableStatistics>(statistics);
 }
 
+TRACE_REQUEST_FUNC(MutexStatistics) {
+  if (!RecordMutexStatistics) {
+    return;
+  }
+  for (MutexStatistics* s = MutexStatistics::first(); s != NULL; s = s->next()) {
+    if (s->acquisitions() == 0) {
+      continue;
+    }
+    EventMutexStatistics event(UNTIMED);
+    event.set_name(s->name());
+    event.set_acquisitionCount(s->acquisitions());
+    event.set_contendedCount(s->contended());
+    event.set_totalWaitTime(s->wait().total_nanos());
+    event.set_maxWaitTime(s->wait().max_nanos());
+    event.set_totalHoldTime(s->hold().total_nanos());
+    event.set_maxHoldTime(s->hold().max_nanos());
+    event.commit();
+  }
+}
+
 TRACE_REQUEST_FUNC(CompilerStatistics) {
   EventCompilerStatistics event;
   event.set_compileCount(CompileBroker::get_total_compile_count());
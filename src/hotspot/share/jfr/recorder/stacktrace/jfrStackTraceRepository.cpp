@@ -28,7 +28,9 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 static JfrStackTraceRepository* _instance = NULL;
 
@@ -87,20 +89,15 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
     JfrStackTrace* stacktrace = _table[i];
     while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
+      stacktrace = const_cast<JfrStackTrace*>(stacktrace->next());
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+    purge();
   }
   last_id = _next_id;
   return count;
@@ -111,18 +108,31 @@ size_t JfrStackTraceRepository::clear() {
   if (_entries == 0) {
     return 0;
   }
+  const size_t processed = _entries;
+  purge();
+  return processed;
+}
+
+// Unlinks all entries, then frees them once no thread can still be
+// looking at them from the lock-free path in add_trace.
+void JfrStackTraceRepository::purge() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const purged = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    purged[i] = _table[i];
+    Atomic::store(&_table[i], (JfrStackTrace*)NULL);
+  }
+  _entries = 0;
+  GlobalCounter::write_synchronize();
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    JfrStackTrace* stacktrace = purged[i];
     while (stacktrace != NULL) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       delete stacktrace;
       stacktrace = next;
     }
   }
-  memset(_table, 0, sizeof(_table));
-  const size_t processed = _entries;
-  _entries = 0;
-  return processed;
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, purged);
 }
 
 traceid JfrStackTraceRepository::record(Thread* thread, int skip /* 0 */) {
@@ -173,24 +183,43 @@ void JfrStackTraceRepository::record_and_cache(JavaThread* thread, int skip /* 0
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
+traceid JfrStackTraceRepository::find(size_t index, const JfrStackTrace& stacktrace) const {
+  const JfrStackTrace* table_entry = Atomic::load_acquire(&_table[index]);
   while (table_entry != NULL) {
     if (table_entry->equals(stacktrace)) {
       return table_entry->id();
     }
     table_entry = table_entry->next();
   }
+  return 0;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    // Traces recorded at high rates are mostly already present, so look
+    // for them without the lock first. Entries are immutable once
+    // published, and purge() frees them only after a synchronization.
+    // The critical section must be left before taking the lock below.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const traceid id = find(index, stacktrace);
+    if (id != 0) {
+      return id;
+    }
+  }
+
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  traceid id = find(index, stacktrace);
+  if (id != 0) {
+    return id;
+  }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  id = ++_next_id;
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
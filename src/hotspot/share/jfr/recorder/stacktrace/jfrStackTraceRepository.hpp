@@ -57,8 +57,10 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   bool is_modified() const;
   size_t write(JfrChunkWriter& cw, bool clear);
   size_t clear();
+  void purge();
 
   const JfrStackTrace* lookup(unsigned int hash, traceid id) const;
+  traceid find(size_t index, const JfrStackTrace& stacktrace) const;
 
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
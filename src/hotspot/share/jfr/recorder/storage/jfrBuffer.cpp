@@ -159,7 +159,6 @@ void JfrBuffer::move(JfrBuffer* const to, size_t size) {
     memcpy(to->pos(), current_top, actual_size);
     to->set_pos(actual_size);
   }
-  to->release();
   set_pos(start());
   release_critical_section_top(start());
 }
@@ -231,6 +231,25 @@ static void write_data_loss(BufferPtr buffer, Thread* thread) {
 
 static const size_t promotion_retry = 100;
 
+// The global system is exhausted. Rather than dropping the thread local data,
+// spill it to a transient buffer that is registered full and written by the recorder thread.
+bool JfrStorage::spill_to_transient(BufferPtr buffer, size_t unflushed_size, Thread* thread) {
+  assert(buffer != NULL, "invariant");
+  assert(unflushed_size > 0, "invariant");
+  if (!control().is_transient_spill_allowed()) {
+    return false;
+  }
+  BufferPtr const spill = acquire_transient(unflushed_size, thread);
+  if (spill == NULL) {
+    return false;
+  }
+  assert(spill->free_size() >= unflushed_size, "invariant");
+  buffer->move(spill, unflushed_size);
+  assert(buffer->empty(), "invariant");
+  release_large(spill, thread);
+  return true;
+}
+
 bool JfrStorage::flush_regular_buffer(BufferPtr buffer, Thread* thread) {
   assert(buffer != NULL, "invariant");
   assert(!buffer->lease(), "invariant");
@@ -255,12 +274,16 @@ bool JfrStorage::flush_regular_buffer(BufferPtr buffer, Thread* thread) {
 
   BufferPtr const promotion_buffer = acquire_promotion_buffer(unflushed_size, _global_mspace, *this, promotion_retry, thread);
   if (promotion_buffer == NULL) {
+    if (spill_to_transient(buffer, unflushed_size, thread)) {
+      return true;
+    }
     write_data_loss(buffer, thread);
     return false;
   }
   assert(promotion_buffer->acquired_by_self(), "invariant");
   assert(promotion_buffer->free_size() >= unflushed_size, "invariant");
   buffer->move(promotion_buffer, unflushed_size);
+  promotion_buffer->release();
   assert(buffer->empty(), "invariant");
   return true;
 }
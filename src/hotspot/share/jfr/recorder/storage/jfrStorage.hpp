@@ -61,6 +61,7 @@ class JfrStorage : public JfrCHeapObj {
   BufferPtr acquire_large(size_t size, Thread* thread);
   BufferPtr acquire_transient(size_t size, Thread* thread);
   bool flush_regular_buffer(BufferPtr buffer, Thread* thread);
+  bool spill_to_transient(BufferPtr buffer, size_t unflushed_size, Thread* thread);
   BufferPtr flush_regular(BufferPtr cur, const u1* cur_pos, size_t used, size_t req, bool native, Thread* thread);
   BufferPtr flush_large(BufferPtr cur, const u1* cur_pos, size_t used, size_t req, bool native, Thread* thread);
   BufferPtr provision_large(BufferPtr cur, const u1* cur_pos, size_t used, size_t req, bool native, Thread* thread);
@@ -27,6 +27,7 @@
 #include "runtime/atomic.hpp"
 
 const size_t max_lease_factor = 2;
+const size_t max_spill_factor = 4;
 JfrStorageControl::JfrStorageControl(size_t global_count_total, size_t in_memory_discard_threshold) :
   _global_count_total(global_count_total),
   _full_count(0),
@@ -34,6 +35,7 @@ JfrStorageControl::JfrStorageControl(size_t global_count_total, size_t in_memory
   _to_disk_threshold(0),
   _in_memory_discard_threshold(in_memory_discard_threshold),
   _global_lease_threshold(global_count_total / max_lease_factor),
+  _transient_spill_threshold(global_count_total * max_spill_factor),
   _to_disk(false) {}
 
 bool JfrStorageControl::to_disk() const {
@@ -97,3 +99,8 @@ size_t JfrStorageControl::decrement_leased() {
 bool JfrStorageControl::is_global_lease_allowed() const {
   return global_lease_count() <= _global_lease_threshold;
 }
+
+// Bounds the transient memory used to absorb thread local flushes while the global system is exhausted.
+bool JfrStorageControl::is_transient_spill_allowed() const {
+  return to_disk() && full_count() < _transient_spill_threshold;
+}
@@ -35,6 +35,7 @@ class JfrStorageControl : public JfrCHeapObj {
   size_t _to_disk_threshold;
   size_t _in_memory_discard_threshold;
   size_t _global_lease_threshold;
+  size_t _transient_spill_threshold;
   bool _to_disk;
 
  public:
@@ -54,6 +55,7 @@ class JfrStorageControl : public JfrCHeapObj {
   size_t increment_leased();
   size_t decrement_leased();
   bool is_global_lease_allowed() const;
+  bool is_transient_spill_allowed() const;
 };
 
 #endif // SHARE_JFR_RECORDER_STORAGE_JFRSTORAGECONTROL_HPP
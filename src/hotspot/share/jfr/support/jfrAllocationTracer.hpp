@@ -28,12 +28,13 @@
 #include "memory/allocation.hpp"
 
 class JfrThreadLocal;
+class Klass;
 
 class JfrAllocationTracer : public StackObj {
  private:
   JfrThreadLocal* _tl;
  public:
-  JfrAllocationTracer(HeapWord* obj, size_t alloc_size, Thread* thread);
+  JfrAllocationTracer(const Klass* klass, HeapWord* obj, size_t alloc_size, bool outside_tlab, Thread* thread);
   ~JfrAllocationTracer();
 };
 
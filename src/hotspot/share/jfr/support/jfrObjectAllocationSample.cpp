@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/threadLocalAllocBuffer.inline.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrObjectAllocationSample.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// The sample budget, ObjectAllocationSampleRate per second,
+// is handed out in fixed windows of 1 / window_divisor seconds.
+static const jlong window_divisor = 10;
+static volatile jlong _window_end = 0;
+static volatile size_t _window_samples = 0;
+
+static bool is_within_budget() {
+  const jlong now = os::javaTimeNanos();
+  const jlong window_end = Atomic::load_acquire(&_window_end);
+  if (now >= window_end) {
+    // Only the thread installing the next window resets the count.
+    if (Atomic::cmpxchg(&_window_end, window_end, now + NANOSECS_PER_SEC / window_divisor) == window_end) {
+      Atomic::release_store(&_window_samples, (size_t)0);
+    }
+  }
+  const size_t budget = MAX2((size_t)(ObjectAllocationSampleRate / window_divisor), (size_t)1);
+  return Atomic::add(&_window_samples, (size_t)1) <= budget;
+}
+
+// The weight of a sample is the number of bytes allocated by the thread since its last sample.
+static bool send_allocation_sample(const Klass* klass, jlong allocated_bytes, JfrThreadLocal* tl) {
+  assert(allocated_bytes > tl->last_sampled_allocated_bytes(), "invariant");
+  EventObjectAllocationSample event;
+  if (!event.should_commit() || !is_within_budget()) {
+    return false;
+  }
+  event.set_objectClass(klass);
+  event.set_weight(allocated_bytes - tl->last_sampled_allocated_bytes());
+  event.commit();
+  tl->set_last_sampled_allocated_bytes(allocated_bytes);
+  return true;
+}
+
+static intptr_t estimate_tlab_size_bytes(Thread* thread) {
+  const size_t desired_tlab_size_bytes = thread->tlab().desired_size() * HeapWordSize;
+  const size_t alignment_reserve_bytes = ThreadLocalAllocBuffer::alignment_reserve_in_bytes();
+  return static_cast<intptr_t>(desired_tlab_size_bytes - alignment_reserve_bytes);
+}
+
+// To avoid large objects being undersampled compared to TLAB refills,
+// an allocation outside the TLAB gets one sampling attempt per TLAB sized chunk.
+static void normalize_as_tlab_and_send_allocation_samples(const Klass* klass, intptr_t alloc_size, jlong allocated_bytes, Thread* thread) {
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  if (!UseTLAB) {
+    send_allocation_sample(klass, allocated_bytes, tl);
+    return;
+  }
+  const intptr_t tlab_size_bytes = estimate_tlab_size_bytes(thread);
+  if (allocated_bytes - tl->last_sampled_allocated_bytes() < tlab_size_bytes) {
+    return;
+  }
+  assert(alloc_size > 0, "invariant");
+  do {
+    if (send_allocation_sample(klass, allocated_bytes, tl)) {
+      return;
+    }
+    alloc_size -= tlab_size_bytes;
+  } while (alloc_size > 0);
+}
+
+void JfrObjectAllocationSample::send_event(const Klass* klass, size_t alloc_size, bool outside_tlab, Thread* thread) {
+  assert(thread != NULL, "invariant");
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  const jlong allocated_bytes = thread->allocated_bytes();
+  if (allocated_bytes <= tl->last_sampled_allocated_bytes()) {
+    return;
+  }
+  if (outside_tlab) {
+    normalize_as_tlab_and_send_allocation_samples(klass, static_cast<intptr_t>(alloc_size), allocated_bytes, thread);
+    return;
+  }
+  send_allocation_sample(klass, allocated_bytes, tl);
+}
@@ -49,6 +49,7 @@ class JfrThreadLocal {
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
+  jlong _last_sampled_allocated_bytes;
   unsigned int _stack_trace_hash;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
@@ -175,6 +176,14 @@ class JfrThreadLocal {
 
   u8 add_data_lost(u8 value);
 
+  jlong last_sampled_allocated_bytes() const {
+    return _last_sampled_allocated_bytes;
+  }
+
+  void set_last_sampled_allocated_bytes(jlong allocated_bytes) {
+    _last_sampled_allocated_bytes = allocated_bytes;
+  }
+
   jlong get_user_time() const {
     return _user_time;
   }
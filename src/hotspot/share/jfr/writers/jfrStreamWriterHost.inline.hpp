@@ -121,6 +121,14 @@ void StreamWriterHost<Adapter, AP>::flush() {
 
 template <typename Adapter, typename AP>
 void StreamWriterHost<Adapter, AP>::write_unbuffered(const void* buf, intptr_t len) {
+  assert(len >= 0, "invariant");
+  if (this->is_valid() && len <= (intptr_t)this->available_size()) {
+    // Coalesce payloads that fit into the stream buffer, so that the many
+    // small buffers of a flush become one large write instead of two
+    // system calls each.
+    MemoryWriterHost<Adapter, AP>::write_bytes(this->current_pos(), buf, len);
+    return;
+  }
   this->flush();
   assert(0 == this->used_offset(), "can only seek from beginning");
   this->write_bytes((const u1*)buf, len);
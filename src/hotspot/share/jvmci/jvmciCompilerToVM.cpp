@@ -1667,13 +1667,25 @@ C2V_VMENTRY_0(jint, methodDataProfileDataSize, (JNIEnv* env, jobject, jlong meta
   if (mdo->is_valid(profile_data)) {
     return profile_data->size_in_bytes();
   }
+  // The profile data of the extra data section is walked entry by entry,
+  // so look the entry up directly rather than walking the extra data
+  // from its start on each call.
   DataLayout* data    = mdo->extra_data_base();
   DataLayout* end   = mdo->extra_data_limit();
-  for (;; data = mdo->next_extra(data)) {
-    assert(data < end, "moved past end of extra data");
-    profile_data = data->data_in();
-    if (mdo->dp_to_di(profile_data->dp()) == position) {
-      return profile_data->size_in_bytes();
+  int offset = position - mdo->dp_to_di((address) data);
+  if (offset >= 0 && offset < mdo->extra_data_size() && offset % DataLayout::cell_size == 0) {
+    data = (DataLayout*) ((address) data + offset);
+    switch (data->tag()) {
+      case DataLayout::bit_data_tag:
+      case DataLayout::speculative_trap_data_tag:
+      case DataLayout::arg_info_data_tag:
+        profile_data = data->data_in();
+        if ((address) data + profile_data->size_in_bytes() <= (address) end) {
+          return profile_data->size_in_bytes();
+        }
+        break;
+      default:
+        break;
     }
   }
   JVMCI_THROW_MSG_0(IllegalArgumentException, err_msg("Invalid profile data position %d", position));
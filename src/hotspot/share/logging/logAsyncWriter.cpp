@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logConfiguration.hpp"
+#include "logging/logFileOutput.hpp"
+#include "logging/logHandle.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.inline.hpp"
+
+class AsyncLogLocker : public StackObj {
+ private:
+  Semaphore& _sem;
+ public:
+  AsyncLogLocker(Semaphore& sem) : _sem(sem) {
+    _sem.wait();
+  }
+  ~AsyncLogLocker() {
+    _sem.signal();
+  }
+};
+
+AsyncLogWriter* AsyncLogWriter::_instance = NULL;
+
+void AsyncLogMessage::write_blocking() {
+  _output.write_blocking(_decorations, _message);
+}
+
+AsyncLogWriter::AsyncLogWriter() :
+  _lock(1),
+  _sem(0),
+  _io_sem(1),
+  _head(NULL),
+  _tail(NULL),
+  _footprint(0),
+  _footprint_max(AsyncLogBufferSize),
+  _dropped() {}
+
+void AsyncLogWriter::count_dropped_locked(LogFileOutput& output) {
+  bool created;
+  uint32_t* counter = _dropped.put_if_absent(&output, 0, &created);
+  *counter = *counter + 1;
+}
+
+void AsyncLogWriter::enqueue_locked(AsyncLogMessage* msg) {
+  const size_t footprint = msg->footprint();
+  if (_footprint + footprint > _footprint_max) {
+    count_dropped_locked(msg->_output);
+    delete msg;
+    return;
+  }
+  _footprint += footprint;
+  if (_tail == NULL) {
+    _head = msg;
+  } else {
+    _tail->_next = msg;
+  }
+  _tail = msg;
+}
+
+static AsyncLogMessage* new_message(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  char* const copy = os::strdup(msg, mtLogging);
+  if (copy == NULL) {
+    return NULL;
+  }
+  AsyncLogMessage* const m = new (std::nothrow) AsyncLogMessage(output, decorations, copy);
+  if (m == NULL) {
+    os::free(copy);
+  }
+  return m;
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  AsyncLogMessage* const m = new_message(output, decorations, msg);
+  {
+    AsyncLogLocker locker(_lock);
+    if (m == NULL) {
+      count_dropped_locked(output);
+    } else {
+      enqueue_locked(m);
+    }
+  }
+  _sem.signal();
+}
+
+// The messages of a LogMessageBuffer are enqueued together, so they stay adjacent in the output.
+void AsyncLogWriter::enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator) {
+  {
+    AsyncLogLocker locker(_lock);
+    for (; !msg_iterator.is_at_end(); msg_iterator++) {
+      AsyncLogMessage* const m = new_message(output, msg_iterator.decorations(), msg_iterator.message());
+      if (m == NULL) {
+        count_dropped_locked(output);
+      } else {
+        enqueue_locked(m);
+      }
+    }
+  }
+  _sem.signal();
+}
+
+class AsyncLogDroppedReporter : public StackObj {
+ private:
+  AsyncLogMessage* _head;
+  AsyncLogMessage* _tail;
+ public:
+  AsyncLogDroppedReporter() : _head(NULL), _tail(NULL) {}
+
+  bool do_entry(LogFileOutput* const& output, const uint32_t& dropped) {
+    char buf[64];
+    jio_snprintf(buf, sizeof(buf), UINT32_FORMAT " messages dropped due to async logging", dropped);
+    const LogDecorations decorations(LogLevel::Warning, LogTagSetMapping<LogTag::_logging>::tagset(), output->decorators());
+    AsyncLogMessage* const m = new_message(*output, decorations, buf);
+    if (m != NULL) {
+      if (_tail == NULL) {
+        _head = m;
+      } else {
+        _tail->_next = m;
+      }
+      _tail = m;
+    }
+    return true;
+  }
+
+  AsyncLogMessage* head() const { return _head; }
+  AsyncLogMessage* tail() const { return _tail; }
+};
+
+// Unlinks all pending messages, followed by a report for each output that had messages dropped.
+AsyncLogMessage* AsyncLogWriter::take_pending() {
+  AsyncLogLocker locker(_lock);
+  AsyncLogMessage* const pending = _head;
+  AsyncLogMessage* tail = _tail;
+  _head = NULL;
+  _tail = NULL;
+  _footprint = 0;
+
+  AsyncLogDroppedReporter reporter;
+  _dropped.iterate(&reporter);
+  for (AsyncLogMessage* m = reporter.head(); m != NULL; m = m->_next) {
+    _dropped.remove(&m->_output);
+  }
+  if (reporter.head() == NULL) {
+    return pending;
+  }
+  if (pending == NULL) {
+    return reporter.head();
+  }
+  tail->_next = reporter.head();
+  return pending;
+}
+
+void AsyncLogWriter::write() {
+  AsyncLogLocker io_locker(_io_sem);
+  AsyncLogMessage* m = take_pending();
+  while (m != NULL) {
+    AsyncLogMessage* const next = m->_next;
+    m->write_blocking();
+    delete m;
+    m = next;
+  }
+}
+
+void AsyncLogWriter::run() {
+  while (true) {
+    // Each enqueue signals once; a batch may already have covered several signals.
+    _sem.wait();
+    write();
+  }
+}
+
+AsyncLogWriter* AsyncLogWriter::instance() {
+  return Atomic::load_acquire(&_instance);
+}
+
+void AsyncLogWriter::initialize() {
+  if (!LogConfiguration::is_async_mode()) {
+    return;
+  }
+  assert(_instance == NULL, "initialize() should only be invoked once");
+  AsyncLogWriter* const self = new AsyncLogWriter();
+  if (os::create_thread(self, os::os_thread)) {
+    Atomic::release_store_fence(&_instance, self);
+    os::start_thread(self);
+    log_debug(logging, thread)("Async logging thread started");
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* const writer = instance();
+  if (writer != NULL) {
+    writer->write();
+  }
+}
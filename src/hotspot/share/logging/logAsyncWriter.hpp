@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/resourceHash.hpp"
+
+class LogFileOutput;
+
+// A log message waiting to be written by the AsyncLogWriter.
+class AsyncLogMessage : public CHeapObj<mtLogging> {
+  friend class AsyncLogWriter;
+  friend class AsyncLogDroppedReporter;
+ private:
+  LogFileOutput& _output;
+  const LogDecorations _decorations;
+  char* _message;
+  AsyncLogMessage* _next;
+
+ public:
+  AsyncLogMessage(LogFileOutput& output, const LogDecorations& decorations, char* message) :
+    _output(output), _decorations(decorations), _message(message), _next(NULL) {}
+
+  ~AsyncLogMessage() {
+    os::free(_message);
+  }
+
+  size_t footprint() const {
+    return sizeof(AsyncLogMessage) + strlen(_message) + 1;
+  }
+
+  void write_blocking();
+};
+
+// Asynchronous logging, enabled with -Xlog:async.
+//
+// Log messages for file outputs are copied into a buffer by the logging threads
+// and written to the files by a dedicated NonJavaThread. Logging threads never wait
+// for I/O; the lock protecting the buffer is only held while linking or unlinking
+// messages. When the buffered messages would exceed AsyncLogBufferSize bytes, new
+// messages are dropped and counted per output. The writer reports the dropped
+// count to the output once there is room again.
+//
+// Messages logged before the writer is started, and messages for stdout and
+// stderr, are written synchronously as before.
+class AsyncLogWriter : public NonJavaThread {
+ private:
+  typedef ResourceHashtable<LogFileOutput*, uint32_t,
+                            primitive_hash<LogFileOutput*>,
+                            primitive_equals<LogFileOutput*>,
+                            17, ResourceObj::C_HEAP, mtLogging> DroppedMessages;
+
+  static AsyncLogWriter* _instance;
+
+  // Protects the pending list, its footprint and the dropped message counts.
+  Semaphore _lock;
+  // Signalled when a message is enqueued.
+  Semaphore _sem;
+  // Held while a batch of messages is being written, so that flush() can
+  // wait for the messages taken by the writer thread.
+  Semaphore _io_sem;
+
+  AsyncLogMessage* _head;
+  AsyncLogMessage* _tail;
+  size_t _footprint;
+  const size_t _footprint_max;
+  DroppedMessages _dropped;
+
+  AsyncLogWriter();
+
+  void enqueue_locked(AsyncLogMessage* msg);
+  void count_dropped_locked(LogFileOutput& output);
+  AsyncLogMessage* take_pending();
+  void write();
+  void run();
+
+ public:
+  void enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg);
+  void enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator);
+
+  char* name() const { return (char*)"AsyncLog Thread"; }
+
+  static AsyncLogWriter* instance();
+  static void initialize();
+
+  // Writes all messages enqueued before the call. Must be called before
+  // an output is deleted, as pending messages refer to their output.
+  static void flush();
+};
+
+#endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logFileOutput.hpp"
 #include "memory/allocation.inline.hpp"
@@ -284,7 +285,7 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
   return true;
 }
 
-int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
+int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg) {
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
@@ -302,12 +303,32 @@ int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
   return written;
 }
 
+int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
+  if (_stream == NULL) {
+    // An error has occurred with this output, avoid writing to it.
+    return 0;
+  }
+
+  AsyncLogWriter* const aio_writer = AsyncLogWriter::instance();
+  if (aio_writer != NULL) {
+    aio_writer->enqueue(*this, decorations, msg);
+    return 0;
+  }
+  return write_blocking(decorations, msg);
+}
+
 int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
   }
 
+  AsyncLogWriter* const aio_writer = AsyncLogWriter::instance();
+  if (aio_writer != NULL) {
+    aio_writer->enqueue(*this, msg_iterator);
+    return 0;
+  }
+
   _rotation_semaphore.wait();
   int written = LogFileStreamOutput::write(msg_iterator);
   _current_size += written;
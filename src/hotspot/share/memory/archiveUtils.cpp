@@ -275,7 +275,7 @@ void ReadClosure::do_oop(oop *p) {
   if (CompressedOops::is_null(o) || !HeapShared::open_archive_heap_region_mapped()) {
     *p = NULL;
   } else {
-    assert(HeapShared::is_heap_object_archiving_allowed(),
+    assert(HeapShared::is_heap_object_archiving_allowed() || HeapShared::is_loaded(),
            "Archived heap object is not allowed");
     assert(HeapShared::open_archive_heap_region_mapped(),
            "Open archive heap region is not mapped");
@@ -29,6 +29,7 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/ostream.hpp"
@@ -160,6 +161,47 @@ Chunk::clean_chunk_pool() {
 }
 
 
+//--------------------------------------------------------------------------------------
+// Thread local chunk cache
+//
+// Threads with a non-zero chunk_cache_limit() keep up to that many default sized
+// chunks to themselves, in front of the large pool, so that their arena churn
+// does not contend on ThreadCritical. Only the owning thread touches its cache.
+
+static Chunk* thread_cache_allocate() {
+  Thread* const thread = Thread::current_or_null();
+  if (thread == NULL || thread->chunk_cache_count() == 0) {
+    return NULL;
+  }
+  Chunk* const chunk = thread->chunk_cache();
+  thread->set_chunk_cache(chunk->next());
+  thread->set_chunk_cache_count(thread->chunk_cache_count() - 1);
+  return chunk;
+}
+
+static bool thread_cache_free(Chunk* chunk) {
+  Thread* const thread = Thread::current_or_null();
+  if (thread == NULL || thread->chunk_cache_count() >= thread->chunk_cache_limit()) {
+    return false;
+  }
+  chunk->set_next(thread->chunk_cache());
+  thread->set_chunk_cache(chunk);
+  thread->set_chunk_cache_count(thread->chunk_cache_count() + 1);
+  return true;
+}
+
+void Chunk::release_thread_cache(Thread* thread) {
+  Chunk* chunk = thread->chunk_cache();
+  thread->set_chunk_cache(NULL);
+  thread->set_chunk_cache_count(0);
+  thread->set_chunk_cache_limit(0);
+  while (chunk != NULL) {
+    Chunk* const next = chunk->next();
+    ChunkPool::large_pool()->free(chunk);
+    chunk = next;
+  }
+}
+
 //--------------------------------------------------------------------------------------
 // ChunkPoolCleaner implementation
 //
@@ -185,7 +227,10 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
   assert(ARENA_ALIGN(requested_size) == aligned_overhead_size(), "Bad alignment");
   size_t bytes = ARENA_ALIGN(requested_size) + length;
   switch (length) {
-   case Chunk::size:        return ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
+   case Chunk::size: {
+     void* p = thread_cache_allocate();
+     return p != NULL ? p : ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
+   }
    case Chunk::medium_size: return ChunkPool::medium_pool()->allocate(bytes, alloc_failmode);
    case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
    case Chunk::tiny_size:   return ChunkPool::tiny_pool()->allocate(bytes, alloc_failmode);
@@ -202,7 +247,7 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
 void Chunk::operator delete(void* p) {
   Chunk* c = (Chunk*)p;
   switch (c->length()) {
-   case Chunk::size:        ChunkPool::large_pool()->free(c); break;
+   case Chunk::size:        if (!thread_cache_free(c)) ChunkPool::large_pool()->free(c); break;
    case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
    case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
    case Chunk::tiny_size:   ChunkPool::tiny_pool()->free(c); break;
@@ -296,11 +341,11 @@ void* Arena::operator new (size_t size, const std::nothrow_t&  nothrow_constant)
 
   // dynamic memory type binding
 void* Arena::operator new(size_t size, MEMFLAGS flags) throw() {
-  return (void *) AllocateHeap(size, flags, CALLER_PC);
+  return (void *) AllocateHeap(size, flags, MALLOC_CALLER_PC);
 }
 
 void* Arena::operator new(size_t size, const std::nothrow_t& nothrow_constant, MEMFLAGS flags) throw() {
-  return (void*)AllocateHeap(size, flags, CALLER_PC, AllocFailStrategy::RETURN_NULL);
+  return (void*)AllocateHeap(size, flags, MALLOC_CALLER_PC, AllocFailStrategy::RETURN_NULL);
 }
 
 void Arena::operator delete(void* p) {
@@ -70,6 +70,9 @@ class Chunk: CHeapObj<mtChunk> {
     non_pool_size = init_size + 32 // An initial size which is not one of above
   };
 
+  // Number of default sized chunks a compiler thread keeps to itself
+  static const uint compiler_thread_cache_limit = 8;
+
   void chop();                  // Chop this chunk
   void next_chop();             // Chop next chunk
   static size_t aligned_overhead_size(void) { return ARENA_ALIGN(sizeof(Chunk)); }
@@ -87,6 +90,9 @@ class Chunk: CHeapObj<mtChunk> {
   static void start_chunk_pool_cleaner_task();
 
   static void clean_chunk_pool();
+
+  // Return the chunks cached by the thread to the chunk pool
+  static void release_thread_cache(Thread* thread);
 };
 
 //------------------------------Arena------------------------------------------
@@ -31,6 +31,8 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/altHashing.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "logging/logMessage.hpp"
@@ -50,6 +52,7 @@
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -1682,6 +1685,37 @@ char* FileMapInfo::map_bitmap_region() {
   return bitmap_base;
 }
 
+// Relocates the pointers marked in the ptrmap in chunks claimed by the worker
+// threads. SharedDataRelocator<false> keeps no state, so one instance is shared.
+class SharedDataRelocationTask : public AbstractGangTask {
+  BitMapView* _ptrmap;
+  SharedDataRelocator<false>* _patcher;
+  volatile size_t _next_chunk;
+  size_t _num_chunks;
+
+ public:
+  // In bits, i.e. pointer-sized slots. Word aligned, so that chunks never share a bitmap word.
+  static const size_t chunk_size = 64 * K;
+
+  SharedDataRelocationTask(BitMapView* ptrmap, SharedDataRelocator<false>* patcher) :
+    AbstractGangTask("CDS archive relocation"),
+    _ptrmap(ptrmap), _patcher(patcher), _next_chunk(0),
+    _num_chunks(align_up(ptrmap->size(), chunk_size) / chunk_size) {}
+
+  static bool is_worth_it(BitMapView* ptrmap) {
+    return ptrmap->size() >= 4 * chunk_size;
+  }
+
+  void work(uint worker_id) {
+    size_t chunk;
+    while ((chunk = Atomic::fetch_and_add(&_next_chunk, (size_t)1)) < _num_chunks) {
+      BitMap::idx_t beg = chunk * chunk_size;
+      BitMap::idx_t end = MIN2(beg + chunk_size, _ptrmap->size());
+      _ptrmap->iterate(_patcher, beg, end);
+    }
+  }
+};
+
 bool FileMapInfo::relocate_pointers(intx addr_delta) {
   log_debug(cds, reloc)("runtime archive relocation start");
   char* bitmap_base = map_bitmap_region();
@@ -1712,7 +1746,15 @@ bool FileMapInfo::relocate_pointers(intx addr_delta) {
 
     SharedDataRelocator<false> patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                        valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+    WorkGang* workers = ArchiveParallelRelocation ? Universe::heap()->safepoint_workers() : NULL;
+    if (workers != NULL && workers->active_workers() > 1 &&
+        SharedDataRelocationTask::is_worth_it(&ptrmap)) {
+      log_debug(cds, reloc)("relocating with %u worker threads", workers->active_workers());
+      SharedDataRelocationTask task(&ptrmap, &patcher);
+      workers->run_task(&task);
+    } else {
+      ptrmap.iterate(&patcher);
+    }
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
@@ -1796,12 +1838,6 @@ MemRegion FileMapInfo::get_heap_regions_range_with_current_oop_encoding_mode() {
 // regions may be added. GC may mark and update references in the mapped
 // open archive objects.
 void FileMapInfo::map_heap_regions_impl() {
-  if (!HeapShared::is_heap_object_archiving_allowed()) {
-    log_info(cds)("CDS heap data is being ignored. UseG1GC, "
-                  "UseCompressedOops and UseCompressedClassPointers are required.");
-    return;
-  }
-
   if (JvmtiExport::should_post_class_file_load_hook() && JvmtiExport::has_early_class_hook_env()) {
     ShouldNotReachHere(); // CDS should have been disabled.
     // The archived objects are mapped at JVM start-up, but we don't know if
@@ -1906,9 +1942,106 @@ void FileMapInfo::map_heap_regions_impl() {
   }
 }
 
+//
+// Load the closed and open archive heap objects into the runtime java heap,
+// for collectors that cannot map them (see CollectedHeap::can_load_archived_objects).
+//
+// All regions are copied into a single block allocated from the heap. The
+// closed and open objects are not distinguished any further: the loaded
+// objects are ordinary heap objects that are never moved by the GC. Since the
+// regions are packed together, the embedded pointers (and all narrow oops
+// into the archive stored in the metadata) are relocated per region, see
+// HeapShared::decode_from_archive().
+void FileMapInfo::load_heap_regions_impl() {
+  if (narrow_klass_base() != CompressedKlassPointers::base() ||
+      narrow_klass_shift() != CompressedKlassPointers::shift()) {
+    log_info(cds)("CDS heap data cannot be used because the archive was created with an incompatible narrow klass encoding mode.");
+    return;
+  }
+
+  size_t total_size = 0;
+  for (int i = MetaspaceShared::first_closed_archive_heap_region;
+           i <= MetaspaceShared::last_valid_region; i++) {
+    total_size += space_at(i)->used();
+  }
+  assert(is_aligned(total_size, HeapWordSize), "sanity");
+
+  // Read and verify all regions before allocating from the heap, so that a
+  // failure does not leave an unparsable block behind.
+  char* buffer = NEW_C_HEAP_ARRAY(char, total_size, mtClassShared);
+  char* p = buffer;
+  for (int i = MetaspaceShared::first_closed_archive_heap_region;
+           i <= MetaspaceShared::last_valid_region; i++) {
+    FileMapRegion* si = space_at(i);
+    size_t size = si->used();
+    if (size == 0) {
+      continue;
+    }
+    if (lseek(_fd, (long)si->file_offset(), SEEK_SET) != (int)si->file_offset() ||
+        read_bytes(p, size) != size) {
+      log_info(cds)("UseSharedSpaces: Unable to read heap data region[%d]", i);
+      FREE_C_HEAP_ARRAY(char, buffer);
+      return;
+    }
+    if (VerifySharedSpaces && !region_crc_check(p, size, si->crc())) {
+      log_info(cds)("UseSharedSpaces: heap data region[%d] is corrupt", i);
+      FREE_C_HEAP_ARRAY(char, buffer);
+      return;
+    }
+    p += size;
+  }
+
+  HeapWord* heap_base = Universe::heap()->allocate_loaded_archive_space(total_size / HeapWordSize);
+  if (heap_base == NULL) {
+    log_info(cds)("UseSharedSpaces: Unable to allocate " SIZE_FORMAT " bytes for heap data", total_size);
+    FREE_C_HEAP_ARRAY(char, buffer);
+    return;
+  }
+  memcpy(heap_base, buffer, total_size);
+  FREE_C_HEAP_ARRAY(char, buffer);
+
+  // The dump time addresses are decoded with the dump time encoding.
+  HeapShared::init_narrow_oop_decoding(narrow_oop_base(), narrow_oop_shift());
+
+  closed_archive_heap_ranges = MemRegion::create_array(MetaspaceShared::max_closed_archive_heap_region, mtInternal);
+  open_archive_heap_ranges = MemRegion::create_array(MetaspaceShared::max_open_archive_heap_region, mtInternal);
+  char* runtime_base = (char*)heap_base;
+  for (int i = MetaspaceShared::first_closed_archive_heap_region;
+           i <= MetaspaceShared::last_valid_region; i++) {
+    FileMapRegion* si = space_at(i);
+    size_t size = si->used();
+    if (size == 0) {
+      continue;
+    }
+    MemRegion mr((HeapWord*)runtime_base, size / HeapWordSize);
+    if (i <= MetaspaceShared::last_closed_archive_heap_region) {
+      closed_archive_heap_ranges[num_closed_archive_heap_ranges++] = mr;
+    } else {
+      open_archive_heap_ranges[num_open_archive_heap_ranges++] = mr;
+    }
+    address dumptime_base = start_address_as_decoded_from_archive(si);
+    HeapShared::add_loaded_region((uintptr_t)dumptime_base, size, (uintptr_t)runtime_base);
+    log_info(cds)("Loaded heap data: region[%d] at " INTPTR_FORMAT ", size = " SIZE_FORMAT_W(8)
+                  " bytes (dumped at " INTPTR_FORMAT ")",
+                  i, p2i(runtime_base), size, p2i(dumptime_base));
+    runtime_base += size;
+  }
+
+  HeapShared::set_loaded();
+  // The embedded pointers always need to be relocated to the new locations.
+  _heap_pointers_need_patching = true;
+}
+
 void FileMapInfo::map_heap_regions() {
   if (has_heap_regions()) {
-    map_heap_regions_impl();
+    if (HeapShared::is_heap_object_archiving_allowed()) {
+      map_heap_regions_impl();
+    } else if (HeapShared::can_load()) {
+      load_heap_regions_impl();
+    } else {
+      log_info(cds)("CDS heap data is being ignored. UseCompressedOops and UseCompressedClassPointers "
+                    "are required, with UseG1GC or a collector that supports loading archived objects.");
+    }
   }
 
   if (!HeapShared::closed_archive_heap_region_mapped()) {
@@ -2032,6 +2165,10 @@ void FileMapInfo::patch_archived_heap_embedded_pointers(MemRegion* ranges, int n
 // This internally allocates objects using SystemDictionary::Object_klass(), so it
 // must be called after the well-known classes are resolved.
 void FileMapInfo::fixup_mapped_heap_regions() {
+  if (HeapShared::is_loaded()) {
+    // Loaded objects occupy a dense block in the heap, nothing to fill.
+    return;
+  }
   // If any closed regions were found, call the fill routine to make them parseable.
   // Note that closed_archive_heap_ranges may be non-NULL even if no ranges were found.
   if (num_closed_archive_heap_ranges != 0) {
@@ -2051,6 +2188,11 @@ void FileMapInfo::fixup_mapped_heap_regions() {
 
 // dealloc the archive regions from java heap
 void FileMapInfo::dealloc_archive_heap_regions(MemRegion* regions, int num) {
+  if (HeapShared::is_loaded()) {
+    // The loaded block cannot be returned to the heap. It stays behind as
+    // unreachable, but parsable, objects.
+    return;
+  }
   if (num > 0) {
     assert(regions != NULL, "Null archive ranges array with non-zero count");
     G1CollectedHeap::heap()->dealloc_archive_regions(regions, num);
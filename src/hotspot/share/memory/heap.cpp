@@ -45,11 +45,15 @@ CodeHeap::CodeHeap(const char* name, const int code_blob_type)
   _freelist_segments            = 0;
   _freelist_length              = 0;
   _max_allocated_capacity       = 0;
+  _hot_segments                 = 0;
   _blob_count                   = 0;
   _nmethod_count                = 0;
   _adapter_count                = 0;
   _full_count                   = 0;
   _fragmentation_count          = 0;
+  for (int i = 0; i < freelist_bins; i++) {
+    _bins[i] = NULL;
+  }
 }
 
 // Dummy initialization of template array.
@@ -278,14 +282,25 @@ bool CodeHeap::expand_by(size_t size) {
 }
 
 
-void* CodeHeap::allocate(size_t instance_size) {
+void CodeHeap::set_hot_region_size(size_t size) {
+  _hot_segments = MIN2(size_to_segments(size), _number_of_reserved_segments);
+}
+
+void* CodeHeap::allocate(size_t instance_size, bool hot) {
   size_t number_of_segments = size_to_segments(instance_size + header_size());
   assert(segments_to_size(number_of_segments) >= sizeof(FreeBlock), "not enough room for FreeList");
   assert_locked_or_safepoint(CodeCache_lock);
 
   // First check if we can satisfy request from freelist
   NOT_PRODUCT(verify());
-  HeapBlock* block = search_freelist(number_of_segments);
+  HeapBlock* block = search_freelist(number_of_segments, hot ? hot_region : cold_region);
+  if (block == NULL && _hot_segments > 0) {
+    // Hot code that does not fit into the hot region goes anywhere. Cold
+    // code only takes space from the hot region before the heap is full.
+    if (hot || _next_segment + MAX2((size_t)CodeCacheMinBlockLength, number_of_segments) > _number_of_committed_segments) {
+      block = search_freelist(number_of_segments, any_region);
+    }
+  }
   NOT_PRODUCT(verify());
 
   if (block != NULL) {
@@ -571,13 +586,42 @@ FreeBlock* CodeHeap::following_block(FreeBlock *b) {
   return (FreeBlock*)(((address)b) + _segment_size * b->length());
 }
 
+void CodeHeap::bin_insert(FreeBlock* b) {
+  size_t i = bin_for(b->length());
+  b->set_bin_prev(NULL);
+  b->set_bin_next(_bins[i]);
+  if (_bins[i] != NULL) {
+    _bins[i]->set_bin_prev(b);
+  }
+  _bins[i] = b;
+}
+
+// Must be called before the length of b changes.
+void CodeHeap::bin_remove(FreeBlock* b) {
+  if (b->bin_prev() != NULL) {
+    b->bin_prev()->set_bin_next(b->bin_next());
+  } else {
+    size_t i = bin_for(b->length());
+    assert(_bins[i] == b, "not in its size bin");
+    _bins[i] = b->bin_next();
+  }
+  if (b->bin_next() != NULL) {
+    b->bin_next()->set_bin_prev(b->bin_prev());
+  }
+}
+
 // Inserts block b after a
 void CodeHeap::insert_after(FreeBlock* a, FreeBlock* b) {
   assert(a != NULL && b != NULL, "must be real pointers");
 
   // Link b into the list after a
   b->set_link(a->link());
+  b->set_prev(a);
+  if (a->link() != NULL) {
+    a->link()->set_prev(b);
+  }
   a->set_link(b);
+  bin_insert(b);
 
   // See if we can merge blocks
   merge_right(b); // Try to make b bigger
@@ -593,8 +637,15 @@ bool CodeHeap::merge_right(FreeBlock* a) {
     // Remember linked (following) block. invalidate should only zap header of this block.
     size_t follower = segment_for(a->link());
     // Merge block a to include the following block.
-    a->set_length(a->length() + a->link()->length());
-    a->set_link(a->link()->link());
+    FreeBlock* f = a->link();
+    bin_remove(f);
+    bin_remove(a);
+    a->set_length(a->length() + f->length());
+    a->set_link(f->link());
+    if (f->link() != NULL) {
+      f->link()->set_prev(a);
+    }
+    bin_insert(a);
 
     // Update the segment map and invalidate block contents.
     mark_segmap_as_used(follower, segment_for(a) + a->length(), true);
@@ -628,7 +679,9 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
   // First element in list?
   if (_freelist == NULL) {
     b->set_link(NULL);
+    b->set_prev(NULL);
     _freelist = b;
+    bin_insert(b);
     return;
   }
 
@@ -638,7 +691,10 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
   if (b < _freelist) {
     // Insert first in list
     b->set_link(_freelist);
+    b->set_prev(NULL);
+    _freelist->set_prev(b);
     _freelist = b;
+    bin_insert(b);
     merge_right(_freelist);
     return;
   }
@@ -664,39 +720,53 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
   _last_insert_point = prev;
 }
 
+// Free blocks starting in the hot region at the start of the heap are
+// reused only for hot code, so that hot code stays packed into a few
+// pages. Without a hot region every block is in every region.
+bool CodeHeap::in_region(FreeBlock* b, FreelistRegion region) const {
+  if (_hot_segments == 0 || region == any_region) {
+    return true;
+  }
+  return (segment_for(b) < _hot_segments) == (region == hot_region);
+}
+
 /**
  * Search freelist for an entry on the list with the best fit.
+ * The size bins make this independent of the number of free blocks,
+ * except for blocks of freelist_bins - 1 or more segments.
  * @return NULL, if no one was found
  */
-HeapBlock* CodeHeap::search_freelist(size_t length) {
+HeapBlock* CodeHeap::search_freelist(size_t length, FreelistRegion region) {
   FreeBlock* found_block  = NULL;
-  FreeBlock* found_prev   = NULL;
-  size_t     found_length = _next_segment; // max it out to begin with
-
   HeapBlock* res  = NULL;
-  FreeBlock* prev = NULL;
-  FreeBlock* cur  = _freelist;
 
   length = length < CodeCacheMinBlockLength ? CodeCacheMinBlockLength : length;
 
-  // Search for best-fitting block
-  while(cur != NULL) {
-    size_t cur_length = cur->length();
-    if (cur_length == length) {
-      // We have a perfect fit
-      found_block  = cur;
-      found_prev   = prev;
-      found_length = cur_length;
-      break;
-    } else if ((cur_length > length) && (cur_length < found_length)) {
-      // This is a new, closer fit. Remember block, its previous element, and its length
-      found_block  = cur;
-      found_prev   = prev;
-      found_length = cur_length;
+  // Any block of the smallest fitting exact size bin is a best fit
+  for (size_t i = length; i < freelist_bins - 1 && found_block == NULL; i++) {
+    for (FreeBlock* cur = _bins[i]; cur != NULL; cur = cur->bin_next()) {
+      if (in_region(cur, region)) {
+        found_block = cur;
+        break;
+      }
+    }
+  }
+
+  if (found_block == NULL) {
+    // Search the bin of long blocks for the best-fitting block
+    for (FreeBlock* cur = _bins[freelist_bins - 1]; cur != NULL; cur = cur->bin_next()) {
+      size_t cur_length = cur->length();
+      if (cur_length < length || !in_region(cur, region)) {
+        continue;
+      }
+      if (found_block == NULL || cur_length < found_block->length()) {
+        found_block = cur;
+        if (cur_length == length) {
+          // We have a perfect fit
+          break;
+        }
+      }
     }
-    // Next element in list
-    prev = cur;
-    cur  = cur->link();
   }
 
   if (found_block == NULL) {
@@ -704,18 +774,26 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
     return NULL;
   }
 
+  size_t found_length = found_block->length();
+  bin_remove(found_block);
+
   // Exact (or at least good enough) fit. Remove from list.
   // Don't leave anything on the freelist smaller than CodeCacheMinBlockLength.
   if (found_length - length < CodeCacheMinBlockLength) {
     _freelist_length--;
     length = found_length;
-    if (found_prev == NULL) {
+    FreeBlock* prev = found_block->prev();
+    FreeBlock* next = found_block->link();
+    if (prev == NULL) {
       assert(_freelist == found_block, "sanity check");
-      _freelist = _freelist->link();
+      _freelist = next;
     } else {
-      assert((found_prev->link() == found_block), "sanity check");
+      assert((prev->link() == found_block), "sanity check");
       // Unmap element
-      found_prev->set_link(found_block->link());
+      prev->set_link(next);
+    }
+    if (next != NULL) {
+      next->set_prev(prev);
     }
     res = (HeapBlock*)found_block;
     // sizeof(HeapBlock) < sizeof(FreeBlock).
@@ -727,9 +805,10 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
   } else {
     // Truncate the free block and return the truncated part
     // as new HeapBlock. The remaining free block does not
-    // need to be updated, except for it's length. Truncating
-    // the segment map does not invalidate the leading part.
+    // need to be updated, except for it's length and size bin.
+    // Truncating the segment map does not invalidate the leading part.
     res = split_block(found_block, found_length - length);
+    bin_insert(found_block);
   }
 
   res->set_used();
@@ -805,6 +884,17 @@ void CodeHeap::verify() {
     // Verify that freelist contains the right amount of free space
     assert(len == _freelist_segments, "wrong freelist");
 
+    // Verify that every free block is in its size bin
+    int binned = 0;
+    for (int i = 0; i < freelist_bins; i++) {
+      for (FreeBlock* b = _bins[i]; b != NULL; b = b->bin_next()) {
+        assert(bin_for(b->length()) == (size_t)i, "free block in wrong size bin");
+        assert(b->bin_next() == NULL || b->bin_next()->bin_prev() == b, "broken size bin");
+        binned++;
+      }
+    }
+    assert(binned == count, "free blocks missing from size bins");
+
     for(HeapBlock* h = first_block(); h != NULL; h = next_block(h)) {
       if (h->free()) count--;
     }
@@ -67,15 +67,24 @@ class HeapBlock {
 class FreeBlock: public HeapBlock {
   friend class VMStructs;
  protected:
-  FreeBlock* _link;
+  FreeBlock* _link;                          // next free block by address
+  FreeBlock* _prev;                          // previous free block by address
+  FreeBlock* _bin_next;                      // next free block in the same size bin
+  FreeBlock* _bin_prev;                      // previous free block in the same size bin
 
  public:
   // Initialization
-  void initialize(size_t length)             { HeapBlock::initialize(length); _link= NULL; }
+  void initialize(size_t length)             { HeapBlock::initialize(length); _link = _prev = _bin_next = _bin_prev = NULL; }
 
   // Accessors
   FreeBlock* link() const                    { return _link; }
   void set_link(FreeBlock* link)             { _link = link; }
+  FreeBlock* prev() const                    { return _prev; }
+  void set_prev(FreeBlock* prev)             { _prev = prev; }
+  FreeBlock* bin_next() const                { return _bin_next; }
+  void set_bin_next(FreeBlock* b)            { _bin_next = b; }
+  FreeBlock* bin_prev() const                { return _bin_prev; }
+  void set_bin_prev(FreeBlock* b)            { _bin_prev = b; }
 };
 
 class CodeHeap : public CHeapObj<mtCode> {
@@ -96,6 +105,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t       _freelist_segments;               // No. of segments in freelist
   int          _freelist_length;
   size_t       _max_allocated_capacity;          // Peak capacity that was allocated during lifetime of the heap
+  size_t       _hot_segments;                    // Segments at the start of the heap whose free blocks are kept for hot code
 
   const char*  _name;                            // Name of the CodeHeap
   const int    _code_blob_type;                  // CodeBlobType it contains
@@ -105,6 +115,11 @@ class CodeHeap : public CHeapObj<mtCode> {
   int          _full_count;                      // Number of times the code heap was full
   int          _fragmentation_count;             // #FreeBlock joins without fully initializing segment map elements.
 
+  // Free blocks are also kept in size bins: one bin per exact length below
+  // freelist_bins - 1 segments, and one bin for all longer blocks.
+  enum { freelist_bins = 128 };
+  FreeBlock*   _bins[freelist_bins];
+
   enum { free_sentinel = 0xFF };
   static const int fragmentation_limit = 10000;  // defragment after that many potential fragmentations.
   static const int freelist_limit = 100;         // improve insert point search if list is longer than this limit.
@@ -132,10 +147,15 @@ class CodeHeap : public CHeapObj<mtCode> {
   FreeBlock* following_block(FreeBlock* b);
   void insert_after(FreeBlock* a, FreeBlock* b);
   bool merge_right (FreeBlock* a);
+  static size_t bin_for(size_t length)          { return MIN2(length, (size_t)freelist_bins - 1); }
+  void bin_insert(FreeBlock* b);
+  void bin_remove(FreeBlock* b);
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock* b);
-  HeapBlock* search_freelist(size_t length);
+  enum FreelistRegion { any_region, hot_region, cold_region };
+  bool in_region(FreeBlock* b, FreelistRegion region) const;
+  HeapBlock* search_freelist(size_t length, FreelistRegion region);
 
   // Iteration helpers
   void*      next_used(HeapBlock* b) const;
@@ -152,7 +172,8 @@ class CodeHeap : public CHeapObj<mtCode> {
   bool  expand_by(size_t size);                  // expands committed memory by size
 
   // Memory allocation
-  void* allocate (size_t size); // Allocate 'size' bytes in the code cache or return NULL
+  void* allocate (size_t size, bool hot = false); // Allocate 'size' bytes in the code cache or return NULL
+  void  set_hot_region_size(size_t size);       // Reserve the free blocks at the start of the heap for hot code
   void  deallocate(void* p);    // Deallocate memory
   // Free the tail of segments allocated by the last call to 'allocate()' which exceed 'used_size'.
   // ATTENTION: this is only safe to use if there was no other call to 'allocate()' after
@@ -307,6 +307,15 @@ void KlassInfoHisto::print_elements(outputStream* st) const {
   }
   st->print_cr("Total " INT64_FORMAT_W(13) "  " UINT64_FORMAT_W(13),
                total, totalw * HeapWordSize);
+  // Mark word and klass pointer of every object, the part of the object
+  // size that is not available for fields or array elements.
+  const uint64_t header_bytes = (uint64_t)oopDesc::klass_offset_in_bytes() +
+    (UseCompressedClassPointers ? sizeof(narrowKlass) : sizeof(Klass*));
+  if (totalw > 0) {
+    const uint64_t headers = (uint64_t)total * header_bytes;
+    st->print_cr("Object headers: " UINT64_FORMAT " bytes (%.1f%% of total)",
+                 headers, 100.0 * (double)headers / (double)(totalw * HeapWordSize));
+  }
 }
 
 class HierarchyClosure : public KlassInfoClosure {
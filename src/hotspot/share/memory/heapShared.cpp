@@ -32,6 +32,7 @@
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "logging/log.hpp"
 #include "logging/logMessage.hpp"
@@ -66,6 +67,13 @@ address   HeapShared::_narrow_oop_base;
 int       HeapShared::_narrow_oop_shift;
 DumpedInternedStrings *HeapShared::_dumped_interned_strings = NULL;
 
+bool HeapShared::_is_loaded = false;
+int HeapShared::_num_loaded_regions = 0;
+HeapShared::LoadedRegion HeapShared::_loaded_regions[MetaspaceShared::max_closed_archive_heap_region +
+                                                     MetaspaceShared::max_open_archive_heap_region];
+uintptr_t HeapShared::_loaded_heap_bottom = 0;
+uintptr_t HeapShared::_loaded_heap_top = 0;
+
 //
 // If you add new entries to the following tables, you should know what you're doing!
 //
@@ -104,11 +112,45 @@ const static int num_open_archive_subgraph_entry_fields =
 const static int num_fmg_open_archive_subgraph_entry_fields =
   sizeof(fmg_open_archive_subgraph_entry_fields) / sizeof(ArchivableStaticFieldInfo);
 
+GrowableArray<ArchivableStaticFieldInfo>* HeapShared::_extra_subgraph_entry_fields = NULL;
+
 ////////////////////////////////////////////////////////////////
 //
 // Java heap object archiving support
 //
 ////////////////////////////////////////////////////////////////
+bool HeapShared::can_load() {
+  return UseCompressedOops && UseCompressedClassPointers &&
+         Universe::heap()->can_load_archived_objects();
+}
+
+// Until set_loaded() is called, decode_from_archive() still returns dump time
+// addresses, which is what FileMapInfo uses to compute dumptime_base.
+void HeapShared::add_loaded_region(uintptr_t dumptime_base, size_t size,
+                                   uintptr_t runtime_base) {
+  assert(!_is_loaded, "too late");
+  assert(_num_loaded_regions < MetaspaceShared::max_closed_archive_heap_region +
+                               MetaspaceShared::max_open_archive_heap_region, "sanity");
+  LoadedRegion* r = &_loaded_regions[_num_loaded_regions++];
+  r->_dumptime_base = dumptime_base;
+  r->_dumptime_top = dumptime_base + size;
+  r->_runtime_offset = (intx)(runtime_base - dumptime_base);
+
+  if (_loaded_heap_bottom == 0 || runtime_base < _loaded_heap_bottom) {
+    _loaded_heap_bottom = runtime_base;
+  }
+  if (runtime_base + size > _loaded_heap_top) {
+    _loaded_heap_top = runtime_base + size;
+  }
+}
+
+void HeapShared::set_loaded() {
+  assert(_num_loaded_regions > 0, "must have loaded something");
+  _is_loaded = true;
+  set_closed_archive_heap_region_mapped();
+  set_open_archive_heap_region_mapped();
+}
+
 void HeapShared::fixup_mapped_heap_regions() {
   FileMapInfo *mapinfo = FileMapInfo::current_info();
   mapinfo->fixup_mapped_heap_regions();
@@ -216,6 +258,10 @@ oop HeapShared::materialize_archived_object(narrowOop v) {
          "must be called after archive heap regions are fixed");
   if (!CompressedOops::is_null(v)) {
     oop obj = HeapShared::decode_from_archive(v);
+    if (is_loaded()) {
+      // Loaded objects are ordinary heap objects.
+      return obj;
+    }
     return G1CollectedHeap::heap()->materialize_archived_object(obj);
   }
   return NULL;
@@ -336,6 +382,20 @@ void HeapShared::copy_open_archive_heap_objects(
                              true /* is_full_module_graph */,
                              THREAD);
   }
+  if (_extra_subgraph_entry_fields != NULL) {
+    for (int i = _extra_subgraph_entry_fields->length() - 1; i >= 0; i--) {
+      if (!is_archivable_extra_subgraph(_extra_subgraph_entry_fields->adr_at(i))) {
+        _extra_subgraph_entry_fields->remove_at(i);
+      }
+    }
+    if (_extra_subgraph_entry_fields->length() > 0) {
+      archive_object_subgraphs(_extra_subgraph_entry_fields->adr_at(0),
+                               _extra_subgraph_entry_fields->length(),
+                               false /* is_closed_archive */,
+                               false /* is_full_module_graph */,
+                               THREAD);
+    }
+  }
 
   G1CollectedHeap::heap()->end_archive_alloc_range(open_archive,
                                                    os::vm_allocation_granularity());
@@ -1065,6 +1125,174 @@ void HeapShared::init_subgraph_entry_fields(Thread* THREAD) {
                                num_fmg_open_archive_subgraph_entry_fields,
                                THREAD);
   }
+  if (ArchiveHeapEntryFields != NULL && ArchiveHeapEntryFields[0] != '\0') {
+    init_extra_subgraph_entry_fields(THREAD);
+  }
+}
+
+static bool is_builtin_subgraph_entry_class(const char* klass_name) {
+  for (int i = 0; i < num_closed_archive_subgraph_entry_fields; i++) {
+    if (strcmp(closed_archive_subgraph_entry_fields[i].klass_name, klass_name) == 0) return true;
+  }
+  for (int i = 0; i < num_open_archive_subgraph_entry_fields; i++) {
+    if (strcmp(open_archive_subgraph_entry_fields[i].klass_name, klass_name) == 0) return true;
+  }
+  for (int i = 0; i < num_fmg_open_archive_subgraph_entry_fields; i++) {
+    if (strcmp(fmg_open_archive_subgraph_entry_fields[i].klass_name, klass_name) == 0) return true;
+  }
+  return false;
+}
+
+// Parse -XX:ArchiveHeapEntryFields=<class>.<field>,... The classes must be
+// loaded by the boot loader (e.g., from -Xbootclasspath/a), because the
+// subgraph object classes are resolved with the NULL loader at run time.
+// The static initializer of each class picks up the archived values by
+// calling jdk.internal.misc.CDS.initializeFromArchive(), just like the JDK
+// classes listed above.
+void HeapShared::init_extra_subgraph_entry_fields(Thread* THREAD) {
+  _extra_subgraph_entry_fields =
+    new (ResourceObj::C_HEAP, mtClass) GrowableArray<ArchivableStaticFieldInfo>(10, mtClass);
+
+  char* list = os::strdup_check_oom(ArchiveHeapEntryFields, mtClass);
+  char* save_ptr;
+  for (char* token = strtok_r(list, ", \n", &save_ptr); token != NULL;
+       token = strtok_r(NULL, ", \n", &save_ptr)) {
+    char* dot = strrchr(token, '.');
+    if (dot == NULL || dot == token || dot[1] == '\0') {
+      warning("ArchiveHeapEntryFields: malformed entry '%s', expected <class>.<field>", token);
+      continue;
+    }
+    *dot = '\0';
+    const char* klass_name = token;
+    const char* field_name = dot + 1;
+
+    if (is_builtin_subgraph_entry_class(klass_name)) {
+      warning("ArchiveHeapEntryFields: %s already has archived fields, ignored", klass_name);
+      continue;
+    }
+
+    TempNewSymbol klass_sym = SymbolTable::new_symbol(klass_name);
+    TempNewSymbol field_sym = SymbolTable::new_symbol(field_name);
+    Klass* k = SystemDictionary::resolve_or_null(klass_sym, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      k = NULL;
+    }
+    if (k == NULL || !k->is_instance_klass() ||
+        !InstanceKlass::cast(k)->is_shared_boot_class()) {
+      warning("ArchiveHeapEntryFields: %s is not an archived boot class, ignored", klass_name);
+      continue;
+    }
+    InstanceKlass* ik = InstanceKlass::cast(k);
+
+    int offset = -1;
+    for (JavaFieldStream fs(ik); !fs.done(); fs.next()) {
+      if (fs.access_flags().is_static() && fs.name() == field_sym) {
+        fieldDescriptor& fd = fs.field_descriptor();
+        if (is_reference_type(fd.field_type())) {
+          offset = fd.offset();
+        }
+        break;
+      }
+    }
+    if (offset < 0) {
+      warning("ArchiveHeapEntryFields: %s has no static reference field %s, ignored",
+              klass_name, field_name);
+      continue;
+    }
+
+    // Run the static initializer now, so that the objects it creates are
+    // what gets archived.
+    ik->initialize(THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      warning("ArchiveHeapEntryFields: initialization of %s failed, ignored", klass_name);
+      continue;
+    }
+
+    // archive_object_subgraphs() records the fields of one class in a single
+    // pass, keyed by klass_name pointer, so keep them adjacent and share the
+    // name.
+    int pos = _extra_subgraph_entry_fields->length();
+    for (int i = 0; i < _extra_subgraph_entry_fields->length(); i++) {
+      if (_extra_subgraph_entry_fields->at(i).klass == ik) {
+        klass_name = _extra_subgraph_entry_fields->at(i).klass_name;
+        pos = i + 1;
+      }
+    }
+    ArchivableStaticFieldInfo info;
+    info.klass_name = (klass_name == token) ? os::strdup_check_oom(klass_name, mtClass) : klass_name;
+    info.field_name = os::strdup_check_oom(field_name, mtClass);
+    info.klass = ik;
+    info.offset = offset;
+    info.type = T_OBJECT;
+    _extra_subgraph_entry_fields->insert_before(pos, info);
+  }
+  os::free(list);
+}
+
+class ArchivableSubgraphPusher: public BasicOopIterateClosure {
+  GrowableArray<oop>* _stack;
+ public:
+  ArchivableSubgraphPusher(GrowableArray<oop>* stack) : _stack(stack) {}
+  void do_oop(narrowOop *p) { do_oop_work(p); }
+  void do_oop(      oop *p) { do_oop_work(p); }
+ private:
+  template <class T> void do_oop_work(T *p) {
+    oop obj = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(obj)) {
+      _stack->push(obj);
+    }
+  }
+};
+
+// The built-in entry fields are known to reference only archivable objects,
+// and archive_reachable_objects_from() exits the VM otherwise. For the
+// user-specified fields, walk the graph first and drop the field if any
+// reachable object cannot be archived, or its class is not in the archive.
+bool HeapShared::is_archivable_extra_subgraph(const ArchivableStaticFieldInfo* info) {
+  assert_at_safepoint(); // raw oops
+  oop root = info->klass->java_mirror()->obj_field(info->offset);
+  if (CompressedOops::is_null(root)) {
+    return true;
+  }
+
+  ResourceMark rm;
+  SeenObjectsTable* seen = new (ResourceObj::C_HEAP, mtClass)SeenObjectsTable();
+  GrowableArray<oop> stack;
+  ArchivableSubgraphPusher pusher(&stack);
+  bool result = true;
+  stack.push(root);
+  while (!stack.is_empty()) {
+    oop obj = stack.pop();
+    bool created;
+    seen->put_if_absent(obj, true, &created);
+    if (!created) {
+      continue;
+    }
+
+    Klass* k = obj->klass();
+    Klass* elem_k = k->is_objArray_klass() ? ObjArrayKlass::cast(k)->bottom_klass() : k;
+    const char* reason = NULL;
+    if (java_lang_Class::is_instance(obj)) {
+      reason = "java.lang.Class objects cannot be archived";
+    } else if (!JavaClasses::is_supported_for_archiving(obj)) {
+      reason = "class has unsupported injected fields";
+    } else if (elem_k->is_instance_klass() &&
+               (!InstanceKlass::cast(elem_k)->is_shared_boot_class() ||
+                SystemDictionaryShared::is_excluded_class(InstanceKlass::cast(elem_k)))) {
+      reason = "class is not an archived boot class";
+    }
+    if (reason != NULL) {
+      warning("ArchiveHeapEntryFields: %s.%s not archived: reaches %s object (%s)",
+              info->klass_name, info->field_name, k->external_name(), reason);
+      result = false;
+      break;
+    }
+    obj->oop_iterate(&pusher);
+  }
+  delete seen;
+  return result;
 }
 
 void HeapShared::init_for_dumping(Thread* THREAD) {
@@ -133,6 +133,21 @@ class HeapShared: AllStatic {
   static bool _archive_heap_region_fixed;
   static DumpedInternedStrings *_dumped_interned_strings;
 
+  // Set when the archived heap regions were copied into the heap by
+  // FileMapInfo::load_heap_regions_impl() instead of being mapped. Each
+  // region then has its own relocation offset, applied by decode_from_archive().
+  struct LoadedRegion {
+    uintptr_t _dumptime_base;
+    uintptr_t _dumptime_top;
+    intx      _runtime_offset;
+  };
+  static bool _is_loaded;
+  static int _num_loaded_regions;
+  static LoadedRegion _loaded_regions[MetaspaceShared::max_closed_archive_heap_region +
+                                      MetaspaceShared::max_open_archive_heap_region];
+  static uintptr_t _loaded_heap_bottom;
+  static uintptr_t _loaded_heap_top;
+
 public:
   static bool oop_equals(oop const& p1, oop const& p2) {
     return p1 == p2;
@@ -212,6 +227,13 @@ private:
   static void init_subgraph_entry_fields(ArchivableStaticFieldInfo fields[],
                                          int num, Thread* THREAD);
 
+  // Entry fields requested with -XX:ArchiveHeapEntryFields. Unlike the
+  // built-in tables, these are validated before use and dropped with a
+  // warning if they don't meet the archiving requirements.
+  static GrowableArray<ArchivableStaticFieldInfo>* _extra_subgraph_entry_fields;
+  static void init_extra_subgraph_entry_fields(Thread* THREAD);
+  static bool is_archivable_extra_subgraph(const ArchivableStaticFieldInfo* info);
+
   // Used by decode_from_archive
   static address _narrow_oop_base;
   static int     _narrow_oop_shift;
@@ -330,6 +352,17 @@ private:
 
   static void fixup_mapped_heap_regions() NOT_CDS_JAVA_HEAP_RETURN;
 
+  // Collectors that cannot map the archived heap regions may still use the
+  // archived objects by having them copied into the heap at startup.
+  static bool can_load() NOT_CDS_JAVA_HEAP_RETURN_(false);
+  static bool is_loaded() {
+    CDS_JAVA_HEAP_ONLY(return _is_loaded;)
+    NOT_CDS_JAVA_HEAP_RETURN_(false);
+  }
+  static void add_loaded_region(uintptr_t dumptime_base, size_t size,
+                                uintptr_t runtime_base) NOT_CDS_JAVA_HEAP_RETURN;
+  static void set_loaded() NOT_CDS_JAVA_HEAP_RETURN;
+
   inline static bool is_archived_object(oop p) NOT_CDS_JAVA_HEAP_RETURN_(false);
 
   static void initialize_from_archived_subgraph(Klass* k, TRAPS) NOT_CDS_JAVA_HEAP_RETURN;
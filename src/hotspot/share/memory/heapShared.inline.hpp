@@ -35,12 +35,30 @@
 #if INCLUDE_CDS_JAVA_HEAP
 
 bool HeapShared::is_archived_object(oop p) {
-  return (p == NULL) ? false : G1ArchiveAllocator::is_archived_object(p);
+  if (p == NULL) {
+    return false;
+  }
+  if (_is_loaded) {
+    uintptr_t addr = cast_from_oop<uintptr_t>(p);
+    return addr >= _loaded_heap_bottom && addr < _loaded_heap_top;
+  }
+  return G1ArchiveAllocator::is_archived_object(p);
 }
 
 inline oop HeapShared::decode_from_archive(narrowOop v) {
   assert(!CompressedOops::is_null(v), "narrow oop value can never be zero");
-  oop result = (oop)(void*)((uintptr_t)_narrow_oop_base + ((uintptr_t)v << _narrow_oop_shift));
+  uintptr_t addr = (uintptr_t)_narrow_oop_base + ((uintptr_t)v << _narrow_oop_shift);
+  if (_is_loaded) {
+    // The loaded regions are no longer contiguous as in the dump time heap.
+    for (int i = 0; i < _num_loaded_regions; i++) {
+      const LoadedRegion* r = &_loaded_regions[i];
+      if (addr >= r->_dumptime_base && addr < r->_dumptime_top) {
+        addr += r->_runtime_offset;
+        break;
+      }
+    }
+  }
+  oop result = (oop)(void*)addr;
   assert(is_object_aligned(result), "address not aligned: " INTPTR_FORMAT, p2i((void*) result));
   return result;
 }
@@ -717,6 +717,7 @@ void MetaspaceUtils::print_report(outputStream* out, size_t scale, int flags) {
         print_number_of_classes(out, num_classes, cl._num_classes_shared_by_spacetype[space_type]);
         out->print(":");
         cl._stats_by_spacetype[space_type].print_on(out, scale, print_by_chunktype);
+        cl._stats_by_spacetype[space_type].print_per_loader_on(out, scale, num_loaders);
       } else {
         out->print(".");
         out->cr();
@@ -1377,6 +1378,11 @@ const char* Metaspace::metadata_type_name(Metaspace::MetadataType mdtype) {
 
 void Metaspace::purge(MetadataType mdtype) {
   get_space_list(mdtype)->purge(get_chunk_manager(mdtype));
+  if (MetaspaceReleaseFreeChunks) {
+    size_t released = get_chunk_manager(mdtype)->release_free_chunk_memory();
+    log_debug(gc, metaspace, freelist)("%s: released " SIZE_FORMAT " bytes of free chunks.",
+                                       metadata_type_name(mdtype), released);
+  }
 }
 
 void Metaspace::purge() {
@@ -35,6 +35,8 @@
 #include "memory/metaspace/occupancyMap.hpp"
 #include "memory/metaspace/virtualSpaceNode.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -572,6 +574,7 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
   }
   chunk->container()->dec_container_count();
   do_update_in_use_info_for_chunk(chunk, false);
+  chunk->set_is_released(false);
 
   // Chunk has been added; update counters.
   account_for_added_chunk(chunk);
@@ -629,6 +632,35 @@ void ChunkManager::return_chunk_list(Metachunk* chunks) {
   }
 }
 
+size_t ChunkManager::release_free_chunk_memory() {
+  assert_lock_strong(MetaspaceExpand_lock);
+  // Large pages in metaspace may be pinned and cannot be discarded.
+  if (UseLargePagesInMetaspace) {
+    return 0;
+  }
+  const size_t page_size = os::vm_page_size();
+  size_t released = 0;
+  // Specialized chunks are smaller than a page, and humongous chunks keep
+  // the dictionary tree nodes in their payload. Humongous chunks are mostly
+  // returned when their VirtualSpaceNode is purged.
+  for (ChunkIndex i = SmallIndex; i <= MediumIndex; i = next_chunk_index(i)) {
+    for (Metachunk* chunk = free_chunks(i)->head(); chunk != NULL; chunk = chunk->next()) {
+      if (chunk->is_released()) {
+        continue;
+      }
+      // Keep the chunk header, it links the chunk into the freelist.
+      char* const start = align_up((char*)(chunk->bottom() + Metachunk::overhead()), page_size);
+      char* const end = align_down((char*)(chunk->bottom() + chunk->word_size()), page_size);
+      if (start < end) {
+        os::free_memory(start, pointer_delta(end, start, 1), page_size);
+        released += pointer_delta(end, start, 1);
+      }
+      chunk->set_is_released(true);
+    }
+  }
+  return released;
+}
+
 void ChunkManager::collect_statistics(ChunkManagerStatistics* out) const {
   MutexLocker cl(MetaspaceExpand_lock, Mutex::_no_safepoint_check_flag);
   for (ChunkIndex i = ZeroIndex; i < NumberOfInUseLists; i = next_chunk_index(i)) {
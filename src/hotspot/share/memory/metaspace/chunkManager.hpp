@@ -129,6 +129,11 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // of type index.
   void return_chunk_list(Metachunk* chunk);
 
+  // Give the payload pages of free small and medium chunks back to the OS.
+  // The memory stays committed and is faulted in again when the chunk is
+  // reused. Returns the number of bytes released.
+  size_t release_free_chunk_memory();
+
   // Total of the space in the free chunks list
   size_t free_chunks_total_words() const { return _free_chunks_total; }
   size_t free_chunks_total_bytes() const { return free_chunks_total_words() * BytesPerWord; }
@@ -58,6 +58,7 @@ Metachunk::Metachunk(ChunkIndex chunktype, bool is_class, size_t word_size,
     _sentinel(CHUNK_SENTINEL),
     _chunk_type(chunktype),
     _is_class(is_class),
+    _is_released(false),
     _origin(origin_normal),
     _use_count(0)
 {
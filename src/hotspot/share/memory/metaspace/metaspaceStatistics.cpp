@@ -270,6 +270,23 @@ void ClassLoaderMetaspaceStatistics::print_on(outputStream* st, size_t scale, bo
   st->cr();
 }
 
+void ClassLoaderMetaspaceStatistics::print_per_loader_on(outputStream* st, size_t scale, uintx num_loaders) const {
+  if (num_loaders == 0) {
+    return;
+  }
+  const UsedChunksStatistics stat = totals().totals();
+  streamIndentor sti(st);
+  st->cr_indent();
+  st->print("Per loader: ");
+  print_scaled_words(st, stat.cap() / num_loaders, scale, 5);
+  st->print(" capacity, ");
+  print_scaled_words_and_percentage(st, stat.used() / num_loaders, stat.cap() / num_loaders, scale, 5);
+  st->print(" used, ");
+  print_scaled_words_and_percentage(st, stat.waste() / num_loaders, stat.cap() / num_loaders, scale, 5);
+  st->print(" waste");
+  st->cr();
+}
+
 } // end namespace metaspace
 
 
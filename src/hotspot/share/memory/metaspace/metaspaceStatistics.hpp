@@ -180,6 +180,9 @@ public:
 
   void print_on(outputStream* st, size_t scale, bool detailed) const;
 
+  // Prints capacity, used and waste averaged over num_loaders loaders.
+  void print_per_loader_on(outputStream* st, size_t scale, uintx num_loaders) const;
+
 }; // ClassLoaderMetaspaceStatistics
 
 } // namespace metaspace
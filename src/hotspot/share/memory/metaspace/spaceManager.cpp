@@ -123,15 +123,26 @@ size_t SpaceManager::calc_chunk_size(size_t word_size) {
   // Instead of jumping to SmallChunk after initial chunk exhausted, keeping allocation
   // from SpecializeChunk up to _anon_or_delegating_metadata_specialize_chunk_limit (4)
   // reduces space waste from 60+% to around 30%.
-  if ((_space_type == Metaspace::ClassMirrorHolderMetaspaceType || _space_type == Metaspace::ReflectionMetaspaceType) &&
-      _mdtype == Metaspace::NonClassType &&
+  const bool is_small_arena =
+    (_space_type == Metaspace::ClassMirrorHolderMetaspaceType || _space_type == Metaspace::ReflectionMetaspaceType);
+  // With UseSmallMetaspaceArenas, the class space of these loaders, which
+  // usually holds a single Klass, keeps to specialized chunks as well.
+  if (is_small_arena &&
+      (_mdtype == Metaspace::NonClassType || UseSmallMetaspaceArenas) &&
       num_chunks_by_type(SpecializedIndex) < anon_and_delegating_metadata_specialize_chunk_limit &&
-      word_size + Metachunk::overhead() <= SpecializedChunk) {
-    return SpecializedChunk;
+      word_size + Metachunk::overhead() <= smallest_chunk_size()) {
+    return smallest_chunk_size();
   }
 
-  if (num_chunks_by_type(MediumIndex) == 0 &&
-      num_chunks_by_type(SmallIndex) < small_chunk_limit) {
+  if (is_small_arena && UseSmallMetaspaceArenas) {
+    // These loaders are many and short-lived. Keep them on small chunks
+    // instead of moving on to medium chunks after small_chunk_limit.
+    chunk_word_size = (size_t) small_chunk_size();
+    if (word_size + Metachunk::overhead() > small_chunk_size()) {
+      chunk_word_size = medium_chunk_size();
+    }
+  } else if (num_chunks_by_type(MediumIndex) == 0 &&
+             num_chunks_by_type(SmallIndex) < small_chunk_limit) {
     chunk_word_size = (size_t) small_chunk_size();
     if (word_size + Metachunk::overhead() > small_chunk_size()) {
       chunk_word_size = medium_chunk_size();
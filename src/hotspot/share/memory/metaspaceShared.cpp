@@ -1596,6 +1596,14 @@ char* MetaspaceShared::reserve_address_space_for_archives(FileMapInfo* static_ma
       align_up(archive_space_size + gap_size + class_space_size,
                os::vm_allocation_granularity());
 
+  // Archives and class space share the narrow Klass encoding range, which
+  //  starts at the archive base.
+  if (total_range_size > KlassEncodingMetaspaceMax) {
+    log_info(cds)("Archives and class space (" SIZE_FORMAT " bytes) exceed the "
+                  "compressed class pointer encoding range", total_range_size);
+    return NULL;
+  }
+
   ReservedSpace total_rs;
   if (base_address != NULL) {
     // Reserve at the given archive base address, or not at all.
@@ -429,7 +429,7 @@ void Universe::initialize_basic_type_mirrors(TRAPS) {
     if (UseSharedSpaces &&
         HeapShared::open_archive_heap_region_mapped() &&
         _mirrors[T_INT].resolve() != NULL) {
-      assert(HeapShared::is_heap_object_archiving_allowed(), "Sanity");
+      assert(HeapShared::is_heap_object_archiving_allowed() || HeapShared::is_loaded(), "Sanity");
 
       // check that all mirrors are mapped also
       for (int i = T_BOOLEAN; i < T_VOID+1; i++) {
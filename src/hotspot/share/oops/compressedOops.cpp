@@ -217,16 +217,16 @@ void CompressedKlassPointers::initialize(address addr, size_t len) {
     //
     // To be very careful here, we avoid any optimizations and just keep using
     //  the same address and shift value. Specifically we avoid using zero-based
-    //  encoding. We also set the expected value range to 4G (encoding range
-    //  cannot be larger than that).
+    //  encoding. We also set the expected value range to 4G, unless the class
+    //  space at runtime was made larger than at dumptime. Since the shift is
+    //  always LogKlassAlignmentInBytes, the encoding covers up to
+    //  KlassEncodingMetaspaceMax from the archive base.
 
     base = addr;
     shift = LogKlassAlignmentInBytes;
 
-    // This must be true since at dumptime cds+ccs is 4G, at runtime it can
-    //  only be smaller, see comment above.
-    assert(len <= 4 * G, "Encoding range cannot be larger than 4G");
-    range = 4 * G;
+    assert(len <= KlassEncodingMetaspaceMax, "Encoding range cannot be larger than 32G");
+    range = len <= 4 * G ? 4 * G : (size_t)KlassEncodingMetaspaceMax;
 
   } else {
 
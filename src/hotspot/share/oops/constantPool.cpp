@@ -423,6 +423,15 @@ void ConstantPool::remove_unshareable_info() {
         // All references to a hidden class's own field/methods are through this
         // index. We cannot clear it. See comments in ClassFileParser::fill_instance_klass.
         clear_it = false;
+      } else if (ArchiveResolvedKlassReferences) {
+        // A reference to the holder itself or to one of its superclasses
+        // resolves to the same class at runtime: a shared class is only
+        // loaded from the archive if its super types are the archived ones.
+        // This runs after relocation, so all pointers are buffer addresses.
+        Klass* k = resolved_klasses()->at(klass_slot_at(index).resolved_klass_index());
+        if (k != NULL && (k == pool_holder() || pool_holder()->is_subclass_of(k))) {
+          clear_it = false;
+        }
       }
       if (clear_it) {
         CPKlassSlot kslot = klass_slot_at(index);
@@ -35,6 +35,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "code/dependencyContext.hpp"
@@ -621,6 +622,8 @@ void InstanceKlass::deallocate_record_components(ClassLoaderData* loader_data,
 // InstanceKlass points to.
 void InstanceKlass::deallocate_contents(ClassLoaderData* loader_data) {
 
+  VerificationCache::forget(this);
+
   // Orphan the mirror first, CMS thinks it's still live.
   if (java_mirror() != NULL) {
     java_lang_Class::set_klass(java_mirror(), NULL);
@@ -2311,7 +2314,7 @@ inline DependencyContext InstanceKlass::dependencies() {
 }
 
 int InstanceKlass::mark_dependent_nmethods(KlassDepChange& changes) {
-  return dependencies().mark_dependent_nmethods(changes);
+  return dependencies().mark_dependent_nmethods(changes, this);
 }
 
 void InstanceKlass::add_dependent_nmethod(nmethod* nm) {
@@ -115,17 +115,41 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+  // Most negative checks are answered by the bitmap alone.
+  if ((secondary_supers_bitmap() & secondary_supers_hash_bit(k)) == 0)
+    return false;
   // Scan the array-of-objects for a match
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
     if (secondary_supers()->at(i) == k) {
-      ((Klass*)this)->set_secondary_super_cache(k);
+      // Avoid dirtying the cache line when the cache is already right,
+      // as it is read by every thread checking against this class.
+      if (secondary_super_cache() != k) {
+        ((Klass*)this)->set_secondary_super_cache(k);
+      }
       return true;
     }
   }
   return false;
 }
 
+void Klass::set_secondary_supers(Array<Klass*>* secondaries) {
+  _secondary_supers = secondaries;
+  uintx bitmap = 0;
+  if (secondaries != NULL) {
+    for (int i = 0; i < secondaries->length(); i++) {
+      Klass* s = secondaries->at(i);
+      if (s == NULL) {
+        // Bootstrap placeholder (see Universe::genesis), filled in later.
+        bitmap = ~(uintx)0;
+        break;
+      }
+      bitmap |= secondary_supers_hash_bit(s);
+    }
+  }
+  _secondary_supers_bitmap = bitmap;
+}
+
 // Return self, except for abstract classes with exactly 1
 // implementor.  Then return the 1 concrete implementation.
 Klass *Klass::up_cast_abstract() {
@@ -547,6 +571,9 @@ void Klass::remove_unshareable_info() {
 
   // Null out class_loader_data because we don't share that yet.
   set_class_loader_data(NULL);
+  // The bitmap hashes Klass addresses, which change when the archive is
+  // mapped. Accept everything until restore_unshareable_info rebuilds it.
+  _secondary_supers_bitmap = ~(uintx)0;
   set_is_shared();
 }
 
@@ -569,6 +596,9 @@ void Klass::restore_unshareable_info(ClassLoaderData* loader_data, Handle protec
     log_trace(cds, unshareable)("restore: %s", external_name());
   }
 
+  // Rebuild the secondary supers bitmap for the runtime Klass addresses.
+  set_secondary_supers(secondary_supers());
+
   // If an exception happened during CDS restore, some of these fields may already be
   // set.  We leave the class on the CLD list, even if incomplete so that we don't
   // modify the CLD list outside a safepoint.
@@ -136,6 +136,9 @@ class Klass : public Metadata {
   Klass*      _secondary_super_cache;
   // Array of all secondary supertypes
   Array<Klass*>* _secondary_supers;
+  // Bloom filter over _secondary_supers: one bit per hashed element, so
+  // that most negative secondary subtype checks need not scan the array
+  uintx       _secondary_supers_bitmap;
   // Ordered list of all primary supertypes
   Klass*      _primary_supers[_primary_super_limit];
   // java/lang/Class instance mirroring this class
@@ -226,7 +229,15 @@ protected:
   void set_secondary_super_cache(Klass* k) { _secondary_super_cache = k; }
 
   Array<Klass*>* secondary_supers() const { return _secondary_supers; }
-  void set_secondary_supers(Array<Klass*>* k) { _secondary_supers = k; }
+  void set_secondary_supers(Array<Klass*>* k);
+
+  uintx secondary_supers_bitmap() const { return _secondary_supers_bitmap; }
+  static uintx secondary_supers_hash_bit(const Klass* k) {
+    uintx h = (uintx)k >> LogKlassAlignmentInBytes;
+    h ^= h >> LogBitsPerWord;
+    h ^= h >> (2 * LogBitsPerWord);
+    return (uintx)1 << (h & (BitsPerWord - 1));
+  }
 
   // Return the element of the _super chain of the given depth.
   // If there is no such element, return either NULL or this.
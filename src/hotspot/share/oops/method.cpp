@@ -68,6 +68,7 @@
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
+#include "runtime/trapHistory.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/align.hpp"
 #include "utilities/quickSort.hpp"
@@ -124,6 +125,9 @@ Method::Method(ConstMethod* xconst, AccessFlags access_flags) {
 void Method::deallocate_contents(ClassLoaderData* loader_data) {
   MetadataFactory::free_metadata(loader_data, constMethod());
   set_constMethod(NULL);
+  if (method_data() != NULL) {
+    MethodData::note_deallocation(method_data());
+  }
   MetadataFactory::free_metadata(loader_data, method_data());
   set_method_data(NULL);
   MetadataFactory::free_metadata(loader_data, method_counters());
@@ -138,6 +142,7 @@ void Method::release_C_heap_structures() {
     FailedSpeculation::free_failed_speculations(method_data()->get_failed_speculations_address());
 #endif
     // Destroy MethodData
+    MethodData::note_deallocation(method_data());
     method_data()->~MethodData();
   }
 }
@@ -536,6 +541,7 @@ void Method::build_interpreter_method_data(const methodHandle& method, TRAPS) {
       return;   // return the exception (which is cleared)
     }
 
+    TrapHistory::apply(method_data);
     method->set_method_data(method_data);
     if (PrintMethodData && (Verbose || WizardMode)) {
       ResourceMark rm(THREAD);
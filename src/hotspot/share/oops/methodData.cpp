@@ -652,11 +652,24 @@ void SpeculativeTrapData::print_data_on(outputStream* st, const char* extra) con
 // A MethodData* holds information which has been collected about
 // a method.
 
+volatile size_t MethodData::_total_count = 0;
+volatile size_t MethodData::_total_bytes = 0;
+
 MethodData* MethodData::allocate(ClassLoaderData* loader_data, const methodHandle& method, TRAPS) {
   int size = MethodData::compute_allocation_size_in_words(method);
 
-  return new (loader_data, size, MetaspaceObj::MethodDataType, THREAD)
+  MethodData* md = new (loader_data, size, MetaspaceObj::MethodDataType, THREAD)
     MethodData(method, size, THREAD);
+  if (md != NULL) {
+    Atomic::inc(&_total_count);
+    Atomic::add(&_total_bytes, (size_t)size * BytesPerWord);
+  }
+  return md;
+}
+
+void MethodData::note_deallocation(const MethodData* md) {
+  Atomic::dec(&_total_count);
+  Atomic::sub(&_total_bytes, (size_t)md->size() * BytesPerWord);
 }
 
 int MethodData::bytecode_cell_count(Bytecodes::Code code) {
@@ -1952,9 +1952,17 @@ private:
 
   Mutex _extra_data_lock;
 
+  // Number and metaspace bytes of all allocated MethodData*, for NMT
+  static volatile size_t _total_count;
+  static volatile size_t _total_bytes;
+
   MethodData(const methodHandle& method, int size, TRAPS);
 public:
   static MethodData* allocate(ClassLoaderData* loader_data, const methodHandle& method, TRAPS);
+  // Called when the MethodData* is freed or its class loader is unloaded.
+  static void note_deallocation(const MethodData* md);
+  static size_t total_count() { return Atomic::load(&_total_count); }
+  static size_t total_bytes() { return Atomic::load(&_total_bytes); }
   MethodData() : _extra_data_lock(Mutex::leaf, "MDO extra data lock") {}; // For ciMethodData
 
   virtual bool is_methodData() const { return true; }
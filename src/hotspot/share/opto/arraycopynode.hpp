@@ -65,6 +65,11 @@ private:
 
   bool _arguments_validated;
 
+  // Set at macro expansion of a tightly coupled arraycopy that left
+  // dest[DestPos..length) of the new array uninitialized because this
+  // copy writes it. Every path of this copy must then initialize it.
+  bool _completes_array_init;
+
   static const TypeFunc* arraycopy_type() {
     const Type** fields = TypeTuple::fields(ParmLimit - TypeFunc::Parms);
     fields[Src]       = TypeInstPtr::BOTTOM;
@@ -179,6 +184,9 @@ public:
 
   bool has_negative_length_guard() const { return _has_negative_length_guard; }
 
+  bool completes_array_init() const     { return _completes_array_init; }
+  void set_completes_array_init()       { _completes_array_init = true; }
+
   static bool may_modify(const TypeOopPtr *t_oop, MemBarNode* mb, PhaseTransform *phase, ArrayCopyNode*& ac);
   bool modifies(intptr_t offset_lo, intptr_t offset_hi, PhaseTransform* phase, bool must_modify) const;
 
@@ -33,6 +33,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "opto/callGenerator.hpp"
+#include "opto/callnode.hpp"
 #include "opto/parse.hpp"
 #include "runtime/handles.inline.hpp"
 #include "utilities/events.hpp"
@@ -104,6 +105,32 @@ static bool is_init_with_ea(ciMethod* callee_method,
   return false;
 }
 
+/**
+ *  Return true when EA is ON and one of the call arguments (including
+ *  the receiver) is an object allocated in this compilation. Inlining
+ *  such a call even when it sits on a cold path lets EA see that the
+ *  object does not escape there, so it can still be scalar replaced.
+ */
+static bool is_allocation_argument_with_ea(ciMethod* callee_method,
+                                           JVMState* jvms, Compile* C) {
+  if (!InlineColdCallsWithAllocationArgs ||
+      !C->do_escape_analysis() || !EliminateAllocations) {
+    return false; // EA is off
+  }
+  SafePointNode* map = jvms->map();
+  if (map == NULL) {
+    return false;
+  }
+  for (int i = 0; i < callee_method->arg_size(); i++) {
+    Node* arg = map->argument(jvms, i);
+    if (arg->bottom_type()->isa_oopptr() != NULL &&
+        AllocateNode::Ideal_allocation(arg, C->initial_gvn()) != NULL) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /**
  *  Force inlining unboxing accessor.
  */
@@ -309,6 +336,9 @@ bool InlineTree::should_not_inline(ciMethod *callee_method,
     if (is_init_with_ea(callee_method, caller_method, C)) {
       // Escape Analysis: inline all executed constructors
       return false;
+    } else if (is_allocation_argument_with_ea(callee_method, jvms, C)) {
+      // Escape Analysis: inline executed methods using a local allocation
+      return false;
     } else {
       intx counter_high_value;
       // Tiered compilation uses a different "high value" than non-tiered compilation.
@@ -408,6 +438,10 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
       // inline constructors even if they are not reached.
     } else if (forced_inline()) {
       // Inlining was forced by CompilerOracle, ciReplay or annotation
+    } else if (UseInterpreter &&
+               is_allocation_argument_with_ea(callee_method, jvms, C)) {
+      // Escape Analysis: inline executed methods using a local allocation
+      // even when the call site profile says it is not reached.
     } else if (is_not_reached(callee_method, caller_method, caller_bci, profile)) {
       // don't inline unreached call sites
        set_msg("call site not reached");
@@ -83,6 +83,11 @@
   product(bool, AlignVector, true,                                          \
           "Perform vector store/load alignment in loop")                    \
                                                                             \
+  product(bool, AlignVectorPreLoop, true, DIAGNOSTIC,                       \
+          "Extend the pre-loop of vectorized loops so that main loop "      \
+          "vector accesses are aligned, also when misaligned vector "       \
+          "accesses are allowed")                                           \
+                                                                            \
   product(intx, NumberOfLoopInstrToAlign, 4,                                \
           "Number of first instructions in a loop to align")                \
           range(0, max_jint)                                                \
@@ -249,6 +254,11 @@
   develop(bool, OptoCoalesce, true,                                         \
           "Use Conservative Copy Coalescing in the Register Allocator")     \
                                                                             \
+  product(uintx, ConservativeCoalesceLiveRangeLimit, 0,                     \
+          "Skip conservative copy coalescing after live range splitting "   \
+          "in methods with more live ranges than this (0 = no limit)")      \
+          range(0, max_juint)                                               \
+                                                                            \
   develop(bool, UseUniqueSubclasses, true,                                  \
           "Narrow an abstract reference to the unique concrete subclass")   \
                                                                             \
@@ -265,6 +275,10 @@
   product(bool, ReduceBulkZeroing, true,                                    \
           "When bulk-initializing, try to avoid needless zeroing")          \
                                                                             \
+  product(bool, ReduceChainedArrayCopyZeroing, false, DIAGNOSTIC,           \
+          "Do not zero the tail of a new primitive array that the next "    \
+          "arraycopy fills completely")                                     \
+                                                                            \
   product(bool, UseFPUForSpilling, false,                                   \
           "Spill integer registers to FPU instead of stack when possible")  \
                                                                             \
@@ -341,6 +355,10 @@
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
                                                                             \
+  product(bool, SuperWordReductionsOutOfLoop, false, DIAGNOSTIC,            \
+          "Accumulate int and long add reductions of vectorized main loops "\
+          "in a vector and reduce it to a scalar only after the loop")      \
+                                                                            \
   product(bool, UseCMoveUnconditionally, false,                             \
           "Use CMove (scalar and vector) ignoring profitability test.")     \
                                                                             \
@@ -393,6 +411,15 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false, DIAGNOSTIC,                  \
+          "Profiling based inlining for more than two receivers, "          \
+          "needs TypeProfileWidth > 2")                                     \
+                                                                            \
+  product(intx, PolymorphicInliningReceivers, 4, DIAGNOSTIC,                \
+          "Max number of profiled receivers type-checked at a "             \
+          "polymorphic call site")                                          \
+          range(3, 8)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -464,6 +491,10 @@
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
                                                                             \
+  product(uintx, CompilationArenaLimit, 0,                                  \
+          "Bail out of a compilation whose node, compile and resource "     \
+          "arenas together exceed this many bytes (0 means no limit)")      \
+                                                                            \
   product(bool, UseJumpTables, true,                                        \
           "Use JumpTables instead of a binary search tree for switches")    \
                                                                             \
@@ -530,6 +561,15 @@
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
+  product(bool, InlineColdCallsWithAllocationArgs, false, DIAGNOSTIC,       \
+          "Inline executed calls on cold paths when an argument is an "     \
+          "object allocated in the compilation, so that escape analysis "   \
+          "can still scalar replace it")                                    \
+                                                                            \
+  product(bool, ReduceAllocationMerges, false, DIAGNOSTIC,                  \
+          "Split field loads through Phis merging allocations so that "     \
+          "the allocations can be scalar replaced")                         \
+                                                                            \
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
@@ -719,6 +759,10 @@
           "max number of live nodes in a method")                           \
           range(0, max_juint / 8)                                           \
                                                                             \
+  product(bool, PrioritizeLateInlines, false, DIAGNOSTIC,                   \
+          "Rank late inlining candidates by call site count per bytecode "  \
+          "so the live node budget goes to the hottest sites first")        \
+                                                                            \
   product(bool, OptimizeExpensiveOps, true, DIAGNOSTIC,                     \
           "Find best control for expensive operations")                     \
                                                                             \
@@ -783,6 +827,10 @@
           "Loop with fewer iterations are not strip mined")                 \
           range(0, max_juint)                                               \
                                                                             \
+  product(bool, UseLongCountedLoopNest, false, DIAGNOSTIC,                  \
+          "Transform loops with a long induction variable into a nest of "  \
+          "an int inner loop and a long outer loop")                        \
+                                                                            \
   product(bool, UseProfiledLoopPredicate, true,                             \
           "Move predicates out of loops based on profiling data")           \
                                                                             \
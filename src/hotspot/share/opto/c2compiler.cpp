@@ -485,6 +485,11 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_dexp:
   case vmIntrinsics::_dlog:
   case vmIntrinsics::_dlog10:
+  case vmIntrinsics::_strict_dsin:
+  case vmIntrinsics::_strict_dcos:
+  case vmIntrinsics::_strict_dtan:
+  case vmIntrinsics::_strict_dlog:
+  case vmIntrinsics::_strict_dlog10:
   case vmIntrinsics::_dpow:
   case vmIntrinsics::_min:
   case vmIntrinsics::_max:
@@ -636,6 +641,8 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_bigIntegerRightShiftWorker:
   case vmIntrinsics::_bigIntegerLeftShiftWorker:
   case vmIntrinsics::_vectorizedMismatch:
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
   case vmIntrinsics::_ghash_processBlocks:
   case vmIntrinsics::_base64_encodeBlock:
   case vmIntrinsics::_updateCRC32:
@@ -421,6 +421,14 @@ class PhaseChaitin : public PhaseRegAlloc {
   int _trip_cnt;
   int _alternate;
 
+  // Conservative coalescing after a split is optional. Skip it for huge
+  // methods, where it dominates the time spent in register allocation.
+  bool do_conservative_coalesce() const {
+    return OptoCoalesce &&
+           (ConservativeCoalesceLiveRangeLimit == 0 ||
+            _lrg_map.max_lrg_id() <= ConservativeCoalesceLiveRangeLimit);
+  }
+
   PhaseLive *_live;             // Liveness, used in the interference graph
   PhaseIFG *_ifg;               // Interference graph (for original chunk)
   VectorSet _spilled_once;      // Nodes that have been spilled
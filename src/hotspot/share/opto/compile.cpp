@@ -516,6 +516,7 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _stub_name(NULL),
                   _stub_entry_point(NULL),
                   _max_node_limit(MaxNodeLimit),
+                  _arena_peak(0),
                   _inlining_progress(false),
                   _inlining_incrementally(false),
                   _do_cleanup(false),
@@ -817,6 +818,7 @@ Compile::Compile( ciEnv* ci_env,
     _stub_name(stub_name),
     _stub_entry_point(NULL),
     _max_node_limit(MaxNodeLimit),
+    _arena_peak(0),
     _inlining_progress(false),
     _inlining_incrementally(false),
     _has_reserved_stack_access(false),
@@ -1889,12 +1891,53 @@ void Compile::inline_boxing_calls(PhaseIterGVN& igvn) {
   }
 }
 
+// Expected benefit of a late inline: profiled invocations of the call
+// site per bytecode of the callee.
+static float late_inline_priority(CallGenerator* cg) {
+  CallStaticJavaNode* call = cg->call_node();
+  if (call == NULL || call->jvms() == NULL) {
+    return 0.0f;
+  }
+  JVMState* jvms = call->jvms();
+  ciCallProfile profile = jvms->method()->call_profile_at_bci(jvms->bci());
+  float count = (float)MAX2(profile.count(), 0);
+  return count / MAX2(cg->method()->code_size_for_inlining(), 1);
+}
+
+// Order pending late inlines hottest first. The sort is stable so sites
+// with equal priority keep their depth first order.
+void Compile::sort_late_inlines_by_priority() {
+  int len = _late_inlines.length();
+  if (len < 2) {
+    return;
+  }
+  ResourceMark rm;
+  float* prio = NEW_RESOURCE_ARRAY(float, len);
+  for (int i = 0; i < len; i++) {
+    prio[i] = late_inline_priority(_late_inlines.at(i));
+  }
+  for (int i = 1; i < len; i++) {
+    CallGenerator* cg = _late_inlines.at(i);
+    float p = prio[i];
+    int j = i - 1;
+    for (; j >= 0 && prio[j] < p; j--) {
+      _late_inlines.at_put(j + 1, _late_inlines.at(j));
+      prio[j + 1] = prio[j];
+    }
+    _late_inlines.at_put(j + 1, cg);
+    prio[j + 1] = p;
+  }
+}
+
 bool Compile::inline_incrementally_one() {
   assert(IncrementalInline, "incremental inlining should be on");
 
   TracePhase tp("incrementalInline_inline", &timers[_t_incrInline_inline]);
   set_inlining_progress(false);
   set_do_cleanup(false);
+  if (PrioritizeLateInlines) {
+    sort_late_inlines_by_priority();
+  }
   int i = 0;
   for (; i <_late_inlines.length() && !inlining_progress(); i++) {
     CallGenerator* cg = _late_inlines.at(i);
@@ -2705,6 +2748,7 @@ void Compile::Code_Gen() {
       return;
     }
   }
+  print_method(PHASE_REGISTER_ALLOCATION, 2);
 
   // Prior to register allocation we kept empty basic blocks in case the
   // the allocator needed a place to spill.  After register allocation we
@@ -4005,6 +4049,8 @@ Compile::TracePhase::~TracePhase() {
     _log = NULL;
   }
 
+  C->check_arena_usage(_phase_name);
+
 #ifdef ASSERT
   if (PrintIdealNodeCount) {
     tty->print_cr("phase name='%s' nodes='%d' live='%d' live_graph_walk='%d'",
@@ -4021,6 +4067,25 @@ Compile::TracePhase::~TracePhase() {
   }
 }
 
+size_t Compile::arena_usage() const {
+  return _node_arena.size_in_bytes() + _old_arena.size_in_bytes() +
+         _comp_arena.size_in_bytes() + Thread::current()->resource_area()->size_in_bytes();
+}
+
+void Compile::check_arena_usage(const char* phase) {
+  size_t usage = arena_usage();
+  if (usage > _arena_peak) {
+    _arena_peak = usage;
+    env()->record_arena_peak(usage);
+  }
+  if (CompilationArenaLimit > 0 && usage > CompilationArenaLimit && !failing()) {
+    if (_log != NULL) {
+      _log->elem("arena_limit phase='%s' usage='" SIZE_FORMAT "'", phase, usage);
+    }
+    record_method_not_compilable("out of arena memory");
+  }
+}
+
 //----------------------------static_subtype_check-----------------------------
 // Shortcut important common cases when superklass is exact:
 // (0) superklass is java.lang.Object (can occur in reflective code)
@@ -261,6 +261,7 @@ class Compile : public Phase {
   int                   _fixed_slots;           // count of frame slots not allocated by the register
                                                 // allocator i.e. locks, original deopt pc, etc.
   uintx                 _max_node_limit;        // Max unique node count during a single compilation.
+  size_t                _arena_peak;            // High-water mark of arena memory, sampled per phase.
 
   int                   _major_progress;        // Count of something big happening
   bool                  _inlining_progress;     // progress doing incremental inlining?
@@ -752,6 +753,13 @@ class Compile : public Phase {
     }
   }
 
+  // Arena memory used by this compilation: node arenas, the compile
+  // arena and the compiler thread's resource area.
+  size_t arena_usage() const;
+  size_t arena_peak() const                { return _arena_peak; }
+  // Update the high-water mark and bail out if CompilationArenaLimit is exceeded.
+  void check_arena_usage(const char* phase);
+
   // Node management
   uint         unique() const              { return _unique; }
   uint         next_unique()               { return _unique++; }
@@ -973,6 +981,7 @@ class Compile : public Phase {
   bool has_mh_late_inlines() const     { return _number_of_mh_late_inlines > 0; }
 
   bool inline_incrementally_one();
+  void sort_late_inlines_by_priority();
   void inline_incrementally_cleanup(PhaseIterGVN& igvn);
   void inline_incrementally(PhaseIterGVN& igvn);
   void inline_string_calls(bool parse_time);
@@ -294,6 +294,42 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           }
         }
       }
+      if (receiver_method == NULL && morphism == 0 && UsePolymorphicInlining &&
+          profile.receivers() > 2) {
+        // Polymorphic call site without a major receiver: type-switch on the
+        // most frequent receivers seen by the profile (see TypeProfileWidth)
+        // and fall back to a virtual call for the others.
+        int receivers = MIN2(profile.receivers(), (int)PolymorphicInliningReceivers);
+        CallGenerator* cg = CallGenerator::for_virtual_call(callee, vtable_index);
+        bool predicted = false;
+        float miss_prob = 1.0f;
+        for (int i = 0; i < receivers; i++) {
+          miss_prob -= profile.receiver_prob(i);
+        }
+        for (int i = receivers - 1; i >= 0 && cg != NULL; i--) {
+          ciMethod* target = callee->resolve_invoke(jvms->method()->holder(), profile.receiver(i));
+          if (target == NULL) {
+            miss_prob += profile.receiver_prob(i);
+            continue;
+          }
+          CallGenerator* hit_cg = this->call_generator(target, vtable_index, !call_does_dispatch, jvms,
+                                                       allow_inline, prof_factor);
+          if (hit_cg == NULL) {
+            miss_prob += profile.receiver_prob(i);
+            continue;
+          }
+          // Probability of this receiver given that the ones checked
+          // before did not match.
+          float hit_prob = profile.receiver_prob(i) / (profile.receiver_prob(i) + MAX2(miss_prob, 0.0f));
+          trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), target, profile.receiver(i), site_count, profile.receiver_count(i));
+          cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cg, MIN2(hit_prob, PROB_MAX));
+          miss_prob += profile.receiver_prob(i);
+          predicted = true;
+        }
+        if (cg != NULL && predicted) {
+          return cg;
+        }
+      }
     }
 
     // If there is only one implementor of this interface then we
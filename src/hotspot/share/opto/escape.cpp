@@ -88,10 +88,129 @@ bool ConnectionGraph::has_candidates(Compile *C) {
   return false;
 }
 
+// Return true if 'n' is the address of a field of 'phi' and is only used
+// by loads.
+static bool is_field_address_of_merge(Node* n, Node* phi) {
+  if (!n->is_AddP() ||
+      n->in(AddPNode::Base) != phi || n->in(AddPNode::Address) != phi ||
+      !n->in(AddPNode::Offset)->is_Con()) {
+    return false;
+  }
+  for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
+    Node* use = n->fast_out(i);
+    if (!use->is_Load() || use->as_Load()->is_mismatched_access() ||
+        use->in(MemNode::Address) != n) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// With 'Foo f = cond ? new Foo(a) : new Foo(b)' both allocations are
+// merged by a Phi and are therefore not scalar replaceable (see
+// adjust_scalar_replaceable_state()). When the Phi is only used to load
+// fields, each load is split into one load per allocation, placed on the
+// corresponding path into the merge region. The Phi then goes away and
+// the allocations can be eliminated as usual.
+bool ConnectionGraph::reduce_allocation_merges(Compile *C, PhaseIterGVN *igvn) {
+  Unique_Node_List merges;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate() || n->is_AllocateArray()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    for (DUIterator_Fast imax, j = res->fast_outs(imax); j < imax; j++) {
+      Node* use = res->fast_out(j);
+      if (use->is_Phi() && use->bottom_type()->isa_instptr() != NULL) {
+        merges.push(use);
+      }
+    }
+  }
+
+  bool progress = false;
+  for (uint i = 0; i < merges.size(); i++) {
+    PhiNode* phi = merges.at(i)->as_Phi();
+    Node* region = phi->in(0);
+    if (region == NULL || region->is_top() || region->is_Loop()) {
+      continue;
+    }
+    bool ok = phi->outcnt() > 0;
+    for (uint j = 1; ok && j < phi->req(); j++) {
+      Node* in = phi->in(j);
+      ok = in != NULL && region->in(j) != NULL && !region->in(j)->is_top() &&
+           AllocateNode::Ideal_allocation(in, igvn) != NULL;
+    }
+    // Every use must be a field address used only by loads whose memory
+    // state is merged at the same region.
+    for (DUIterator_Fast jmax, j = phi->fast_outs(jmax); ok && j < jmax; j++) {
+      Node* addp = phi->fast_out(j);
+      if (!is_field_address_of_merge(addp, phi)) {
+        ok = false;
+        break;
+      }
+      for (DUIterator_Fast kmax, k = addp->fast_outs(kmax); ok && k < kmax; k++) {
+        Node* mem = addp->fast_out(k)->in(MemNode::Memory);
+        if (mem->is_MergeMem()) {
+          mem = mem->as_MergeMem()->memory_at(C->get_alias_index(addp->fast_out(k)->adr_type()));
+        }
+        ok = mem->is_Phi() && mem->in(0) == region;
+      }
+    }
+    if (!ok) {
+      continue;
+    }
+
+#ifndef PRODUCT
+    if (PrintEliminateAllocations) {
+      tty->print("=== Reducing allocation merge: ");
+      phi->dump();
+    }
+#endif
+    Node_List addps;
+    for (DUIterator_Fast jmax, j = phi->fast_outs(jmax); j < jmax; j++) {
+      addps.push(phi->fast_out(j));
+    }
+    for (uint j = 0; j < addps.size(); j++) {
+      Node* addp = addps.at(j);
+      while (addp->outcnt() > 0) {
+        Node* load = addp->raw_out(0);
+        Node* mem = load->in(MemNode::Memory);
+        if (mem->is_MergeMem()) {
+          mem = mem->as_MergeMem()->memory_at(C->get_alias_index(load->adr_type()));
+        }
+        PhiNode* value = PhiNode::make_blank(region, load);
+        for (uint j = 1; j < phi->req(); j++) {
+          Node* base = phi->in(j);
+          Node* adr = igvn->transform(new AddPNode(base, base, addp->in(AddPNode::Offset)));
+          Node* split = load->clone();
+          split->set_req(0, region->in(j));
+          split->set_req(MemNode::Memory, mem->in(j));
+          split->set_req(MemNode::Address, adr);
+          value->init_req(j, igvn->transform(split));
+        }
+        igvn->replace_node(load, igvn->transform(value));
+      }
+      // Dead now, removed by the following IGVN pass.
+      igvn->_worklist.push(addp);
+    }
+    progress = true;
+  }
+  return progress;
+}
+
 void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   Compile::TracePhase tp("escapeAnalysis", &Phase::timers[Phase::_t_escapeAnalysis]);
   ResourceMark rm;
 
+  if (ReduceAllocationMerges && reduce_allocation_merges(C, igvn)) {
+    igvn->optimize();
+    if (C->failing()) return;
+  }
+
   // Add ConP#NULL and ConN#NULL nodes before ConnectionGraph construction
   // to create space for them in ConnectionGraph::_nodes[].
   Node* oop_null = igvn->zerocon(T_OBJECT);
@@ -1008,7 +1127,8 @@ void ConnectionGraph::process_call_arguments(CallNode *call) {
                   strcmp(call->as_CallLeaf()->_name, "montgomery_square") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "bigIntegerRightShiftWorker") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "bigIntegerLeftShiftWorker") == 0 ||
-                  strcmp(call->as_CallLeaf()->_name, "vectorizedMismatch") == 0)
+                  strcmp(call->as_CallLeaf()->_name, "vectorizedMismatch") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "stringHashCode") == 0)
                  ))) {
             call->dump();
             fatal("EA unexpected CallLeaf %s", call->as_CallLeaf()->_name);
@@ -568,6 +568,9 @@ public:
   // Perform escape analysis
   static void do_analysis(Compile *C, PhaseIterGVN *igvn);
 
+  // Split field loads through Phis which merge only allocations
+  static bool reduce_allocation_merges(Compile *C, PhaseIterGVN *igvn);
+
   bool not_global_escape(Node *n);
 
   // To be used by, e.g., BarrierSetC2 impls
@@ -265,6 +265,11 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_dlog:
   case vmIntrinsics::_dlog10:
   case vmIntrinsics::_dpow:
+  case vmIntrinsics::_strict_dsin:
+  case vmIntrinsics::_strict_dcos:
+  case vmIntrinsics::_strict_dtan:
+  case vmIntrinsics::_strict_dlog:
+  case vmIntrinsics::_strict_dlog10:
   case vmIntrinsics::_dcopySign:
   case vmIntrinsics::_fcopySign:
   case vmIntrinsics::_dsignum:
@@ -574,6 +579,9 @@ bool LibraryCallKit::try_to_inline(int predicate) {
 
   case vmIntrinsics::_vectorizedMismatch:
     return inline_vectorizedMismatch();
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
+    return inline_string_hashCode(intrinsic_id());
 
   case vmIntrinsics::_ghash_processBlocks:
     return inline_ghash_processBlocks();
@@ -1648,6 +1656,14 @@ bool LibraryCallKit::inline_math_native(vmIntrinsics::ID id) {
       runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dlog10(), "dlog10") :
       runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dlog10), "LOG10");
 
+    // StrictMath natives: call the fdlibm ports directly, never the faster
+    // but not bit-compatible stubs, which saves the JNI native wrapper.
+  case vmIntrinsics::_strict_dsin:   return runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dsin),   "StrictMath_SIN");
+  case vmIntrinsics::_strict_dcos:   return runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dcos),   "StrictMath_COS");
+  case vmIntrinsics::_strict_dtan:   return runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dtan),   "StrictMath_TAN");
+  case vmIntrinsics::_strict_dlog:   return runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dlog),   "StrictMath_LOG");
+  case vmIntrinsics::_strict_dlog10: return runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dlog10), "StrictMath_LOG10");
+
     // These intrinsics are supported on all hardware
   case vmIntrinsics::_ceil:
   case vmIntrinsics::_floor:
@@ -5149,6 +5165,44 @@ bool LibraryCallKit::inline_vectorizedMismatch() {
   return true;
 }
 
+//-------------inline_string_hashCode------------------------------
+// int StringLatin1.hashCode(byte[] value)
+// int StringUTF16.hashCode(byte[] value)
+bool LibraryCallKit::inline_string_hashCode(vmIntrinsics::ID id) {
+  assert(UseStringHashCodeIntrinsic, "not implemented on this platform");
+
+  address stubAddr = StubRoutines::stringHashCode();
+  if (stubAddr == NULL) {
+    return false; // Intrinsic's stub is not implemented on this platform
+  }
+  const char* stubName = "stringHashCode";
+  assert(callee()->signature()->size() == 1, "hashCode has 1 parameter");
+
+  Node* value = argument(0);
+  value = null_check(value);
+  if (stopped()) {
+    return true;
+  }
+
+  // Hash over the backing array; UTF16 strings use two bytes per char.
+  Node* adr = array_element_address(value, intcon(0), T_BYTE);
+  Node* cnt = load_array_length(value);
+  int log2scale = 0;
+  if (id == vmIntrinsics::_hashCodeU) {
+    cnt = _gvn.transform(new RShiftINode(cnt, intcon(1)));
+    log2scale = 1;
+  }
+
+  Node* call = make_runtime_call(RC_LEAF,
+    OptoRuntime::stringHashCode_Type(),
+    stubAddr, stubName, TypePtr::BOTTOM,
+    adr, cnt, intcon(log2scale));
+
+  Node* result = _gvn.transform(new ProjNode(call, TypeFunc::Parms));
+  set_result(result);
+  return true;
+}
+
 /**
  * Calculate CRC32 for byte.
  * int java.util.zip.CRC32.update(int crc, int b)
@@ -301,6 +301,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_montgomerySquare();
   bool inline_bigIntegerShift(bool isRightShift);
   bool inline_vectorizedMismatch();
+  bool inline_string_hashCode(vmIntrinsics::ID id);
   bool inline_fma(vmIntrinsics::ID id);
   bool inline_character_compare(vmIntrinsics::ID id);
   bool inline_fp_min_max(vmIntrinsics::ID id);
@@ -62,6 +62,7 @@ void LoopNode::dump_spec(outputStream *st) const {
   if (is_inner_loop()) st->print( "inner " );
   if (is_partial_peel_loop()) st->print( "partial_peel " );
   if (partial_peel_has_failed()) st->print( "partial_peel_failed " );
+  if (is_loop_nest_outer_loop()) st->print( "loop_nest_outer " );
 }
 #endif
 
@@ -501,6 +502,176 @@ static int check_stride_overflow(jint stride_con, const TypeInt* limit_t) {
   return 0;
 }
 
+//------------------------transform_long_counted_loop--------------------------
+// Turn a loop with a long induction variable
+//
+//   for (long i = init; i < limit; i += stride) { ... i ... }
+//
+// into a nest of a long outer loop and an int inner loop that can then
+// be transformed into a counted loop (and range check eliminated,
+// unrolled and vectorized):
+//
+//   long i = init;
+//   do {
+//     int inner_limit = (int)clamp(limit - i, stride, max_jint - stride);
+//     int j = 0;
+//     do {
+//       ... i + j ...
+//       j += stride;
+//     } while (j < inner_limit);
+//   } while ((i = i + j) < limit);
+//
+// The inner loop keeps the original loop head and body. The original
+// exit test becomes the exit test of the outer loop, and, as for strip
+// mined loops, the safepoint that precedes it is cloned on the outer
+// loop so the nest polls at least once per inner loop execution.
+// The inner loop's exit test only ever fails early: whenever the outer
+// test then decides to stay in the loop, the inner loop is re-entered.
+bool PhaseIdealLoop::transform_long_counted_loop(Node* x, IdealLoopTree*& loop) {
+  if (!UseLongCountedLoopNest || x->Opcode() != Op_Loop || loop->_child != NULL ||
+      x->as_Loop()->is_loop_nest_outer_loop()) {
+    return false;
+  }
+
+  Node* back_control = loop_exit_control(x, loop);
+  if (back_control == NULL) {
+    return false;
+  }
+
+  BoolTest::mask bt = BoolTest::illegal;
+  float cl_prob = 0;
+  Node* incr = NULL;
+  Node* limit = NULL;
+  Node* cmp = loop_exit_test(back_control, loop, incr, limit, bt, cl_prob);
+  if (cmp == NULL || cmp->Opcode() != Op_CmpL || bt != BoolTest::lt) {
+    return false;
+  }
+
+  Node* phi_incr = NULL;
+  incr = loop_iv_incr(incr, x, loop, phi_incr);
+  if (incr == NULL || phi_incr != NULL || incr->Opcode() != Op_AddL) {
+    return false;
+  }
+
+  Node* xphi = NULL;
+  Node* stride = loop_iv_stride(incr, loop, xphi);
+  if (stride == NULL) {
+    return false;
+  }
+
+  PhiNode* phi = loop_iv_phi(xphi, phi_incr, x, loop);
+  if (phi == NULL || phi->in(LoopNode::LoopBackControl) != incr) {
+    return false;
+  }
+
+  jlong stride_con = stride->get_long();
+  if (stride_con <= 0 || stride_con > max_jint / 4) {
+    return false;
+  }
+
+  IfNode* exit_test = back_control->in(0)->as_If();
+  Node* sfpt = exit_test->in(0);
+  if (sfpt->Opcode() != Op_SafePoint || x->in(LoopNode::LoopBackControl) != back_control) {
+    return false;
+  }
+
+  // ---- SUCCESS! Build the loop nest ----
+  C->print_method(PHASE_BEFORE_CLOOPS, 3);
+
+  Node* entry_control = x->in(LoopNode::EntryControl);
+  BoolNode* test = exit_test->in(1)->as_Bool();
+  ProjNode* exit_branch = exit_test->proj_out(back_control->Opcode() == Op_IfTrue ? 0 : 1);
+
+  // Outer loop control flow: the inner loop exits to a copy of the
+  // safepoint and the original exit test.
+  Node* inner_exit_branch = exit_branch->clone();
+  Node* outer_sfpt = sfpt->clone();
+  outer_sfpt->set_req(0, inner_exit_branch);
+  IfNode* outer_exit_test = new IfNode(outer_sfpt, test, exit_test->_prob, exit_test->_fcnt);
+  Node* outer_back_branch = back_control->clone();
+  outer_back_branch->set_req(0, outer_exit_test);
+  LoopNode* outer_head = new LoopNode(entry_control, outer_back_branch);
+  outer_head->mark_loop_nest_outer_loop();
+
+  IdealLoopTree* outer_ilt = insert_outer_loop(loop, outer_head, outer_back_branch);
+
+  // When this code runs, loop bodies have not yet been populated.
+  const bool body_populated = false;
+  _igvn.register_new_node_with_optimizer(outer_head);
+  set_loop(outer_head, outer_ilt);
+  set_idom(outer_head, entry_control, dom_depth(entry_control) + 1);
+  _igvn.replace_input_of(x, LoopNode::EntryControl, outer_head);
+  set_idom(x, outer_head, dom_depth(outer_head) + 1);
+  register_control(inner_exit_branch, outer_ilt, exit_test, body_populated);
+  register_control(outer_sfpt, outer_ilt, inner_exit_branch, body_populated);
+  register_control(outer_exit_test, outer_ilt, outer_sfpt, body_populated);
+  register_control(outer_back_branch, outer_ilt, outer_exit_test, body_populated);
+  _igvn.replace_input_of(exit_branch, 0, outer_exit_test);
+  set_idom(exit_branch, outer_exit_test, dom_depth(outer_exit_test));
+
+  // Long induction variable of the outer loop
+  PhiNode* outer_phi = PhiNode::make(outer_head, phi->in(LoopNode::EntryControl), TypeLong::LONG);
+  outer_phi->set_req(LoopNode::LoopBackControl, incr);
+  _igvn.register_new_node_with_optimizer(outer_phi);
+  set_ctrl(outer_phi, outer_head);
+
+  // Int induction variable of the inner loop
+  Node* int_zero = _igvn.intcon(0);
+  set_ctrl(int_zero, C->root());
+  Node* int_stride = _igvn.intcon((jint)stride_con);
+  set_ctrl(int_stride, C->root());
+  PhiNode* inner_phi = new PhiNode(x, TypeInt::INT);
+  _igvn.register_new_node_with_optimizer(inner_phi);
+  set_ctrl(inner_phi, x);
+  Node* inner_incr = new AddINode(inner_phi, int_stride);
+  _igvn.register_new_node_with_optimizer(inner_incr);
+  inner_phi->init_req(LoopNode::EntryControl, int_zero);
+  inner_phi->init_req(LoopNode::LoopBackControl, inner_incr);
+
+  // Number of iterations of the inner loop, clamped so it neither
+  // overflows an int nor goes below a single iteration.
+  jlong inner_iters_max = max_jint - stride_con;
+  Node* long_stride = _igvn.longcon(stride_con);
+  Node* long_iters_max = _igvn.longcon(inner_iters_max);
+  Node* remaining = new SubLNode(limit, outer_phi);
+  Node* cmp_max = new CmpLNode(remaining, long_iters_max);
+  Node* bol_max = new BoolNode(cmp_max, BoolTest::gt);
+  Node* clamp_max = CMoveNode::make(NULL, bol_max, remaining, long_iters_max, TypeLong::LONG);
+  Node* cmp_min = new CmpLNode(clamp_max, long_stride);
+  Node* bol_min = new BoolNode(cmp_min, BoolTest::lt);
+  Node* clamp_min = CMoveNode::make(NULL, bol_min, clamp_max, long_stride,
+                                    TypeLong::make(stride_con, inner_iters_max, Type::WidenMin));
+  Node* inner_limit = new ConvL2INode(clamp_min);
+  _igvn.register_new_node_with_optimizer(remaining);
+  _igvn.register_new_node_with_optimizer(cmp_max);
+  _igvn.register_new_node_with_optimizer(bol_max);
+  _igvn.register_new_node_with_optimizer(clamp_max);
+  _igvn.register_new_node_with_optimizer(cmp_min);
+  _igvn.register_new_node_with_optimizer(bol_min);
+  _igvn.register_new_node_with_optimizer(clamp_min);
+  _igvn.register_new_node_with_optimizer(inner_limit);
+
+  BoolTest::mask inner_bt = back_control->Opcode() == Op_IfTrue ? BoolTest::lt : BoolTest::ge;
+  Node* inner_cmp = new CmpINode(inner_incr, inner_limit);
+  Node* inner_bol = new BoolNode(inner_cmp, inner_bt);
+  _igvn.register_new_node_with_optimizer(inner_cmp);
+  _igvn.register_new_node_with_optimizer(inner_bol);
+  set_subtree_ctrl(inner_bol);
+  _igvn.replace_input_of(exit_test, 1, inner_bol);
+
+  // Inside the nest the original long induction variable is i + j.
+  Node* inner_iv = new ConvI2LNode(inner_phi);
+  Node* iv = new AddLNode(outer_phi, inner_iv);
+  _igvn.register_new_node_with_optimizer(inner_iv);
+  _igvn.register_new_node_with_optimizer(iv);
+  set_subtree_ctrl(iv);
+  _igvn.replace_node(phi, iv);
+
+  loop = outer_ilt;
+  C->set_major_progress();
+  return true;
+}
+
 //------------------------------is_counted_loop--------------------------------
 bool PhaseIdealLoop::is_counted_loop(Node* x, IdealLoopTree*& loop) {
   PhaseGVN *gvn = &_igvn;
@@ -2574,6 +2745,10 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
     // Look for induction variables
     phase->replace_parallel_iv(this);
 
+  } else if (_parent != NULL && !_irreducible &&
+             phase->transform_long_counted_loop(_head, loop)) {
+    // Now the inner loop of a nest. It becomes a counted loop in the next
+    // round of loop opts.
   } else if (_parent != NULL && !_irreducible) {
     // Not a counted loop. Keep one safepoint.
     bool keep_one_sfpt = true;
@@ -2581,7 +2756,8 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
   }
 
   // Recursively
-  assert(loop->_child != this || (loop->_head->as_Loop()->is_OuterStripMinedLoop() && _head->as_CountedLoop()->is_strip_mined()), "what kind of loop was added?");
+  assert(loop->_child != this || (loop->_head->as_Loop()->is_OuterStripMinedLoop() && _head->as_CountedLoop()->is_strip_mined()) ||
+         loop->_head->as_Loop()->is_loop_nest_outer_loop(), "what kind of loop was added?");
   assert(loop->_child != this || (loop->_child->_child == NULL && loop->_child->_next == NULL), "would miss some loops");
   if (loop->_child && loop->_child != this) loop->_child->counted_loop(phase);
   if (loop->_next)  loop->_next ->counted_loop(phase);
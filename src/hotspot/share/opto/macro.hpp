@@ -143,6 +143,10 @@ private:
                            bool disjoint_bases = false,
                            bool length_never_negative = false,
                            RegionNode* slow_region = NULL);
+  ArrayCopyNode* tail_filling_arraycopy(ArrayCopyNode* ac, AllocateArrayNode* alloc,
+                                        BasicType basic_elem_type,
+                                        Node* dest, Node* dest_offset,
+                                        Node* copy_length);
   void generate_clear_array(Node* ctrl, MergeMemNode* merge_mem,
                             const TypePtr* adr_type,
                             Node* dest,
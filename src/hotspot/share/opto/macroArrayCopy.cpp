@@ -427,13 +427,25 @@ Node* PhaseMacroExpand::generate_arraycopy(ArrayCopyNode *ac, AllocateArrayNode*
                            NULL);
     }
 
+    // If the next arraycopy fills the whole tail, only the space after
+    // the last element needs zeroing; that copy takes care of the rest.
+    ArrayCopyNode* tail_ac = tail_filling_arraycopy(ac, alloc, basic_elem_type,
+                                                    dest, dest_offset, copy_length);
+    if (tail_ac != NULL) {
+      generate_clear_array(*ctrl, mem,
+                           adr_type, dest, basic_elem_type,
+                           dest_length, NULL,
+                           dest_size);
+      tail_ac->set_completes_array_init();
+    }
+
     // Next, perform a dynamic check on the tail length.
     // It is often zero, and we can win big if we prove this.
     // There are two wins:  Avoid generating the ClearArray
     // with its attendant messy index arithmetic, and upgrade
     // the copy to a more hardware-friendly word size of 64 bits.
     Node* tail_ctl = NULL;
-    if (!(*ctrl)->is_top() && !dest_tail->eqv_uncast(dest_length)) {
+    if (tail_ac == NULL && !(*ctrl)->is_top() && !dest_tail->eqv_uncast(dest_length)) {
       Node* cmp_lt   = transform_later( new CmpINode(dest_tail, dest_length) );
       Node* bol_lt   = transform_later( new BoolNode(cmp_lt, BoolTest::lt) );
       tail_ctl = generate_slow_guard(ctrl, bol_lt, NULL);
@@ -441,7 +453,7 @@ Node* PhaseMacroExpand::generate_arraycopy(ArrayCopyNode *ac, AllocateArrayNode*
     }
 
     // At this point, let's assume there is no tail.
-    if (!(*ctrl)->is_top() && alloc != NULL && basic_elem_type != T_OBJECT) {
+    if (tail_ac == NULL && !(*ctrl)->is_top() && alloc != NULL && basic_elem_type != T_OBJECT) {
       // There is no tail.  Try an upgrade to a 64-bit copy.
       bool didit = false;
       {
@@ -662,6 +674,14 @@ Node* PhaseMacroExpand::generate_arraycopy(ArrayCopyNode *ac, AllocateArrayNode*
                            adr_type, dest, basic_elem_type,
                            intcon(0), NULL,
                            alloc->in(AllocateNode::AllocSize));
+    } else if (ac->completes_array_init()) {
+      // The preceding copy left our part of the new array uninitialized.
+      AllocateArrayNode* dest_alloc = AllocateArrayNode::Ideal_array_allocation(dest, &_igvn);
+      assert(dest_alloc != NULL, "expect alloc");
+      generate_clear_array(local_ctrl, local_mem,
+                           adr_type, dest, basic_elem_type,
+                           dest_offset, NULL,
+                           dest_alloc->in(AllocateNode::AllocSize));
     }
 
     local_mem = generate_slow_arraycopy(ac,
@@ -731,6 +751,84 @@ Node* PhaseMacroExpand::generate_arraycopy(ArrayCopyNode *ac, AllocateArrayNode*
   return out_mem;
 }
 
+// Returns the arraycopy that immediately follows the tightly coupled
+// copy 'ac' and writes exactly dest[dest_offset + copy_length..length)
+// of the same new primitive array, or NULL. Nothing may observe the
+// array between the two copies: the second copy must be the only
+// control and memory user of the first, and its arguments must be
+// validated so it needs no guards of its own.
+ArrayCopyNode* PhaseMacroExpand::tail_filling_arraycopy(ArrayCopyNode* ac, AllocateArrayNode* alloc,
+                                                        BasicType basic_elem_type,
+                                                        Node* dest, Node* dest_offset,
+                                                        Node* copy_length) {
+  if (!ReduceChainedArrayCopyZeroing || is_reference_type(basic_elem_type) ||
+      basic_elem_type == T_CONFLICT || alloc == NULL) {
+    return NULL;
+  }
+  ProjNode* ctl_proj = ac->proj_out_or_null(TypeFunc::Control);
+  ProjNode* mem_proj = NULL;
+  for (DUIterator_Fast imax, i = ac->fast_outs(imax); i < imax; i++) {
+    ProjNode* pn = ac->fast_out(i)->as_Proj();
+    if (pn->_con == TypeFunc::Memory && !pn->_is_io_use) {
+      mem_proj = pn;
+    }
+  }
+  if (ctl_proj == NULL || mem_proj == NULL) {
+    return NULL;
+  }
+  Node* catch_node = ctl_proj->unique_ctrl_out();
+  if (catch_node == NULL || !catch_node->is_Catch()) {
+    return NULL;
+  }
+  ProjNode* fallthrough = catch_node->as_Catch()->proj_out_or_null(CatchProjNode::fall_through_index);
+  if (fallthrough == NULL || fallthrough->outcnt() != 1 || !fallthrough->unique_out()->is_ArrayCopy()) {
+    return NULL;
+  }
+  ArrayCopyNode* next = fallthrough->unique_out()->as_ArrayCopy();
+  if (!next->is_arraycopy_validated() || next->is_alloc_tightly_coupled() ||
+      next->in(TypeFunc::Control) != fallthrough ||
+      !next->in(ArrayCopyNode::Dest)->eqv_uncast(dest) ||
+      next->in(ArrayCopyNode::Src)->eqv_uncast(dest)) {
+    return NULL;
+  }
+  // The memory state of the first copy may only feed the second one.
+  for (DUIterator_Fast imax, i = mem_proj->fast_outs(imax); i < imax; i++) {
+    Node* use = mem_proj->fast_out(i);
+    if (use == next) {
+      continue;
+    }
+    if (!use->is_MergeMem() || use->outcnt() != 1 || use->unique_out() != next) {
+      return NULL;
+    }
+  }
+  // next->DestPos == dest_offset + copy_length
+  Node* next_pos = next->in(ArrayCopyNode::DestPos)->uncast();
+  bool pos_matches = false;
+  if (_igvn.find_int_con(dest_offset, -1) == 0 && next_pos == copy_length->uncast()) {
+    pos_matches = true;
+  } else if (next_pos->Opcode() == Op_AddI) {
+    Node* a = next_pos->in(1)->uncast();
+    Node* b = next_pos->in(2)->uncast();
+    pos_matches = (a == dest_offset->uncast() && b == copy_length->uncast()) ||
+                  (b == dest_offset->uncast() && a == copy_length->uncast());
+  }
+  if (!pos_matches) {
+    return NULL;
+  }
+  // next->DestPos + next->Length == dest.length
+  Node* dest_length = alloc->in(AllocateNode::ALength)->uncast();
+  Node* next_len = next->in(ArrayCopyNode::Length)->uncast();
+  bool end_matches = false;
+  if (dest_length->Opcode() == Op_AddI) {
+    Node* a = dest_length->in(1)->uncast();
+    Node* b = dest_length->in(2)->uncast();
+    end_matches = (a == next_pos && b == next_len) || (b == next_pos && a == next_len);
+  } else if (next_len->Opcode() == Op_SubI) {
+    end_matches = next_len->in(1)->uncast() == dest_length && next_len->in(2)->uncast() == next_pos;
+  }
+  return end_matches ? next : NULL;
+}
+
 // Helper for initialization of arrays, creating a ClearArray.
 // It writes zero bits in [start..end), within the body of an array object.
 // The memory effects are all chained onto the 'adr_type' alias category.
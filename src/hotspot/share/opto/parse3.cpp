@@ -55,6 +55,14 @@ void Parse::do_field_access(bool is_get, bool is_field) {
     return;
   }
 
+  // Leave accesses to fields watched by JVMTI to the interpreter.
+  if (field->is_watched_by_jvmti(is_get)) {
+    uncommon_trap(Deoptimization::Reason_unhandled,
+                  Deoptimization::Action_reinterpret,
+                  NULL, "JVMTI field watch");
+    return;
+  }
+
   // Deoptimize on putfield writes to call site target field outside of CallSite ctor.
   if (!is_get && field->is_call_site_target() &&
       !(method()->holder() == field_holder && method()->is_object_initializer())) {
@@ -50,6 +50,7 @@ enum CompilerPhaseType {
   PHASE_OPTIMIZE_FINISHED,
   PHASE_AFTER_MATCHING,
   PHASE_GLOBAL_CODE_MOTION,
+  PHASE_REGISTER_ALLOCATION,
   PHASE_FINAL_CODE,
   PHASE_AFTER_EA,
   PHASE_BEFORE_CLOOPS,
@@ -101,6 +102,7 @@ class CompilerPhaseTypeHelper {
       case PHASE_OPTIMIZE_FINISHED:          return "Optimize finished";
       case PHASE_AFTER_MATCHING:             return "After Matching";
       case PHASE_GLOBAL_CODE_MOTION:         return "Global code motion";
+      case PHASE_REGISTER_ALLOCATION:        return "Register allocation";
       case PHASE_FINAL_CODE:                 return "Final Code";
       case PHASE_AFTER_EA:                   return "After Escape Analysis";
       case PHASE_BEFORE_CLOOPS:              return "Before CountedLoop";
@@ -292,6 +292,7 @@ private:
   static const TypeFunc* bigIntegerShift_Type();
 
   static const TypeFunc* vectorizedMismatch_Type();
+  static const TypeFunc* stringHashCode_Type();
 
   static const TypeFunc* ghash_processBlocks_Type();
   static const TypeFunc* base64_encodeBlock_Type();
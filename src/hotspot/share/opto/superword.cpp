@@ -36,6 +36,7 @@
 #include "opto/mulnode.hpp"
 #include "opto/opcodes.hpp"
 #include "opto/opaquenode.hpp"
+#include "opto/rootnode.hpp"
 #include "opto/superword.hpp"
 #include "opto/vectornode.hpp"
 #include "opto/movenode.hpp"
@@ -2044,7 +2045,12 @@ bool SuperWord::profitable(Node_List* p) {
   if (p0->is_reduction()) {
     Node* second_in = p0->in(2);
     Node_List* second_pk = my_pack(second_in);
-    if ((second_pk == NULL) || (_num_work_vecs == _num_reductions)) {
+    // A reduction that is the only vector work in the loop is not worth a
+    // horizontal reduction per iteration, unless it will be accumulated in
+    // a vector and reduced only once after the loop.
+    bool reduce_after_loop = SuperWordReductionsOutOfLoop && is_reassociable_reduction(p0) &&
+                             lpt()->_head->as_CountedLoop()->is_main_loop();
+    if ((second_pk == NULL) || (_num_work_vecs == _num_reductions && !reduce_after_loop)) {
       // Remove reduction flag if no parent pack or if not enough work
       // to cover reduction expansion overhead
       p0->remove_flag(Node::Flag_is_reduction);
@@ -2397,8 +2403,12 @@ void SuperWord::output() {
   if (cl->is_main_loop()) {
     // MUST ENSURE main loop's initial value is properly aligned:
     //  (iv_initial_value + min_iv_offset) % vector_width_in_bytes() == 0
-
-    align_initial_loop_index(align_to_ref());
+    // unless misaligned vector accesses are allowed. Then aligning is
+    // only a performance tradeoff: for short arrays the extra pre-loop
+    // iterations cost more than the misaligned accesses they avoid.
+    if (AlignVectorPreLoop || vectors_should_be_aligned()) {
+      align_initial_loop_index(align_to_ref());
+    }
 
     // Insert extract (unpack) operations for scalar uses
     for (int i = 0; i < _packset.length(); i++) {
@@ -2712,6 +2722,10 @@ void SuperWord::output() {
     }
   }
 
+  if (SuperWordReductionsOutOfLoop && cl->is_main_loop() && max_vlen_in_bytes > 0) {
+    move_reductions_out_of_loop();
+  }
+
   if (do_reserve_copy()) {
     make_reversable.use_new();
   }
@@ -2719,6 +2733,140 @@ void SuperWord::output() {
   return;
 }
 
+//------------------------------is_reassociable_reduction---------------------------
+bool SuperWord::is_reassociable_reduction(Node* n) {
+  // Integer addition is associative and commutative, so the order in which
+  // the elements are summed does not matter.
+  int opc = n->Opcode();
+  return opc == Op_AddI || opc == Op_AddL || opc == Op_AddReductionVI || opc == Op_AddReductionVL;
+}
+
+//------------------------------move_reductions_out_of_loop---------------------------
+// After output() a vectorized reduction is a chain
+//
+//   phi = Phi(init, r_k)
+//   r_1 = AddReductionV(phi, v_1) ... r_k = AddReductionV(r_k-1, v_k)
+//
+// that reduces every vector to a scalar in each iteration. For int and long
+// addition it is replaced by
+//
+//   vphi = Phi(zero vector, a_k)
+//   a_1 = AddV(vphi, v_1) ... a_k = AddV(a_k-1, v_k)
+//
+// with a single AddReductionV(init, a_k) for the uses after the loop.
+void SuperWord::move_reductions_out_of_loop() {
+  CountedLoopNode* cl = lpt()->_head->as_CountedLoop();
+  // Collect the candidate phis first, new phis are added to cl below.
+  Node_List phis;
+  for (DUIterator_Fast imax, i = cl->fast_outs(imax); i < imax; i++) {
+    Node* phi = cl->fast_out(i);
+    if (phi->is_Phi() && phi->outcnt() == 1 && phi->req() == 3 &&
+        (phi->bottom_type()->isa_int() || phi->bottom_type()->isa_long())) {
+      phis.push(phi);
+    }
+  }
+
+  Unique_Node_List chain;
+  for (uint i = 0; i < phis.size(); i++) {
+    Node* phi = phis.at(i);
+    Node* first = phi->unique_out();
+    int opc = first->Opcode();
+    if ((opc != Op_AddReductionVI && opc != Op_AddReductionVL) || first->in(1) != phi) {
+      continue;
+    }
+
+    // Walk the chain of reductions back to the phi. Only the last reduction
+    // may have uses outside the loop.
+    chain.clear();
+    Node* last = NULL;
+    bool ok = true;
+    for (Node* r = first; ok && last == NULL; ) {
+      chain.push(r);
+      Node* next = NULL;
+      for (DUIterator_Fast jmax, j = r->fast_outs(jmax); j < jmax; j++) {
+        Node* use = r->fast_out(j);
+        if (!lpt()->is_member(_phase->get_loop(_phase->ctrl_or_self(use)))) {
+          continue;
+        }
+        if (next != NULL) {
+          ok = false; // More than one use in the loop
+          break;
+        }
+        next = use;
+      }
+      if (!ok || next == NULL) {
+        ok = false;
+      } else if (next == phi) {
+        last = r;
+      } else if (next->Opcode() == opc && next->in(1) == r && !chain.member(next)) {
+        if (r->outcnt() != 1) {
+          ok = false; // Uses of an intermediate value outside of the loop
+        }
+        r = next;
+      } else {
+        ok = false;
+      }
+    }
+    if (!ok || phi->in(LoopNode::LoopBackControl) != last) {
+      continue;
+    }
+
+    const TypeVect* vt = first->in(2)->bottom_type()->isa_vect();
+    if (vt == NULL) {
+      continue;
+    }
+    for (uint k = 0; k < chain.size() && ok; k++) {
+      ok = chain.at(k)->in(2)->bottom_type()->isa_vect() == vt;
+    }
+    BasicType bt = (opc == Op_AddReductionVI) ? T_INT : T_LONG;
+    if (!ok || vt->element_basic_type() != bt ||
+        !VectorNode::implemented(bt == T_INT ? Op_AddI : Op_AddL, vt->length(), bt) ||
+        !Matcher::match_rule_supported_vector(bt == T_INT ? Op_ReplicateI : Op_ReplicateL, vt->length(), bt)) {
+      continue;
+    }
+
+    // Vector accumulator, starting from zero.
+    Node* zero = (bt == T_INT) ? (Node*)_igvn.intcon(0) : (Node*)_igvn.longcon(0);
+    Node* zero_vec = VectorNode::scalar2vector(zero, vt->length(), (bt == T_INT) ? (const Type*)TypeInt::INT : (const Type*)TypeLong::LONG);
+    _igvn.register_new_node_with_optimizer(zero_vec);
+    _phase->set_ctrl(zero, _phase->C->root());
+    _phase->set_ctrl(zero_vec, _phase->C->root());
+
+    PhiNode* vphi = new PhiNode(cl, vt);
+    vphi->init_req(LoopNode::EntryControl, zero_vec);
+    _igvn.register_new_node_with_optimizer(vphi);
+    _phase->set_ctrl(vphi, cl);
+
+    Node* acc = vphi;
+    for (uint k = 0; k < chain.size(); k++) {
+      Node* r = chain.at(k);
+      Node* add = VectorNode::make(bt == T_INT ? Op_AddI : Op_AddL, acc, r->in(2), vt->length(), bt);
+      _igvn.register_new_node_with_optimizer(add);
+      _phase->set_ctrl(add, _phase->get_ctrl(r));
+      acc = add;
+    }
+    _igvn.replace_input_of(vphi, LoopNode::LoopBackControl, acc);
+
+    // A single reduction for the uses after the loop.
+    Node* init = phi->in(LoopNode::EntryControl);
+    Node* exit = cl->loopexit()->proj_out(false);
+    Node* result = ReductionNode::make(opc == Op_AddReductionVI ? Op_AddI : Op_AddL, NULL, init, acc, bt);
+    _igvn.register_new_node_with_optimizer(result);
+    _phase->set_ctrl(result, exit);
+    for (DUIterator_Last jmin, j = last->last_outs(jmin); j >= jmin; --j) {
+      Node* use = last->last_out(j);
+      if (use != phi) {
+        _igvn.rehash_node_delayed(use);
+        j -= use->replace_edge(last, result);
+      }
+    }
+    // The scalar chain is now only used by the old phi and dies with it.
+    _igvn.replace_node(phi, init);
+
+    NOT_PRODUCT(if (TraceSuperWord || TraceLoopOpts) { tty->print_cr("SuperWord::move_reductions_out_of_loop: %d reductions accumulated in vector phi %d", chain.size(), vphi->_idx); })
+  }
+}
+
 //------------------------------vector_opd---------------------------
 // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
 Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
@@ -498,6 +498,11 @@ class SuperWord : public ResourceObj {
   bool profitable(Node_List* p);
   // If a use of pack p is not a vector use, then replace the use with an extract operation.
   void insert_extracts(Node_List* p);
+  // Can an int or long add reduction be accumulated in a vector across iterations?
+  static bool is_reassociable_reduction(Node* n);
+  // Replace in-loop int and long add reduction chains by vector accumulators
+  // that are only reduced to a scalar after the loop.
+  void move_reductions_out_of_loop();
   // Is use->in(u_idx) a vector use?
   bool is_vector_use(Node* use, int u_idx);
   // Construct reverse postorder list of block members
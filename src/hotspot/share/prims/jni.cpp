@@ -2664,12 +2664,13 @@ DEFINE_RELEASESCALARARRAYELEMENTS(T_DOUBLE,  jdouble,  Double,  double
                                   HOTSPOT_JNI_RELEASEDOUBLEARRAYELEMENTS_RETURN())
 
 static void check_bounds(jsize start, jsize copy_len, jsize array_len, TRAPS) {
-  ResourceMark rm(THREAD);
   if (copy_len < 0) {
+    ResourceMark rm(THREAD);
     stringStream ss;
     ss.print("Length %d is negative", copy_len);
     THROW_MSG(vmSymbols::java_lang_ArrayIndexOutOfBoundsException(), ss.as_string());
   } else if (start < 0 || (start > array_len - copy_len)) {
+    ResourceMark rm(THREAD);
     stringStream ss;
     ss.print("Array region %d.." INT64_FORMAT " out of bounds for length %d",
              start, (int64_t)start+(int64_t)copy_len, array_len);
@@ -2682,7 +2683,7 @@ static void check_bounds(jsize start, jsize copy_len, jsize array_len, TRAPS) {
   DT_VOID_RETURN_MARK_DECL(Get##Result##ArrayRegion \
                            , ReturnProbe); \
 \
-JNI_ENTRY(void, \
+JNI_ENTRY_FAST_RETURN(void, \
 jni_Get##Result##ArrayRegion(JNIEnv *env, ElementType##Array array, jsize start, \
              jsize len, ElementType *buf)) \
   JNIWrapper("Get" XSTR(Result) "ArrayRegion"); \
@@ -2726,7 +2727,7 @@ DEFINE_GETSCALARARRAYREGION(T_DOUBLE,  jdouble, Double,  double
   DT_VOID_RETURN_MARK_DECL(Set##Result##ArrayRegion \
                            ,ReturnProbe);           \
 \
-JNI_ENTRY(void, \
+JNI_ENTRY_FAST_RETURN(void, \
 jni_Set##Result##ArrayRegion(JNIEnv *env, ElementType##Array array, jsize start, \
              jsize len, const ElementType *buf)) \
   JNIWrapper("Set" XSTR(Result) "ArrayRegion"); \
@@ -2975,7 +2976,7 @@ static void unlock_gc_or_unpin_object(JavaThread* thread, jobject obj) {
   }
 }
 
-JNI_ENTRY(void*, jni_GetPrimitiveArrayCritical(JNIEnv *env, jarray array, jboolean *isCopy))
+JNI_ENTRY_FAST_RETURN(void*, jni_GetPrimitiveArrayCritical(JNIEnv *env, jarray array, jboolean *isCopy))
   JNIWrapper("GetPrimitiveArrayCritical");
  HOTSPOT_JNI_GETPRIMITIVEARRAYCRITICAL_ENTRY(env, array, (uintptr_t *) isCopy);
   if (isCopy != NULL) {
@@ -2995,7 +2996,7 @@ JNI_ENTRY(void*, jni_GetPrimitiveArrayCritical(JNIEnv *env, jarray array, jboole
 JNI_END
 
 
-JNI_ENTRY(void, jni_ReleasePrimitiveArrayCritical(JNIEnv *env, jarray array, void *carray, jint mode))
+JNI_ENTRY_FAST_RETURN(void, jni_ReleasePrimitiveArrayCritical(JNIEnv *env, jarray array, void *carray, jint mode))
   JNIWrapper("ReleasePrimitiveArrayCritical");
   HOTSPOT_JNI_RELEASEPRIMITIVEARRAYCRITICAL_ENTRY(env, array, carray, mode);
   unlock_gc_or_unpin_object(thread, array);
@@ -3003,7 +3004,7 @@ HOTSPOT_JNI_RELEASEPRIMITIVEARRAYCRITICAL_RETURN();
 JNI_END
 
 
-JNI_ENTRY(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jboolean *isCopy))
+JNI_ENTRY_FAST_RETURN(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jboolean *isCopy))
   JNIWrapper("GetStringCritical");
   HOTSPOT_JNI_GETSTRINGCRITICAL_ENTRY(env, string, (uintptr_t *) isCopy);
   oop s = lock_gc_or_pin_object(thread, string);
@@ -3032,7 +3033,7 @@ JNI_ENTRY(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jbool
 JNI_END
 
 
-JNI_ENTRY(void, jni_ReleaseStringCritical(JNIEnv *env, jstring str, const jchar *chars))
+JNI_ENTRY_FAST_RETURN(void, jni_ReleaseStringCritical(JNIEnv *env, jstring str, const jchar *chars))
   JNIWrapper("ReleaseStringCritical");
   HOTSPOT_JNI_RELEASESTRINGCRITICAL_ENTRY(env, str, (uint16_t *) chars);
   // The str and chars arguments are ignored for UTF16 strings
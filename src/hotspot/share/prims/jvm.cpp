@@ -3884,7 +3884,10 @@ JVM_ENTRY(void, JVM_LogLambdaFormInvoker(JNIEnv *env, jstring line))
     ResourceMark rm(THREAD);
     Handle h_line (THREAD, JNIHandles::resolve_non_null(line));
     char* c_line = java_lang_String::as_utf8_string(h_line());
-    classlist_file->print_cr("%s %s", LambdaFormInvokers::lambda_form_invoker_tag(), c_line);
+    MutexLocker ml(THREAD, LambdaFormInvokers_lock, Mutex::_no_safepoint_check_flag);
+    if (LambdaFormInvokers::record_unique(c_line)) {
+      classlist_file->print_cr("%s %s", LambdaFormInvokers::lambda_form_invoker_tag(), c_line);
+    }
   }
 #endif // INCLUDE_CDS
 JVM_END
@@ -2317,6 +2317,9 @@ JvmtiEnv::SetFieldAccessWatch(fieldDescriptor* fdesc_ptr) {
   fdesc_ptr->set_is_field_access_watched(true);
 
   JvmtiEventController::change_field_watch(JVMTI_EVENT_FIELD_ACCESS, true);
+  if (JvmtiExport::selective_field_watch_deoptimization()) {
+    JvmtiExport::deoptimize_for_field_watch(fdesc_ptr);
+  }
 
   return JVMTI_ERROR_NONE;
 } /* end SetFieldAccessWatch */
@@ -2341,6 +2344,9 @@ JvmtiEnv::SetFieldModificationWatch(fieldDescriptor* fdesc_ptr) {
   fdesc_ptr->set_is_field_modification_watched(true);
 
   JvmtiEventController::change_field_watch(JVMTI_EVENT_FIELD_MODIFICATION, true);
+  if (JvmtiExport::selective_field_watch_deoptimization()) {
+    JvmtiExport::deoptimize_for_field_watch(fdesc_ptr);
+  }
 
   return JVMTI_ERROR_NONE;
 } /* end SetFieldModificationWatch */
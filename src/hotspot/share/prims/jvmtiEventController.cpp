@@ -527,7 +527,12 @@ JvmtiEventControllerPrivate::recompute_thread_enabled(JvmtiThreadState *state) {
   }
 
   // compute interp_only mode
-  bool should_be_interp = (any_env_enabled & INTERP_EVENT_BITS) != 0 || has_frame_pops;
+  julong interp_event_bits = INTERP_EVENT_BITS;
+  if (JvmtiExport::selective_field_watch_deoptimization()) {
+    // compiled code that accesses watched fields has been deoptimized
+    interp_event_bits &= ~(FIELD_ACCESS_BIT | FIELD_MODIFICATION_BIT);
+  }
+  bool should_be_interp = (any_env_enabled & interp_event_bits) != 0 || has_frame_pops;
   bool is_now_interp = state->is_interp_only_mode();
 
   if (should_be_interp != is_now_interp) {
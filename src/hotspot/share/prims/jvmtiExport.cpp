@@ -26,6 +26,7 @@
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
 #include "code/nmethod.hpp"
 #include "code/pcDesc.hpp"
 #include "code/scopeDesc.hpp"
@@ -57,6 +58,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/os.inline.hpp"
@@ -301,6 +303,7 @@ public:
 
 int               JvmtiExport::_field_access_count                        = 0;
 int               JvmtiExport::_field_modification_count                  = 0;
+uint64_t          JvmtiExport::_field_watch_count                         = 0;
 
 bool              JvmtiExport::_can_access_local_variables                = false;
 bool              JvmtiExport::_can_hotswap_or_post_breakpoint            = false;
@@ -344,6 +347,22 @@ address JvmtiExport::get_field_modification_count_addr() {
   return (address)(&_field_modification_count);
 }
 
+bool JvmtiExport::selective_field_watch_deoptimization() {
+  // JVMCI compiled code does not check for watched fields.
+  return SelectiveFieldWatchDeoptimization JVMCI_ONLY(&& !UseJVMCICompiler);
+}
+
+// A watch has just been set on the field: throw away compiled code that
+// may access it without posting the event. Methods are matched by field
+// name and signature, which may deoptimize more than necessary.
+void JvmtiExport::deoptimize_for_field_watch(fieldDescriptor* fd) {
+  assert(selective_field_watch_deoptimization(), "no need to deoptimize");
+  MutexLocker ml(Compile_lock);
+  // Fail compilations that started before the watch was set.
+  _field_watch_count++;
+  CodeCache::flush_dependents_on_field(fd->name(), fd->signature());
+}
+
 
 ///////////////////////////////////////////////////////////////
 // Functions needed by java.lang.instrument for starting up javaagent.
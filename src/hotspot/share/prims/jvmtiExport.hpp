@@ -48,6 +48,7 @@ class JvmtiEnv;
 class JvmtiThreadState;
 
 class OopStorage;
+class fieldDescriptor;
 
 #define JVMTI_SUPPORT_FLAG(key)                                           \
   private:                                                                \
@@ -74,6 +75,7 @@ class JvmtiExport : public AllStatic {
 #if INCLUDE_JVMTI
   static int         _field_access_count;
   static int         _field_modification_count;
+  static uint64_t    _field_watch_count;
 
   static bool        _can_access_local_variables;
   static bool        _can_hotswap_or_post_breakpoint;
@@ -268,6 +270,19 @@ class JvmtiExport : public AllStatic {
   // field modification management
   static address  get_field_modification_count_addr() NOT_JVMTI_RETURN_(0);
 
+  // Field watches made selective by SelectiveFieldWatchDeoptimization
+  // leave threads in compiled code; only compiled code that accesses a
+  // watched field is deoptimized, and compilers leave such accesses to
+  // the interpreter.
+  static bool selective_field_watch_deoptimization() NOT_JVMTI_RETURN_(false);
+  static void deoptimize_for_field_watch(fieldDescriptor* fd) NOT_JVMTI_RETURN;
+
+  // Number of field watches set so far. Updated under Compile_lock.
+  inline static uint64_t field_watch_count() {
+    JVMTI_ONLY(return _field_watch_count);
+    NOT_JVMTI(return 0);
+  }
+
   // -----------------
 
   static bool is_jvmti_version(jint version)                      {
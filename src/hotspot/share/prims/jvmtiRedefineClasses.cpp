@@ -25,7 +25,7 @@
 #include "precompiled.hpp"
 #include "aot/aotLoader.hpp"
 #include "classfile/classFileStream.hpp"
-#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/classLoadInfo.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/metadataOnStackMark.hpp"
@@ -34,6 +34,8 @@
 #include "classfile/verifier.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -266,8 +268,7 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(thread);
-  ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  adjust_and_clean_metadata(thread);
 
   // JSR-292 support
   if (_any_class_has_resolved_methods) {
@@ -3677,6 +3678,61 @@ void VM_RedefineClasses::set_new_constant_pool(
 // must be cleaned.
 
 // Adjust cpools and vtables closure
+// Collects the loaded classes, for ParAdjustAndCleanMetadataTask.
+class CollectKlassesClosure : public KlassClosure {
+  GrowableArray<Klass*>* _klasses;
+ public:
+  CollectKlassesClosure(GrowableArray<Klass*>* klasses) : _klasses(klasses) {}
+  void do_klass(Klass* k) { _klasses->append(k); }
+};
+
+// Applies AdjustAndCleanMetadata to the collected classes in parallel.
+// The workers claim chunks of classes; adjusting a class only updates
+// the vtable, itable, constant pool caches and MethodData of that class.
+class ParAdjustAndCleanMetadataTask : public AbstractGangTask {
+  GrowableArray<Klass*>* _klasses;
+  volatile int _next;
+
+  static const int ChunkSize = 64;
+
+ public:
+  ParAdjustAndCleanMetadataTask(GrowableArray<Klass*>* klasses) :
+    AbstractGangTask("RedefineClasses adjust metadata"),
+    _klasses(klasses),
+    _next(0) {}
+
+  void work(uint worker_id) {
+    VM_RedefineClasses::AdjustAndCleanMetadata adjust_and_clean_metadata(Thread::current());
+    int length = _klasses->length();
+    for (int start = Atomic::fetch_and_add(&_next, ChunkSize);
+         start < length;
+         start = Atomic::fetch_and_add(&_next, ChunkSize)) {
+      int end = MIN2(start + ChunkSize, length);
+      for (int i = start; i < end; i++) {
+        adjust_and_clean_metadata.do_klass(_klasses->at(i));
+      }
+    }
+  }
+};
+
+void VM_RedefineClasses::adjust_and_clean_metadata(Thread* thread) {
+  WorkGang* gang = Universe::heap()->safepoint_workers();
+  if (ParallelRedefineClassesAdjustment && gang != NULL) {
+    ResourceMark rm(thread);
+    GrowableArray<Klass*> klasses((int)(ClassLoaderDataGraph::num_instance_classes() +
+                                        ClassLoaderDataGraph::num_array_classes()));
+    CollectKlassesClosure collect(&klasses);
+    ClassLoaderDataGraph::classes_do(&collect);
+
+    WithUpdatedActiveWorkers update_and_restore(gang, gang->total_workers());
+    ParAdjustAndCleanMetadataTask task(&klasses);
+    gang->run_task(&task);
+  } else {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(thread);
+    ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  }
+}
+
 void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
 
   // This is a very busy routine. We don't want too much tracing
@@ -336,6 +336,7 @@ struct JvmtiCachedClassFileData {
 };
 
 class VM_RedefineClasses: public VM_Operation {
+  friend class ParAdjustAndCleanMetadataTask;
  private:
   // These static fields are needed by ClassLoaderDataGraph::classes_do()
   // facility and the CheckClass and AdjustAndCleanMetadata helpers.
@@ -506,6 +507,8 @@ class VM_RedefineClasses: public VM_Operation {
   void flush_dependent_code();
   void mark_dependent_code(InstanceKlass* ik);
 
+  void adjust_and_clean_metadata(Thread* thread);
+
   // lock classes to redefine since constant pool merging isn't thread safe.
   void lock_classes();
   void unlock_classes();
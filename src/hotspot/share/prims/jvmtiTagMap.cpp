@@ -28,6 +28,8 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -59,6 +61,7 @@
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_ZGC
 #include "gc/z/zGlobals.hpp"
@@ -1252,13 +1255,88 @@ static jint invoke_primitive_field_callback_for_instance_fields(
 }
 
 
+// Accepts the objects a class filtered heap iteration is interested in.
+class KlassFilterClosure : public BoolObjectClosure {
+ private:
+  Klass* _klass;
+  bool _include_subclasses;
+ public:
+  KlassFilterClosure(Klass* klass, bool include_subclasses) :
+    _klass(klass), _include_subclasses(include_subclasses) {}
+
+  bool do_object_b(oop o) {
+    return _include_subclasses ? o->is_a(_klass) : o->klass() == _klass;
+  }
+};
+
+// Parallel heap scan for the JVMTI heap functions. The workers apply
+// the filter in parallel and collect the matching objects; the closure,
+// which invokes the agent's callbacks and updates the tag map, is then
+// applied to them by the VM thread.
+class ParHeapFilterTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  BoolObjectClosure* _filter;
+  GrowableArray<oop>* _matches;
+  Mutex _lock;
+
+  class FilterClosure : public ObjectClosure {
+   private:
+    ParHeapFilterTask* _task;
+   public:
+    FilterClosure(ParHeapFilterTask* task) : _task(task) {}
+    void do_object(oop o) {
+      if (_task->_filter->do_object_b(o)) {
+        MutexLocker ml(&_task->_lock, Mutex::_no_safepoint_check_flag);
+        _task->_matches->append(o);
+      }
+    }
+  };
+
+ public:
+  ParHeapFilterTask(ParallelObjectIterator* poi, BoolObjectClosure* filter, GrowableArray<oop>* matches) :
+    AbstractGangTask("JVMTI heap iteration"),
+    _poi(poi),
+    _filter(filter),
+    _matches(matches),
+    _lock(Mutex::leaf, "JVMTI heap iteration lock", false, Mutex::_safepoint_check_never) {}
+
+  void work(uint worker_id) {
+    FilterClosure cl(this);
+    _poi->object_iterate(&cl, worker_id);
+  }
+};
+
 // VM operation to iterate over all objects in the heap (both reachable
 // and unreachable)
 class VM_HeapIterateOperation: public VM_Operation {
  private:
   ObjectClosure* _blk;
+  BoolObjectClosure* _filter;   // objects _blk is interested in, or NULL
+
+  bool parallel_object_iterate() {
+    WorkGang* gang = Universe::heap()->safepoint_workers();
+    if (gang == NULL) {
+      return false;
+    }
+    WithUpdatedActiveWorkers update_and_restore(gang, gang->total_workers());
+    ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(gang->active_workers());
+    if (poi == NULL) {
+      return false;
+    }
+    GrowableArray<oop> matches(256, mtServiceability);
+    ParHeapFilterTask task(poi, _filter, &matches);
+    gang->run_task(&task);
+    delete poi;
+    for (int i = 0; i < matches.length(); i++) {
+      _blk->do_object(matches.at(i));
+    }
+    return true;
+  }
+
  public:
-  VM_HeapIterateOperation(ObjectClosure* blk) { _blk = blk; }
+  VM_HeapIterateOperation(ObjectClosure* blk, BoolObjectClosure* filter = NULL) :
+    _blk(blk), _filter(filter) {}
 
   VMOp_Type type() const { return VMOp_HeapIterateOperation; }
   void doit() {
@@ -1275,6 +1353,9 @@ class VM_HeapIterateOperation: public VM_Operation {
     }
 
     // do the iteration
+    if (ParallelJVMTIHeapIteration && _filter != NULL && parallel_object_iterate()) {
+      return;
+    }
     Universe::heap()->object_iterate(_blk);
   }
 
@@ -1488,7 +1569,8 @@ void JvmtiTagMap::iterate_over_heap(jvmtiHeapObjectFilter object_filter,
                                    object_filter,
                                    heap_object_callback,
                                    user_data);
-  VM_HeapIterateOperation op(&blk);
+  KlassFilterClosure filter(klass, true /* include_subclasses */);
+  VM_HeapIterateOperation op(&blk, klass != NULL ? &filter : NULL);
   VMThread::execute(&op);
 }
 
@@ -1505,7 +1587,8 @@ void JvmtiTagMap::iterate_through_heap(jint heap_filter,
                                       heap_filter,
                                       callbacks,
                                       user_data);
-  VM_HeapIterateOperation op(&blk);
+  KlassFilterClosure filter(klass, false /* include_subclasses */);
+  VM_HeapIterateOperation op(&blk, klass != NULL ? &filter : NULL);
   VMThread::execute(&op);
 }
 
@@ -270,22 +270,13 @@ void ResolvedMethodTable::do_concurrent_work(JavaThread* jt) {
 }
 
 void ResolvedMethodTable::grow(JavaThread* jt) {
-  ResolvedMethodTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
   log_trace(membername, table)("Started to grow");
   {
     TraceTime timer("Grow", TRACETIME_LOG(Debug, membername, table, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
-      }
-      gt.cont(jt);
+    if (!_local_table->grow_to_load_factor(jt, &_items_count, PREF_AVG_LIST_LEN)) {
+      return;
     }
   }
-  gt.done(jt);
   _current_size = table_size();
   log_info(membername, table)("Grown to size:" SIZE_FORMAT, _current_size);
 }
@@ -116,17 +116,21 @@ int StackWalk::fill_in_frames(jlong mode, BaseFrameStream& stream,
   assert(max_nframes > 0, "invalid max_nframes");
   assert(start_index + max_nframes <= frames_array->length(), "oob");
 
+  // skip hidden frames for default StackWalker option (i.e. SHOW_HIDDEN_FRAMES
+  // not set) and when StackWalker::getCallerClass is called
+  const bool skip_hidden = !ShowHiddenFrames && (skip_hidden_frames(mode) || get_caller_class(mode));
+  // getCallerClass must not be called from a @CallerSensitive method
+  const bool check_caller_sensitive = !need_method_info(mode) && get_caller_class(mode);
+  LogTarget(Debug, stackwalk) lt;
+
   int frames_decoded = 0;
   for (; !stream.at_end(); stream.next()) {
     Method* method = stream.method();
 
     if (method == NULL) continue;
 
-    // skip hidden frames for default StackWalker option (i.e. SHOW_HIDDEN_FRAMES
-    // not set) and when StackWalker::getCallerClass is called
-    if (!ShowHiddenFrames && (skip_hidden_frames(mode) || get_caller_class(mode))) {
+    if (skip_hidden) {
       if (method->is_hidden()) {
-        LogTarget(Debug, stackwalk) lt;
         if (lt.is_enabled()) {
           ResourceMark rm(THREAD);
           LogStream ls(lt);
@@ -139,7 +143,6 @@ int StackWalk::fill_in_frames(jlong mode, BaseFrameStream& stream,
     }
 
     int index = end_index++;
-    LogTarget(Debug, stackwalk) lt;
     if (lt.is_enabled()) {
       ResourceMark rm(THREAD);
       LogStream ls(lt);
@@ -148,8 +151,7 @@ int StackWalk::fill_in_frames(jlong mode, BaseFrameStream& stream,
       ls.print_cr(" bci=%d", stream.bci());
     }
 
-    if (!need_method_info(mode) && get_caller_class(mode) &&
-          index == start_index && method->caller_sensitive()) {
+    if (check_caller_sensitive && index == start_index && method->caller_sensitive()) {
       ResourceMark rm(THREAD);
       THROW_MSG_0(vmSymbols::java_lang_UnsupportedOperationException(),
         err_msg("StackWalker::getCallerClass called from @CallerSensitive '%s' method",
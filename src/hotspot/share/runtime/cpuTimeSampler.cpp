@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/cpuTimeSampler.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/task.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.hpp"
+#include "runtime/vframe.inline.hpp"
+#include "utilities/align.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
+
+class CPUTimeSample {
+ public:
+  volatile size_t _seq;  // claim number + 1 once the sample is complete, 0 while written
+  uint      _ticks;      // timer expirations this sample accounts for
+  int       _depth;
+  jmethodID _methods[CPUTimeSampler::max_depth];  // innermost frame first
+};
+
+class CPUTimeSamplerTask : public PeriodicTask {
+ public:
+  CPUTimeSamplerTask(size_t interval_time) : PeriodicTask(interval_time) {}
+  void task() { CPUTimeSampler::sample_threads(); }
+};
+
+class CPUTimeSampleClosure : public AsyncHandshakeClosure {
+ public:
+  CPUTimeSampleClosure() : AsyncHandshakeClosure("CPUTimeSample") {}
+  void do_thread(Thread* thread) {
+    CPUTimeSampler::record(thread->as_Java_thread());
+  }
+};
+
+CPUTimeSamplerTask* CPUTimeSampler::_task             = NULL;
+CPUTimeSample*      CPUTimeSampler::_samples          = NULL;
+volatile size_t     CPUTimeSampler::_next             = 0;
+bool                CPUTimeSampler::_timers_available = false;
+
+void CPUTimeSampler::engage() {
+  if (!is_enabled() || is_active()) {
+    return;
+  }
+  if (!_timers_available) {
+    warning("CPUTimeSamplingInterval is not supported on this platform");
+    return;
+  }
+  _samples = NEW_C_HEAP_ARRAY(CPUTimeSample, CPUTimeSamplingBufferSize, mtInternal);
+  for (intx i = 0; i < CPUTimeSamplingBufferSize; i++) {
+    _samples[i]._seq = 0;
+  }
+  // Hand out pending samples about as often as the timers fire.
+  size_t interval = align_up(MAX2(CPUTimeSamplingInterval, (intx)PeriodicTask::min_interval),
+                             (intx)PeriodicTask::interval_gran);
+  _task = new CPUTimeSamplerTask(MIN2(interval, (size_t)PeriodicTask::max_interval));
+  _task->enroll();
+}
+
+void CPUTimeSampler::disengage() {
+  if (!is_active()) {
+    return;
+  }
+  _task->disenroll();
+  delete _task;
+  _task = NULL;
+
+  LogTarget(Info, cpu, sampling) lt;
+  if (lt.is_enabled()) {
+    ResourceMark rm;
+    LogStream ls(lt);
+    print_summary(&ls);
+  }
+  // The buffer is not freed; a late handshake may still write into it.
+}
+
+void CPUTimeSampler::tick(JavaThread* thread) {
+  thread->inc_cpu_time_ticks();
+}
+
+void CPUTimeSampler::sample_threads() {
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    // Only one sampling handshake per thread is queued at a time; ticks
+    // that arrive in the meantime are folded into it.
+    if (jt->has_cpu_time_ticks() && jt->try_set_cpu_time_sample_pending()) {
+      Handshake::execute(new CPUTimeSampleClosure(), jt);
+    }
+  }
+}
+
+void CPUTimeSampler::record(JavaThread* thread) {
+  assert(thread == Thread::current(), "must be executed by the sampled thread");
+  uint ticks = thread->take_cpu_time_ticks();
+  thread->clear_cpu_time_sample_pending();
+  if (ticks == 0 || !thread->has_last_Java_frame() || _samples == NULL) {
+    return;
+  }
+
+  size_t claim = Atomic::add(&_next, (size_t)1) - 1;
+  CPUTimeSample* s = &_samples[claim % (size_t)CPUTimeSamplingBufferSize];
+  Atomic::store(&s->_seq, (size_t)0);
+  OrderAccess::storestore();
+
+  int depth = 0;
+  for (vframeStream vfst(thread); !vfst.at_end() && depth < max_depth; vfst.next()) {
+    s->_methods[depth++] = vfst.method()->jmethod_id();
+  }
+  s->_depth = depth;
+  s->_ticks = ticks;
+  Atomic::release_store(&s->_seq, claim + 1);
+}
+
+class CPUTimeMethodTicks {
+ public:
+  jmethodID _method;
+  uint      _self;   // ticks with the method as the innermost frame
+  uint      _total;  // ticks with the method anywhere on the stack
+};
+
+static int compare_method_ticks(CPUTimeMethodTicks* a, CPUTimeMethodTicks* b) {
+  if (a->_self != b->_self) {
+    return a->_self > b->_self ? -1 : 1;
+  }
+  return a->_total > b->_total ? -1 : (a->_total < b->_total ? 1 : 0);
+}
+
+static void add_method_ticks(GrowableArray<CPUTimeMethodTicks>* result,
+                             ResourceHashtable<jmethodID, int>* index,
+                             jmethodID method, uint self, uint total) {
+  int* i = index->get(method);
+  if (i == NULL) {
+    CPUTimeMethodTicks mt = { method, 0, 0 };
+    index->put(method, result->length());
+    result->append(mt);
+    i = index->get(method);
+  }
+  result->adr_at(*i)->_self += self;
+  result->adr_at(*i)->_total += total;
+}
+
+void CPUTimeSampler::print_summary(outputStream* st) {
+  if (_samples == NULL) {
+    return;
+  }
+  GrowableArray<CPUTimeMethodTicks> methods;
+  ResourceHashtable<jmethodID, int> index;
+  jmethodID stack[max_depth];
+  size_t samples = 0;
+  uint total_ticks = 0;
+
+  for (intx i = 0; i < CPUTimeSamplingBufferSize; i++) {
+    CPUTimeSample* s = &_samples[i];
+    size_t seq = Atomic::load_acquire(&s->_seq);
+    if (seq == 0) {
+      continue;
+    }
+    uint ticks = s->_ticks;
+    int depth = MIN2(s->_depth, (int)max_depth);
+    memcpy(stack, s->_methods, depth * sizeof(jmethodID));
+    OrderAccess::loadload();
+    if (Atomic::load(&s->_seq) != seq || depth == 0) {
+      continue;  // overwritten while we read it
+    }
+
+    samples++;
+    total_ticks += ticks;
+    for (int d = 0; d < depth; d++) {
+      // Count recursive frames once.
+      bool seen = false;
+      for (int e = 0; e < d && !seen; e++) {
+        seen = stack[e] == stack[d];
+      }
+      if (!seen) {
+        add_method_ticks(&methods, &index, stack[d], d == 0 ? ticks : 0, ticks);
+      }
+    }
+  }
+  methods.sort(compare_method_ticks);
+
+  st->print_cr("CPU-time samples: " SIZE_FORMAT " kept of " SIZE_FORMAT " taken, %u ticks of " INTX_FORMAT " ms",
+               samples, Atomic::load(&_next), total_ticks, CPUTimeSamplingInterval);
+  st->print_cr("   self    total  method");
+  for (int i = 0; i < MIN2(methods.length(), 20); i++) {
+    const CPUTimeMethodTicks& mt = methods.at(i);
+    Method* m = Method::checked_resolve_jmethod_id(mt._method);
+    st->print_cr("  %5.1f%%  %5.1f%%  %s",
+                 100.0 * mt._self / MAX2(total_ticks, 1u),
+                 100.0 * mt._total / MAX2(total_ticks, 1u),
+                 m != NULL ? m->external_name() : "<unloaded>");
+  }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_CPUTIMESAMPLER_HPP
+#define SHARE_RUNTIME_CPUTIMESAMPLER_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+
+class CPUTimeSample;
+class CPUTimeSamplerTask;
+class JavaThread;
+class outputStream;
+
+// CPUTimeSampler takes stack samples of Java threads in proportion to the
+// CPU time they consume.  The platform arms a per-thread CPU-time timer
+// (see os_linux.cpp) whose expiration calls tick() on the thread that
+// used the time.  A periodic task hands each thread with outstanding ticks
+// an asynchronous handshake, and the thread records its own stack with the
+// ordinary vframe machinery when it next reaches a handshake poll.  Idle
+// threads are never sampled and cost nothing.
+//
+// Samples go into a fixed-size lock-free ring buffer.  A summary of the
+// hottest methods is logged at exit with -Xlog:cpu+sampling.
+
+class CPUTimeSampler : AllStatic {
+  friend class CPUTimeSamplerTask;
+ public:
+  enum { max_depth = 64 };
+
+ private:
+  static CPUTimeSamplerTask* _task;
+  static CPUTimeSample*      _samples;
+  static volatile size_t     _next;
+  static bool                _timers_available;
+
+  static void sample_threads();
+
+ public:
+  static bool is_enabled()   { return CPUTimeSamplingInterval > 0; }
+  static bool is_active()    { return _task != NULL; }
+
+  // Set by the platform once CPU-time timers can be armed.
+  static void set_timers_available() { _timers_available = true; }
+
+  static void engage();
+  static void disengage();
+
+  // Called by the platform timer signal handler. Async-signal-safe.
+  static void tick(JavaThread* thread);
+
+  // Called on the sampled thread from the sampling handshake.
+  static void record(JavaThread* thread);
+
+  static void print_summary(outputStream* st);
+};
+
+#endif // SHARE_RUNTIME_CPUTIMESAMPLER_HPP
@@ -360,6 +360,9 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseVectorizedMismatchIntrinsic, false, DIAGNOSTIC,          \
           "Enables intrinsification of ArraysSupport.vectorizedMismatch()") \
                                                                             \
+  product(bool, UseStringHashCodeIntrinsic, false, DIAGNOSTIC,              \
+          "Enables intrinsification of StringLatin1/StringUTF16.hashCode()")\
+                                                                            \
   product(bool, UseCopySignIntrinsic, false, DIAGNOSTIC,                    \
           "Enables intrinsification of Math.copySign")                      \
                                                                             \
@@ -440,6 +443,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, BytecodeVerificationLocal, false, DIAGNOSTIC,               \
           "Enable the Java bytecode verifier for local classes")            \
                                                                             \
+  product(ccstr, VerificationCacheFile, NULL, EXPERIMENTAL,                 \
+          "File in which classes that passed the split verifier are "       \
+          "remembered, so that they need not be verified again in later "   \
+          "runs")                                                           \
+                                                                            \
   develop(bool, ForceFloatExceptions, trueInDebug,                          \
           "Force exceptions on FP stack under/overflow")                    \
                                                                             \
@@ -541,6 +549,12 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, "off",                               \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uintx, NMTDetailSampleInterval, 1, EXPERIMENTAL,                  \
+          "With NativeMemoryTracking=detail, capture the call stack of "    \
+          "one in this many malloc calls. Malloc site totals are "          \
+          "extrapolated from the sampled allocations")                      \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -634,6 +648,10 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, OmitStackTraceInFastThrow, true,                            \
           "Omit backtraces for some 'hot' exceptions in optimized code")    \
                                                                             \
+  product(ccstr, OmitStackTraceInClasses, NULL, EXPERIMENTAL,               \
+          "Comma separated list of Throwable classes whose instances do "   \
+          "not collect a backtrace, e.g. exceptions used for control flow") \
+                                                                            \
   product(bool, ShowCodeDetailsInExceptionMessages, true, MANAGEABLE,       \
           "Show exception messages from RuntimeExceptions that contain "    \
           "snippets of the failing code. Disable this to improve privacy.") \
@@ -693,6 +711,15 @@ const intx ObjectAlignmentInBytes = 8;
           "Allow parallel defineClass requests for class loaders "          \
           "registering as parallel capable")                                \
                                                                             \
+  product(ccstr, PrefetchClassList, NULL, EXPERIMENTAL,                     \
+          "File with a list of classes (in the class list format) to be "   \
+          "loaded in the background by the system class loader at "         \
+          "startup")                                                        \
+                                                                            \
+  product(uintx, PrefetchClassThreads, 2, EXPERIMENTAL,                     \
+          "Number of threads used for PrefetchClassList")                   \
+          range(1, 64)                                                      \
+                                                                            \
   product_pd(bool, DontYieldALot,                                           \
           "Throw away obvious excess yield calls")                          \
                                                                             \
@@ -845,6 +872,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, TraceJVMTI, NULL,                                          \
           "Trace flags for JVMTI functions and events")                     \
                                                                             \
+  product(bool, SelectiveFieldWatchDeoptimization, false, EXPERIMENTAL,     \
+          "JVMTI field watches deoptimize only the compiled code that "     \
+          "accesses the watched fields instead of running all threads "     \
+          "in the interpreter")                                             \
+                                                                            \
   /* This option can change an EMCP method into an obsolete method. */      \
   /* This can affect tests that except specific methods to be EMCP. */      \
   /* This option should be used with caution.                       */      \
@@ -859,6 +891,10 @@ const intx ObjectAlignmentInBytes = 8;
           "(Deprecated) Allow redefinition to add and delete private "      \
           "static or final methods for compatibility with old releases")    \
                                                                             \
+  product(bool, ParallelRedefineClassesAdjustment, false, EXPERIMENTAL,     \
+          "Use the GC safepoint workers to adjust the method references "   \
+          "of all loaded classes during RedefineClasses")                   \
+                                                                            \
   develop(bool, TraceBytecodes, false,                                      \
           "Trace bytecode execution")                                       \
                                                                             \
@@ -895,6 +931,11 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
+  product(int, InlineCacheBufferSize, 10*K, EXPERIMENTAL,                   \
+          "Size in bytes of the buffer for inline cache transition stubs. " \
+          "A safepoint is needed to empty the buffer when it is full")      \
+          range(10*K, 1*M)                                                  \
+                                                                            \
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
@@ -940,6 +981,10 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, VerifyBeforeIteration, false, DIAGNOSTIC,                   \
           "Verify memory system before JVMTI iteration")                    \
                                                                             \
+  product(bool, ParallelJVMTIHeapIteration, false, EXPERIMENTAL,            \
+          "Scan the heap with the GC safepoint workers when a JVMTI heap "  \
+          "iteration is filtered by class")                                 \
+                                                                            \
   /* compiler interface */                                                  \
                                                                             \
   develop(bool, CIPrintCompilerName, false,                                 \
@@ -999,6 +1044,15 @@ const intx ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(uintx, CompilerThreadQueuedBytes, 0, DIAGNOSTIC,                  \
+             "Bytes of queued bytecode that justify one more dynamically "  \
+             "started compiler thread, in addition to the task count "      \
+             "(0 sizes by task count only)")                                \
+                                                                            \
+  product(uintx, CompilerThreadWarmupTime, 0, DIAGNOSTIC,                   \
+             "Do not remove idle compiler threads during this many "        \
+             "milliseconds after VM start")                                 \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1130,6 +1184,12 @@ const intx ObjectAlignmentInBytes = 8;
           "If LogVMOutput or LogCompilation is on, save VM output to "      \
           "this file [default: ./hotspot_pid%p.log] (%p replaced with pid)")\
                                                                             \
+  product(size_t, AsyncLogBufferSize, 2*M, EXPERIMENTAL,                    \
+          "Memory budget in bytes for the messages buffered by "            \
+          "asynchronous logging (-Xlog:async). Messages are dropped "       \
+          "when the budget is exhausted")                                   \
+          range(100*K, 50*M)                                                \
+                                                                            \
   product(ccstr, ErrorFile, NULL,                                           \
           "If an error occurs, save the error data to this file "           \
           "[default: ./hs_err_pid%p.log] (%p replaced with pid)")           \
@@ -1260,6 +1320,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseInterpreter, true,                                       \
           "Use interpreter for non-compiled methods")                       \
                                                                             \
+  product(int, OopMapCacheSize, 32, EXPERIMENTAL,                           \
+          "Number of entries in the per-class cache of interpreter oop "    \
+          "maps used by GC stack scanning")                                 \
+          range(32, 4096)                                                   \
+                                                                            \
   develop(bool, UseFastSignatureHandlers, true,                             \
           "Use fast signature handlers for native calls")                   \
                                                                             \
@@ -1525,6 +1590,21 @@ const intx ObjectAlignmentInBytes = 8;
   product(intx, SpecTrapLimitExtraEntries,  3, EXPERIMENTAL,                \
           "Extra method data trap entries for speculation")                 \
                                                                             \
+  product(ccstr, TrapHistoryFile, NULL, EXPERIMENTAL,                       \
+          "Read uncommon trap history from this file at startup and "       \
+          "write it back at exit, so that speculation that failed in an "   \
+          "earlier run is avoided from the first compilation")              \
+                                                                            \
+  product(ccstr, HotMethodHistoryFile, NULL, EXPERIMENTAL,                  \
+          "Read the methods that reached tier 4 in an earlier run from "    \
+          "this file at startup and write them back at exit, so that "      \
+          "they are compiled with scaled down tiered thresholds")           \
+                                                                            \
+  product(double, HotMethodHistoryThresholdScaling, 0.1, EXPERIMENTAL,      \
+          "Factor applied to the tiered compilation thresholds of the "     \
+          "methods recorded in HotMethodHistoryFile")                       \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   develop(intx, InlineFrequencyRatio,    20,                                \
           "Ratio of call site execution to caller method invocation")       \
           range(0, max_jint)                                                \
@@ -1554,7 +1634,7 @@ const intx ObjectAlignmentInBytes = 8;
   product(size_t, CompressedClassSpaceSize, 1*G,                            \
           "Maximum size of class area in Metaspace when compressed "        \
           "class pointers are used")                                        \
-          range(1*M, 3*G)                                                   \
+          range(1*M, LP64_ONLY(31*G) NOT_LP64(3*G))                         \
                                                                             \
   product(uintx, MinHeapFreeRatio, 40, MANAGEABLE,                          \
           "The minimum percentage of heap free after GC to avoid expansion."\
@@ -1588,6 +1668,14 @@ const intx ObjectAlignmentInBytes = 8;
           "The minimum expansion of Metaspace (in bytes)")                  \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, UseSmallMetaspaceArenas, false, EXPERIMENTAL,               \
+          "Allocate metaspace for hidden class and reflection loaders "     \
+          "from specialized and small chunks only")                         \
+                                                                            \
+  product(bool, MetaspaceReleaseFreeChunks, false, EXPERIMENTAL,            \
+          "After class unloading, give the pages of free metaspace chunks " \
+          "back to the operating system")                                   \
+                                                                            \
   product(uintx, MaxMetaspaceFreeRatio,    70,                              \
           "The maximum percentage of Metaspace free after GC to avoid "     \
           "shrinking")                                                      \
@@ -1672,6 +1760,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, SegmentedCodeCache, false,                                  \
           "Use a segmented code cache")                                     \
                                                                             \
+  product(uintx, HotCodeRegionSize, 0, DIAGNOSTIC,                          \
+          "Size of the start of the code heap for C2 code whose free "      \
+          "space is reused only for code of methods recently seen active "  \
+          "by the sweeper (0 disables the hot region)")                     \
+                                                                            \
   product_pd(uintx, ReservedCodeCacheSize,                                  \
           "Reserved code cache size (in bytes) - maximum code cache size")  \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
@@ -2103,6 +2196,12 @@ const intx ObjectAlignmentInBytes = 8;
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskAging, 0, DIAGNOSTIC,                      \
+          "Grow the selection weight of a queued compile task by its "      \
+          "own weight for every given number of milliseconds it has "       \
+          "been waiting (0 disables aging)")                                \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -2194,6 +2293,19 @@ const intx ObjectAlignmentInBytes = 8;
           range(PeriodicTask::min_interval, max_jint)                       \
           constraint(PerfDataSamplingIntervalFunc, AfterErgo)               \
                                                                             \
+  product(intx, CPUTimeSamplingInterval, 0, EXPERIMENTAL,                   \
+          "Sample the stack of a Java thread each time it has used this "   \
+          "many milliseconds of CPU time (0 means off). Linux only")        \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(intx, CPUTimeSamplingBufferSize, 4096, EXPERIMENTAL,              \
+          "Number of most recent samples kept by the CPU-time sampler")     \
+          range(1, max_jint)                                                \
+                                                                            \
+  product(bool, RecordMutexStatistics, false, DIAGNOSTIC,                   \
+          "Record acquire wait and hold time histograms for each named "    \
+          "VM Mutex/Monitor, see jcmd VM.mutex_stats")                      \
+                                                                            \
   product(bool, PerfDisableSharedMem, false,                                \
           "Store performance data in standard memory")                      \
                                                                             \
@@ -2333,6 +2445,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(bool, AssistTableGrowth, false, EXPERIMENTAL,                     \
+          "Threads inserting into the Symbol and String tables request "    \
+          "a grow when the load factor is exceeded and help move buckets "  \
+          "of a grow in progress")                                          \
+                                                                            \
   product(bool, UseStringDeduplication, false,                              \
           "Use string deduplication")                                       \
                                                                             \
@@ -2379,6 +2496,19 @@ const intx ObjectAlignmentInBytes = 8;
            "do not map the archive")                                        \
            range(0, 2)                                                      \
                                                                             \
+  product(bool, ArchiveParallelRelocation, false, DIAGNOSTIC,               \
+          "Use the GC worker threads to relocate the pointers in the CDS "  \
+          "archive when it is not mapped at the requested address")         \
+                                                                            \
+  product(bool, ArchiveResolvedKlassReferences, false, DIAGNOSTIC,          \
+          "Keep class constant pool entries that refer to the pool "        \
+          "holder or one of its superclasses resolved in the CDS archive")  \
+                                                                            \
+  product(ccstrlist, ArchiveHeapEntryFields, "", DIAGNOSTIC,                \
+          "Comma separated list of additional static fields, given as "     \
+          "<class>.<field> (e.g. com/foo/Tables.CACHE), whose object "      \
+          "graphs are archived in the open archive heap region")            \
+                                                                            \
   product(size_t, ArrayAllocatorMallocLimit, (size_t)-1, EXPERIMENTAL,      \
           "Allocation less than this value will be allocated "              \
           "using malloc. Larger allocations will use mmap.")                \
@@ -2453,12 +2583,27 @@ const intx ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(size_t, LeakProfilerEdgeQueueLimit, 1*G, EXPERIMENTAL,   \
+          "Upper bound in bytes on the memory reserved for the breadth-"    \
+          "first search for paths to GC roots by the JFR leak profiler. "   \
+          "When the queue is full, the search continues depth-first")       \
+          range(32*M, max_uintx))                                           \
+                                                                            \
+  JFR_ONLY(product(uint, ObjectAllocationSampleRate, 150, EXPERIMENTAL,     \
+          "Maximum number of ObjectAllocationSample events emitted by "     \
+          "JFR per second")                                                 \
+          range(1, max_juint))                                              \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
   product(bool, UseEmptySlotsInSupers, true,                                \
                 "Allow allocating fields in empty slots of super-classes")  \
                                                                             \
+  product(ccstr, HotFieldProfileFile, NULL, EXPERIMENTAL,                   \
+          "File recording the hot instance fields of each class. Read at "  \
+          "startup to lay out hot fields first, written at exit")           \
+                                                                            \
   product(bool, DeoptimizeNMethodBarriersALot, false, DIAGNOSTIC,           \
                 "Make nmethod barriers deoptimise a lot.")
 
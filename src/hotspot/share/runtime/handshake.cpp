@@ -422,18 +422,33 @@ void HandshakeState::process_self_inner() {
     HandleMark hm(_handshakee);
     CautiouslyPreserveExceptionMark pem(_handshakee);
     MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
-    HandshakeOperation* op = pop_for_self();
-    if (op != NULL) {
+    // Drain everything queued while holding the lock once, so that a burst
+    // of small (typically asynchronous) operations is processed as a batch
+    // instead of re-taking the lock and re-checking the poll for each one.
+    jlong batch_start_ns = log_is_enabled(Debug, handshake) ? os::javaTimeNanos() : 0;
+    jlong max_queued_ns = 0;
+    int executed = 0;
+    HandshakeOperation* op;
+    while ((op = pop_for_self()) != NULL) {
       assert(op->_target == NULL || op->_target == Thread::current(), "Wrong thread");
       bool async = op->is_async();
       log_trace(handshake)("Proc handshake %s " INTPTR_FORMAT " on " INTPTR_FORMAT " by self",
                            async ? "asynchronous" : "synchronous", p2i(op), p2i(_handshakee));
+      if (async && batch_start_ns != 0) {
+        max_queued_ns = MAX2(max_queued_ns, batch_start_ns - ((AsyncHandshakeOperation*)op)->start_time());
+      }
       op->do_handshake(_handshakee);
+      executed++;
       if (async) {
         log_handshake_info(((AsyncHandshakeOperation*)op)->start_time(), op->name(), 1, 0, "asynchronous");
         delete op;
       }
     }
+    if (batch_start_ns != 0 && executed > 0) {
+      log_debug(handshake)("JavaThread " INTPTR_FORMAT " processed %d queued operations by self in " JLONG_FORMAT
+                           " ns, max asynchronous queue latency: " JLONG_FORMAT " ns",
+                           p2i(_handshakee), executed, os::javaTimeNanos() - batch_start_ns, max_queued_ns);
+    }
   }
 }
 
@@ -79,6 +79,10 @@ void vmStructs_init() NOT_DEBUG_RETURN;
 void vtableStubs_init();
 void InlineCacheBuffer_init();
 void compilerOracle_init();
+void trapHistory_init();
+void hotMethodHistory_init();
+void verificationCache_init();
+void hotFieldProfile_init();
 bool compileBroker_init();
 void dependencyContext_init();
 
@@ -137,6 +141,10 @@ jint init_globals() {
   vtableStubs_init();
   InlineCacheBuffer_init();
   compilerOracle_init();
+  trapHistory_init();
+  hotMethodHistory_init();
+  verificationCache_init();
+  hotFieldProfile_init();
   dependencyContext_init();
 
   if (!compileBroker_init()) {
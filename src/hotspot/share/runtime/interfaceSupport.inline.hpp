@@ -97,6 +97,23 @@ class ThreadStateTransition : public StackObj {
     thread->set_thread_state(to);
   }
 
+  // Same as transition(thread, _thread_in_vm, _thread_in_native), but without
+  // the fence and the safepoint poll. A thread in native is already safepoint
+  // safe, so a pending safepoint or handshake does not have to be processed on
+  // the way out; it is picked up on the next transition out of native.
+  static inline void transition_from_vm_to_native(JavaThread *thread) {
+    assert(thread->thread_state() == _thread_in_vm, "coming from wrong thread state");
+
+    // Check NoSafepointVerifier
+    // This also clears unhandled oops if CheckUnhandledOops is used.
+    thread->check_possible_safepoint();
+
+    thread->frame_anchor()->make_walkable(thread);
+    // Oop accesses made in the VM must not float past the state change.
+    OrderAccess::release();
+    thread->set_thread_state(_thread_in_native);
+  }
+
   // Same as above, but assumes from = _thread_in_Java. This is simpler, since we
   // never block on entry to the VM. This will break the code, since e.g. preserve arguments
   // have not been setup.
@@ -201,6 +218,19 @@ class ThreadInVMfromNative : public ThreadStateTransition {
 };
 
 
+// Like ThreadInVMfromNative, but returns to native without polling. Used by
+// short JNI functions that native code calls at a high rate.
+class ThreadInVMfromNativeFastReturn : public ThreadStateTransition {
+ public:
+  ThreadInVMfromNativeFastReturn(JavaThread* thread) : ThreadStateTransition(thread) {
+    trans_from_native(_thread_in_vm);
+  }
+  ~ThreadInVMfromNativeFastReturn() {
+    transition_from_vm_to_native(_thread);
+  }
+};
+
+
 class ThreadToNativeFromVM : public ThreadStateTransition {
  public:
   ThreadToNativeFromVM(JavaThread *thread) : ThreadStateTransition(thread) {
@@ -446,6 +476,20 @@ extern "C" {                                                         \
     VM_ENTRY_BASE(result_type, header, thread)
 
 
+// Same as JNI_ENTRY, but the return to native does not poll for safepoints.
+// Used for short functions that native code calls at a high rate.
+
+#define JNI_ENTRY_FAST_RETURN(result_type, header)                   \
+extern "C" {                                                         \
+  result_type JNICALL header {                                       \
+    JavaThread* thread=JavaThread::thread_from_jni_environment(env); \
+    assert( !VerifyJNIEnvThread || (thread == Thread::current()), "JNIEnv is only valid in same thread"); \
+    ThreadInVMfromNativeFastReturn __tiv(thread);                    \
+    debug_only(VMNativeEntryWrapper __vew;)                          \
+    VM_ENTRY_BASE(result_type, header, thread)                       \
+    WeakPreserveExceptionMark __wem(thread);
+
+
 #define JNI_LEAF(result_type, header)                                \
 extern "C" {                                                         \
   result_type JNICALL header {                                       \
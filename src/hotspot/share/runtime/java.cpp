@@ -27,12 +27,15 @@
 #include "aot/aotLoader.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/hotFieldProfile.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
+#include "classfile/verificationCache.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/hotMethodHistory.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrThreadId.hpp"
@@ -56,6 +59,7 @@
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/biasedLocking.hpp"
+#include "runtime/cpuTimeSampler.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/flags/flagSetting.hpp"
 #include "runtime/handles.inline.hpp"
@@ -69,6 +73,7 @@
 #include "runtime/task.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/timer.hpp"
+#include "runtime/trapHistory.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/memTracker.hpp"
@@ -440,6 +445,13 @@ void before_exit(JavaThread* thread) {
     os::infinite_sleep();
   }
 
+  // Save the uncommon trap history, hot methods, verified classes and hot
+  // fields for the next run.
+  TrapHistory::dump();
+  HotMethodHistory::dump();
+  VerificationCache::dump();
+  HotFieldProfile::dump();
+
   EventThreadEnd event;
   if (event.should_commit()) {
     event.set_thread(JFR_THREAD_ID(thread));
@@ -454,6 +466,9 @@ void before_exit(JavaThread* thread) {
     WatcherThread::stop();
   }
 
+  // Stop CPU-time sampling and log the summary
+  CPUTimeSampler::disengage();
+
   // shut down the StatSampler task
   StatSampler::disengage();
   StatSampler::destroy();
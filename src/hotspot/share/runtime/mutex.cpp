@@ -26,6 +26,7 @@
 #include "logging/log.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutex.hpp"
+#include "runtime/mutexStatistics.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/thread.inline.hpp"
@@ -70,6 +71,19 @@ void Mutex::check_no_safepoint_state(Thread* thread) {
 }
 #endif // ASSERT
 
+void Mutex::record_acquired() {
+  if (_stats != NULL) {
+    _stats->record_acquire();
+    _acquired_at = os::javaTimeNanos();
+  }
+}
+
+void Mutex::record_released() {
+  if (_stats != NULL) {
+    _stats->record_hold(os::javaTimeNanos() - _acquired_at);
+  }
+}
+
 void Mutex::lock_contended(Thread* self) {
   Mutex *in_flight_mutex = NULL;
   DEBUG_ONLY(int retry_cnt = 0;)
@@ -106,11 +120,18 @@ void Mutex::lock(Thread* self) {
 
   if (!_lock.try_lock()) {
     // The lock is contended, use contended slow-path function to lock
-    lock_contended(self);
+    if (_stats == NULL) {
+      lock_contended(self);
+    } else {
+      jlong start = os::javaTimeNanos();
+      lock_contended(self);
+      _stats->record_wait(os::javaTimeNanos() - start);
+    }
   }
 
   assert_owner(NULL);
   set_owner(self);
+  record_acquired();
 }
 
 void Mutex::lock() {
@@ -126,9 +147,16 @@ void Mutex::lock() {
 void Mutex::lock_without_safepoint_check(Thread * self) {
   check_no_safepoint_state(self);
   assert(_owner != self, "invariant");
-  _lock.lock();
+  if (_stats == NULL) {
+    _lock.lock();
+  } else if (!_lock.try_lock()) {
+    jlong start = os::javaTimeNanos();
+    _lock.lock();
+    _stats->record_wait(os::javaTimeNanos() - start);
+  }
   assert_owner(NULL);
   set_owner(self);
+  record_acquired();
 }
 
 void Mutex::lock_without_safepoint_check() {
@@ -146,6 +174,7 @@ bool Mutex::try_lock() {
   if (_lock.try_lock()) {
     assert_owner(NULL);
     set_owner(self);
+    record_acquired();
     return true;
   }
   return false;
@@ -158,6 +187,7 @@ void Mutex::release_for_safepoint() {
 
 void Mutex::unlock() {
   DEBUG_ONLY(assert_owner(Thread::current()));
+  record_released();
   set_owner(NULL);
   _lock.unlock();
 }
@@ -196,12 +226,14 @@ bool Monitor::wait_without_safepoint_check(int64_t timeout) {
 
   // conceptually set the owner to NULL in anticipation of
   // abdicating the lock in wait
+  record_released();
   set_owner(NULL);
   // Check safepoint state after resetting owner and possible NSV.
   check_no_safepoint_state(self);
 
   int wait_status = _lock.wait(timeout);
   set_owner(self);
+  record_acquired();
   return wait_status != 0;          // return true IFF timeout
 }
 
@@ -220,6 +252,7 @@ bool Monitor::wait(int64_t timeout, bool as_suspend_equivalent) {
   int wait_status;
   // conceptually set the owner to NULL in anticipation of
   // abdicating the lock in wait
+  record_released();
   set_owner(NULL);
   // Check safepoint state after resetting owner and possible NSV.
   check_safepoint_state(self);
@@ -255,6 +288,7 @@ bool Monitor::wait(int64_t timeout, bool as_suspend_equivalent) {
     assert_owner(NULL);
     // Conceptually reestablish ownership of the lock.
     set_owner(self);
+    record_acquired();
   } else {
     lock(self);
   }
@@ -280,6 +314,8 @@ Mutex::Mutex(int Rank, const char * name, bool allow_vm_block,
     strncpy(_name, name, MUTEX_NAME_LEN - 1);
     _name[MUTEX_NAME_LEN - 1] = '\0';
   }
+  _stats = RecordMutexStatistics ? MutexStatistics::lookup(_name) : NULL;
+  _acquired_at = 0;
 #ifdef ASSERT
   _allow_vm_block  = allow_vm_block;
   _rank            = Rank;
@@ -37,6 +37,8 @@
 // TODO: Check if _name[MUTEX_NAME_LEN] should better get replaced by const char*.
 static const int MUTEX_NAME_LEN = 64;
 
+class MutexStatistics;
+
 class Mutex : public CHeapObj<mtSynchronizer> {
 
  public:
@@ -79,6 +81,8 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   Thread * volatile _owner;              // The owner of the lock
   os::PlatformMonitor _lock;             // Native monitor implementation
   char _name[MUTEX_NAME_LEN];            // Name of mutex/monitor
+  MutexStatistics* _stats;               // Contention statistics, NULL unless RecordMutexStatistics
+  jlong _acquired_at;                    // Time of the last acquisition, if _stats != NULL
 
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
@@ -98,6 +102,9 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   void assert_owner            (Thread* expected)                     NOT_DEBUG_RETURN;
   void no_safepoint_verifier   (Thread* thread, bool enable)          NOT_DEBUG_RETURN;
 
+  void record_acquired();
+  void record_released();
+
  public:
   enum {
     _allow_vm_block_flag        = true,
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexStatistics.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+
+MutexStatistics* volatile MutexStatistics::_head = NULL;
+
+MutexStatistics::MutexStatistics(const char* name) :
+  _next(NULL), _acquisitions(0), _contended(0) {
+  strncpy(_name, name, sizeof(_name) - 1);
+  _name[sizeof(_name) - 1] = '\0';
+  memset(&_wait, 0, sizeof(_wait));
+  memset(&_hold, 0, sizeof(_hold));
+}
+
+MutexStatistics* MutexStatistics::lookup(const char* name) {
+  MutexStatistics* created = NULL;
+  MutexStatistics* head = Atomic::load_acquire(&_head);
+  MutexStatistics* searched_to = NULL;
+  while (true) {
+    for (MutexStatistics* s = head; s != searched_to; s = s->_next) {
+      if (strncmp(s->_name, name, sizeof(s->_name) - 1) == 0) {
+        delete created;
+        return s;
+      }
+    }
+    if (created == NULL) {
+      created = new MutexStatistics(name);
+    }
+    // Only entries pushed since the last attempt need to be searched again.
+    searched_to = head;
+    created->_next = head;
+    MutexStatistics* witness = Atomic::cmpxchg(&_head, head, created);
+    if (witness == head) {
+      return created;
+    }
+    head = witness;
+  }
+}
+
+void MutexStatistics::Histogram::record(jlong nanos) {
+  jlong micros = nanos / (NANOUNITS / MICROUNITS);
+  int bucket = (micros == 0) ? 0 : MIN2(log2_long(micros) + 1, NumBuckets - 1);
+  Atomic::inc(&_buckets[bucket]);
+  Atomic::add(&_total_nanos, nanos);
+  jlong max = Atomic::load(&_max_nanos);
+  while (nanos > max) {
+    jlong witness = Atomic::cmpxchg(&_max_nanos, max, nanos);
+    if (witness == max) {
+      break;
+    }
+    max = witness;
+  }
+}
+
+void MutexStatistics::record_wait(jlong nanos) {
+  Atomic::inc(&_contended);
+  _wait.record(nanos);
+}
+
+void MutexStatistics::Histogram::print_on(outputStream* st) const {
+  int last = NumBuckets - 1;
+  while (last > 0 && _buckets[last] == 0) {
+    last--;
+  }
+  for (int i = 0; i <= last; i++) {
+    if (i == NumBuckets - 1) {
+      st->print_cr("      >= " UINT64_FORMAT_W(10) "us: " UINT64_FORMAT, (uint64_t)1 << (i - 1), _buckets[i]);
+    } else {
+      st->print_cr("      <  " UINT64_FORMAT_W(10) "us: " UINT64_FORMAT, (uint64_t)1 << i, _buckets[i]);
+    }
+  }
+}
+
+static int compare_by_wait(MutexStatistics** a, MutexStatistics** b) {
+  jlong wa = (*a)->wait().total_nanos();
+  jlong wb = (*b)->wait().total_nanos();
+  return (wa < wb) ? 1 : (wa > wb) ? -1 : 0;
+}
+
+void MutexStatistics::print_on(outputStream* st, bool histograms) {
+  ResourceMark rm;
+  GrowableArray<MutexStatistics*> locks;
+  for (MutexStatistics* s = first(); s != NULL; s = s->next()) {
+    if (s->acquisitions() > 0) {
+      locks.append(s);
+    }
+  }
+  locks.sort(compare_by_wait);
+
+  st->print_cr("%-40s %12s %12s %12s %10s %12s %10s",
+               "Name", "Acquired", "Contended", "Wait(ms)", "MaxWait", "Hold(ms)", "MaxHold");
+  for (int i = 0; i < locks.length(); i++) {
+    MutexStatistics* s = locks.at(i);
+    st->print_cr("%-40s " UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(12)
+                 " %12.3f %8.3fms %12.3f %8.3fms",
+                 s->name(), s->acquisitions(), s->contended(),
+                 (double)s->wait().total_nanos() / NANOSECS_PER_MILLISEC,
+                 (double)s->wait().max_nanos() / NANOSECS_PER_MILLISEC,
+                 (double)s->hold().total_nanos() / NANOSECS_PER_MILLISEC,
+                 (double)s->hold().max_nanos() / NANOSECS_PER_MILLISEC);
+    if (histograms) {
+      if (s->contended() > 0) {
+        st->print_cr("    wait:");
+        s->wait().print_on(st);
+      }
+      st->print_cr("    hold:");
+      s->hold().print_on(st);
+    }
+  }
+}
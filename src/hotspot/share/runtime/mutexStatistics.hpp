@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_MUTEXSTATISTICS_HPP
+#define SHARE_RUNTIME_MUTEXSTATISTICS_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// Contention accounting for VM Mutexes and Monitors, enabled with
+// -XX:+RecordMutexStatistics. One immortal MutexStatistics is kept per lock
+// name, so locks that are created and destroyed dynamically (and the many
+// instances that share a name, such as per-MDO locks) are aggregated.
+//
+// Wait time is only measured when the uncontended try_lock fast path
+// fails; hold time is measured from acquisition to release. Both are kept
+// as totals, maxima and log2 histograms in microseconds.
+class MutexStatistics : public CHeapObj<mtSynchronizer> {
+ public:
+  // Bucket 0 is < 1us, bucket i (i > 0) is [2^(i-1), 2^i) us, and the last
+  // bucket collects everything longer.
+  static const int NumBuckets = 24;
+
+  class Histogram {
+    friend class MutexStatistics;
+    volatile uint64_t _buckets[NumBuckets];
+    volatile jlong    _total_nanos;
+    volatile jlong    _max_nanos;
+    void record(jlong nanos);
+   public:
+    uint64_t bucket(int i) const { return _buckets[i]; }
+    jlong total_nanos() const    { return _total_nanos; }
+    jlong max_nanos() const      { return _max_nanos; }
+    void print_on(outputStream* st) const;
+  };
+
+ private:
+  static MutexStatistics* volatile _head;
+
+  MutexStatistics* volatile _next;
+  char                      _name[64];
+  volatile uint64_t         _acquisitions;
+  volatile uint64_t         _contended;
+  Histogram                 _wait;
+  Histogram                 _hold;
+
+  MutexStatistics(const char* name);
+
+ public:
+  // Returns the statistics for the given name, creating them on first use.
+  static MutexStatistics* lookup(const char* name);
+
+  void record_acquire()               { Atomic::inc(&_acquisitions); }
+  void record_wait(jlong nanos);
+  void record_hold(jlong nanos)       { _hold.record(nanos); }
+
+  const char* name() const            { return _name; }
+  uint64_t acquisitions() const       { return _acquisitions; }
+  uint64_t contended() const          { return _contended; }
+  const Histogram& wait() const       { return _wait; }
+  const Histogram& hold() const       { return _hold; }
+  MutexStatistics* next() const       { return _next; }
+
+  static MutexStatistics* first()     { return Atomic::load_acquire(&_head); }
+
+  // Prints all locks that have been acquired, most contended first. With
+  // histograms, also prints the wait and hold time distributions.
+  static void print_on(outputStream* st, bool histograms);
+};
+
+#endif // SHARE_RUNTIME_MUTEXSTATISTICS_HPP
@@ -1771,6 +1771,7 @@ int ObjectMonitor::TrySpin(Thread * Self) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinSuccesses, inc());
       return 1;
     }
     SpinPause();
@@ -1861,6 +1862,7 @@ int ObjectMonitor::TrySpin(Thread * Self) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        OM_PERFDATA_OP(SpinSuccesses, inc());
         return 1;
       }
 
@@ -1892,14 +1894,14 @@ int ObjectMonitor::TrySpin(Thread * Self) {
   }
 
   // Spin failed with prejudice -- reduce _SpinDuration.
-  // TODO: Use an AIMD-like policy to adjust _SpinDuration.
-  // AIMD is globally stable.
+  // Use an AIMD-like policy: successful spins increase _SpinDuration
+  // additively, failed spins decrease it multiplicatively as well. AIMD is
+  // globally stable, and backs off quickly when spinning keeps failing,
+  // e.g. when the owner is preempted on a host with oversubscribed cores.
   {
     int x = _SpinDuration;
     if (x > 0) {
-      // Consider an AIMD scheme like: x -= (x >> 3) + 100
-      // This is globally sample and tends to damp the response.
-      x -= Knob_Penalty;
+      x -= (x >> 3) + Knob_Penalty;
       if (x < 0) x = 0;
       _SpinDuration = x;
     }
@@ -1913,8 +1915,12 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(Self) > 0) return 1;
+    if (TryLock(Self) > 0) {
+      OM_PERFDATA_OP(SpinSuccesses, inc());
+      return 1;
+    }
   }
+  OM_PERFDATA_OP(SpinFailures, inc());
   return 0;
 }
 
@@ -2060,6 +2066,8 @@ PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = NULL;
 PerfCounter * ObjectMonitor::_sync_FutileWakeups               = NULL;
 PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
 PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinSuccesses               = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinFailures                = NULL;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
@@ -2097,6 +2105,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_SpinSuccesses);
+    NEWPERFCOUNTER(_sync_SpinFailures);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
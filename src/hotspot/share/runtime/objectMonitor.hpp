@@ -205,6 +205,8 @@ class ObjectMonitor {
   static PerfCounter * _sync_FutileWakeups;
   static PerfCounter * _sync_Parks;
   static PerfCounter * _sync_Notifications;
+  static PerfCounter * _sync_SpinSuccesses;
+  static PerfCounter * _sync_SpinFailures;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
   static PerfLongVariable * _sync_MonExtant;
@@ -667,7 +667,7 @@ static bool has_reached_max_malloc_test_peak(size_t alloc_size) {
 }
 
 void* os::malloc(size_t size, MEMFLAGS flags) {
-  return os::malloc(size, flags, CALLER_PC);
+  return os::malloc(size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -728,7 +728,7 @@ void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS flags) {
-  return os::realloc(memblock, size, flags, CALLER_PC);
+  return os::realloc(memblock, size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -1753,7 +1753,14 @@ bool os::release_memory(char* addr, size_t bytes) {
 }
 
 void os::pretouch_memory(void* start, void* end, size_t page_size) {
-  for (volatile char *p = (char*)start; p < (char*)end; p += page_size) {
+  if (start >= end) {
+    return;
+  }
+  size_t touch_page_size = pd_pretouch_memory(start, end, page_size);
+  if (touch_page_size == 0) {
+    return;
+  }
+  for (volatile char *p = (char*)start; p < (char*)end; p += touch_page_size) {
     *p = 0;
   }
 }
@@ -140,6 +140,10 @@ class os: AllStatic {
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Pre-touches [start, end) in a platform-specific way. Returns the page size
+  // to pre-touch the range with one write per page, or 0 if the range has
+  // already been pre-touched.
+  static size_t pd_pretouch_memory(void* start, void* end, size_t page_size);
 
   static char*  pd_reserve_memory_special(size_t size, size_t alignment,
                                           char* addr, bool executable);
@@ -949,6 +949,27 @@ static methodHandle resolve_interface_call(InstanceKlass* klass,
   return methodHandle(THREAD, info.selected_method());
 }
 
+// The receiver is known to implement the interface, so the target can be
+// selected through the itable like invokeinterface does, without the full
+// name and signature resolution. Returns NULL if that is not possible or
+// would fail; resolve_interface_call() then reports the proper error.
+static Method* select_interface_method(const methodHandle& method, Klass* recv_klass, TRAPS) {
+  if (!method->has_itable_index() || !recv_klass->is_instance_klass()) {
+    return NULL;
+  }
+  Method* selected = InstanceKlass::cast(recv_klass)->method_at_itable(method->method_holder(),
+                                                                       method->itable_index(),
+                                                                       THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return NULL;
+  }
+  if (!selected->is_public() || selected->is_abstract()) {
+    return NULL;
+  }
+  return selected;
+}
+
 // Conversion
 static BasicType basic_type_mirror_to_basic_type(oop basic_type_mirror, TRAPS) {
   assert(java_lang_Class::is_primitive(basic_type_mirror),
@@ -1021,24 +1042,27 @@ static oop invoke(InstanceKlass* klass,
     } else {
       // resolve based on the receiver
       if (reflected_method->method_holder()->is_interface()) {
-        // resolve interface call
-        //
-        // Match resolution errors with those thrown due to reflection inlining
-        // Linktime resolution & IllegalAccessCheck already done by Class.getMethod()
-        method = resolve_interface_call(klass, reflected_method, target_klass, receiver, THREAD);
-        if (HAS_PENDING_EXCEPTION) {
-          // Method resolution threw an exception; wrap it in an InvocationTargetException
-          oop resolution_exception = PENDING_EXCEPTION;
-          CLEAR_PENDING_EXCEPTION;
-          // JVMTI has already reported the pending exception
-          // JVMTI internal flag reset is needed in order to report InvocationTargetException
-          if (THREAD->is_Java_thread()) {
-            JvmtiExport::clear_detected_exception(THREAD->as_Java_thread());
+        method = methodHandle(THREAD, select_interface_method(reflected_method, target_klass, THREAD));
+        if (method.is_null()) {
+          // resolve interface call
+          //
+          // Match resolution errors with those thrown due to reflection inlining
+          // Linktime resolution & IllegalAccessCheck already done by Class.getMethod()
+          method = resolve_interface_call(klass, reflected_method, target_klass, receiver, THREAD);
+          if (HAS_PENDING_EXCEPTION) {
+            // Method resolution threw an exception; wrap it in an InvocationTargetException
+            oop resolution_exception = PENDING_EXCEPTION;
+            CLEAR_PENDING_EXCEPTION;
+            // JVMTI has already reported the pending exception
+            // JVMTI internal flag reset is needed in order to report InvocationTargetException
+            if (THREAD->is_Java_thread()) {
+              JvmtiExport::clear_detected_exception(THREAD->as_Java_thread());
+            }
+            JavaCallArguments args(Handle(THREAD, resolution_exception));
+            THROW_ARG_0(vmSymbols::java_lang_reflect_InvocationTargetException(),
+                        vmSymbols::throwable_void_signature(),
+                        &args);
           }
-          JavaCallArguments args(Handle(THREAD, resolution_exception));
-          THROW_ARG_0(vmSymbols::java_lang_reflect_InvocationTargetException(),
-                      vmSymbols::throwable_void_signature(),
-                      &args);
         }
       }  else {
         // if the method can be overridden, we resolve using the vtable index.
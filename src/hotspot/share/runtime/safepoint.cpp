@@ -66,6 +66,7 @@
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -205,7 +206,34 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+// Logs the thread that was the last to reach the safepoint, and where it
+// stopped. That is the code that determined the time to safepoint, e.g. a
+// long counted loop without a safepoint poll.
+static void log_last_running_thread(JavaThread* thread) {
+  LogTarget(Info, safepoint, ttsp) lt;
+  if (thread == NULL || !lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  LogStream ls(lt);
+  ls.print("Last thread to reach safepoint: \"%s\", time to safepoint: " INT64_FORMAT " ns",
+           thread->name(),
+           (int64_t)(os::javaTimeNanos() - SafepointTracing::start_of_safepoint()));
+  if (thread->has_last_Java_frame()) {
+    // Only the method and bci are read, so the frames need not be processed.
+    RegisterMap reg_map(thread, false /* update_map */, false /* process_frames */);
+    javaVFrame* jvf = thread->last_java_vframe(&reg_map);
+    if (jvf != NULL) {
+      ls.print(", at ");
+      jvf->method()->print_short_name(&ls);
+      ls.print(" @ bci %d (%s)", jvf->bci(), jvf->is_compiled_frame() ? "compiled" : "interpreted");
+    }
+  }
+  ls.cr();
+}
+
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** last_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -235,6 +263,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *last_running = NULL;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -257,6 +286,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        *last_running = cur_tss->thread();
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -372,12 +402,13 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  JavaThread* last_running = NULL;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_running);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -417,6 +448,7 @@ void SafepointSynchronize::begin() {
                                    _waiting_to_block, iterations);
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
+  log_last_running_thread(last_running);
 
   // We do the safepoint cleanup first since a GC related safepoint
   // needs cleanup to be completed before running the GC op.
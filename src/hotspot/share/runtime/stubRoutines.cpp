@@ -163,6 +163,7 @@ address StubRoutines::_bigIntegerRightShiftWorker = NULL;
 address StubRoutines::_bigIntegerLeftShiftWorker = NULL;
 
 address StubRoutines::_vectorizedMismatch = NULL;
+address StubRoutines::_stringHashCode = NULL;
 
 address StubRoutines::_dexp = NULL;
 address StubRoutines::_dlog = NULL;
@@ -245,6 +245,7 @@ class StubRoutines: AllStatic {
   static address _bigIntegerLeftShiftWorker;
 
   static address _vectorizedMismatch;
+  static address _stringHashCode;
 
   static address _dexp;
   static address _dlog;
@@ -424,6 +425,7 @@ class StubRoutines: AllStatic {
   static address bigIntegerLeftShift()  { return _bigIntegerLeftShiftWorker; }
 
   static address vectorizedMismatch()  { return _vectorizedMismatch; }
+  static address stringHashCode()      { return _stringHashCode; }
 
   static address dexp()                { return _dexp; }
   static address dlog()                { return _dlog; }
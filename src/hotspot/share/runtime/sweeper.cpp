@@ -343,51 +343,61 @@ void NMethodSweeper::sweep_code_cache() {
     MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
     while (!_current.end()) {
-      swept_count++;
-      // Since we will give up the CodeCache_lock, always skip ahead
-      // to the next nmethod.  Other blobs can be deleted by other
-      // threads but nmethods are only reclaimed by the sweeper.
-      CompiledMethod* nm = _current.method();
-      _current.next();
-
-      // Now ready to process nmethod and give up CodeCache_lock
+      // Take a batch of nmethods with a single acquisition of the
+      // CodeCache_lock, which the compiler threads need for installing
+      // code. Since we will give up the CodeCache_lock, always skip ahead
+      // past the batch. Other blobs can be deleted by other threads but
+      // nmethods are only reclaimed by the sweeper, so the batch stays
+      // valid.
+      CompiledMethod* batch[sweep_batch_size];
+      int batch_length = 0;
+      while (batch_length < sweep_batch_size && !_current.end()) {
+        batch[batch_length++] = _current.method();
+        _current.next();
+      }
+
+      // Now ready to process the nmethods and give up CodeCache_lock
       {
         MutexUnlocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-        // Save information before potentially flushing the nmethod
-        // Only flushing nmethods so size only matters for them.
-        int size = nm->is_nmethod() ? ((nmethod*)nm)->total_size() : 0;
-        bool is_c2_method = nm->is_compiled_by_c2();
-        bool is_osr = nm->is_osr_method();
-        int compile_id = nm->compile_id();
-        intptr_t address = p2i(nm);
-        const char* state_before = nm->state();
-        const char* state_after = "";
-
-        MethodStateChange type = process_compiled_method(nm);
-        switch (type) {
-          case Flushed:
-            state_after = "flushed";
-            freed_memory += size;
-            ++flushed_count;
-            if (is_c2_method) {
-              ++flushed_c2_count;
-            }
-            break;
-          case MadeZombie:
-            state_after = "made zombie";
-            ++zombified_count;
-            break;
-          case None:
-            break;
-          default:
-           ShouldNotReachHere();
-        }
-        if (PrintMethodFlushing && Verbose && type != None) {
-          tty->print_cr("### %s nmethod %3d/" PTR_FORMAT " (%s) %s", is_osr ? "osr" : "", compile_id, address, state_before, state_after);
+        for (int i = 0; i < batch_length; i++) {
+          CompiledMethod* nm = batch[i];
+          swept_count++;
+          // Save information before potentially flushing the nmethod
+          // Only flushing nmethods so size only matters for them.
+          int size = nm->is_nmethod() ? ((nmethod*)nm)->total_size() : 0;
+          bool is_c2_method = nm->is_compiled_by_c2();
+          bool is_osr = nm->is_osr_method();
+          int compile_id = nm->compile_id();
+          intptr_t address = p2i(nm);
+          const char* state_before = nm->state();
+          const char* state_after = "";
+
+          MethodStateChange type = process_compiled_method(nm);
+          switch (type) {
+            case Flushed:
+              state_after = "flushed";
+              freed_memory += size;
+              ++flushed_count;
+              if (is_c2_method) {
+                ++flushed_c2_count;
+              }
+              break;
+            case MadeZombie:
+              state_after = "made zombie";
+              ++zombified_count;
+              break;
+            case None:
+              break;
+            default:
+             ShouldNotReachHere();
+          }
+          if (PrintMethodFlushing && Verbose && type != None) {
+            tty->print_cr("### %s nmethod %3d/" PTR_FORMAT " (%s) %s", is_osr ? "osr" : "", compile_id, address, state_before, state_after);
+          }
+          _seen++;
         }
       }
 
-      _seen++;
       handle_safepoint_request();
     }
   }
@@ -66,6 +66,8 @@ class NMethodSweeper : public AllStatic {
     MadeZombie,
     Flushed
   };
+  // Number of nmethods taken per acquisition of the CodeCache_lock
+  enum { sweep_batch_size = 16 };
   static long      _traversals;                   // Stack scan count, also sweep ID.
   static long      _total_nof_code_cache_sweeps;  // Total number of full sweeps of the code cache
   static CompiledMethodIterator _current;         // Current compiled method
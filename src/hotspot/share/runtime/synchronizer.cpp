@@ -605,6 +605,35 @@ void ObjectSynchronizer::handle_sync_on_primitive_wrapper(Handle obj, Thread* cu
 // of this algorithm. Make sure to update that code if the following function is
 // changed. The implementation is extremely sensitive to race condition. Be careful.
 
+// The number of times enter() re-reads a mark word that is stack-locked
+// by another thread before inflating the lock. Many contended critical
+// sections are short enough to be released within this window, and the
+// object then stays on the stack-locking path instead of getting an
+// ObjectMonitor that has to be deflated later.
+static const int StackLockSpinLimit = 64;
+
+// Spins while obj is stack-locked by another thread, and tries to
+// stack-lock it with lock once it is unlocked. Returns true on success.
+static bool spin_stack_lock(oop obj, BasicLock* lock) {
+  if (!os::is_MP()) {
+    return false;
+  }
+  for (int i = 0; i < StackLockSpinLimit; i++) {
+    SpinPause();
+    markWord mark = obj->mark();
+    if (mark.is_neutral()) {
+      lock->set_displaced_header(mark);
+      if (mark == obj->cas_set_mark(markWord::from_pointer(lock), mark)) {
+        return true;
+      }
+    } else if (!mark.has_locker()) {
+      // Inflated or being inflated.
+      return false;
+    }
+  }
+  return false;
+}
+
 void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, TRAPS) {
   if (DiagnoseSyncOnPrimitiveWrappers != 0 && obj->klass()->is_box()) {
     handle_sync_on_primitive_wrapper(obj, THREAD);
@@ -635,6 +664,9 @@ void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, TRAPS) {
     assert(lock != (BasicLock*)obj->mark().value(), "don't relock with same BasicLock");
     lock->set_displaced_header(markWord::from_pointer(NULL));
     return;
+  } else if (mark.has_locker() && spin_stack_lock(obj(), lock)) {
+    // Stack-locked by another thread, and released while spinning.
+    return;
   }
 
   // The object header will never be displaced to this lock,
@@ -2337,8 +2369,10 @@ class HandshakeForDeflation : public HandshakeClosure {
 };
 
 void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
+  EventJavaMonitorDeflation event;
+
   // Deflate any global idle monitors.
-  deflate_global_idle_monitors_using_JT();
+  int deflated_count = deflate_global_idle_monitors_using_JT();
 
   int count = 0;
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *jt = jtiwh.next(); ) {
@@ -2346,7 +2380,7 @@ void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
       // This JavaThread is using ObjectMonitors so deflate any that
       // are idle unless this JavaThread is exiting; do not race with
       // ObjectSynchronizer::om_flush().
-      deflate_per_thread_idle_monitors_using_JT(jt);
+      deflated_count += deflate_per_thread_idle_monitors_using_JT(jt);
       count++;
     }
   }
@@ -2361,6 +2395,14 @@ void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
                              Atomic::load(&om_list_globals._free_count),
                              Atomic::load(&om_list_globals._wait_count));
 
+  if (event.should_commit()) {
+    event.set_deflatedCount(deflated_count);
+    event.set_threadCount(count);
+    event.set_population(Atomic::load(&om_list_globals._population));
+    event.set_inUseCount(Atomic::load(&om_list_globals._in_use_count));
+    event.commit();
+  }
+
   GVars.stw_random = os::random();
 
   // The ServiceThread's async deflation request has been processed.
@@ -2406,23 +2448,23 @@ void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
 
 // Deflate global idle ObjectMonitors using a JavaThread.
 //
-void ObjectSynchronizer::deflate_global_idle_monitors_using_JT() {
+int ObjectSynchronizer::deflate_global_idle_monitors_using_JT() {
   JavaThread* self = JavaThread::current();
 
-  deflate_common_idle_monitors_using_JT(true /* is_global */, self);
+  return deflate_common_idle_monitors_using_JT(true /* is_global */, self);
 }
 
 // Deflate the specified JavaThread's idle ObjectMonitors using a JavaThread.
 //
-void ObjectSynchronizer::deflate_per_thread_idle_monitors_using_JT(JavaThread* target) {
+int ObjectSynchronizer::deflate_per_thread_idle_monitors_using_JT(JavaThread* target) {
   assert(Thread::current()->is_Java_thread(), "precondition");
 
-  deflate_common_idle_monitors_using_JT(false /* !is_global */, target);
+  return deflate_common_idle_monitors_using_JT(false /* !is_global */, target);
 }
 
 // Deflate global or per-thread idle ObjectMonitors using a JavaThread.
 //
-void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target) {
+int ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target) {
   JavaThread* self = JavaThread::current();
 
   int deflated_count = 0;
@@ -2515,6 +2557,7 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
       ls->print_cr("jt=" INTPTR_FORMAT ": async-deflating per-thread idle monitors, %3.7f secs, %d monitors", p2i(target), timer.seconds(), deflated_count);
     }
   }
+  return deflated_count;
 }
 
 // Monitor cleanup on JavaThread::exit
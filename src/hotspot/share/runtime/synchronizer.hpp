@@ -130,9 +130,10 @@ class ObjectSynchronizer : AllStatic {
   // Basically we deflate all monitors that are not busy.
   // An adaptive profile-based deflation policy could be used if needed
   static void deflate_idle_monitors_using_JT();
-  static void deflate_global_idle_monitors_using_JT();
-  static void deflate_per_thread_idle_monitors_using_JT(JavaThread* target);
-  static void deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target);
+  // These return the number of deflated monitors.
+  static int deflate_global_idle_monitors_using_JT();
+  static int deflate_per_thread_idle_monitors_using_JT(JavaThread* target);
+  static int deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target);
 
   // For a given in-use monitor list: global or per-thread, deflate idle
   // monitors using a JavaThread.
@@ -26,6 +26,7 @@
 #include "jvm.h"
 #include "aot/aotLoader.hpp"
 #include "classfile/classLoader.hpp"
+#include "classfile/classPrefetcher.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -46,6 +47,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -67,6 +69,7 @@
 #include "runtime/arguments.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/biasedLocking.hpp"
+#include "runtime/cpuTimeSampler.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlagLimit.hpp"
 #include "runtime/deoptimization.hpp"
@@ -231,6 +234,9 @@ Thread::Thread() {
 
   // allocated data structures
   set_osthread(NULL);
+  set_chunk_cache(NULL);
+  set_chunk_cache_count(0);
+  set_chunk_cache_limit(0);
   set_resource_area(new (mtThread)ResourceArea());
   DEBUG_ONLY(_current_resource_mark = NULL;)
   set_handle_area(new (mtThread) HandleArea(NULL));
@@ -454,6 +460,9 @@ Thread::~Thread() {
   // osthread() can be NULL, if creation of thread failed.
   if (osthread() != NULL) os::free_thread(osthread());
 
+  // Chunks freed by this thread above may have gone to its cache
+  Chunk::release_thread_cache(this);
+
   // Clear Thread::current if thread is deleting itself and it has not
   // already been done. This must be done before the memory is deallocated.
   // Needed to ensure JNI correctly detects non-attached threads.
@@ -1739,12 +1748,16 @@ JavaThread::JavaThread() :
   _jni_active_critical(0),
   _pending_jni_exception_check_fn(nullptr),
   _depth_first_number(0),
+  _profile_sample_countdown(0),
+  _profile_sample_seed((juint)os::random() | 1),
 
   // JVMTI PopFrame support
   _popframe_condition(popframe_inactive),
   _frames_to_pop_failed_realloc(0),
 
   _handshake(this),
+  _cpu_time_ticks(0),
+  _cpu_time_sample_pending(false),
 
   _popframe_preserved_args(nullptr),
   _popframe_preserved_args_size(0),
@@ -3329,6 +3342,9 @@ CompilerThread::CompilerThread(CompileQueue* queue,
   // Compiler uses resource area for compilation, let's bias it to mtCompiler
   resource_area()->bias_to(mtCompiler);
 
+  // Compilations grow and release arenas of default sized chunks at a high rate
+  set_chunk_cache_limit(Chunk::compiler_thread_cache_limit);
+
 #ifndef PRODUCT
   _ideal_graph_printer = NULL;
 #endif
@@ -3749,6 +3765,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // real raw monitor. VM is setup enough here for raw monitor enter.
   JvmtiExport::transition_pending_onload_raw_monitors();
 
+  // From here on, file outputs are written by the async log writer if -Xlog:async was given
+  AsyncLogWriter::initialize();
+
   // Create the VMThread
   { TraceTime timer("Start VMThread", TRACETIME_LOG(Info, startuptime));
 
@@ -3930,6 +3949,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   if (MemProfiling)                   MemProfiler::engage();
   StatSampler::engage();
+  if (CPUTimeSampler::is_enabled())   CPUTimeSampler::engage();
   if (CheckJNICalls)                  JniPeriodicChecker::engage();
 
   BiasedLocking::init();
@@ -3945,6 +3965,13 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     CLEAR_PENDING_EXCEPTION;
   }
 
+  if (!DumpSharedSpaces) {
+    ClassPrefetcher::start(THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+    }
+  }
+
   {
     MutexLocker ml(PeriodicTask_lock);
     // Make sure the WatcherThread can be started by WatcherThread::start()
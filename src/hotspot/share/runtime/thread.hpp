@@ -71,6 +71,7 @@ class Parker;
 class MonitorInfo;
 
 class AbstractCompiler;
+class Chunk;
 class ciEnv;
 class CompileThread;
 class CompileLog;
@@ -593,6 +594,14 @@ class Thread: public ThreadShadow {
   ResourceArea* resource_area() const            { return _resource_area; }
   void set_resource_area(ResourceArea* area)     { _resource_area = area; }
 
+  // Arena chunk cache
+  Chunk* chunk_cache() const                     { return _chunk_cache; }
+  void set_chunk_cache(Chunk* chunk)             { _chunk_cache = chunk; }
+  uint chunk_cache_count() const                 { return _chunk_cache_count; }
+  void set_chunk_cache_count(uint count)         { _chunk_cache_count = count; }
+  uint chunk_cache_limit() const                 { return _chunk_cache_limit; }
+  void set_chunk_cache_limit(uint limit)         { _chunk_cache_limit = limit; }
+
   OSThread* osthread() const                     { return _osthread;   }
   void set_osthread(OSThread* thread)            { _osthread = thread; }
 
@@ -752,6 +761,11 @@ protected:
 
   DEBUG_ONLY(ResourceMark* _current_resource_mark;)
 
+  // Arena chunks cached by this thread, see Chunk::operator new and delete
+  Chunk* _chunk_cache;
+  uint   _chunk_cache_count;
+  uint   _chunk_cache_limit;
+
   // Thread local handle area for allocation of handles within the VM
   HandleArea* _handle_area;
   GrowableArray<Metadata*>* _metadata_handles;
@@ -1213,6 +1227,11 @@ class JavaThread: public Thread {
   // For deadlock detection.
   int _depth_first_number;
 
+  // C1 sampled profiling: profiled events left until the next MDO update,
+  // and the xorshift state that draws the next stride.
+  jint  _profile_sample_countdown;
+  juint _profile_sample_seed;
+
   // JVMTI PopFrame support
   // This is set to popframe_pending to signal that top Java frame should be popped immediately
   int _popframe_condition;
@@ -1345,6 +1364,17 @@ class JavaThread: public Thread {
  public:
   HandshakeState* handshake_state() { return &_handshake; }
 
+  // Support for CPU-time sampling, see cpuTimeSampler.hpp
+ private:
+  volatile uint _cpu_time_ticks;          // timer expirations not yet sampled
+  volatile bool _cpu_time_sample_pending; // a sampling handshake is queued
+ public:
+  inline void inc_cpu_time_ticks();  // async-signal-safe
+  inline bool has_cpu_time_ticks() const;
+  inline uint take_cpu_time_ticks();
+  inline bool try_set_cpu_time_sample_pending();
+  inline void clear_cpu_time_sample_pending();
+
   // A JavaThread can always safely operate on it self and other threads
   // can do it safely if they are the active handshaker.
   bool is_handshake_safe_for(Thread* th) const {
@@ -1585,6 +1615,8 @@ class JavaThread: public Thread {
   // For assembly stub generation
   static ByteSize threadObj_offset()             { return byte_offset_of(JavaThread, _threadObj); }
   static ByteSize jni_environment_offset()       { return byte_offset_of(JavaThread, _jni_environment); }
+  static ByteSize profile_sample_countdown_offset() { return byte_offset_of(JavaThread, _profile_sample_countdown); }
+  static ByteSize profile_sample_seed_offset()   { return byte_offset_of(JavaThread, _profile_sample_seed); }
   static ByteSize pending_jni_exception_check_fn_offset() {
     return byte_offset_of(JavaThread, _pending_jni_exception_check_fn);
   }
@@ -141,6 +141,27 @@ inline void JavaThread::set_thread_state_fence(JavaThreadState s) {
   OrderAccess::fence();
 }
 
+inline void JavaThread::inc_cpu_time_ticks() {
+  Atomic::inc(&_cpu_time_ticks);
+}
+
+inline bool JavaThread::has_cpu_time_ticks() const {
+  return Atomic::load(&_cpu_time_ticks) != 0;
+}
+
+inline uint JavaThread::take_cpu_time_ticks() {
+  return Atomic::xchg(&_cpu_time_ticks, 0u);
+}
+
+inline bool JavaThread::try_set_cpu_time_sample_pending() {
+  return !Atomic::load(&_cpu_time_sample_pending) &&
+         !Atomic::cmpxchg(&_cpu_time_sample_pending, false, true);
+}
+
+inline void JavaThread::clear_cpu_time_sample_pending() {
+  Atomic::release_store(&_cpu_time_sample_pending, false);
+}
+
 ThreadSafepointState* JavaThread::safepoint_state() const  {
   return _safepoint_state;
 }
@@ -92,6 +92,12 @@ ThreadsList* volatile ThreadsSMRSupport::_java_thread_list = &_bootstrap_list;
 // _deleted_thread_cnt field.
 uint64_t              ThreadsSMRSupport::_java_thread_list_alloc_cnt = 1;
 
+// # of JavaThread* arrays allocated for ThreadsLists over VM lifetime.
+// The other ThreadsLists share the array of the list they were created
+// from, see ThreadsListArray.
+// Impl note: See _java_thread_list_alloc_cnt note.
+uint64_t              ThreadsSMRSupport::_java_thread_list_array_alloc_cnt = 1;
+
 // # of ThreadsLists freed over VM lifetime.
 // Impl note: See _java_thread_list_alloc_cnt note.
 uint64_t              ThreadsSMRSupport::_java_thread_list_free_cnt = 0;
@@ -572,35 +578,70 @@ void SafeThreadsListPtr::verify_hazard_ptr_scanned() {
 #endif
 }
 
-// 'entries + 1' so we always have at least one entry.
+// 'capacity + 1' so we always have at least one entry.
+ThreadsListArray::ThreadsListArray(uint capacity) :
+  _capacity(capacity),
+  _used(0),
+  _ref_cnt(0),
+  _data(NEW_C_HEAP_ARRAY(JavaThread*, capacity + 1, mtThread))
+{
+  _data[capacity] = NULL;  // Make sure the extra entry is NULL.
+}
+
+ThreadsListArray::~ThreadsListArray() {
+  FREE_C_HEAP_ARRAY(JavaThread*, _data);
+}
+
+// Capacity of a newly allocated array for a ThreadsList of the given
+// length. Doubling makes the cost of copying amortized O(1) per
+// add_thread() call.
+static uint threads_list_capacity(uint length) {
+  return MAX2(2 * length, 8u);
+}
+
 ThreadsList::ThreadsList(int entries) :
-  _length(entries),
+  ThreadsList(new ThreadsListArray(entries), entries) {
+}
+
+ThreadsList::ThreadsList(ThreadsListArray* array, uint length) :
+  _length(length),
   _next_list(NULL),
-  _threads(NEW_C_HEAP_ARRAY(JavaThread*, entries + 1, mtThread)),
+  _array(array),
+  _threads(array->_data),
   _nested_handle_cnt(0)
 {
-  *(JavaThread**)(_threads + entries) = NULL;  // Make sure the extra entry is NULL.
+  assert(length <= array->_capacity, "sanity");
+  array->_ref_cnt++;
+  array->_used = length;
 }
 
 ThreadsList::~ThreadsList() {
-  FREE_C_HEAP_ARRAY(JavaThread*, _threads);
+  assert(_array->_ref_cnt > 0, "sanity");
+  if (--_array->_ref_cnt == 0) {
+    delete _array;
+  }
 }
 
-// Add a JavaThread to a ThreadsList. The returned ThreadsList is a
-// new copy of the specified ThreadsList with the specified JavaThread
-// appended to the end.
+// Add a JavaThread to a ThreadsList. The returned ThreadsList is the
+// specified ThreadsList with the specified JavaThread appended to the end.
+// It shares the array of the specified ThreadsList if the JavaThread can
+// be appended in place, and uses a new copy of it otherwise.
 ThreadsList *ThreadsList::add_thread(ThreadsList *list, JavaThread *java_thread) {
   const uint index = list->_length;
   const uint new_length = index + 1;
-  const uint head_length = index;
-  ThreadsList *const new_list = new ThreadsList(new_length);
-
-  if (head_length > 0) {
-    Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)new_list->_threads, head_length);
+  ThreadsListArray* array = list->_array;
+
+  // Only the newest list of an array can be extended in place, since
+  // the elements past its end are still unused.
+  if (array->_used != index || new_length > array->_capacity) {
+    array = new ThreadsListArray(threads_list_capacity(new_length));
+    if (index > 0) {
+      Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)array->_data, index);
+    }
   }
-  *(JavaThread**)(new_list->_threads + index) = java_thread;
+  array->_data[index] = java_thread;
 
-  return new_list;
+  return new ThreadsList(array, new_length);
 }
 
 void ThreadsList::dec_nested_handle_cnt() {
@@ -674,16 +715,16 @@ ThreadsList *ThreadsList::remove_thread(ThreadsList* list, JavaThread* java_thre
   const uint new_length = list->_length - 1;
   const uint head_length = index;
   const uint tail_length = (new_length >= index) ? (new_length - index) : 0;
-  ThreadsList *const new_list = new ThreadsList(new_length);
+  ThreadsListArray* const array = new ThreadsListArray(threads_list_capacity(new_length));
 
   if (head_length > 0) {
-    Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)new_list->_threads, head_length);
+    Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)array->_data, head_length);
   }
   if (tail_length > 0) {
-    Copy::disjoint_words((HeapWord*)list->_threads + index + 1, (HeapWord*)new_list->_threads + index, tail_length);
+    Copy::disjoint_words((HeapWord*)list->_threads + index + 1, (HeapWord*)array->_data + index, tail_length);
   }
 
-  return new_list;
+  return new ThreadsList(array, new_length);
 }
 
 ThreadsListHandle::ThreadsListHandle(Thread *self) : _list_ptr(self, /* acquire */ true) {
@@ -754,15 +795,19 @@ bool ThreadsListHandle::cv_internal_thread_to_JavaThread(jobject jthread,
 }
 
 void ThreadsSMRSupport::add_thread(JavaThread *thread){
-  ThreadsList *new_list = ThreadsList::add_thread(get_java_thread_list(), thread);
+  ThreadsList *old_list = get_java_thread_list();
+  ThreadsList *new_list = ThreadsList::add_thread(old_list, thread);
   if (EnableThreadSMRStatistics) {
     inc_java_thread_list_alloc_cnt();
+    if (new_list->_array != old_list->_array) {
+      _java_thread_list_array_alloc_cnt++;
+    }
     update_java_thread_list_max(new_list->length());
   }
   // Initial _java_thread_list will not generate a "Threads::add" mesg.
   log_debug(thread, smr)("tid=" UINTX_FORMAT ": Threads::add: new ThreadsList=" INTPTR_FORMAT, os::current_thread_id(), p2i(new_list));
 
-  ThreadsList *old_list = xchg_java_thread_list(new_list);
+  xchg_java_thread_list(new_list);
   free_list(old_list);
   if (ThreadIdTable::is_initialized()) {
     jlong tid = SharedRuntime::get_java_tid(thread);
@@ -932,6 +977,7 @@ void ThreadsSMRSupport::remove_thread(JavaThread *thread) {
   ThreadsList *new_list = ThreadsList::remove_thread(ThreadsSMRSupport::get_java_thread_list(), thread);
   if (EnableThreadSMRStatistics) {
     ThreadsSMRSupport::inc_java_thread_list_alloc_cnt();
+    ThreadsSMRSupport::_java_thread_list_array_alloc_cnt++;
     // This list is smaller so no need to check for a "longest" update.
   }
 
@@ -1128,10 +1174,12 @@ void ThreadsSMRSupport::print_info_on(outputStream* st) {
     return;
   }
   st->print_cr("_java_thread_list_alloc_cnt=" UINT64_FORMAT ", "
+               "_java_thread_list_array_alloc_cnt=" UINT64_FORMAT ", "
                "_java_thread_list_free_cnt=" UINT64_FORMAT ", "
                "_java_thread_list_max=%u, "
                "_nested_thread_list_max=%u",
                _java_thread_list_alloc_cnt,
+               _java_thread_list_array_alloc_cnt,
                _java_thread_list_free_cnt,
                _java_thread_list_max,
                _nested_thread_list_max);
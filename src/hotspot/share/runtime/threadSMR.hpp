@@ -111,6 +111,7 @@ class ThreadsSMRSupport : AllStatic {
   static ThreadsList           _bootstrap_list;
   static ThreadsList* volatile _java_thread_list;
   static uint64_t              _java_thread_list_alloc_cnt;
+  static uint64_t              _java_thread_list_array_alloc_cnt;
   static uint64_t              _java_thread_list_free_cnt;
   static uint                  _java_thread_list_max;
   static uint                  _nested_thread_list_max;
@@ -159,18 +160,42 @@ class ThreadsSMRSupport : AllStatic {
   static void print_info_on(const Thread* thread, outputStream* st);
 };
 
+// The JavaThread* array behind one or more ThreadsLists. A ThreadsList
+// only reads the first length() elements of its array, and those are
+// never written again once the list is published. So when the array has
+// spare capacity, ThreadsList::add_thread() appends in place and shares
+// it with the list it extends, instead of copying it. The array is freed
+// together with the last ThreadsList that refers to it. ThreadsLists are
+// only created and freed with the Threads_lock held, so that is what
+// protects _used and _ref_cnt.
+//
+class ThreadsListArray : public CHeapObj<mtThread> {
+  friend class ThreadsList;
+
+  const uint _capacity;
+  uint _used;     // # of elements written so far
+  uint _ref_cnt;  // # of ThreadsLists referring to this array
+  JavaThread** const _data;
+
+  ThreadsListArray(uint capacity);
+  ~ThreadsListArray();
+};
+
 // A fast list of JavaThreads.
 //
 class ThreadsList : public CHeapObj<mtThread> {
   friend class VMStructs;
   friend class SafeThreadsListPtr;  // for {dec,inc}_nested_handle_cnt() access
-  friend class ThreadsSMRSupport;  // for _nested_handle_cnt, {add,remove}_thread(), {,set_}next_list() access
+  friend class ThreadsSMRSupport;  // for _nested_handle_cnt, _array, {add,remove}_thread(), {,set_}next_list() access
 
   const uint _length;
   ThreadsList* _next_list;
+  ThreadsListArray* const _array;
   JavaThread *const *const _threads;
   volatile intx _nested_handle_cnt;
 
+  ThreadsList(ThreadsListArray* array, uint length);
+
   template <class T>
   void threads_do_dispatch(T *cl, JavaThread *const thread) const;
 
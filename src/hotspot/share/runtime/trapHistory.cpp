@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/methodData.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/deoptimization.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/trapHistory.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+#if COMPILER2_OR_JVMCI
+
+// File format, one record per line:
+//
+//   method <holder> <name> <signature> <code size>
+//   trap <reason> <count>      trap count of the preceding method
+//   bci <bci> <reason>         reason recorded at a bci of that method
+//
+// Reasons are stored by name so that the file stays meaningful when the
+// DeoptReason enumeration changes.  A method whose code size differs from
+// the recorded one has been changed and its history is ignored.
+
+class TrapHistoryKey {
+ public:
+  Symbol* _holder;
+  Symbol* _name;
+  Symbol* _signature;
+
+  TrapHistoryKey(Symbol* holder, Symbol* name, Symbol* signature) :
+    _holder(holder), _name(name), _signature(signature) {}
+
+  static unsigned hash(const TrapHistoryKey& k) {
+    return k._holder->identity_hash() ^
+           (31 * k._name->identity_hash()) ^
+           (961 * k._signature->identity_hash());
+  }
+
+  static bool equals(const TrapHistoryKey& a, const TrapHistoryKey& b) {
+    return a._holder == b._holder && a._name == b._name && a._signature == b._signature;
+  }
+};
+
+class TrapHistoryEntry : public CHeapObj<mtCompiler> {
+ public:
+  struct BciReason {
+    int _bci;
+    int _reason;
+  };
+
+  int _code_size;
+  u1  _trap_count[Deoptimization::Reason_LIMIT];
+  GrowableArrayCHeap<BciReason, mtCompiler> _bci_reasons;
+
+  TrapHistoryEntry(int code_size) : _code_size(code_size), _bci_reasons(4) {
+    memset(_trap_count, 0, sizeof(_trap_count));
+  }
+};
+
+typedef ResourceHashtable<TrapHistoryKey, TrapHistoryEntry*,
+                          TrapHistoryKey::hash, TrapHistoryKey::equals,
+                          1009, ResourceObj::C_HEAP, mtCompiler> TrapHistoryTable;
+
+static TrapHistoryTable* _table = NULL;
+static outputStream* _out = NULL;
+
+static int reason_from_name(const char* name) {
+  for (int reason = 0; reason < Deoptimization::Reason_LIMIT; reason++) {
+    if (strcmp(Deoptimization::trap_reason_name(reason), name) == 0) {
+      return reason;
+    }
+  }
+  if (strcmp(Deoptimization::trap_reason_name(Deoptimization::Reason_many), name) == 0) {
+    return Deoptimization::Reason_many;
+  }
+  return -1;
+}
+
+bool TrapHistory::is_enabled() {
+  return TrapHistoryFile != NULL;
+}
+
+static uint recorded_reason_limit() {
+  return MIN2((uint)Deoptimization::Reason_LIMIT, MethodData::trap_reason_limit());
+}
+
+void TrapHistory::load() {
+  if (!is_enabled()) {
+    return;
+  }
+  fileStream in(TrapHistoryFile, "r");
+  if (!in.is_open()) {
+    // No history yet; it is written when this VM exits.
+    return;
+  }
+
+  _table = new (ResourceObj::C_HEAP, mtCompiler) TrapHistoryTable();
+
+  const int max_name = 1024;
+  char line[3 * max_name + 64];
+  char holder[max_name];
+  char name[max_name];
+  char signature[max_name];
+  char reason_name[64];
+  TrapHistoryEntry* entry = NULL;
+  int methods = 0;
+
+  while (in.readln(line, sizeof(line)) != NULL) {
+    int code_size, count, bci;
+    if (sscanf(line, "method %1023s %1023s %1023s %d", holder, name, signature, &code_size) == 4) {
+      TrapHistoryKey key(SymbolTable::new_symbol(holder),
+                         SymbolTable::new_symbol(name),
+                         SymbolTable::new_symbol(signature));
+      entry = new TrapHistoryEntry(code_size);
+      if (_table->put(key, entry)) {
+        methods++;
+      } else {
+        // Duplicate record; keep the first one.
+        delete entry;
+        entry = NULL;
+      }
+    } else if (entry != NULL && sscanf(line, "trap %63s %d", reason_name, &count) == 2) {
+      int reason = reason_from_name(reason_name);
+      if (reason >= 0 && (uint)reason < recorded_reason_limit() && count > 0) {
+        entry->_trap_count[reason] = (u1)MIN2((uint)count, MethodData::trap_count_limit());
+      }
+    } else if (entry != NULL && sscanf(line, "bci %d %63s", &bci, reason_name) == 2) {
+      int reason = reason_from_name(reason_name);
+      if (bci >= 0 && bci < entry->_code_size &&
+          (reason == Deoptimization::Reason_many ||
+           (reason >= 0 && Deoptimization::reason_is_recorded_per_bytecode((Deoptimization::DeoptReason)reason)))) {
+        TrapHistoryEntry::BciReason br = { bci, reason };
+        entry->_bci_reasons.append(br);
+      }
+    }
+  }
+
+  log_info(jit)("Loaded trap history for %d methods from %s", methods, TrapHistoryFile);
+}
+
+static void dump_method_header(Method* m, bool& printed) {
+  if (!printed) {
+    _out->print_cr("method %s %s %s %d", m->klass_name()->as_C_string(),
+                   m->name()->as_C_string(), m->signature()->as_C_string(), m->code_size());
+    printed = true;
+  }
+}
+
+static void dump_bci(Method* m, bool& printed, int bci, int trap_state) {
+  int reason = Deoptimization::trap_state_reason(trap_state);
+  if (reason == Deoptimization::Reason_none) {
+    return;
+  }
+  dump_method_header(m, printed);
+  _out->print_cr("bci %d %s", bci, Deoptimization::trap_reason_name(reason));
+}
+
+static void dump_method(Method* m) {
+  MethodData* mdo = m->method_data();
+  if (mdo == NULL || m->method_holder()->is_hidden()) {
+    return;
+  }
+  ResourceMark rm;
+  bool printed = false;
+
+  for (uint reason = 0; reason < recorded_reason_limit(); reason++) {
+    uint count = mdo->trap_count(reason);
+    if (count == 0) {
+      continue;
+    }
+    if (count == (uint)-1) {
+      // The counter overflowed.
+      count = MethodData::trap_count_limit();
+    }
+    dump_method_header(m, printed);
+    _out->print_cr("trap %s %u", Deoptimization::trap_reason_name(reason), count);
+  }
+
+  for (ProfileData* data = mdo->first_data(); mdo->is_valid(data); data = mdo->next_data(data)) {
+    dump_bci(m, printed, data->bci(), data->trap_state());
+  }
+
+  // Speculative trap entries name a particular inlinee Method* and are
+  // not carried over.
+  DataLayout* end = mdo->args_data_limit();
+  for (DataLayout* dp = mdo->extra_data_base(); dp < end; dp = MethodData::next_extra(dp)) {
+    u1 tag = dp->tag();
+    if (tag == DataLayout::no_tag || tag == DataLayout::arg_info_data_tag) {
+      break;
+    }
+    if (tag == DataLayout::bit_data_tag) {
+      dump_bci(m, printed, dp->bci(), dp->trap_state());
+    }
+  }
+}
+
+void TrapHistory::dump() {
+  if (!is_enabled()) {
+    return;
+  }
+  fileStream out(TrapHistoryFile, "w");
+  if (!out.is_open()) {
+    warning("Cannot open trap history file %s", TrapHistoryFile);
+    return;
+  }
+  _out = &out;
+  SystemDictionary::methods_do(dump_method);
+  _out = NULL;
+}
+
+void TrapHistory::apply(MethodData* mdo) {
+  if (_table == NULL) {
+    return;
+  }
+  Method* m = mdo->method();
+  TrapHistoryKey key(m->klass_name(), m->name(), m->signature());
+  TrapHistoryEntry** found = _table->get(key);
+  if (found == NULL || (*found)->_code_size != m->code_size()) {
+    return;
+  }
+  TrapHistoryEntry* entry = *found;
+  ResourceMark rm;
+
+  for (uint reason = 0; reason < recorded_reason_limit(); reason++) {
+    for (uint i = 0; i < entry->_trap_count[reason]; i++) {
+      mdo->inc_trap_count(reason);
+    }
+  }
+
+  for (int i = 0; i < entry->_bci_reasons.length(); i++) {
+    const TrapHistoryEntry::BciReason& br = entry->_bci_reasons.at(i);
+    ProfileData* data = mdo->allocate_bci_to_data(br._bci, NULL);
+    if (data == NULL) {
+      // Out of extra data entries.
+      break;
+    }
+    data->set_trap_state(Deoptimization::trap_state_add_reason(data->trap_state(), br._reason));
+  }
+}
+
+#else // COMPILER2_OR_JVMCI
+
+bool TrapHistory::is_enabled() { return false; }
+void TrapHistory::load() {}
+void TrapHistory::dump() {}
+void TrapHistory::apply(MethodData* mdo) {}
+
+#endif // COMPILER2_OR_JVMCI
+
+void trapHistory_init() {
+  TrapHistory::load();
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_TRAPHISTORY_HPP
+#define SHARE_RUNTIME_TRAPHISTORY_HPP
+
+#include "memory/allocation.hpp"
+
+class Method;
+class MethodData;
+
+// TrapHistory carries the uncommon trap history recorded in MethodData
+// objects from one run of the VM to the next.  With -XX:TrapHistoryFile,
+// the per-method trap counts and the per-bci trap reasons are written to
+// the file when the VM exits and read back when it starts.  A MethodData
+// created for a method that has a history is seeded with it, so the
+// first C2 compilation already knows which speculations failed before
+// and does not have to rediscover them through deoptimization.
+
+class TrapHistory : AllStatic {
+ public:
+  // Read the history file, if any.  Called once during VM startup.
+  static void load();
+
+  // Write the history of all profiled methods to the history file.
+  static void dump();
+
+  // Seed a freshly allocated MethodData with the recorded history.
+  static void apply(MethodData* mdo);
+
+  static bool is_enabled();
+};
+
+#endif // SHARE_RUNTIME_TRAPHISTORY_HPP
@@ -29,6 +29,7 @@
 #include "compiler/compileBroker.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "logging/logConfiguration.hpp"
@@ -37,8 +38,10 @@
 #include "memory/universe.hpp"
 #include "oops/symbol.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
+#include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
@@ -282,6 +285,8 @@ void VM_ThreadDump::doit() {
     concurrent_locks.dump_at_safepoint();
   }
 
+  GrowableArray<ThreadSnapshot*> snapshots(_num_threads == 0 ? _result->t_list()->length() : _num_threads);
+
   if (_num_threads == 0) {
     // Snapshot all live threads
 
@@ -296,7 +301,7 @@ void VM_ThreadDump::doit() {
       if (_with_locked_synchronizers) {
         tcl = concurrent_locks.thread_concurrent_locks(jt);
       }
-      snapshot_thread(jt, tcl);
+      snapshot_thread(jt, tcl, &snapshots);
     }
   } else {
     // Snapshot threads in the given _threads array
@@ -331,15 +336,67 @@ void VM_ThreadDump::doit() {
       if (_with_locked_synchronizers) {
         tcl = concurrent_locks.thread_concurrent_locks(jt);
       }
-      snapshot_thread(jt, tcl);
+      snapshot_thread(jt, tcl, &snapshots);
     }
   }
+
+  dump_stacks(&snapshots);
+  if (_with_locked_monitors) {
+    _result->add_jni_locked_monitors_at_safepoint();
+  }
 }
 
-void VM_ThreadDump::snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl) {
+void VM_ThreadDump::snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl,
+                                    GrowableArray<ThreadSnapshot*>* snapshots) {
   ThreadSnapshot* snapshot = _result->add_thread_snapshot(java_thread);
-  snapshot->dump_stack_at_safepoint(_max_depth, _with_locked_monitors);
   snapshot->set_concurrent_locks(tcl);
+  snapshots->append(snapshot);
+}
+
+// Walks the stacks of the snapshotted threads. Threads are claimed one
+// at a time so that a few deep stacks do not hold up a single worker.
+class ThreadDumpStacksTask : public AbstractGangTask {
+  GrowableArray<ThreadSnapshot*>* const _snapshots;
+  const int  _max_depth;
+  const bool _with_locked_monitors;
+  volatile int _claimed;
+
+public:
+  ThreadDumpStacksTask(GrowableArray<ThreadSnapshot*>* snapshots, int max_depth, bool with_locked_monitors) :
+    AbstractGangTask("Thread Dump Stacks"),
+    _snapshots(snapshots),
+    _max_depth(max_depth),
+    _with_locked_monitors(with_locked_monitors),
+    _claimed(0) {}
+
+  void work(uint worker_id) {
+    Thread* thread = Thread::current();
+    for (int i = Atomic::fetch_and_add(&_claimed, 1);
+         i < _snapshots->length();
+         i = Atomic::fetch_and_add(&_claimed, 1)) {
+      ResourceMark rm(thread);
+      HandleMark hm(thread);
+      // JNI locked monitors are collected for all threads in one pass afterwards.
+      _snapshots->at(i)->dump_stack_at_safepoint(_max_depth, _with_locked_monitors,
+                                                 false /* scan_inflated_monitors */);
+    }
+  }
+};
+
+// Below this many threads the stacks are walked by the VM thread alone.
+static const int ParallelThreadDumpThreshold = 64;
+
+void VM_ThreadDump::dump_stacks(GrowableArray<ThreadSnapshot*>* snapshots) {
+  ThreadDumpStacksTask task(snapshots, _max_depth, _with_locked_monitors);
+
+  WorkGang* workers = Universe::heap()->safepoint_workers();
+  if (workers != NULL && snapshots->length() >= ParallelThreadDumpThreshold) {
+    uint n_workers = MIN2(workers->active_workers(),
+                          (uint)(snapshots->length() / ParallelThreadDumpThreshold));
+    workers->run_task(&task, MAX2(n_workers, 1u));
+  } else {
+    task.work(0);
+  }
 }
 
 volatile bool VM_Exit::_vm_exited = false;
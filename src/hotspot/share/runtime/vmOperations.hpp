@@ -92,6 +92,7 @@
   template(ShenandoahInitUpdateRefs)              \
   template(ShenandoahFinalUpdateRefs)             \
   template(ShenandoahDegeneratedGC)               \
+  template(EpsilonCollect)                        \
   template(Exit)                                  \
   template(LinuxDllLoad)                          \
   template(RotateGCLog)                           \
@@ -121,12 +122,17 @@ class VM_Operation : public StackObj {
 
  private:
   Thread*         _calling_thread;
+  jlong           _request_time;      // When the calling thread asked for execution (nanos)
+  VM_Operation*   _next_batched;      // Link in the VM thread's list of batched operations
+  volatile bool   _batched_done;      // Set by the VM thread once a batched operation completed
 
   // The VM operation name array
   static const char* _names[];
 
+  friend class VMThread;
+
  public:
-  VM_Operation() : _calling_thread(NULL) {}
+  VM_Operation() : _calling_thread(NULL), _request_time(0), _next_batched(NULL), _batched_done(false) {}
 
   // VM operation support (used by VM thread)
   Thread* calling_thread() const                 { return _calling_thread; }
@@ -158,6 +164,12 @@ class VM_Operation : public StackObj {
   // or concurrently with Java threads running.
   virtual bool evaluate_at_safepoint() const { return true; }
 
+  // Override to return true for read-only safepoint operations that may be
+  // evaluated together with other batchable operations in one safepoint,
+  // instead of each needing a safepoint of its own. Such an operation must
+  // not depend on being the operation that started the safepoint.
+  virtual bool is_batchable() const { return false; }
+
   // Debugging
   virtual void print_on_error(outputStream* st) const;
   virtual const char* name() const  { return _names[type()]; }
@@ -344,6 +356,7 @@ class VM_FindDeadlocks: public VM_Operation {
 
   DeadlockCycle* result()      { return _deadlocks; };
   VMOp_Type type() const       { return VMOp_FindDeadlocks; }
+  bool is_batchable() const    { return true; }
   void doit();
 };
 
@@ -360,7 +373,9 @@ class VM_ThreadDump : public VM_Operation {
   bool                           _with_locked_monitors;
   bool                           _with_locked_synchronizers;
 
-  void snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl);
+  void snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl,
+                       GrowableArray<ThreadSnapshot*>* snapshots);
+  void dump_stacks(GrowableArray<ThreadSnapshot*>* snapshots);
 
  public:
   VM_ThreadDump(ThreadDumpResult* result,
@@ -376,6 +391,7 @@ class VM_ThreadDump : public VM_Operation {
                 bool with_locked_synchronizers);
 
   VMOp_Type type() const { return VMOp_ThreadDump; }
+  bool is_batchable() const { return true; }
   void doit();
   bool doit_prologue();
   void doit_epilogue();
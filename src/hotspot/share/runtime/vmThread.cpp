@@ -81,6 +81,7 @@ void VMOperationTimeoutTask::disarm() {
 
 static VM_None    safepointALot_op("SafepointALot");
 static VM_Cleanup cleanup_op;
+static VM_None    batched_op("Batched operations");
 
 bool              VMThread::_should_terminate   = false;
 bool              VMThread::_terminated         = false;
@@ -88,6 +89,10 @@ Monitor*          VMThread::_terminate_lock     = NULL;
 VMThread*         VMThread::_vm_thread          = NULL;
 VM_Operation*     VMThread::_cur_vm_operation   = NULL;
 VM_Operation*     VMThread::_next_vm_operation  = &cleanup_op; // Prevent any thread from setting an operation until VM thread is ready.
+VM_Operation*     VMThread::_batched_operations = NULL;
+uint              VMThread::_queue_wait_count[VM_Operation::VMOp_Terminating] = { 0 };
+jlong             VMThread::_queue_wait_total[VM_Operation::VMOp_Terminating] = { 0 };
+jlong             VMThread::_queue_wait_max[VM_Operation::VMOp_Terminating]   = { 0 };
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = NULL;
 VMOperationTimeoutTask* VMThread::_timeout_task = NULL;
 
@@ -158,6 +163,11 @@ void VMThread::run() {
   // Wait for VM_Operations until termination
   this->loop();
 
+  if (log_is_enabled(Info, vmthread)) {
+    LogStream ls(Log(vmthread)::info());
+    print_queue_wait_statistics(&ls);
+  }
+
   // Note the intention to exit before safepointing.
   // 6295565  This has the effect of waiting for any large tty
   // outputs to finish.
@@ -337,11 +347,20 @@ bool VMThread::set_next_operation(VM_Operation *op) {
   return true;
 }
 
+void VMThread::add_batched_operation(VM_Operation* op) {
+  assert_lock_strong(VMOperation_lock);
+  assert(op->is_batchable() && op->evaluate_at_safepoint(), "must be a batchable safepoint operation");
+  log_debug(vmthread)("Batching VM operation: %s", op->name());
+  op->_next_batched = _batched_operations;
+  _batched_operations = op;
+}
+
 void VMThread::wait_until_executed(VM_Operation* op) {
   MonitorLocker ml(VMOperation_lock,
                    Thread::current()->is_Java_thread() ?
                      Mutex::_safepoint_check_flag :
                      Mutex::_no_safepoint_check_flag);
+  bool batched = false;
   {
     TraceTime timer("Installing VM operation", TRACETIME_LOG(Trace, vmthread));
     while (true) {
@@ -349,6 +368,14 @@ void VMThread::wait_until_executed(VM_Operation* op) {
         ml.notify_all();
         break;
       }
+      if (op->is_batchable()) {
+        // Rather than waiting for the slot, join the batch that is
+        // evaluated together in the next suitable safepoint.
+        add_batched_operation(op);
+        ml.notify_all();
+        batched = true;
+        break;
+      }
       // Wait to install this operation as the next operation in the VM Thread
       log_trace(vmthread)("A VM operation already set, waiting");
       ml.wait();
@@ -357,15 +384,93 @@ void VMThread::wait_until_executed(VM_Operation* op) {
   {
     // Wait until the operation has been processed
     TraceTime timer("Waiting for VM operation to be completed", TRACETIME_LOG(Trace, vmthread));
-    // _next_vm_operation is cleared holding VMOperation_lock after it has been
-    // executed. We wait until _next_vm_operation is not our op.
-    while (_next_vm_operation == op) {
-      // VM Thread can process it once we unlock the mutex on wait.
-      ml.wait();
+    if (batched) {
+      // The VM thread sets _batched_done holding VMOperation_lock after
+      // the operation has been executed.
+      while (!op->_batched_done) {
+        ml.wait();
+      }
+    } else {
+      // _next_vm_operation is cleared holding VMOperation_lock after it has been
+      // executed. We wait until _next_vm_operation is not our op.
+      while (_next_vm_operation == op) {
+        // VM Thread can process it once we unlock the mutex on wait.
+        ml.wait();
+      }
     }
   }
 }
 
+void VMThread::evaluate_batched_operations() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  VM_Operation* const primary = _cur_vm_operation;
+  while (true) {
+    VM_Operation* list;
+    {
+      MutexLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+      list = _batched_operations;
+      _batched_operations = NULL;
+    }
+    if (list == NULL) {
+      break;
+    }
+    // Operations were pushed in LIFO order, evaluate them in request order.
+    VM_Operation* ordered = NULL;
+    while (list != NULL) {
+      VM_Operation* next = list->_next_batched;
+      list->_next_batched = ordered;
+      ordered = list;
+      list = next;
+    }
+    while (ordered != NULL) {
+      VM_Operation* op = ordered;
+      ordered = op->_next_batched;
+      op->_next_batched = NULL;
+
+      _cur_vm_operation = op;
+      EventMark em("Executing batched VM operation: %s", op->name());
+      log_debug(vmthread)("Evaluating batched safepoint VM operation: %s", op->name());
+      record_queue_wait(op);
+      evaluate_operation(op);
+      _cur_vm_operation = primary;
+
+      // The requesting thread may free op as soon as it sees it done.
+      MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+      op->_batched_done = true;
+      ml.notify_all();
+    }
+  }
+}
+
+void VMThread::record_queue_wait(VM_Operation* op) {
+  if (op->_request_time == 0) {
+    // Not requested through VMThread::execute from another thread.
+    return;
+  }
+  jlong wait = os::javaTimeNanos() - op->_request_time;
+  op->_request_time = 0;
+  int type = op->type();
+  _queue_wait_count[type]++;
+  _queue_wait_total[type] += wait;
+  _queue_wait_max[type] = MAX2(_queue_wait_max[type], wait);
+  log_debug(vmthread)("VM operation %s waited %.3f ms to start",
+                      op->name(), (double)wait / NANOSECS_PER_MILLISEC);
+}
+
+void VMThread::print_queue_wait_statistics(outputStream* st) {
+  st->print_cr("VM operation queue wait times:");
+  for (int type = 0; type < VM_Operation::VMOp_Terminating; type++) {
+    uint count = _queue_wait_count[type];
+    if (count == 0) {
+      continue;
+    }
+    st->print_cr("  %-40s %8u ops, avg %9.3f ms, max %9.3f ms",
+                 VM_Operation::name(type), count,
+                 (double)_queue_wait_total[type] / count / NANOSECS_PER_MILLISEC,
+                 (double)_queue_wait_max[type] / NANOSECS_PER_MILLISEC);
+  }
+}
+
 static void self_destruct_if_needed() {
   // Support for self destruction
   if ((SelfDestructTimer != 0) && !VMError::is_error_reported() &&
@@ -392,6 +497,9 @@ void VMThread::inner_execute(VM_Operation* op) {
   }
 
   _cur_vm_operation = op;
+  if (prev_vm_operation == NULL) {
+    record_queue_wait(op);
+  }
 
   HandleMark hm(VMThread::vm_thread());
   EventMark em("Executing %s VM operation: %s", prev_vm_operation != NULL ? "nested" : "", op->name());
@@ -413,6 +521,13 @@ void VMThread::inner_execute(VM_Operation* op) {
 
   evaluate_operation(_cur_vm_operation);
 
+  // Only fold batched operations into safepoints that exist for batchable
+  // operations, so they never observe a safepoint set up by another kind
+  // of operation (e.g. one skipping thread oop barriers, or a GC).
+  if (end_safepoint && (op == &batched_op || op->is_batchable())) {
+    evaluate_batched_operations();
+  }
+
   if (end_safepoint) {
     if (_timeout_task != NULL) {
       _timeout_task->disarm();
@@ -438,6 +553,12 @@ void VMThread::wait_for_operation() {
     if (_next_vm_operation != NULL) {
       return;
     }
+    if (_batched_operations != NULL) {
+      // Operations batched behind an operation that did not pick them up
+      // get a safepoint of their own.
+      _next_vm_operation = &batched_op;
+      return;
+    }
     if (handshake_alot()) {
       {
         MutexUnlocker mul(VMOperation_lock);
@@ -472,6 +593,7 @@ void VMThread::loop() {
   // via the normal way.
   cleanup_op.set_calling_thread(_vm_thread);
   safepointALot_op.set_calling_thread(_vm_thread);
+  batched_op.set_calling_thread(_vm_thread);
 
   while (true) {
     if (should_terminate()) break;
@@ -528,6 +650,7 @@ void VMThread::execute(VM_Operation* op) {
   }
 
   op->set_calling_thread(t);
+  op->_request_time = os::javaTimeNanos();
 
   wait_until_executed(op);
 
@@ -74,6 +74,14 @@ class VMThread: public NamedThread {
   void inner_execute(VM_Operation* op);
   void wait_for_operation();
 
+  // Batching of read-only safepoint operations, see VM_Operation::is_batchable().
+  static void add_batched_operation(VM_Operation* op);
+  void evaluate_batched_operations();
+
+  // Time from the request of an operation until the VM thread starts it.
+  static void record_queue_wait(VM_Operation* op);
+  static void print_queue_wait_statistics(outputStream* st);
+
  public:
   // Constructor
   VMThread();
@@ -133,6 +141,12 @@ class VMThread: public NamedThread {
   // VM_Operation support
   static VM_Operation*     _cur_vm_operation;   // Current VM operation
   static VM_Operation*     _next_vm_operation;  // Next VM operation
+  static VM_Operation*     _batched_operations; // Batchable operations waiting for a safepoint (VMOperation_lock)
+
+  // Queue wait statistics per operation type, only updated by the VM thread
+  static uint              _queue_wait_count[VM_Operation::VMOp_Terminating];
+  static jlong             _queue_wait_total[VM_Operation::VMOp_Terminating];
+  static jlong             _queue_wait_max[VM_Operation::VMOp_Terminating];
 
   bool set_next_operation(VM_Operation *op);    // Set the _next_vm_operation if possible.
 
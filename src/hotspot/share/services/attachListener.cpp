@@ -212,6 +212,16 @@ static jint jcmd(AttachOperation* op, outputStream* out) {
   return JNI_OK;
 }
 
+// Like jcmd, but the commands (one per line) are all run in this
+// attach session and their results are returned as a JSON object.
+// See DCmd::parse_and_execute_json for the format.
+static jint jcmd_json(AttachOperation* op, outputStream* out) {
+  Thread* THREAD = Thread::current();
+  DCmd::parse_and_execute_json(DCmd_Source_AttachAPI, out, op->arg(0), ' ', THREAD);
+  assert(!HAS_PENDING_EXCEPTION, "each command's exception is reported in its result");
+  return JNI_OK;
+}
+
 // Implementation of "dumpheap" command.
 // See also: HeapDumpDCmd class
 //
@@ -350,6 +360,7 @@ static AttachOperationFunctionInfo funcs[] = {
   { "setflag",          set_flag },
   { "printflag",        print_flag },
   { "jcmd",             jcmd },
+  { "jcmdjson",         jcmd_json },
   { NULL,               NULL }
 };
 
@@ -357,6 +357,7 @@ public:
 class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
+  DCmdArgument<jlong> _parallel_thread_num;
 public:
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -891,4 +892,28 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class MutexStatsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _histogram;
+public:
+  MutexStatsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "VM.mutex_stats";
+  }
+  static const char* description() {
+    return "Print acquire wait and hold times of VM Mutexes and Monitors. "
+           "Requires -XX:+RecordMutexStatistics.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #endif // SHARE_SERVICES_DIAGNOSTICCOMMAND_HPP
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "classfile/javaClasses.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
@@ -412,6 +413,73 @@ void DCmd::parse_and_execute(DCmdSource source, outputStream* out,
   }
 }
 
+static void print_json_string(outputStream* out, const char* s, size_t len) {
+  out->print_raw("\"");
+  for (size_t i = 0; i < len; i++) {
+    char c = s[i];
+    switch (c) {
+      case '"':  out->print_raw("\\\""); break;
+      case '\\': out->print_raw("\\\\"); break;
+      case '\n': out->print_raw("\\n");  break;
+      case '\r': out->print_raw("\\r");  break;
+      case '\t': out->print_raw("\\t");  break;
+      default:
+        if ((unsigned char)c < 0x20) {
+          out->print("\\u%04x", (unsigned char)c);
+        } else {
+          out->put(c);
+        }
+    }
+  }
+  out->print_raw("\"");
+}
+
+void DCmd::parse_and_execute_json(DCmdSource source, outputStream* out,
+                                  const char* cmdline, char delim, TRAPS) {
+  assert(source != DCmd_Source_MBean, "JMX invokes one command at a time");
+
+  out->print_raw("{\"results\":[");
+  if (cmdline != NULL) {
+    DCmdIter iter(cmdline, '\n');
+    int count = 0;
+    while (iter.has_next()) {
+      CmdLine line = iter.next();
+      if (line.is_stop()) {
+        break;
+      }
+      if (!line.is_executable()) {
+        continue;
+      }
+      ResourceMark rm(THREAD);
+      bufferedStream result;
+      {
+        DCmd* command = DCmdFactory::create_local_DCmd(source, line, &result, THREAD);
+        if (!HAS_PENDING_EXCEPTION) {
+          assert(command != NULL, "command error must be handled before this line");
+          DCmdMark mark(command);
+          command->parse(&line, delim, THREAD);
+          if (!HAS_PENDING_EXCEPTION) {
+            command->execute(source, THREAD);
+          }
+        }
+      }
+      bool failed = HAS_PENDING_EXCEPTION;
+      if (failed) {
+        java_lang_Throwable::print(PENDING_EXCEPTION, &result);
+        CLEAR_PENDING_EXCEPTION;
+      }
+      out->print_raw(count > 0 ? ",{\"command\":" : "{\"command\":");
+      print_json_string(out, line.cmd_addr(), line.cmd_len());
+      out->print_raw(failed ? ",\"status\":\"error\"" : ",\"status\":\"ok\"");
+      out->print_raw(",\"output\":");
+      print_json_string(out, result.base(), result.size());
+      out->print_raw("}");
+      count++;
+    }
+  }
+  out->print_raw_cr("]}");
+}
+
 void DCmdWithParser::parse(CmdLine* line, char delim, TRAPS) {
   _dcmdparser.parse(line, delim, CHECK);
 }
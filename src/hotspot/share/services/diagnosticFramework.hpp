@@ -305,6 +305,11 @@ public:
   // main method to invoke the framework
   static void parse_and_execute(DCmdSource source, outputStream* out, const char* cmdline,
                                 char delim, TRAPS);
+  // Like parse_and_execute, but runs every command of a batch even if an
+  // earlier one fails, and prints the results as a JSON object:
+  //   {"results":[{"command":"...","status":"ok"|"error","output":"..."},...]}
+  static void parse_and_execute_json(DCmdSource source, outputStream* out, const char* cmdline,
+                                     char delim, TRAPS);
 };
 
 class DCmdWithParser : public DCmd {
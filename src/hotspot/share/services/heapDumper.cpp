@@ -35,6 +35,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/heapShared.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/objArrayKlass.hpp"
@@ -671,7 +672,9 @@ class DumperSupport : AllStatic {
   static void end_of_dump(DumpWriter* writer);
 
   static oop mask_dormant_archived_object(oop o) {
-    if (o != NULL && o->klass()->java_mirror() == NULL) {
+    // Only archived objects can be dormant.  Check the address first so that
+    // dumping a reference doesn't have to load the referenced object's klass.
+    if (o != NULL && HeapShared::is_archived_object(o) && o->klass()->java_mirror() == NULL) {
       // Ignore this object since the corresponding java mirror is not loaded.
       // Might be a dormant archive object.
       return NULL;
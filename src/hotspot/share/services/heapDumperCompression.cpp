@@ -31,10 +31,24 @@
 #include "services/heapDumperCompression.hpp"
 
 
+static bool is_fifo_file(const char* path) {
+  struct stat st;
+  if (os::stat(path, &st) != 0) {
+    return false;
+  }
+  return S_ISFIFO(st.st_mode);
+}
+
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
-  _fd = os::create_binary_file(_path, false);    // don't replace existing file
+  if (is_fifo_file(_path)) {
+    // Stream into an existing named pipe, e.g. one read by a process
+    // that ships the dump off the machine.
+    _fd = os::open(_path, O_WRONLY, 0);
+  } else {
+    _fd = os::create_binary_file(_path, false);  // don't replace existing file
+  }
 
   if (_fd < 0) {
     return os::strerror(errno);
@@ -54,10 +68,16 @@ char const* FileWriter::write_buf(char* buf, ssize_t size) {
   assert(_fd >= 0, "Must be open");
   assert(size > 0, "Must write at least one byte");
 
-  ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
+  // Pipes and sockets can accept fewer bytes than requested.
+  while (size > 0) {
+    ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
 
-  if (n <= 0) {
-    return os::strerror(errno);
+    if (n <= 0) {
+      return os::strerror(errno);
+    }
+
+    buf += n;
+    size -= n;
   }
 
   return NULL;
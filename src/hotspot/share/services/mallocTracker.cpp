@@ -70,7 +70,7 @@ void MallocHeader::release() const {
 
   MallocMemorySummary::record_free(size(), flags());
   MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
-  if (MemTracker::tracking_level() == NMT_detail) {
+  if (MemTracker::tracking_level() == NMT_detail && _bucket_idx != UNSAMPLED_MALLOCSITE_BUCKET) {
     MallocSiteTable::deallocation_at(size(), _bucket_idx, _pos_idx);
   }
 }
@@ -89,6 +89,9 @@ bool MallocHeader::record_malloc_site(const NativeCallStack& stack, size_t size,
 }
 
 bool MallocHeader::get_stack(NativeCallStack& stack) const {
+  if (_bucket_idx == UNSAMPLED_MALLOCSITE_BUCKET) {
+    return false;
+  }
   return MallocSiteTable::access_stack(stack, _bucket_idx, _pos_idx);
 }
 
@@ -29,6 +29,7 @@
 
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/nmtCommon.hpp"
 #include "utilities/nativeCallStack.hpp"
@@ -253,6 +254,8 @@ class MallocHeader {
 #define MAX_MALLOCSITE_TABLE_SIZE  right_n_bits(16)
 #define MAX_BUCKET_LENGTH          right_n_bits(8)
 #endif  // _LP64
+// Bucket index of a detail mode allocation whose call stack was not sampled
+#define UNSAMPLED_MALLOCSITE_BUCKET MAX_MALLOCSITE_TABLE_SIZE
 
  public:
   MallocHeader(size_t size, MEMFLAGS flags, const NativeCallStack& stack, NMT_TrackingLevel level) {
@@ -268,7 +271,10 @@ class MallocHeader {
     if (level == NMT_detail) {
       size_t bucket_idx;
       size_t pos_idx;
-      if (record_malloc_site(stack, size, &bucket_idx, &pos_idx, flags)) {
+      if (stack.is_empty() && NMTDetailSampleInterval > 1) {
+        _bucket_idx = UNSAMPLED_MALLOCSITE_BUCKET;
+        _pos_idx = 0;
+      } else if (record_malloc_site(stack, size, &bucket_idx, &pos_idx, flags)) {
         assert(bucket_idx <= MAX_MALLOCSITE_TABLE_SIZE, "Overflow bucket index");
         assert(pos_idx <= MAX_BUCKET_LENGTH, "Overflow bucket position index");
         _bucket_idx = bucket_idx;
@@ -25,10 +25,13 @@
 
 #include "classfile/classLoaderDataGraph.inline.hpp"
 #include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "services/memBaseline.hpp"
 #include "services/memTracker.hpp"
+#include "utilities/growableArray.hpp"
 
 /*
  * Sizes are sorted in descenting order for reporting
@@ -146,9 +149,63 @@ bool MemBaseline::baseline_summary() {
   MallocMemorySummary::snapshot(&_malloc_memory_snapshot);
   VirtualMemorySummary::snapshot(&_virtual_memory_snapshot);
   MetaspaceSnapshot::snapshot(_metaspace_snapshot);
+  baseline_huge_pages();
   return true;
 }
 
+#ifdef LINUX
+class HugePageMapping {
+ public:
+  address _start;
+  size_t  _huge_bytes;
+};
+
+class HugePageMappingCollector : public os::Linux::HugePageMappingClosure {
+  GrowableArray<HugePageMapping>* _mappings;
+ public:
+  HugePageMappingCollector(GrowableArray<HugePageMapping>* mappings) : _mappings(mappings) { }
+  void do_mapping(address start, address end, size_t huge_bytes) {
+    HugePageMapping m = { start, huge_bytes };
+    _mappings->append(m);
+  }
+};
+
+// A mapping is counted for the reserved region it starts in. Both the
+// regions and the mappings come in address order.
+class HugePageRegionWalker : public VirtualMemoryWalker {
+  GrowableArray<HugePageMapping>* _mappings;
+  int     _pos;
+  size_t* _huge_page_backed;
+ public:
+  HugePageRegionWalker(GrowableArray<HugePageMapping>* mappings, size_t* huge_page_backed) :
+    _mappings(mappings), _pos(0), _huge_page_backed(huge_page_backed) { }
+
+  bool do_allocation_site(const ReservedMemoryRegion* rgn) {
+    while (_pos < _mappings->length() && _mappings->at(_pos)._start < rgn->base()) {
+      _pos++;
+    }
+    while (_pos < _mappings->length() && _mappings->at(_pos)._start < rgn->end()) {
+      _huge_page_backed[NMTUtil::flag_to_index(rgn->flag())] += _mappings->at(_pos)._huge_bytes;
+      _pos++;
+    }
+    return true;
+  }
+};
+#endif // LINUX
+
+void MemBaseline::baseline_huge_pages() {
+  memset(_huge_page_backed, 0, sizeof(_huge_page_backed));
+#ifdef LINUX
+  ResourceMark rm;
+  GrowableArray<HugePageMapping> mappings;
+  HugePageMappingCollector collector(&mappings);
+  if (os::Linux::huge_page_mappings_do(&collector) && mappings.length() > 0) {
+    HugePageRegionWalker walker(&mappings, _huge_page_backed);
+    VirtualMemoryTracker::walk_virtual_memory(&walker);
+  }
+#endif // LINUX
+}
+
 bool MemBaseline::baseline_allocation_sites() {
   // Malloc allocation sites
   MallocAllocationSiteWalker malloc_walker;
@@ -69,6 +69,9 @@ class MemBaseline {
   size_t                 _instance_class_count;
   size_t                 _array_class_count;
 
+  // Bytes of committed virtual memory backed by huge pages, by type
+  size_t                 _huge_page_backed[mt_number_of_types];
+
   // Allocation sites information
   // Malloc allocation sites
   LinkedListImpl<MallocSite>                  _malloc_sites;
@@ -90,6 +93,7 @@ class MemBaseline {
   MemBaseline():
     _instance_class_count(0), _array_class_count(0),
     _baseline_type(Not_baselined) {
+    memset(_huge_page_backed, 0, sizeof(_huge_page_backed));
   }
 
   bool baseline(bool summaryOnly = true);
@@ -157,6 +161,12 @@ class MemBaseline {
     return _virtual_memory_snapshot.by_type(flag);
   }
 
+  // Only tracked on Linux; 0 elsewhere.
+  size_t huge_page_backed(MEMFLAGS flag) const {
+    assert(baseline_type() != Not_baselined, "Not yet baselined");
+    return _huge_page_backed[NMTUtil::flag_to_index(flag)];
+  }
+
 
   size_t class_count() const {
     assert(baseline_type() != Not_baselined, "Not yet baselined");
@@ -184,6 +194,7 @@ class MemBaseline {
     // _malloc_memory_snapshot and _virtual_memory_snapshot are copied over.
     _instance_class_count  = 0;
     _array_class_count = 0;
+    memset(_huge_page_backed, 0, sizeof(_huge_page_backed));
 
     _malloc_sites.clear();
     _virtual_memory_sites.clear();
@@ -194,6 +205,9 @@ class MemBaseline {
   // Baseline summary information
   bool baseline_summary();
 
+  // Attribute huge page backed memory to the reserved regions it lies in
+  void baseline_huge_pages();
+
   // Baseline allocation sites (detail tracking only)
   bool baseline_allocation_sites();
 
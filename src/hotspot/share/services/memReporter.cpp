@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 
 #include "memory/allocation.hpp"
+#include "oops/methodData.hpp"
 #include "services/mallocTracker.hpp"
 #include "services/memReporter.hpp"
 #include "services/threadStackTracker.hpp"
@@ -190,6 +191,12 @@ void MemSummaryReporter::report_summary_of_type(MEMFLAGS flag,
       print_virtual_memory_line(virtual_memory->reserved(), virtual_memory->committed());
     }
 
+    size_t huge_page_backed = _summary_baseline.huge_page_backed(flag);
+    if (amount_in_current_scale(huge_page_backed) > 0) {
+      out->print_cr("%27s (huge pages=" SIZE_FORMAT "%s)", " ",
+        amount_in_current_scale(huge_page_backed), scale);
+    }
+
     if (amount_in_current_scale(malloc_memory->arena_size()) > 0) {
       print_arena_line(malloc_memory->arena_size(), malloc_memory->arena_count());
     }
@@ -234,6 +241,10 @@ void MemSummaryReporter::report_metadata(Metaspace::MetadataType type) const {
   out->print_cr("%27s (    free=" SIZE_FORMAT "%s)", " ", amount_in_current_scale(free), scale);
   out->print_cr("%27s (    waste=" SIZE_FORMAT "%s =%2.2f%%)", " ", amount_in_current_scale(waste),
     scale, ((float)waste * 100)/committed);
+  if (type == Metaspace::NonClassType) {
+    out->print_cr("%27s (    method data=" SIZE_FORMAT "%s #" SIZE_FORMAT ")", " ",
+      amount_in_current_scale(MethodData::total_bytes()), scale, MethodData::total_count());
+  }
 }
 
 void MemDetailReporter::report_detail() {
@@ -245,16 +256,26 @@ void MemDetailReporter::report_detail() {
   report_virtual_memory_allocation_sites();
 }
 
+// Malloc site totals are scaled up when only one in NMTDetailSampleInterval
+// call stacks is captured.
+static size_t extrapolate_sampled(size_t value) {
+  return value * NMTDetailSampleInterval;
+}
+
 void MemDetailReporter::report_malloc_sites() {
   MallocSiteIterator         malloc_itr = _baseline.malloc_sites(MemBaseline::by_size);
   if (malloc_itr.is_empty()) return;
 
   outputStream* out = output();
+  if (NMTDetailSampleInterval > 1) {
+    out->print_cr("Malloc sites are estimated from 1 in " UINTX_FORMAT " sampled allocations\n",
+                  NMTDetailSampleInterval);
+  }
 
   const MallocSite* malloc_site;
   while ((malloc_site = malloc_itr.next()) != NULL) {
     // Don't report if size is too small
-    if (amount_in_current_scale(malloc_site->size()) == 0)
+    if (amount_in_current_scale(extrapolate_sampled(malloc_site->size())) == 0)
       continue;
 
     const NativeCallStack* stack = malloc_site->call_stack();
@@ -263,7 +284,7 @@ void MemDetailReporter::report_malloc_sites() {
     MEMFLAGS flag = malloc_site->flag();
     assert(NMTUtil::flag_is_valid(flag) && flag != mtNone,
       "Must have a valid memory type");
-    print_malloc(malloc_site->size(), malloc_site->count(),flag);
+    print_malloc(extrapolate_sampled(malloc_site->size()), extrapolate_sampled(malloc_site->count()), flag);
     out->print_cr("\n");
   }
 }
@@ -724,13 +745,13 @@ void MemDetailDiffReporter::diff_virtual_memory_sites() const {
 
 
 void MemDetailDiffReporter::new_malloc_site(const MallocSite* malloc_site) const {
-  diff_malloc_site(malloc_site->call_stack(), malloc_site->size(), malloc_site->count(),
-    0, 0, malloc_site->flag());
+  diff_malloc_site(malloc_site->call_stack(), extrapolate_sampled(malloc_site->size()),
+    extrapolate_sampled(malloc_site->count()), 0, 0, malloc_site->flag());
 }
 
 void MemDetailDiffReporter::old_malloc_site(const MallocSite* malloc_site) const {
-  diff_malloc_site(malloc_site->call_stack(), 0, 0, malloc_site->size(),
-    malloc_site->count(), malloc_site->flag());
+  diff_malloc_site(malloc_site->call_stack(), 0, 0, extrapolate_sampled(malloc_site->size()),
+    extrapolate_sampled(malloc_site->count()), malloc_site->flag());
 }
 
 void MemDetailDiffReporter::diff_malloc_site(const MallocSite* early,
@@ -741,8 +762,9 @@ void MemDetailDiffReporter::diff_malloc_site(const MallocSite* early,
     old_malloc_site(early);
     new_malloc_site(current);
   } else {
-    diff_malloc_site(current->call_stack(), current->size(), current->count(),
-      early->size(), early->count(), early->flag());
+    diff_malloc_site(current->call_stack(),
+      extrapolate_sampled(current->size()), extrapolate_sampled(current->count()),
+      extrapolate_sampled(early->size()), extrapolate_sampled(early->count()), early->flag());
   }
 }
 
@@ -96,6 +96,7 @@ class MemSummaryReporter : public MemReporterBase {
   VirtualMemorySnapshot*  _vm_snapshot;
   size_t                  _instance_class_count;
   size_t                  _array_class_count;
+  const MemBaseline&      _summary_baseline;
 
  public:
   // This constructor is for normal reporting from a recent baseline.
@@ -104,7 +105,8 @@ class MemSummaryReporter : public MemReporterBase {
     _malloc_snapshot(baseline.malloc_memory_snapshot()),
     _vm_snapshot(baseline.virtual_memory_snapshot()),
     _instance_class_count(baseline.instance_class_count()),
-    _array_class_count(baseline.array_class_count()) { }
+    _array_class_count(baseline.array_class_count()),
+    _summary_baseline(baseline) { }
 
 
   // Generate summary report
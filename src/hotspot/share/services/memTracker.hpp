@@ -33,6 +33,7 @@
 
 #define CURRENT_PC   NativeCallStack::empty_stack()
 #define CALLER_PC    NativeCallStack::empty_stack()
+#define MALLOC_CALLER_PC NativeCallStack::empty_stack()
 
 class Tracker : public StackObj {
  public:
@@ -80,6 +81,7 @@ class MemTracker : AllStatic {
 
 #else
 
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/mallocTracker.hpp"
@@ -90,6 +92,10 @@ class MemTracker : AllStatic {
                     NativeCallStack(0, true) : NativeCallStack::empty_stack())
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1, true) : NativeCallStack::empty_stack())
+// Call stack of a malloc site, only captured for sampled mallocs (NMTDetailSampleInterval)
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail && \
+                           MemTracker::sample_malloc_stack()) ?         \
+                    NativeCallStack(1, true) : NativeCallStack::empty_stack())
 
 class MemBaseline;
 
@@ -306,6 +312,13 @@ class MemTracker : AllStatic {
 
   static void tuning_statistics(outputStream* out);
 
+  // Detail mode captures the call stack of one in NMTDetailSampleInterval mallocs,
+  // counted per thread.
+  static inline bool sample_malloc_stack() {
+    return NMTDetailSampleInterval == 1 ||
+           (_malloc_sample_count++ % NMTDetailSampleInterval) == 0;
+  }
+
  private:
   static NMT_TrackingLevel init_tracking_level();
   static void report(bool summary_only, outputStream* output);
@@ -313,6 +326,8 @@ class MemTracker : AllStatic {
  private:
   // Tracking level
   static volatile NMT_TrackingLevel   _tracking_level;
+  // Mallocs seen by this thread, for stack sampling
+  static THREAD_LOCAL uintx           _malloc_sample_count;
   // If NMT option value passed by launcher through environment
   // variable is valid
   static bool                         _is_nmt_env_valid;
@@ -45,6 +45,7 @@
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
 #include "services/threadService.hpp"
+#include "utilities/resourceHash.hpp"
 
 // TODO: we need to define a naming convention for perf counters
 // to distinguish counters for:
@@ -613,6 +614,28 @@ void StackFrameInfo::print_on(outputStream* st) const {
 
 }
 
+// Iterate through monitor cache once to find JNI locked monitors for
+// all stack traces registered with add().
+class AllInflatedMonitorsClosure: public MonitorClosure {
+private:
+  ResourceHashtable<const void*, ThreadStackTrace*,
+                    primitive_hash<const void*>, primitive_equals<const void*>,
+                    1031> _stack_traces;
+public:
+  void add(ThreadStackTrace* st) {
+    _stack_traces.put(st->thread(), st);
+  }
+  void do_monitor(ObjectMonitor* mid) {
+    ThreadStackTrace** st = _stack_traces.get(mid->owner());
+    if (st != NULL) {
+      oop object = mid->object();
+      if (!(*st)->is_owned_monitor_on_stack(object)) {
+        (*st)->add_jni_locked_monitor(object);
+      }
+    }
+  }
+};
+
 // Iterate through monitor cache to find JNI locked monitors
 class InflatedMonitorsClosure: public MonitorClosure {
 private:
@@ -662,7 +685,7 @@ ThreadStackTrace::~ThreadStackTrace() {
   }
 }
 
-void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth) {
+void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth, bool scan_inflated_monitors) {
   assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
 
   if (_thread->has_last_Java_frame()) {
@@ -684,7 +707,7 @@ void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth) {
     }
   }
 
-  if (_with_locked_monitors) {
+  if (_with_locked_monitors && scan_inflated_monitors) {
     // Iterate inflated monitors and find monitors locked by this thread
     // not found in the stack
     InflatedMonitorsClosure imc(_thread, this);
@@ -936,9 +959,28 @@ ThreadSnapshot::~ThreadSnapshot() {
   delete _concurrent_locks;
 }
 
-void ThreadSnapshot::dump_stack_at_safepoint(int max_depth, bool with_locked_monitors) {
+void ThreadSnapshot::dump_stack_at_safepoint(int max_depth, bool with_locked_monitors,
+                                             bool scan_inflated_monitors) {
   _stack_trace = new ThreadStackTrace(_thread, with_locked_monitors);
-  _stack_trace->dump_stack_at_safepoint(max_depth);
+  _stack_trace->dump_stack_at_safepoint(max_depth, scan_inflated_monitors);
+}
+
+void ThreadDumpResult::add_jni_locked_monitors_at_safepoint() {
+  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+
+  ResourceMark rm;
+  AllInflatedMonitorsClosure aimc;
+  bool found = false;
+  for (ThreadSnapshot* ts = _snapshots; ts != NULL; ts = ts->next()) {
+    ThreadStackTrace* st = ts->get_stack_trace();
+    if (st != NULL && st->jni_locked_monitors() != NULL) {
+      aimc.add(st);
+      found = true;
+    }
+  }
+  if (found) {
+    ObjectSynchronizer::monitors_iterate(&aimc);
+  }
 }
 
 
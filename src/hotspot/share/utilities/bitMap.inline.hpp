@@ -211,6 +211,18 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
       idx_t limit = aligned_right
         ? to_words_align_down(r_index) // Miniscule savings when aligned.
         : to_words_align_up(r_index);
+      // Skip over sparse regions a block of words at a time.  The loads
+      // within a block are independent, so the compiler can combine
+      // them into wide vector loads and a single test.
+      const idx_t block = 4;
+      while (index + block < limit) {
+        bm_word_t any = 0;
+        for (idx_t i = 1; i <= block; ++i) {
+          any |= map(index + i) ^ flip;
+        }
+        if (any != 0) break;
+        index += block;
+      }
       while (++index < limit) {
         cword = map(index) ^ flip;
         if (cword != 0) {
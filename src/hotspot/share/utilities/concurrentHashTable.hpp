@@ -35,6 +35,7 @@
 // type kept inside each Node and CONFIG contains hash and allocation methods.
 // A CALLBACK_FUNC and LOOKUP_FUNC needs to be provided for get and insert.
 
+class JavaThread;
 class Thread;
 class Mutex;
 
@@ -396,6 +397,26 @@ class ConcurrentHashTable : public CHeapObj<F> {
   bool shrink(Thread* thread, size_t size_limit_log2 = 0);
   bool grow(Thread* thread, size_t size_limit_log2 = 0);
 
+  // If an assistable GrowTask is in progress, moves one range of buckets to
+  // the new table on behalf of the resize lock owner. Returns true if a range
+  // was moved. Must not be called within a critical section or by the resize
+  // lock owner.
+  bool grow_assist(Thread* thread);
+
+  // For threads that just inserted into the table: assists a grow in progress
+  // with grow_assist(). Otherwise returns true if '*items_count' per bucket is
+  // above 'max_load_factor' and the size limit is not reached, so the caller
+  // should request a grow. Non-Java threads never assist nor request.
+  bool grow_assist_or_check(Thread* thread, const volatile size_t* items_count,
+                            double max_load_factor);
+
+  // Doubles the table with GrowTasks, blocking for safepoints between ranges,
+  // while '*items_count' per bucket is above 'max_load_factor' and the size
+  // limit is not reached. Returns false if the first GrowTask could not take
+  // the resize lock.
+  bool grow_to_load_factor(JavaThread* jt, const volatile size_t* items_count,
+                           double max_load_factor, bool assistable = false);
+
   // All callbacks for get are under critical sections. Other callbacks may be
   // under critical section or may have locked parts of table. Calling any
   // methods on the table during a callback is not supported.Only MultiGetHandle
@@ -419,6 +440,10 @@ class ConcurrentHashTable : public CHeapObj<F> {
   // risk for a duplicates and no other threads uses this table.
   bool unsafe_insert(const VALUE& value);
 
+  // Removes all items and resets the table to the given size, or the initial
+  // size if not given. Can only be used when no other threads use this table.
+  void unsafe_reset(size_t size_log2 = 0);
+
   // Returns true if items was deleted matching LOOKUP_FUNC and
   // prior to destruction DELETE_FUNC is called.
   template <typename LOOKUP_FUNC, typename DELETE_FUNC>
@@ -443,10 +468,18 @@ class ConcurrentHashTable : public CHeapObj<F> {
 
   // Visit all items with SCAN_FUNC without any protection.
   // It will assume there is no other thread accessing this
-  // table during the safepoint. Must be called with VM thread.
+  // table during the safepoint. Must be called with VM thread or a GC worker
+  // thread.
   template <typename SCAN_FUNC>
   void do_safepoint_scan(SCAN_FUNC& scan_f);
 
+  // Visit the items in the buckets [start_idx, stop_idx) of the table with
+  // SCAN_FUNC without any protection, like do_safepoint_scan(). Allows
+  // multiple threads to visit disjoint parts of the table in parallel. The
+  // table must not be in the middle of a resize.
+  template <typename SCAN_FUNC>
+  void do_safepoint_scan(SCAN_FUNC& scan_f, size_t start_idx, size_t stop_idx);
+
   // Destroying items matching EVALUATE_FUNC, before destroying items
   // DELETE_FUNC is called, if resize lock is obtained. Else returns false.
   template <typename EVALUATE_FUNC, typename DELETE_FUNC>
@@ -494,6 +527,13 @@ class ConcurrentHashTable : public CHeapObj<F> {
  public:
   class BulkDeleteTask;
   class GrowTask;
+
+ private:
+  // An assistable GrowTask in progress, published by the resize lock owner
+  // so that other threads can claim ranges of it, see grow_assist().
+  GrowTask* volatile _grow_task;
+  // Number of threads currently inside grow_assist().
+  volatile size_t _grow_assistants;
 };
 
 #endif // SHARE_UTILITIES_CONCURRENTHASHTABLE_HPP
@@ -683,8 +683,12 @@ inline bool ConcurrentHashTable<CONFIG, F>::
 
     // We can only move 1 pointer otherwise a reader might be moved to the wrong
     // chain. E.g. looking for even hash value but got moved to the odd bucket
-    // chain.
-    write_synchonize_on_visible_epoch(thread);
+    // chain. Threads assisting a grow cannot use the owner's epoch.
+    if (_resize_lock_owner == thread) {
+      write_synchonize_on_visible_epoch(thread);
+    } else {
+      GlobalCounter::write_synchronize();
+    }
     if (delete_me != NULL) {
       Node::destroy_node(delete_me);
       delete_me = NULL;
@@ -995,7 +999,7 @@ inline ConcurrentHashTable<CONFIG, F>::
     : _new_table(NULL), _log2_size_limit(log2size_limit),
        _log2_start_size(log2size), _grow_hint(grow_hint),
        _size_limit_reached(false), _resize_lock_owner(NULL),
-       _invisible_epoch(0)
+       _invisible_epoch(0), _grow_task(NULL), _grow_assistants(0)
 {
   _stats_rate = TableRateStatistics();
   _resize_lock =
@@ -1055,6 +1059,19 @@ inline bool ConcurrentHashTable<CONFIG, F>::
   return ret;
 }
 
+template <typename CONFIG, MEMFLAGS F>
+inline void ConcurrentHashTable<CONFIG, F>::
+  unsafe_reset(size_t size_log2)
+{
+  size_t tmp = size_log2 == 0 ? _log2_start_size : size_log2;
+  assert(_resize_lock_owner == NULL, "Must not be resizing");
+  assert(_new_table == NULL || _new_table == POISON_PTR, "Must not be resizing");
+  free_nodes();
+  delete _table;
+  _table = new InternalTable(tmp);
+  _size_limit_reached = _table->_log2_size == _log2_size_limit;
+}
+
 template <typename CONFIG, MEMFLAGS F>
 inline bool ConcurrentHashTable<CONFIG, F>::
   unsafe_insert(const VALUE& value) {
@@ -1110,8 +1127,8 @@ inline void ConcurrentHashTable<CONFIG, F>::
   // We only allow this method to be used during a safepoint.
   assert(SafepointSynchronize::is_at_safepoint(),
          "must only be called in a safepoint");
-  assert(Thread::current()->is_VM_thread(),
-         "should be in vm thread");
+  assert(Thread::current()->is_VM_thread() || Thread::current()->is_Worker_thread(),
+         "should be in vm thread or gc worker thread");
 
   // Here we skip protection,
   // thus no other thread may use this table at the same time.
@@ -1145,6 +1162,34 @@ inline void ConcurrentHashTable<CONFIG, F>::
   }
 }
 
+template <typename CONFIG, MEMFLAGS F>
+template <typename SCAN_FUNC>
+inline void ConcurrentHashTable<CONFIG, F>::
+  do_safepoint_scan(SCAN_FUNC& scan_f, size_t start_idx, size_t stop_idx)
+{
+  // We only allow this method to be used during a safepoint.
+  assert(SafepointSynchronize::is_at_safepoint(),
+         "must only be called in a safepoint");
+  assert(Thread::current()->is_VM_thread() || Thread::current()->is_Worker_thread(),
+         "should be in vm thread or gc worker thread");
+  assert(get_new_table() == NULL DEBUG_ONLY(|| get_new_table() == POISON_PTR),
+         "must not be in the middle of a resize");
+
+  // Here we skip protection,
+  // thus no other thread may modify this table at the same time.
+  InternalTable* table = get_table();
+  assert(start_idx <= stop_idx && stop_idx <= table->_size,
+         "Invalid bucket range [" SIZE_FORMAT ", " SIZE_FORMAT ") for table of size " SIZE_FORMAT,
+         start_idx, stop_idx, table->_size);
+  for (size_t bucket_it = start_idx; bucket_it < stop_idx; bucket_it++) {
+    Bucket* bucket = table->get_bucket(bucket_it);
+    assert(!bucket->have_redirect(), "Bucket must not be redirected.");
+    if (!visit_nodes(bucket, scan_f)) {
+      return;
+    }
+  }
+}
+
 template <typename CONFIG, MEMFLAGS F>
 template <typename EVALUATE_FUNC, typename DELETE_FUNC>
 inline bool ConcurrentHashTable<CONFIG, F>::
@@ -26,8 +26,10 @@
 #define SHARE_UTILITIES_CONCURRENTHASHTABLETASKS_INLINE_HPP
 
 #include "runtime/atomic.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/spinYield.hpp"
 
 // This inline file contains BulkDeleteTask and GrowTasks which are both bucket
 // operations, which they are serialized with each other.
@@ -161,12 +163,18 @@ class ConcurrentHashTable<CONFIG, F>::BulkDeleteTask :
   }
 };
 
+// An assistable GrowTask is published in the table while in progress, and
+// threads calling grow_assist() claim ranges of it concurrently with the
+// owner. done() waits for those threads before the new table is installed.
 template <typename CONFIG, MEMFLAGS F>
 class ConcurrentHashTable<CONFIG, F>::GrowTask :
   public BucketsOperation
 {
+  bool _assistable;
+
  public:
-  GrowTask(ConcurrentHashTable<CONFIG, F>* cht) : BucketsOperation(cht) {
+  GrowTask(ConcurrentHashTable<CONFIG, F>* cht, bool assistable = false)
+    : BucketsOperation(cht), _assistable(assistable) {
   }
   // Before start prepare must be called.
   bool prepare(Thread* thread) {
@@ -175,6 +183,9 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
       return false;
     }
     this->setup(thread);
+    if (_assistable) {
+      Atomic::release_store(&BucketsOperation::_cht->_grow_task, this);
+    }
     return true;
   }
 
@@ -195,9 +206,79 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
   // Must be called after do_task returns false.
   void done(Thread* thread) {
     this->thread_owns_resize_lock(thread);
+    if (_assistable) {
+      // All ranges are claimed; wait for assistants still moving theirs.
+      Atomic::release_store(&BucketsOperation::_cht->_grow_task, (GrowTask*)NULL);
+      OrderAccess::fence();
+      SpinYield yield;
+      while (Atomic::load_acquire(&BucketsOperation::_cht->_grow_assistants) != 0) {
+        yield.wait();
+      }
+    }
     BucketsOperation::_cht->internal_grow_epilog(thread);
     this->thread_do_not_own_resize_lock(thread);
   }
 };
 
+template <typename CONFIG, MEMFLAGS F>
+inline bool ConcurrentHashTable<CONFIG, F>::
+  grow_assist(Thread* thread)
+{
+  if (Atomic::load_acquire(&_grow_task) == NULL) {
+    return false;
+  }
+  assert(_resize_lock_owner != thread, "Owner does not assist");
+  Atomic::inc(&_grow_assistants);
+  // Re-check after announcing ourselves, the owner may be in done().
+  GrowTask* task = Atomic::load_acquire(&_grow_task);
+  bool moved = task != NULL && task->do_task(thread);
+  Atomic::dec(&_grow_assistants);
+  return moved;
+}
+
+template <typename CONFIG, MEMFLAGS F>
+inline bool ConcurrentHashTable<CONFIG, F>::
+  grow_assist_or_check(Thread* thread, const volatile size_t* items_count,
+                       double max_load_factor)
+{
+  // Non-Java threads, like the VM thread, may insert at a safepoint while
+  // the resize lock owner is paused for it, so leave the grow to the owner.
+  if (!thread->is_Java_thread()) {
+    return false;
+  }
+  if (grow_assist(thread)) {
+    return false;
+  }
+  return double(Atomic::load(items_count)) / double(size_t(1) << get_size_log2(thread)) > max_load_factor &&
+         !is_max_size_reached();
+}
+
+template <typename CONFIG, MEMFLAGS F>
+inline bool ConcurrentHashTable<CONFIG, F>::
+  grow_to_load_factor(JavaThread* jt, const volatile size_t* items_count,
+                      double max_load_factor, bool assistable)
+{
+  // Keep doubling while the table is still overloaded, so that a burst of
+  // insertions is absorbed in one round of concurrent work rather than one
+  // round per doubling. The resize lock is released between doublings.
+  bool grown = false;
+  do {
+    GrowTask gt(this, assistable);
+    if (!gt.prepare(jt)) {
+      break;
+    }
+    while (gt.do_task(jt)) {
+      gt.pause(jt);
+      {
+        ThreadBlockInVM tbivm(jt);
+      }
+      gt.cont(jt);
+    }
+    gt.done(jt);
+    grown = true;
+  } while (double(Atomic::load(items_count)) / double(size_t(1) << get_size_log2(jt)) > max_load_factor &&
+           !is_max_size_reached());
+  return grown;
+}
+
 #endif // SHARE_UTILITIES_CONCURRENTHASHTABLETASKS_INLINE_HPP
@@ -157,6 +157,24 @@ JIMAGE_GetResource(JImageFile* jimage, JImageLocationRef location,
 typedef jlong(*JImageGetResource_t)(JImageFile* jimage, JImageLocationRef location,
         char* buffer, jlong size);
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and
+ * location information (see JImageFindResource), return the address of the
+ * resource's bytes within the image, which stay valid until the image is
+ * closed. Returns NULL if the resource is compressed or the image is not
+ * memory mapped, in which case JImageGetResource must be used instead.
+ *
+ * Ex.
+ *  jlong size;
+ *  JImageLocationRef location = (*JImageFindResource)(image,
+ *                               "java.base", "9.0", "java/lang/String.class", &size);
+ *  const char* bytes = (*JImageGetResourceAddress)(image, location);
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* jimage, JImageLocationRef location);
+
+typedef const char*(*JImageGetResourceAddress_t)(JImageFile* jimage, JImageLocationRef location);
+
 
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
@@ -298,6 +298,7 @@ find_positions(int fd, Byte *eb, jlong* base_offset, jlong* censtart)
 
 #define BUFSIZE (3 * 65536 + CENHDR + SIGSIZ)
 #define MINREAD 1024
+#define REFILLREAD 65536
 
 /*
  * Locate the manifest file with the zip/jar file.
@@ -324,7 +325,10 @@ find_positions(int fd, Byte *eb, jlong* base_offset, jlong* censtart)
  *
  * In most cases, all that needs to be read are the first two entries in
  * a typical jar file (META-INF and META-INF/MANIFEST.MF). Keep this factoid
- * in mind when optimizing this code.
+ * in mind when optimizing this code. Only the first read is MINREAD bytes;
+ * if the manifest is not among the first entries it may be anywhere in a
+ * large Central Directory, so the buffer is refilled REFILLREAD bytes at a
+ * time instead.
  */
 static int
 find_file(int fd, zentry *entry, const char *file_name)
@@ -392,7 +396,7 @@ find_file(int fd, zentry *entry, const char *file_name)
          */
         if (bytes < CENHDR) {
             p = memmove(bp, p, bytes);
-            if ((res = read(fd, bp + bytes, MINREAD)) <= 0) {
+            if ((res = read(fd, bp + bytes, REFILLREAD)) <= 0) {
                 free(buffer);
                 return (-1);
             }
@@ -403,7 +407,8 @@ find_file(int fd, zentry *entry, const char *file_name)
             if (p != bp)
                 p = memmove(bp, p, bytes);
             read_size = entry_size - bytes + SIGSIZ;
-            read_size = (read_size < MINREAD) ? MINREAD : read_size;
+            read_size = (read_size < REFILLREAD) ? REFILLREAD : read_size;
+            read_size = (read_size > BUFSIZE - bytes) ? BUFSIZE - bytes : read_size;
             if ((res = read(fd, bp + bytes,  read_size)) <= 0) {
                 free(buffer);
                 return (-1);
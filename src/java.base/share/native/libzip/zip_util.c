@@ -454,6 +454,54 @@ hash_append(unsigned int hash, char c)
     return ((int)hash)*31 + c;
 }
 
+/*
+ * Returns the first name index slot to probe for a hash. The name hashes
+ * are weak in the low bits, so mix them before masking.
+ */
+static jint
+firstSlot(unsigned int hash, jint tablelen)
+{
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+    return (jint)(hash & (unsigned int)(tablelen - 1));
+}
+
+/*
+ * Builds the open addressing name index over zip->entries, with at
+ * least a quarter of the slots left empty. Returns 0 on success and -1
+ * if the index could not be allocated. Called with the zip lock held.
+ */
+static int
+buildTable(jzfile *zip)
+{
+    jzslot *table;
+    jint tablelen = 1;
+    jint i, slot;
+
+    while (tablelen < zip->total + zip->total / 3 + 1) {
+        tablelen <<= 1;
+    }
+    table = malloc((size_t)tablelen * sizeof(table[0]));
+    if (table == NULL) {
+        return -1;
+    }
+    for (i = 0; i < tablelen; i++) {
+        table[i].index = ZIP_ENDCHAIN;
+    }
+    for (i = 0; i < zip->total; i++) {
+        unsigned int hsh = zip->entries[i].hash;
+        for (slot = firstSlot(hsh, tablelen); table[slot].index != ZIP_ENDCHAIN;
+             slot = (slot + 1) & (tablelen - 1)) {
+        }
+        table[slot].hash = hsh;
+        table[slot].index = i;
+    }
+    zip->tablelen = tablelen;
+    zip->table = table;
+    return 0;
+}
+
 /*
  * Returns true if the specified entry's name begins with the string
  * "META-INF/" irrespective of case.
@@ -577,7 +625,7 @@ readCEN(jzfile *zip, jint knownTotal)
     /* Following are unsigned 32-bit */
     jlong endpos, end64pos, cenpos, cenlen, cenoff;
     /* Following are unsigned 16-bit */
-    jint total, tablelen, i, j;
+    jint total, i;
     unsigned char *cenbuf = NULL;
     unsigned char *cenend;
     unsigned char *cp;
@@ -588,7 +636,6 @@ readCEN(jzfile *zip, jint knownTotal)
     unsigned char endbuf[ENDHDR];
     jint endhdrlen = ENDHDR;
     jzcell *entries;
-    jint *table;
 
     /* Clear previous zip error */
     zip->msg = NULL;
@@ -689,20 +736,15 @@ readCEN(jzfile *zip, jint knownTotal)
      */
     total = (knownTotal != -1) ? knownTotal : total;
     entries  = zip->entries  = calloc(total, sizeof(entries[0]));
-    tablelen = zip->tablelen = ((total/2) | 1); // Odd -> fewer collisions
-    table    = zip->table    = malloc(tablelen * sizeof(table[0]));
     /* According to ISO C it is perfectly legal for malloc to return zero
-     * if called with a zero argument. We check this for 'entries' but not
-     * for 'table' because 'tablelen' can't be zero (see computation above). */
-    if ((entries == NULL && total != 0) || table == NULL) goto Catch;
-    for (j = 0; j < tablelen; j++)
-        table[j] = ZIP_ENDCHAIN;
+     * if called with a zero argument. The name index is built lazily by
+     * buildTable() on the first lookup. */
+    if (entries == NULL && total != 0) goto Catch;
 
     /* Iterate through the entries in the central directory */
     for (i = 0, cp = cenbuf; cp <= cenend - CENHDR; i++, cp += CENSIZE(cp)) {
         /* Following are unsigned 16-bit */
         jint method, nlen;
-        unsigned int hsh;
 
         if (i >= total) {
             /* This will only happen if the zip file has an incorrect
@@ -735,11 +777,6 @@ readCEN(jzfile *zip, jint knownTotal)
         /* Record the CEN offset and the name hash in our hash cell. */
         entries[i].cenpos = cenpos + (cp - cenbuf);
         entries[i].hash = hashN((char *)cp+CENHDR, nlen);
-
-        /* Add the entry to the hash table */
-        hsh = entries[i].hash % tablelen;
-        entries[i].next = table[hsh];
-        table[hsh] = i;
     }
     if (cp != cenend) {
         ZIP_FORMAT_ERROR("invalid CEN header (bad header size)");
@@ -1179,15 +1216,20 @@ jzentry *
 ZIP_GetEntry2(jzfile *zip, char *name, jint ulen, jboolean addSlash)
 {
     unsigned int hsh = hashN(name, ulen);
-    jint idx;
+    jint slot, mask;
     jzentry *ze = 0;
 
     ZIP_Lock(zip);
     if (zip->total == 0) {
         goto Finally;
     }
+    if (zip->table == NULL && buildTable(zip) != 0) {
+        zip->msg = "out of memory";
+        goto Finally;
+    }
 
-    idx = zip->table[hsh % zip->tablelen];
+    mask = zip->tablelen - 1;
+    slot = firstSlot(hsh, zip->tablelen);
 
     /*
      * This while loop is an optimization where a double lookup
@@ -1208,13 +1250,14 @@ ZIP_GetEntry2(jzfile *zip, char *name, jint ulen, jboolean addSlash)
         ze = 0;
 
         /*
-         * Search down the target hash chain for a cell whose
-         * 32 bit hash matches the hashed name.
+         * Probe the name index for a slot whose 32 bit hash
+         * matches the hashed name, up to the first empty slot.
          */
-        while (idx != ZIP_ENDCHAIN) {
-            jzcell *zc = &zip->entries[idx];
+        for (; zip->table[slot].index != ZIP_ENDCHAIN; slot = (slot + 1) & mask) {
+            jzslot *zs = &zip->table[slot];
 
-            if (zc->hash == hsh) {
+            if (zs->hash == hsh) {
+                jzcell *zc = &zip->entries[zs->index];
                 /*
                  * OK, we've found a ZIP entry whose 32 bit hashcode
                  * matches the name we're looking for.  Try to read
@@ -1236,7 +1279,6 @@ ZIP_GetEntry2(jzfile *zip, char *name, jint ulen, jboolean addSlash)
                 }
                 ze = 0;
             }
-            idx = zc->next;
         }
 
         /* Entry found, return it */
@@ -1258,7 +1300,7 @@ ZIP_GetEntry2(jzfile *zip, char *name, jint ulen, jboolean addSlash)
         name[ulen++] = '/';
         name[ulen] = '\0';
         hsh = hash_append(hsh, '/');
-        idx = zip->table[hsh % zip->tablelen];
+        slot = firstSlot(hsh, zip->tablelen);
         addSlash = JNI_FALSE;
     }
 
@@ -1702,3 +1744,82 @@ ZIP_GZip_Fully(char* inBuf, size_t inLen, char* outBuf, size_t outLen, char* tmp
 
   return result;
 }
+
+/*
+ * Compresses one block of a deflate stream that was split into blocks
+ * compressed independently, possibly on different threads (as pigz
+ * does). Each block is raw deflate data primed with the last 32K of the
+ * previous block's input as dictionary (dict may be NULL for the first
+ * block) and ends byte aligned with a sync flush, or with the final
+ * block marker when last is true. Concatenating the blocks in order
+ * gives a single standard deflate stream; a gzip stream additionally
+ * needs a gzip header and a trailer holding the crc32 of the whole input
+ * (see ZIP_CRC32_Combine) and its length. The buffer sizes returned by
+ * ZIP_GZip_InitParams are sufficient for each block.
+ */
+JNIEXPORT size_t
+ZIP_Deflate_Block(char* inBuf, size_t inLen, char* dict, size_t dictLen,
+                  char* outBuf, size_t outLen, char* tmp, size_t tmpLen,
+                  int level, jboolean last, char const** pmsg) {
+  z_stream strm;
+  int err;
+  char* block[] = {tmp, tmpLen + tmp};
+  size_t result = 0;
+
+  memset(&strm, 0, sizeof(z_stream));
+  strm.zalloc = zlib_block_alloc;
+  strm.zfree = zlib_block_free;
+  strm.opaque = (voidpf) block;
+
+  err = deflateInit2(&strm, level >= 0 && level <= 9 ? level : Z_DEFAULT_COMPRESSION,
+                     Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  if (err == Z_MEM_ERROR) {
+    *pmsg = "Out of memory in deflateInit2";
+    return 0;
+  } else if (err != Z_OK) {
+    *pmsg = "Internal error in deflateInit2";
+    return 0;
+  }
+  *pmsg = NULL;
+
+  if (dict != NULL && dictLen > 0) {
+    /* Only the last window's worth of the dictionary can be referenced. */
+    if (dictLen > (1 << MAX_WBITS)) {
+      dict += dictLen - (1 << MAX_WBITS);
+      dictLen = 1 << MAX_WBITS;
+    }
+    if (deflateSetDictionary(&strm, (Bytef *) dict, (uInt) dictLen) != Z_OK) {
+      *pmsg = "Internal error in deflateSetDictionary";
+    }
+  }
+
+  if (*pmsg == NULL) {
+    strm.next_out = (Bytef *) outBuf;
+    strm.avail_out = (uInt) outLen;
+    strm.next_in = (Bytef *) inBuf;
+    strm.avail_in = (uInt) inLen;
+
+    err = deflate(&strm, last ? Z_FINISH : Z_SYNC_FLUSH);
+
+    if (last ? err == Z_STREAM_END : (err == Z_OK && strm.avail_in == 0 && strm.avail_out > 0)) {
+      result = (size_t) strm.total_out;
+    } else if (err == Z_OK || err == Z_BUF_ERROR) {
+      *pmsg = "Buffer too small";
+    } else {
+      *pmsg = "Intern deflate error";
+    }
+  }
+
+  deflateEnd(&strm);
+
+  return result;
+}
+
+/*
+ * Returns the crc32 of two concatenated buffers given their crc32 values
+ * and the length of the second one.
+ */
+JNIEXPORT jint
+ZIP_CRC32_Combine(jint crc1, jint crc2, jlong len2) {
+  return (jint) crc32_combine((uLong) (unsigned int) crc1, (uLong) (unsigned int) crc2, (z_off_t) len2);
+}
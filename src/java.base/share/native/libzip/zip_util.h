@@ -182,10 +182,18 @@ typedef struct jzentry {  /* Zip file entry */
  */
 typedef struct jzcell {
     unsigned int hash;    /* 32 bit hashcode on name */
-    unsigned int next;    /* hash chain: index into jzfile->entries */
     jlong cenpos;         /* Offset of central directory file header */
 } jzcell;
 
+/*
+ * Slot of the open addressing name index. The name hash is kept next to
+ * the entry index so that probing does not touch the hash cells.
+ */
+typedef struct jzslot {
+    unsigned int hash;    /* 32 bit hashcode on name */
+    jint index;           /* index into jzfile->entries, or ZIP_ENDCHAIN */
+} jzslot;
+
 typedef struct cencache {
     char *data;           /* A cached page of CEN headers */
     jlong pos;            /* file offset of data */
@@ -224,8 +232,8 @@ typedef struct jzfile {   /* Zip file */
     char *msg;            /* zip error message */
     jzcell *entries;      /* array of hash cells */
     jint total;           /* total number of entries */
-    jint *table;          /* Hash chain heads: indexes into entries */
-    jint tablelen;        /* number of hash heads */
+    jzslot *table;        /* name index, built on the first lookup */
+    jint tablelen;        /* number of index slots, a power of two */
     struct jzfile *next;  /* next zip file in search list */
     jzentry *cache;       /* we cache the most recently freed jzentry */
     /* Information on metadata names in META-INF directory */
@@ -237,7 +245,7 @@ typedef struct jzfile {   /* Zip file */
 } jzfile;
 
 /*
- * Index representing end of hash chain
+ * Index representing an empty name index slot
  */
 #define ZIP_ENDCHAIN ((jint)-1)
 
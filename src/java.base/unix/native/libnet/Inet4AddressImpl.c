@@ -105,6 +105,9 @@ Java_java_net_Inet4AddressImpl_lookupAllHostAddr(JNIEnv *env, jobject this,
     memset(&hints, 0, sizeof(hints));
     hints.ai_flags = AI_CANONNAME;
     hints.ai_family = AF_INET;
+    // only the addresses are used; without a socket type getaddrinfo
+    // returns every address once per type (stream, datagram, raw)
+    hints.ai_socktype = SOCK_STREAM;
 
     error = getaddrinfo(hostname, NULL, &hints, &res);
 
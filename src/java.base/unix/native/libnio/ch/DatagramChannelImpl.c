@@ -153,3 +153,135 @@ Java_sun_nio_ch_DatagramChannelImpl_send0(JNIEnv *env, jclass clazz,
     }
     return n;
 }
+
+#if defined(__linux__)
+
+/* Upper bound on the datagrams moved by one recvmmsg/sendmmsg call */
+#define MAX_BATCH 64
+
+/*
+ * Receives up to count datagrams in one recvmmsg call. Datagram i is
+ * stored at bufAddress + i * bufLen, its sender at senderAddress + i *
+ * sizeof(SOCKETADDRESS), and its length in the jint at lengthsAddress + i.
+ * Returns the number of datagrams received.
+ */
+JNIEXPORT jint JNICALL
+Java_sun_nio_ch_DatagramChannelImpl_receiveBatch0(JNIEnv *env, jclass clazz,
+                                                  jobject fdo, jlong bufAddress,
+                                                  jint bufLen, jlong senderAddress,
+                                                  jlong lengthsAddress, jint count,
+                                                  jboolean connected)
+{
+    jint fd = fdval(env, fdo);
+    char *buf = (char *)jlong_to_ptr(bufAddress);
+    SOCKETADDRESS *sa = (SOCKETADDRESS *)jlong_to_ptr(senderAddress);
+    jint *lengths = (jint *)jlong_to_ptr(lengthsAddress);
+    struct mmsghdr msgs[MAX_BATCH];
+    struct iovec iovs[MAX_BATCH];
+    jboolean retry = JNI_FALSE;
+    int i, n;
+
+    if (bufLen > MAX_PACKET_LEN) {
+        bufLen = MAX_PACKET_LEN;
+    }
+    if (count > MAX_BATCH) {
+        count = MAX_BATCH;
+    }
+
+    memset(msgs, 0, sizeof(struct mmsghdr) * count);
+    for (i = 0; i < count; i++) {
+        iovs[i].iov_base = buf + ((size_t)i * bufLen);
+        iovs[i].iov_len = bufLen;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &sa[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(SOCKETADDRESS);
+    }
+
+    do {
+        retry = JNI_FALSE;
+        n = recvmmsg(fd, msgs, count, 0, NULL);
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return IOS_UNAVAILABLE;
+            }
+            if (errno == EINTR) {
+                return IOS_INTERRUPTED;
+            }
+            if (errno == ECONNREFUSED) {
+                if (connected == JNI_FALSE) {
+                    retry = JNI_TRUE;
+                } else {
+                    JNU_ThrowByName(env, JNU_JAVANETPKG "PortUnreachableException", 0);
+                    return IOS_THROWN;
+                }
+            } else {
+                return handleSocketError(env, errno);
+            }
+        }
+    } while (retry == JNI_TRUE);
+
+    for (i = 0; i < n; i++) {
+        lengths[i] = (jint)msgs[i].msg_len;
+    }
+    return n;
+}
+
+/*
+ * Sends up to count datagrams in one sendmmsg call. The datagrams are
+ * packed back to back at bufAddress, datagram i being lengths[i] bytes
+ * long, and all go to the same target (NULL when connected).
+ * Returns the number of datagrams sent.
+ */
+JNIEXPORT jint JNICALL
+Java_sun_nio_ch_DatagramChannelImpl_sendBatch0(JNIEnv *env, jclass clazz,
+                                               jobject fdo, jlong bufAddress,
+                                               jlong lengthsAddress, jint count,
+                                               jlong targetAddress, jint targetAddressLen)
+{
+    jint fd = fdval(env, fdo);
+    char *buf = (char *)jlong_to_ptr(bufAddress);
+    jint *lengths = (jint *)jlong_to_ptr(lengthsAddress);
+    SOCKETADDRESS *sa = (SOCKETADDRESS *)jlong_to_ptr(targetAddress);
+    struct mmsghdr msgs[MAX_BATCH];
+    struct iovec iovs[MAX_BATCH];
+    size_t offset = 0;
+    int i, n;
+
+    if (count > MAX_BATCH) {
+        count = MAX_BATCH;
+    }
+
+    memset(msgs, 0, sizeof(struct mmsghdr) * count);
+    for (i = 0; i < count; i++) {
+        jint len = lengths[i];
+        if (len > MAX_PACKET_LEN) {
+            len = MAX_PACKET_LEN;
+        }
+        iovs[i].iov_base = buf + offset;
+        iovs[i].iov_len = len;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = sa;
+        msgs[i].msg_hdr.msg_namelen = (socklen_t) targetAddressLen;
+        offset += lengths[i];
+    }
+
+    n = sendmmsg(fd, msgs, count, 0);
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return IOS_UNAVAILABLE;
+        }
+        if (errno == EINTR) {
+            return IOS_INTERRUPTED;
+        }
+        if (errno == ECONNREFUSED) {
+            JNU_ThrowByName(env, JNU_JAVANETPKG "PortUnreachableException", 0);
+            return IOS_THROWN;
+        }
+        return handleSocketError(env, errno);
+    }
+    return n;
+}
+
+#endif /* __linux__ */
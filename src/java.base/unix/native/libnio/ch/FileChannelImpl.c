@@ -30,6 +30,7 @@
 #include <unistd.h>
 
 #if defined(__linux__)
+#include <dlfcn.h>
 #include <sys/sendfile.h>
 #elif defined(_AIX)
 #include <string.h>
@@ -52,11 +53,22 @@
 
 static jfieldID chan_fd;        /* jobject 'fd' in sun.nio.ch.FileChannelImpl */
 
+#if defined(__linux__)
+typedef ssize_t copy_file_range_func(int, loff_t*, int, loff_t*, size_t,
+                                     unsigned int);
+/* copy_file_range(2) is only in glibc 2.27 and newer */
+static copy_file_range_func* my_copy_file_range_func = NULL;
+#endif
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileChannelImpl_initIDs(JNIEnv *env, jclass clazz)
 {
     jlong pageSize = sysconf(_SC_PAGESIZE);
     chan_fd = (*env)->GetFieldID(env, clazz, "fd", "Ljava/io/FileDescriptor;");
+#if defined(__linux__)
+    my_copy_file_range_func =
+        (copy_file_range_func*) dlsym(RTLD_DEFAULT, "copy_file_range");
+#endif
     return pageSize;
 }
 
@@ -169,7 +181,38 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 
 #if defined(__linux__)
     off64_t offset = (off64_t)position;
-    jlong n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
+    jlong n;
+
+    /*
+     * copy_file_range lets the file system share or copy extents without
+     * round tripping the data through a pipe. It fails with EINVAL (or
+     * EXDEV on older kernels) for non-regular targets like sockets and
+     * pipes, which then go through sendfile.
+     */
+    if (my_copy_file_range_func != NULL) {
+        loff_t off = (loff_t)position;
+        n = my_copy_file_range_func(srcFD, &off, dstFD, NULL, (size_t)count, 0);
+        if (n >= 0)
+            return n;
+        switch (errno) {
+            case EINTR:
+                return IOS_INTERRUPTED;
+            case EINVAL:
+            case ENOSYS:
+            case EXDEV:
+            case EBADF:
+            case EOPNOTSUPP:
+            case EPERM:
+            case ETXTBSY:
+                /* not supported for these descriptors, use sendfile */
+                break;
+            default:
+                JNU_ThrowIOExceptionWithLastError(env, "Copy failed");
+                return IOS_THROWN;
+        }
+    }
+
+    n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
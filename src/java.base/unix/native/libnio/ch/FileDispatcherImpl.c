@@ -124,6 +124,52 @@ Java_sun_nio_ch_FileDispatcherImpl_pwrite0(JNIEnv *env, jclass clazz, jobject fd
     return convertReturnVal(env, pwrite64(fd, buf, len, offset), JNI_FALSE);
 }
 
+/*
+ * Positional I/O directly on a heap byte array, without staging through
+ * a temporary direct buffer. The array is accessed in a critical region,
+ * which holds off GC, so only pread/pwrite are offered: they fail with
+ * ESPIPE on pipes and sockets and so cannot block indefinitely.
+ */
+JNIEXPORT jint JNICALL
+Java_sun_nio_ch_FileDispatcherImpl_preadArray0(JNIEnv *env, jclass clazz, jobject fdo,
+                                               jbyteArray array, jint off, jint len,
+                                               jlong offset)
+{
+    jint fd = fdval(env, fdo);
+    ssize_t n;
+    int err;
+    jbyte *buf = (*env)->GetPrimitiveArrayCritical(env, array, NULL);
+    if (buf == NULL) {
+        return IOS_THROWN;
+    }
+    n = pread64(fd, buf + off, len, offset);
+    err = errno;
+    (*env)->ReleasePrimitiveArrayCritical(env, array, buf, 0);
+    errno = err;   /* releasing may end a GC critical region */
+
+    return convertReturnVal(env, n, JNI_TRUE);
+}
+
+JNIEXPORT jint JNICALL
+Java_sun_nio_ch_FileDispatcherImpl_pwriteArray0(JNIEnv *env, jclass clazz, jobject fdo,
+                                                jbyteArray array, jint off, jint len,
+                                                jlong offset)
+{
+    jint fd = fdval(env, fdo);
+    ssize_t n;
+    int err;
+    jbyte *buf = (*env)->GetPrimitiveArrayCritical(env, array, NULL);
+    if (buf == NULL) {
+        return IOS_THROWN;
+    }
+    n = pwrite64(fd, buf + off, len, offset);
+    err = errno;
+    (*env)->ReleasePrimitiveArrayCritical(env, array, buf, JNI_ABORT);
+    errno = err;   /* releasing may end a GC critical region */
+
+    return convertReturnVal(env, n, JNI_FALSE);
+}
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileDispatcherImpl_writev0(JNIEnv *env, jclass clazz,
                                        jobject fdo, jlong address, jint len)
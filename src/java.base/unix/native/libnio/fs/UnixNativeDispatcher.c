@@ -815,6 +815,65 @@ Java_sun_nio_fs_UnixNativeDispatcher_readdir(JNIEnv* env, jclass this, jlong val
     }
 }
 
+/*
+ * Reads as many directory entries as fit into the size bytes at address,
+ * skipping "." and "..". Each entry is a jint record length (a multiple of
+ * 4), a jint d_type (DT_UNKNOWN where the file system or platform does not
+ * report it, in which case the caller has to stat the entry), and the NUL
+ * terminated name. Returns the number of bytes used, 0 at the end of the
+ * directory. An entry that does not fit is returned by the next call.
+ */
+JNIEXPORT jint JNICALL
+Java_sun_nio_fs_UnixNativeDispatcher_readdirBatch(JNIEnv* env, jclass this,
+    jlong value, jlong address, jint size)
+{
+    DIR* dirp = jlong_to_ptr(value);
+    char* buf = (char*)jlong_to_ptr(address);
+    jint used = 0;
+
+    for (;;) {
+        struct dirent* ptr;
+        long pos = telldir(dirp);
+        size_t len;
+        jint reclen;
+        jint type;
+
+        errno = 0;
+        ptr = readdir(dirp);
+        if (ptr == NULL) {
+            if (errno != 0) {
+                throwUnixException(env, errno);
+                return -1;
+            }
+            return used;
+        }
+        if (strcmp(ptr->d_name, ".") == 0 || strcmp(ptr->d_name, "..") == 0) {
+            continue;
+        }
+
+        len = strlen(ptr->d_name);
+        reclen = (jint)((2 * sizeof(jint) + len + 1 + 3) & ~(size_t)3);
+        if (reclen > size - used) {
+            if (used == 0) {
+                throwUnixException(env, ENAMETOOLONG);
+                return -1;
+            }
+            /* Leave the entry for the next call. */
+            seekdir(dirp, pos);
+            return used;
+        }
+#if defined(DT_UNKNOWN) && !defined(_AIX)
+        type = (jint)ptr->d_type;
+#else
+        type = 0;
+#endif
+        memcpy(buf + used, &reclen, sizeof(jint));
+        memcpy(buf + used + sizeof(jint), &type, sizeof(jint));
+        memcpy(buf + used + 2 * sizeof(jint), ptr->d_name, len + 1);
+        used += reclen;
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_sun_nio_fs_UnixNativeDispatcher_mkdir0(JNIEnv* env, jclass this,
     jlong pathAddress, jint mode)
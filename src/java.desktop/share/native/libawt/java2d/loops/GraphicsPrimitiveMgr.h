@@ -493,6 +493,13 @@ extern jboolean RegisterPrimitives(JNIEnv *env,
                                    NativePrimitive *pPrim,
                                    jint NumPrimitives);
 
+/*
+ * Return the accelerated (SIMD) version of a C loop function if one
+ * exists and the CPU supports it, or the C loop function itself.
+ * See MapAccelFunc.c.
+ */
+extern AnyFunc *MapAccelFunction(AnyFunc *func_c);
+
 /*
  * The utility function to retrieve the NativePrimitive structure
  * from a given Java GraphicsPrimitive object.
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * This file defines SSE2 versions of the most commonly used SrcOver
+ * loops that render into surfaces of type "IntArgbPre".  They are
+ * swapped in for the C loops by MapAccelFunction().
+ *
+ * Four pixels are processed at a time, with each 8-bit component
+ * widened to 16 bits.  The same arithmetic is applied to every pixel
+ * and the results match the C loops bit for bit:
+ *
+ *     MUL8(a, b) == ((a*b + 128) + ((a*b + 128) >> 8)) >> 8
+ *
+ * for all a, b in [0, 255], which is how mul8table is built.  The
+ * special cases of the C loops (alpha of 0 or 0xff) fall out of the
+ * general formula, except that pixels whose resulting source alpha
+ * is 0 are left untouched by the MaskBlit loops.
+ *
+ * See also AlphaMacros.h and MapAccelFunc.c
+ */
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "GraphicsPrimitiveMgr.h"
+#include "IntArgbPre.h"
+
+#define SSE2_PIXELS     4
+
+static __m128i
+mul8_sse2(__m128i a, __m128i b)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+/*
+ * Broadcast the 16-bit alpha (component 3) of each of the two pixels
+ * held in v to all four of that pixel's components.
+ */
+static __m128i
+alpha_sse2(__m128i v)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xff), 0xff);
+}
+
+/*
+ * Widen four mask bytes into one path alpha per component, two pixels
+ * per register.
+ */
+static void
+path_sse2(const jubyte *pMask, __m128i *lo, __m128i *hi)
+{
+    jint m;
+    __m128i v;
+
+    memcpy(&m, pMask, sizeof(m));
+    v = _mm_unpacklo_epi8(_mm_cvtsi32_si128(m), _mm_setzero_si128());
+    v = _mm_unpacklo_epi16(v, v);
+    *lo = _mm_unpacklo_epi32(v, v);
+    *hi = _mm_unpackhi_epi32(v, v);
+}
+
+/*
+ * Store four pixels the way ComposeIntDcmComponents1234 does, so that a
+ * component which overflows 0xff (only possible with inconsistent
+ * premultiplied data) spills into its neighbour exactly as in C.
+ */
+static void
+store_sse2(juint *pDst, __m128i lo, __m128i hi)
+{
+    __m128i low8 = _mm_set1_epi16(0xff);
+    __m128i bytes = _mm_packus_epi16(_mm_and_si128(lo, low8),
+                                     _mm_and_si128(hi, low8));
+    __m128i carry = _mm_packus_epi16(_mm_srli_epi16(lo, 8),
+                                     _mm_srli_epi16(hi, 8));
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_or_si128(bytes, _mm_slli_epi32(carry, 8)));
+}
+
+/*
+ * SrcOver fill of four pixels:
+ *     res = MUL8(pathA, src) + MUL8(0xff - MUL8(pathA, srcA), dst)
+ */
+static void
+fill4_sse2(juint *pRas, __m128i pathLo, __m128i pathHi,
+           __m128i src, __m128i srcA)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i ones = _mm_set1_epi16(0xff);
+    __m128i d = _mm_loadu_si128((__m128i *) pRas);
+    __m128i dLo = _mm_unpacklo_epi8(d, zero);
+    __m128i dHi = _mm_unpackhi_epi8(d, zero);
+    __m128i fLo = _mm_sub_epi16(ones, mul8_sse2(pathLo, srcA));
+    __m128i fHi = _mm_sub_epi16(ones, mul8_sse2(pathHi, srcA));
+
+    store_sse2(pRas,
+               _mm_add_epi16(mul8_sse2(pathLo, src), mul8_sse2(fLo, dLo)),
+               _mm_add_epi16(mul8_sse2(pathHi, src), mul8_sse2(fHi, dHi)));
+}
+
+void
+IntArgbPreSrcOverMaskFill_SSE2(void *rasBase,
+                               jubyte *pMask, jint maskOff, jint maskScan,
+                               jint width, jint height,
+                               jint fgColor,
+                               SurfaceDataRasInfo *pRasInfo,
+                               NativePrimitive *pPrim,
+                               CompositeInfo *pCompInfo)
+{
+    jint srcA, srcR, srcG, srcB;
+    jint rasScan = pRasInfo->scanStride;
+    juint *pRas = (juint *) rasBase;
+    __m128i src, srcAv;
+    __m128i opaque = _mm_set1_epi16(0xff);
+
+    ExtractIntDcmComponents1234(fgColor, srcA, srcR, srcG, srcB);
+    if (srcA != 0xff) {
+        if (srcA == 0) {
+            return;
+        }
+        srcR = MUL8(srcA, srcR);
+        srcG = MUL8(srcA, srcG);
+        srcB = MUL8(srcA, srcB);
+    }
+    src = _mm_setr_epi16((short) srcB, (short) srcG, (short) srcR, (short) srcA,
+                         (short) srcB, (short) srcG, (short) srcR, (short) srcA);
+    srcAv = _mm_set1_epi16((short) srcA);
+
+    if (pMask) {
+        pMask += maskOff;
+    }
+    do {
+        jint x = 0;
+        __m128i pathLo = opaque, pathHi = opaque;
+
+        for (; x + SSE2_PIXELS <= width; x += SSE2_PIXELS) {
+            if (pMask) {
+                jint m;
+                memcpy(&m, pMask + x, sizeof(m));
+                if (m == 0) {
+                    continue;
+                }
+                path_sse2(pMask + x, &pathLo, &pathHi);
+            }
+            fill4_sse2(pRas + x, pathLo, pathHi, src, srcAv);
+        }
+        if (x < width) {
+            juint tmp[SSE2_PIXELS];
+            jubyte tmpMask[SSE2_PIXELS] = { 0, 0, 0, 0 };
+            jint n = width - x;
+
+            memcpy(tmp, pRas + x, n * sizeof(juint));
+            if (pMask) {
+                memcpy(tmpMask, pMask + x, n);
+                path_sse2(tmpMask, &pathLo, &pathHi);
+            }
+            fill4_sse2(tmp, pathLo, pathHi, src, srcAv);
+            memcpy(pRas + x, tmp, n * sizeof(juint));
+        }
+        pRas = PtrAddBytes(pRas, rasScan);
+        if (pMask) {
+            pMask = PtrAddBytes(pMask, maskScan);
+        }
+    } while (--height > 0);
+}
+
+/*
+ * SrcOver blit of four pixels, where srcF is the (extra and path) alpha
+ * applied to the source:
+ *     resA = MUL8(srcF, srcA)
+ *     res  = MUL8(F, src) + MUL8(0xff - resA, dst)
+ * with F = srcF for a premultiplied source and F = resA otherwise; in
+ * the latter case the source alpha is replaced by 0xff so that the
+ * alpha component still works out to resA.
+ */
+static void
+blit4_sse2(juint *pDst, const juint *pSrc, __m128i fLo, __m128i fHi,
+           jboolean srcPre)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i ones = _mm_set1_epi16(0xff);
+    __m128i s = _mm_loadu_si128((const __m128i *) pSrc);
+    __m128i d = _mm_loadu_si128((__m128i *) pDst);
+    __m128i sLo = _mm_unpacklo_epi8(s, zero);
+    __m128i sHi = _mm_unpackhi_epi8(s, zero);
+    __m128i dLo = _mm_unpacklo_epi8(d, zero);
+    __m128i dHi = _mm_unpackhi_epi8(d, zero);
+    __m128i aLo = mul8_sse2(fLo, alpha_sse2(sLo));
+    __m128i aHi = mul8_sse2(fHi, alpha_sse2(sHi));
+    __m128i rLo, rHi, keepLo, keepHi;
+
+    if (!srcPre) {
+        __m128i alphaOnly = _mm_setr_epi16(0, 0, 0, 0xff, 0, 0, 0, 0xff);
+        sLo = _mm_or_si128(sLo, alphaOnly);
+        sHi = _mm_or_si128(sHi, alphaOnly);
+        fLo = aLo;
+        fHi = aHi;
+    }
+    rLo = _mm_add_epi16(mul8_sse2(fLo, sLo),
+                        mul8_sse2(_mm_sub_epi16(ones, aLo), dLo));
+    rHi = _mm_add_epi16(mul8_sse2(fHi, sHi),
+                        mul8_sse2(_mm_sub_epi16(ones, aHi), dHi));
+
+    /* Pixels with no source coverage are not written by the C loops */
+    keepLo = _mm_cmpeq_epi16(aLo, zero);
+    keepHi = _mm_cmpeq_epi16(aHi, zero);
+    rLo = _mm_or_si128(_mm_and_si128(keepLo, dLo), _mm_andnot_si128(keepLo, rLo));
+    rHi = _mm_or_si128(_mm_and_si128(keepHi, dHi), _mm_andnot_si128(keepHi, rHi));
+
+    store_sse2(pDst, rLo, rHi);
+}
+
+static void
+SrcOverMaskBlit_SSE2(void *dstBase, void *srcBase,
+                     jubyte *pMask, jint maskOff, jint maskScan,
+                     jint width, jint height,
+                     SurfaceDataRasInfo *pDstInfo,
+                     SurfaceDataRasInfo *pSrcInfo,
+                     CompositeInfo *pCompInfo,
+                     jboolean srcPre)
+{
+    jint extraA = (jint) (pCompInfo->details.extraAlpha * 255.0 + 0.5);
+    jint srcScan = pSrcInfo->scanStride;
+    jint dstScan = pDstInfo->scanStride;
+    juint *pSrc = (juint *) srcBase;
+    juint *pDst = (juint *) dstBase;
+    __m128i extraAv = _mm_set1_epi16((short) extraA);
+
+    if (pMask) {
+        pMask += maskOff;
+    }
+    do {
+        jint x = 0;
+        __m128i fLo = extraAv, fHi = extraAv;
+
+        for (; x + SSE2_PIXELS <= width; x += SSE2_PIXELS) {
+            if (pMask) {
+                jint m;
+                memcpy(&m, pMask + x, sizeof(m));
+                if (m == 0) {
+                    continue;
+                }
+                path_sse2(pMask + x, &fLo, &fHi);
+                fLo = mul8_sse2(fLo, extraAv);
+                fHi = mul8_sse2(fHi, extraAv);
+            }
+            blit4_sse2(pDst + x, pSrc + x, fLo, fHi, srcPre);
+        }
+        if (x < width) {
+            juint tmpSrc[SSE2_PIXELS] = { 0, 0, 0, 0 };
+            juint tmpDst[SSE2_PIXELS];
+            jubyte tmpMask[SSE2_PIXELS] = { 0, 0, 0, 0 };
+            jint n = width - x;
+
+            memcpy(tmpSrc, pSrc + x, n * sizeof(juint));
+            memcpy(tmpDst, pDst + x, n * sizeof(juint));
+            if (pMask) {
+                memcpy(tmpMask, pMask + x, n);
+                path_sse2(tmpMask, &fLo, &fHi);
+                fLo = mul8_sse2(fLo, extraAv);
+                fHi = mul8_sse2(fHi, extraAv);
+            }
+            blit4_sse2(tmpDst, tmpSrc, fLo, fHi, srcPre);
+            memcpy(pDst + x, tmpDst, n * sizeof(juint));
+        }
+        pSrc = PtrAddBytes(pSrc, srcScan);
+        pDst = PtrAddBytes(pDst, dstScan);
+        if (pMask) {
+            pMask = PtrAddBytes(pMask, maskScan);
+        }
+    } while (--height > 0);
+}
+
+void
+IntArgbPreToIntArgbPreSrcOverMaskBlit_SSE2(void *dstBase, void *srcBase,
+                                           jubyte *pMask, jint maskOff,
+                                           jint maskScan,
+                                           jint width, jint height,
+                                           SurfaceDataRasInfo *pDstInfo,
+                                           SurfaceDataRasInfo *pSrcInfo,
+                                           NativePrimitive *pPrim,
+                                           CompositeInfo *pCompInfo)
+{
+    SrcOverMaskBlit_SSE2(dstBase, srcBase, pMask, maskOff, maskScan,
+                         width, height, pDstInfo, pSrcInfo, pCompInfo,
+                         JNI_TRUE);
+}
+
+void
+IntArgbToIntArgbPreSrcOverMaskBlit_SSE2(void *dstBase, void *srcBase,
+                                        jubyte *pMask, jint maskOff,
+                                        jint maskScan,
+                                        jint width, jint height,
+                                        SurfaceDataRasInfo *pDstInfo,
+                                        SurfaceDataRasInfo *pSrcInfo,
+                                        NativePrimitive *pPrim,
+                                        CompositeInfo *pCompInfo)
+{
+    SrcOverMaskBlit_SSE2(dstBase, srcBase, pMask, maskOff, maskScan,
+                         width, height, pDstInfo, pSrcInfo, pCompInfo,
+                         JNI_FALSE);
+}
+
+#endif /* __SSE2__ || _M_X64 */
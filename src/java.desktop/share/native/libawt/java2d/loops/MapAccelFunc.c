@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "GraphicsPrimitiveMgr.h"
+#include "LoopMacros.h"
+
+/*
+ * This file maps the C loop functions which have an accelerated
+ * (SIMD) counterpart to that counterpart.  RegisterPrimitives()
+ * passes every loop through MapAccelFunction() before handing it
+ * to the Java GraphicsPrimitiveMgr, so the choice is made once,
+ * when the loops are registered.
+ */
+
+typedef struct {
+    AnyFunc *func_c;
+    AnyFunc *func_accel;
+} AnyFunc_pair;
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+DECLARE_SRCOVER_MASKFILL(IntArgbPre);
+DECLARE_SRCOVER_MASKBLIT(IntArgbPre, IntArgbPre);
+DECLARE_SRCOVER_MASKBLIT(IntArgb, IntArgbPre);
+
+MaskFillFunc IntArgbPreSrcOverMaskFill_SSE2;
+MaskBlitFunc IntArgbPreToIntArgbPreSrcOverMaskBlit_SSE2;
+MaskBlitFunc IntArgbToIntArgbPreSrcOverMaskBlit_SSE2;
+
+/*
+ * SSE2 is part of the x86_64 baseline, so no run time check is needed.
+ */
+static AnyFunc_pair accel_func_pairs[] = {
+    { (AnyFunc *) NAME_SRCOVER_MASKFILL(IntArgbPre),
+      (AnyFunc *) IntArgbPreSrcOverMaskFill_SSE2 },
+    { (AnyFunc *) NAME_SRCOVER_MASKBLIT(IntArgbPre, IntArgbPre),
+      (AnyFunc *) IntArgbPreToIntArgbPreSrcOverMaskBlit_SSE2 },
+    { (AnyFunc *) NAME_SRCOVER_MASKBLIT(IntArgb, IntArgbPre),
+      (AnyFunc *) IntArgbToIntArgbPreSrcOverMaskBlit_SSE2 },
+};
+
+#define NUM_ACCEL_FUNCS \
+    ((jint) (sizeof(accel_func_pairs) / sizeof(accel_func_pairs[0])))
+
+#else
+
+static AnyFunc_pair *accel_func_pairs = NULL;
+
+#define NUM_ACCEL_FUNCS 0
+
+#endif /* __SSE2__ || _M_X64 */
+
+AnyFunc *MapAccelFunction(AnyFunc *func_c)
+{
+    jint i;
+
+    for (i = 0; i < NUM_ACCEL_FUNCS; i++) {
+        if (accel_func_pairs[i].func_c == func_c) {
+            return accel_func_pairs[i].func_accel;
+        }
+    }
+    return func_c;
+}
@@ -25,6 +25,7 @@
 
 #include <jni_util.h>
 #include <stdlib.h>
+#include <string.h>
 #include "hb.h"
 #include "hb-jdk.h"
 #include "hb-ot.h"
@@ -232,6 +233,171 @@ JDKFontInfo*
 #define TYPO_LIGA 0x00000002
 #define TYPO_RTL  0x80000000
 
+/*
+ * Cache of shaping results.
+ *
+ * Report and PDF generators lay out the same short strings over and
+ * over, and every shape call makes several JNI up-calls per character
+ * (glyph lookup, advances) before HarfBuzz even starts.  So the glyph
+ * infos and positions of recently shaped runs are kept, keyed by the
+ * strike they were shaped with, the script, the layout flags, and the
+ * run text plus the surrounding context HarfBuzz can look at.
+ *
+ * The strike is held as a weak global reference and compared by
+ * identity, so the same strike always gives the same advances, and an
+ * entry whose strike has been collected can never match again.
+ *
+ * HarfBuzz looks at no more than 5 code points of context on either
+ * side of a run (HB_BUFFER_CONTEXT_LENGTH); 12 UTF-16 units always
+ * contain those, even when the window starts on half a surrogate pair.
+ * Only that window is copied out of the Java array, which therefore
+ * shapes exactly like the whole text.
+ *
+ * The cache is direct-mapped; a new run evicts whatever was in its
+ * slot.  It is protected by the SunLayoutEngine class monitor, which
+ * is never held across a call into Java.
+ */
+#define SHAPE_CONTEXT_LENGTH 12
+#define SHAPE_CACHE_SIZE     512 /* must be a power of 2 */
+#define SHAPE_CACHE_MAX_RUN  256
+
+typedef struct {
+    jweak strike;
+    jlong pFace;
+    jlong pNativeFont;
+    float ptSize;
+    float matrix[4];
+    jboolean aat;
+    jint script;
+    jint flags;
+    unsigned int hash;
+    int textLen;               /* context + run + context */
+    int runStart;              /* offset of the run within text */
+    int runLen;
+    jchar *text;
+    int glyphCount;
+    hb_glyph_info_t *glyphInfo; /* clusters are relative to the run */
+    hb_glyph_position_t *glyphPos;
+} ShapeCacheEntry;
+
+static ShapeCacheEntry shapeCache[SHAPE_CACHE_SIZE];
+
+static unsigned int shapeHash(jlong pFace, jint script, jint flags,
+                              const jchar *text, int textLen, int runStart) {
+    unsigned int h = 2166136261u;
+    int i;
+    h = (h ^ (unsigned int)pFace) * 16777619u;
+    h = (h ^ (unsigned int)script) * 16777619u;
+    h = (h ^ (unsigned int)flags) * 16777619u;
+    h = (h ^ (unsigned int)runStart) * 16777619u;
+    for (i = 0; i < textLen; i++) {
+        h = (h ^ text[i]) * 16777619u;
+    }
+    return h;
+}
+
+static void freeShapeCacheEntry(JNIEnv *env, ShapeCacheEntry *e) {
+    if (e->strike != NULL) {
+        (*env)->DeleteWeakGlobalRef(env, e->strike);
+    }
+    free(e->text);
+    free(e->glyphInfo);
+    free(e->glyphPos);
+    memset(e, 0, sizeof(*e));
+}
+
+/*
+ * Copies the cached glyphs for this run, if any, into newly allocated
+ * arrays which the caller must free.  Returns the glyph count, or -1.
+ */
+static int lookupShapeCache(JNIEnv *env, jclass lock, JDKFontInfo *fi,
+                            jlong pFace, jint script, jint flags,
+                            const jchar *text, int textLen, int runStart,
+                            int runLen, unsigned int hash,
+                            hb_glyph_info_t **glyphInfo,
+                            hb_glyph_position_t **glyphPos) {
+    ShapeCacheEntry *e = &shapeCache[hash & (SHAPE_CACHE_SIZE - 1)];
+    int count = -1;
+
+    if ((*env)->MonitorEnter(env, lock) != JNI_OK) {
+        return -1;
+    }
+    if (e->strike != NULL && e->hash == hash && e->pFace == pFace &&
+        e->pNativeFont == fi->nativeFont && e->aat == fi->aat &&
+        e->ptSize == fi->ptSize &&
+        memcmp(e->matrix, fi->matrix, sizeof(e->matrix)) == 0 &&
+        e->script == script && e->flags == flags &&
+        e->textLen == textLen && e->runStart == runStart &&
+        e->runLen == runLen &&
+        memcmp(e->text, text, textLen * sizeof(jchar)) == 0 &&
+        (*env)->IsSameObject(env, e->strike, fi->fontStrike)) {
+        *glyphInfo = malloc((e->glyphCount + 1) * sizeof(hb_glyph_info_t));
+        *glyphPos = malloc((e->glyphCount + 1) * sizeof(hb_glyph_position_t));
+        if (*glyphInfo != NULL && *glyphPos != NULL) {
+            memcpy(*glyphInfo, e->glyphInfo,
+                   e->glyphCount * sizeof(hb_glyph_info_t));
+            memcpy(*glyphPos, e->glyphPos,
+                   e->glyphCount * sizeof(hb_glyph_position_t));
+            count = e->glyphCount;
+        } else {
+            free(*glyphInfo);
+            free(*glyphPos);
+        }
+    }
+    (*env)->MonitorExit(env, lock);
+    return count;
+}
+
+static void storeShapeCache(JNIEnv *env, jclass lock, JDKFontInfo *fi,
+                            jlong pFace, jint script, jint flags,
+                            const jchar *text, int textLen, int runStart,
+                            int runLen, unsigned int hash,
+                            int glyphCount, hb_glyph_info_t *glyphInfo,
+                            hb_glyph_position_t *glyphPos) {
+    ShapeCacheEntry n;
+    int i;
+
+    memset(&n, 0, sizeof(n));
+    n.text = malloc(textLen * sizeof(jchar));
+    n.glyphInfo = malloc((glyphCount + 1) * sizeof(hb_glyph_info_t));
+    n.glyphPos = malloc((glyphCount + 1) * sizeof(hb_glyph_position_t));
+    n.strike = (*env)->NewWeakGlobalRef(env, fi->fontStrike);
+    if (n.text == NULL || n.glyphInfo == NULL || n.glyphPos == NULL ||
+        n.strike == NULL) {
+        freeShapeCacheEntry(env, &n);
+        return;
+    }
+    memcpy(n.text, text, textLen * sizeof(jchar));
+    memcpy(n.glyphInfo, glyphInfo, glyphCount * sizeof(hb_glyph_info_t));
+    memcpy(n.glyphPos, glyphPos, glyphCount * sizeof(hb_glyph_position_t));
+    for (i = 0; i < glyphCount; i++) {
+        n.glyphInfo[i].cluster -= runStart;
+    }
+    n.pFace = pFace;
+    n.pNativeFont = fi->nativeFont;
+    n.ptSize = fi->ptSize;
+    memcpy(n.matrix, fi->matrix, sizeof(n.matrix));
+    n.aat = fi->aat;
+    n.script = script;
+    n.flags = flags;
+    n.hash = hash;
+    n.textLen = textLen;
+    n.runStart = runStart;
+    n.runLen = runLen;
+    n.glyphCount = glyphCount;
+
+    if ((*env)->MonitorEnter(env, lock) != JNI_OK) {
+        freeShapeCacheEntry(env, &n);
+        return;
+    }
+    {
+        ShapeCacheEntry *e = &shapeCache[hash & (SHAPE_CACHE_SIZE - 1)];
+        freeShapeCacheEntry(env, e);
+        *e = n;
+    }
+    (*env)->MonitorExit(env, lock);
+}
+
 JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
     (JNIEnv *env, jclass cls,
      jobject font2D,
@@ -256,6 +422,11 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_font_t* hbfont;
      jchar  *chars;
      jsize len;
+     jint ctxStart, ctxLimit;
+     unsigned int hash = 0;
+     jboolean cacheable;
+     hb_glyph_info_t *cachedInfo = NULL;
+     hb_glyph_position_t *cachedPos = NULL;
      int glyphCount;
      hb_glyph_info_t *glyphInfo;
      hb_glyph_position_t *glyphPos;
@@ -277,6 +448,49 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      jdkFontInfo->font2D = font2D;
      jdkFontInfo->fontStrike = fontStrike;
 
+     len = (*env)->GetArrayLength(env, text);
+     if (offset < 0 || limit < offset || limit > len) {
+         free((void*)jdkFontInfo);
+         JNU_ThrowArrayIndexOutOfBoundsException(env, "");
+         return JNI_FALSE;
+     }
+     ctxStart = (offset > SHAPE_CONTEXT_LENGTH) ?
+                offset - SHAPE_CONTEXT_LENGTH : 0;
+     ctxLimit = (len - limit > SHAPE_CONTEXT_LENGTH) ?
+                limit + SHAPE_CONTEXT_LENGTH : len;
+     chars = (jchar*)malloc((ctxLimit - ctxStart + 1) * sizeof(jchar));
+     if (chars == NULL) {
+         free((void*)jdkFontInfo);
+         JNU_ThrowOutOfMemoryError(env, NULL);
+         return JNI_FALSE;
+     }
+     (*env)->GetCharArrayRegion(env, text, ctxStart, ctxLimit - ctxStart, chars);
+     if ((*env)->ExceptionCheck(env)) {
+         free(chars);
+         free((void*)jdkFontInfo);
+         return JNI_FALSE;
+     }
+
+     cacheable = (limit - offset) <= SHAPE_CACHE_MAX_RUN;
+     if (cacheable) {
+         hash = shapeHash(pFace, script, flags, chars, ctxLimit - ctxStart,
+                          offset - ctxStart);
+         glyphCount = lookupShapeCache(env, cls, jdkFontInfo, pFace, script,
+                                       flags, chars, ctxLimit - ctxStart,
+                                       offset - ctxStart, limit - offset,
+                                       hash, &cachedInfo, &cachedPos);
+         if (glyphCount >= 0) {
+             ret = storeGVData(env, gvdata, slot, baseIndex, 0, startPt,
+                               limit - offset, glyphCount, cachedInfo,
+                               cachedPos, jdkFontInfo->devScale);
+             free(cachedInfo);
+             free(cachedPos);
+             free(chars);
+             free((void*)jdkFontInfo);
+             return ret;
+         }
+     }
+
      hbface = (hb_face_t*) jlong_to_ptr(pFace);
      hbfont = hb_jdk_font_create(hbface, jdkFontInfo, NULL);
 
@@ -291,16 +505,8 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_buffer_set_cluster_level(buffer,
                                  HB_BUFFER_CLUSTER_LEVEL_MONOTONE_CHARACTERS);
 
-     chars = (*env)->GetCharArrayElements(env, text, NULL);
-     if ((*env)->ExceptionCheck(env)) {
-         hb_buffer_destroy(buffer);
-         hb_font_destroy(hbfont);
-         free((void*)jdkFontInfo);
-         return JNI_FALSE;
-     }
-     len = (*env)->GetArrayLength(env, text);
-
-     hb_buffer_add_utf16(buffer, chars, len, offset, limit-offset);
+     hb_buffer_add_utf16(buffer, chars, ctxLimit - ctxStart,
+                         offset - ctxStart, limit - offset);
 
      features = calloc(2, sizeof(hb_feature_t));
      if (features) {
@@ -313,15 +519,23 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      glyphInfo = hb_buffer_get_glyph_infos(buffer, 0);
      glyphPos = hb_buffer_get_glyph_positions(buffer, &buflen);
 
-     ret = storeGVData(env, gvdata, slot, baseIndex, offset, startPt,
-                       limit - offset, glyphCount, glyphInfo, glyphPos,
-                       jdkFontInfo->devScale);
+     // Clusters are indices into chars, which starts at ctxStart.
+     ret = storeGVData(env, gvdata, slot, baseIndex, offset - ctxStart,
+                       startPt, limit - offset, glyphCount, glyphInfo,
+                       glyphPos, jdkFontInfo->devScale);
+
+     if (ret && cacheable) {
+         storeShapeCache(env, cls, jdkFontInfo, pFace, script, flags,
+                         chars, ctxLimit - ctxStart, offset - ctxStart,
+                         limit - offset, hash,
+                         glyphCount, glyphInfo, glyphPos);
+     }
 
      hb_buffer_destroy (buffer);
      hb_font_destroy(hbfont);
      free((void*)jdkFontInfo);
      if (features != NULL) free(features);
-     (*env)->ReleaseCharArrayElements(env, text, chars, JNI_ABORT);
+     free(chars);
      return ret;
 }
 
@@ -33,6 +33,13 @@
 #include <lcms2.h>
 #include "jlong.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 
 #define ALIGNLONG(x) (((x)+3) & ~(3))         // Aligns to DWORD boundary
 
@@ -87,6 +94,10 @@ cmsInt32Number TransportValue32(cmsInt32Number Value)
 /* Default temp profile list size */
 #define DF_ICC_BUF_SIZE 32
 
+/* Images with at least this many pixels are converted by several threads */
+#define PARALLEL_MIN_PIXELS (256 * 1024)
+#define PARALLEL_MAX_THREADS 4
+
 #define ERR_MSG_SIZE 256
 
 #ifdef _MSC_VER
@@ -562,6 +573,157 @@ void releaseILData (JNIEnv *env, void* pData, jint dataType,
     }
 }
 
+/*
+ * A band of rows converted by one thread.  lcms transforms may be used
+ * from several threads at once: cmsDoTransform only reads the shared
+ * transform, including its one-pixel cache.
+ */
+typedef struct {
+    cmsHTRANSFORM trans;
+    char *inputRow;
+    char *outputRow;
+    int inputStride;
+    int outputStride;
+    int width;
+    int rows;
+} ConvertBand;
+
+static void convertBand(ConvertBand *band)
+{
+    char *inputRow = band->inputRow;
+    char *outputRow = band->outputRow;
+    int i;
+
+    for (i = 0; i < band->rows; i++) {
+        cmsDoTransform(band->trans, inputRow, outputRow, band->width);
+        inputRow += band->inputStride;
+        outputRow += band->outputStride;
+    }
+}
+
+/*
+ * errorHandler attaches the thread that reports an lcms error; a worker
+ * must not exit attached.  Detaching a thread that is not attached is
+ * a no-op.
+ */
+#ifdef _WIN32
+static DWORD WINAPI convertBandThread(LPVOID arg)
+{
+    convertBand((ConvertBand *) arg);
+    (*javaVM)->DetachCurrentThread(javaVM);
+    return 0;
+}
+#else
+static void *convertBandThread(void *arg)
+{
+    convertBand((ConvertBand *) arg);
+    (*javaVM)->DetachCurrentThread(javaVM);
+    return NULL;
+}
+#endif
+
+static int availableProcessors()
+{
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (int) si.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int) n : 1;
+#endif
+}
+
+/*
+ * Size in bytes of one pixel in the given lcms format, or 0 if pixels
+ * of this format are not stored contiguously.
+ */
+static int pixelSize(cmsUInt32Number format)
+{
+    int bytes = T_BYTES(format);
+
+    if (T_PLANAR(format)) {
+        return 0;
+    }
+    if (bytes == 0) {
+        bytes = sizeof(cmsFloat64Number);
+    }
+    return bytes * (T_CHANNELS(format) + T_EXTRA(format));
+}
+
+/*
+ * Converts height rows of width pixels, splitting them into bands that
+ * are converted in parallel.  Returns JNI_FALSE, without converting
+ * anything, if the image is too small for this to pay off.
+ */
+static jboolean convertInParallel(cmsHTRANSFORM trans,
+                                  char *inputRow, int inputStride,
+                                  char *outputRow, int outputStride,
+                                  int width, int height)
+{
+    ConvertBand bands[PARALLEL_MAX_THREADS];
+#ifdef _WIN32
+    HANDLE threads[PARALLEL_MAX_THREADS];
+#else
+    pthread_t threads[PARALLEL_MAX_THREADS];
+#endif
+    jboolean started[PARALLEL_MAX_THREADS];
+    int nbands, rowsPerBand, i;
+
+    if ((jlong) width * height < PARALLEL_MIN_PIXELS || height < 2) {
+        return JNI_FALSE;
+    }
+    nbands = availableProcessors();
+    if (nbands > PARALLEL_MAX_THREADS) {
+        nbands = PARALLEL_MAX_THREADS;
+    }
+    if (nbands > height) {
+        nbands = height;
+    }
+    if (nbands < 2) {
+        return JNI_FALSE;
+    }
+    rowsPerBand = (height + nbands - 1) / nbands;
+
+    for (i = 0; i < nbands; i++) {
+        int first = i * rowsPerBand;
+        bands[i].trans = trans;
+        bands[i].inputRow = inputRow + (jlong) first * inputStride;
+        bands[i].outputRow = outputRow + (jlong) first * outputStride;
+        bands[i].inputStride = inputStride;
+        bands[i].outputStride = outputStride;
+        bands[i].width = width;
+        bands[i].rows = (first + rowsPerBand <= height) ?
+                        rowsPerBand : height - first;
+        started[i] = JNI_FALSE;
+    }
+
+    /* The calling thread converts the first band itself */
+    for (i = 1; i < nbands; i++) {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, convertBandThread, &bands[i], 0, NULL);
+        started[i] = (threads[i] != NULL);
+#else
+        started[i] = (pthread_create(&threads[i], NULL,
+                                     convertBandThread, &bands[i]) == 0);
+#endif
+    }
+    convertBand(&bands[0]);
+    for (i = 1; i < nbands; i++) {
+        if (started[i]) {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        } else {
+            convertBand(&bands[i]);
+        }
+    }
+    return JNI_TRUE;
+}
+
 /*
  * Class:     sun_java2d_cmm_lcms_LCMS
  * Method:    colorConvert
@@ -621,8 +783,17 @@ JNIEXPORT void JNICALL Java_sun_java2d_cmm_lcms_LCMS_colorConvert
     outputRow = (char*)outputBuffer + dstOffset;
 
     if (srcAtOnce && dstAtOnce) {
-        cmsDoTransform(sTrans, inputRow, outputRow, width * height);
-    } else {
+        int inSize = pixelSize(cmsGetTransformInputFormat(sTrans));
+        int outSize = pixelSize(cmsGetTransformOutputFormat(sTrans));
+        if (inSize == 0 || outSize == 0 ||
+            !convertInParallel(sTrans, inputRow, width * inSize,
+                               outputRow, width * outSize, width, height))
+        {
+            cmsDoTransform(sTrans, inputRow, outputRow, width * height);
+        }
+    } else if (!convertInParallel(sTrans, inputRow, srcNextRowOffset,
+                                  outputRow, dstNextRowOffset,
+                                  width, height)) {
         for (i = 0; i < height; i++) {
             cmsDoTransform(sTrans, inputRow, outputRow, width);
             inputRow += srcNextRowOffset;
@@ -30,6 +30,8 @@
 #include <stddef.h>
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "libproc_impl.h"
 #include "ps_core_common.h"
 #include "proc_service.h"
@@ -105,6 +107,47 @@ static bool sort_map_array(struct ps_prochandle* ph) {
 #define MIN(x, y) (((x) < (y))? (x): (y))
 #endif
 
+// Map the whole core file read-only.  Reads from core segments are then
+// plain memory copies instead of one pread system call each.  If the
+// mapping fails (e.g. address space is short on 32-bit) we fall back to
+// pread.
+static void map_core_file(struct ps_prochandle* ph) {
+   struct stat st;
+   void* base;
+
+   if (fstat(ph->core->core_fd, &st) != 0 || st.st_size <= 0 ||
+       (uintmax_t) st.st_size > (uintmax_t) SIZE_MAX) {
+      return;
+   }
+
+   base = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+               ph->core->core_fd, 0);
+   if (base == MAP_FAILED) {
+      print_debug("can't mmap core file, using pread\n");
+      return;
+   }
+
+   ph->core->core_base = (char*) base;
+   ph->core->core_size = (size_t) st.st_size;
+}
+
+// pread replacement which reads core file data from the mapping if
+// there is one.
+static ssize_t core_pread(struct ps_prochandle* ph, int fd, char *buf,
+                          size_t len, off_t off) {
+   struct core_data* core = ph->core;
+
+   if (fd == core->core_fd && core->core_base != NULL) {
+      if (off < 0 || (size_t) off >= core->core_size) {
+         return 0;
+      }
+      len = MIN(len, core->core_size - (size_t) off);
+      memcpy(buf, core->core_base + off, len);
+      return len;
+   }
+   return pread(fd, buf, len, off);
+}
+
 static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
    ssize_t resid = size;
    int page_size=sysconf(_SC_PAGE_SIZE);
@@ -124,7 +167,7 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
       len = MIN(resid, mp->memsz - mapoff);
       off = mp->offset + mapoff;
 
-      if ((len = pread(fd, buf, len, off)) <= 0) {
+      if ((len = core_pread(ph, fd, buf, len, off)) <= 0) {
          break;
       }
 
@@ -755,6 +798,8 @@ Pgrab_core(const char* exec_file, const char* core_file) {
     goto err;
   }
 
+  map_core_file(ph);
+
   if ((ph->core->exec_fd = open(exec_file, O_RDONLY)) < 0) {
     print_debug("can't open executable file\n");
     goto err;
@@ -46,6 +46,10 @@ typedef struct symtab {
   size_t num_symbols;
   struct elf_symbol *symbols;
   struct hsearch_data *hash_table;
+  // named symbols with a size, sorted by offset, for nearest_symbol
+  struct elf_symbol **by_offset;
+  size_t num_by_offset;
+  uintptr_t max_size;
 } symtab_t;
 
 
@@ -220,6 +224,48 @@ static int open_file_from_debug_link(const char *name,
 
 static struct symtab* build_symtab_internal(int fd, const char *filename, bool try_debuginfo);
 
+// Order symbols by offset. Aliases at the same offset are ordered by
+// descending position in the symbol table, so that the backward scan
+// in nearest_symbol finds the first of them.
+static int sym_cmp_offset(const void *lhsp, const void *rhsp) {
+  const struct elf_symbol *lhs = *((const struct elf_symbol **)lhsp);
+  const struct elf_symbol *rhs = *((const struct elf_symbol **)rhsp);
+
+  if (lhs->offset != rhs->offset) {
+    return (lhs->offset < rhs->offset ? -1 : 1);
+  }
+  if (lhs == rhs) {
+    return 0;
+  }
+  return (lhs < rhs ? 1 : -1);
+}
+
+// Build the offset sorted index used by nearest_symbol. Stack walks
+// look up a symbol for every frame, which used to be a linear scan
+// over the whole symbol table.
+static bool build_offset_index(struct symtab* symtab) {
+  size_t n, cnt = 0;
+
+  symtab->by_offset = (struct elf_symbol **)
+                      calloc(symtab->num_symbols, sizeof(struct elf_symbol *));
+  if (symtab->by_offset == NULL) {
+    return false;
+  }
+
+  for (n = 0; n < symtab->num_symbols; n++) {
+    struct elf_symbol* sym = &(symtab->symbols[n]);
+    if (sym->name != NULL && sym->size != 0) {
+      symtab->by_offset[cnt++] = sym;
+      if (sym->size > symtab->max_size) {
+        symtab->max_size = sym->size;
+      }
+    }
+  }
+  symtab->num_by_offset = cnt;
+  qsort(symtab->by_offset, cnt, sizeof(struct elf_symbol *), sym_cmp_offset);
+  return true;
+}
+
 /* Look for a ".gnu_debuglink" section.  If one exists, try to open a
    suitable debuginfo file and read a symbol table from it.  */
 static struct symtab *build_symtab_from_debug_link(const char *name,
@@ -445,6 +491,10 @@ static struct symtab* build_symtab_internal(int fd, const char *filename, bool t
         item.data = (void *)&(symtab->symbols[j]);
         hsearch_r(item, ENTER, &ret, symtab->hash_table);
       }
+
+      if (!build_offset_index(symtab)) {
+        goto bad;
+      }
     }
   }
 
@@ -523,6 +573,7 @@ void destroy_symtab(struct symtab* symtab) {
   if (!symtab) return;
   if (symtab->strs) free(symtab->strs);
   if (symtab->symbols) free(symtab->symbols);
+  if (symtab->by_offset) free(symtab->by_offset);
   if (symtab->hash_table) {
      hdestroy_r(symtab->hash_table);
      free(symtab->hash_table);
@@ -557,12 +608,28 @@ quit:
 
 const char* nearest_symbol(struct symtab* symtab, uintptr_t offset,
                            uintptr_t* poffset) {
-  int n = 0;
-  if (!symtab) return NULL;
-  for (; n < symtab->num_symbols; n++) {
-     struct elf_symbol* sym = &(symtab->symbols[n]);
-     if (sym->name != NULL &&
-         offset >= sym->offset && offset < sym->offset + sym->size) {
+  size_t lo = 0, hi;
+  if (!symtab || !symtab->by_offset) return NULL;
+
+  // find the first symbol starting above offset
+  hi = symtab->num_by_offset;
+  while (lo < hi) {
+     size_t mid = lo + (hi - lo) / 2;
+     if (symtab->by_offset[mid]->offset <= offset) {
+        lo = mid + 1;
+     } else {
+        hi = mid;
+     }
+  }
+
+  // walk back over the symbols starting at or below offset; none of
+  // them can contain offset once the distance exceeds the largest size
+  while (lo > 0) {
+     struct elf_symbol* sym = symtab->by_offset[--lo];
+     if (offset - sym->offset >= symtab->max_size) {
+        break;
+     }
+     if (offset - sym->offset < sym->size) {
         if (poffset) *poffset = (offset - sym->offset);
         return sym->name;
      }
@@ -31,6 +31,7 @@
 #ifdef LINUX
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
 #include "proc_service.h"
 #include "salibelf.h"
 #endif
@@ -66,6 +67,12 @@ static void close_files(struct ps_prochandle* ph) {
   if (ph->core->core_fd >= 0)
     close(ph->core->core_fd);
 
+#ifdef LINUX
+  // unmap core file
+  if (ph->core->core_base != NULL)
+    munmap(ph->core->core_base, ph->core->core_size);
+#endif
+
   // close exec file descriptor
   if (ph->core->exec_fd >= 0)
     close(ph->core->exec_fd);
@@ -31,6 +31,7 @@
 #include "eventHandler.h"
 #include "eventHelper.h"
 #include "threadControl.h"
+#include "classTrack.h"
 #include "SDE.h"
 #include "FrameID.h"
 
@@ -132,6 +133,7 @@ classesForSignature(PacketInputStream *in, PacketOutputStream *out)
                 jclass clazz = theClasses[i];
                 jint status = classStatus(clazz);
                 char *candidate_signature = NULL;
+                char *allocated_signature = NULL;
                 jint wanted =
                     (JVMTI_CLASS_STATUS_PREPARED|JVMTI_CLASS_STATUS_ARRAY|
                      JVMTI_CLASS_STATUS_PRIMITIVE);
@@ -141,15 +143,21 @@ classesForSignature(PacketInputStream *in, PacketOutputStream *out)
                     continue;
                 }
 
-                error = classSignature(clazz, &candidate_signature, NULL);
-                if (error != JVMTI_ERROR_NONE) {
-                  // Clazz become invalid since the time we get the class list
-                  // Skip this entry
-                  if (error == JVMTI_ERROR_INVALID_CLASS) {
-                    continue;
-                  }
-
-                  break;
+                /* Prepared classes carry their signature as a tag */
+                candidate_signature = classTrack_getSignature(clazz);
+                if (candidate_signature == NULL) {
+                    error = classSignature(clazz, &allocated_signature, NULL);
+                    if (error != JVMTI_ERROR_NONE) {
+                      // Clazz become invalid since the time we get the class list
+                      // Skip this entry
+                      if (error == JVMTI_ERROR_INVALID_CLASS) {
+                        error = JVMTI_ERROR_NONE;
+                        continue;
+                      }
+
+                      break;
+                    }
+                    candidate_signature = allocated_signature;
                 }
 
                 if (strcmp(candidate_signature, signature) == 0) {
@@ -160,7 +168,7 @@ classesForSignature(PacketInputStream *in, PacketOutputStream *out)
                     theClasses[i] = theClasses[matchCount];
                     theClasses[matchCount++] = clazz;
                 }
-                jvmtiDeallocate(candidate_signature);
+                jvmtiDeallocate(allocated_signature);
             }
 
             /* At this point matching prepared classes occupy
@@ -248,11 +256,16 @@ allClasses1(PacketInputStream *in, PacketOutputStream *out, int outputGenerics)
 
         jint classCount;
         jclass *theClasses;
+        jint *statuses;
         jvmtiError error;
 
         error = allLoadedClasses(&theClasses, &classCount);
         if ( error != JVMTI_ERROR_NONE ) {
             outStream_setError(out, map2jdwpError(error));
+        } else if ((statuses = jvmtiAllocate(
+                        (classCount > 0 ? classCount : 1) * (jint)sizeof(jint))) == NULL) {
+            outStream_setError(out, JDWP_ERROR(OUT_OF_MEMORY));
+            jvmtiDeallocate(theClasses);
         } else {
             /* Count classes in theClasses which are prepared */
             int prepCount = 0;
@@ -269,10 +282,12 @@ allClasses1(PacketInputStream *in, PacketOutputStream *out, int outputGenerics)
                 /* We want prepared classes and arrays only */
                 if ((status & wanted) != 0) {
                     /* Float interesting classes (those that
-                     * are prepared) to the beginning of the array.
+                     * are prepared) to the beginning of the array,
+                     * remembering their status for the reply.
                      */
                     theClasses[i] = theClasses[prepCount];
-                    theClasses[prepCount++] = clazz;
+                    theClasses[prepCount] = clazz;
+                    statuses[prepCount++] = status;
                 }
             }
 
@@ -283,16 +298,27 @@ allClasses1(PacketInputStream *in, PacketOutputStream *out, int outputGenerics)
             (void)outStream_writeInt(out, prepCount);
             for (; writtenCount < prepCount; writtenCount++) {
                 char *signature = NULL;
+                char *allocatedSignature = NULL;
                 char *genericSignature = NULL;
                 jclass clazz = theClasses[writtenCount];
-                jint status = classStatus(clazz);
+                jint status = statuses[writtenCount];
                 jbyte tag = referenceTypeTag(clazz);
                 jvmtiError error;
 
-                error = classSignature(clazz, &signature, &genericSignature);
-                if (error != JVMTI_ERROR_NONE) {
-                    outStream_setError(out, map2jdwpError(error));
-                    break;
+                /* Prepared classes carry their signature as a tag,
+                 * but generic signatures have to come from JVMTI.
+                 */
+                if (outputGenerics != 1) {
+                    signature = classTrack_getSignature(clazz);
+                }
+                if (signature == NULL) {
+                    error = classSignature(clazz, &allocatedSignature,
+                                           outputGenerics == 1 ? &genericSignature : NULL);
+                    if (error != JVMTI_ERROR_NONE) {
+                        outStream_setError(out, map2jdwpError(error));
+                        break;
+                    }
+                    signature = allocatedSignature;
                 }
 
                 (void)outStream_writeByte(out, tag);
@@ -303,7 +329,7 @@ allClasses1(PacketInputStream *in, PacketOutputStream *out, int outputGenerics)
                 }
 
                 (void)outStream_writeInt(out, map2jdwpClassStatus(status));
-                jvmtiDeallocate(signature);
+                jvmtiDeallocate(allocatedSignature);
                 if (genericSignature != NULL) {
                   jvmtiDeallocate(genericSignature);
                 }
@@ -313,6 +339,7 @@ allClasses1(PacketInputStream *in, PacketOutputStream *out, int outputGenerics)
                     break;
                 }
             }
+            jvmtiDeallocate(statuses);
             jvmtiDeallocate(theClasses);
         }
 
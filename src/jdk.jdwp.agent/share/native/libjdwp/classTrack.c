@@ -124,6 +124,28 @@ classTrack_addPreparedClass(JNIEnv *env_unused, jclass klass)
     }
 }
 
+/*
+ * Return the signature attached to a prepared class, or NULL if the
+ * class has not been tagged (yet). The string belongs to the class
+ * tracker and must not be freed; it stays valid while the caller
+ * holds a reference to the class.
+ */
+char *
+classTrack_getSignature(jclass klass)
+{
+    jvmtiError error;
+    jlong tag;
+
+    if (trackingEnv == NULL) {
+        return NULL;
+    }
+    error = JVMTI_FUNC_PTR(trackingEnv, GetTag)(trackingEnv, klass, &tag);
+    if (error != JVMTI_ERROR_NONE || tag == NOT_TAGGED) {
+        return NULL;
+    }
+    return (char*)jlong_to_ptr(tag);
+}
+
 static jboolean
 setupEvents()
 {
@@ -39,6 +39,13 @@ classTrack_processUnloads(JNIEnv *env);
 void
 classTrack_addPreparedClass(JNIEnv *env, jclass klass);
 
+/*
+ * Get the signature attached to a prepared class, or NULL.
+ * The caller must not free it.
+ */
+char *
+classTrack_getSignature(jclass klass);
+
 /*
  * Initialize class tracking.
  */
@@ -61,10 +61,12 @@
 
 /* Initial hash table size (must be power of 2) */
 #define HASH_INIT_SIZE 512
-/* If element count exceeds HASH_EXPAND_SCALE*hash_size we expand & re-hash */
+/* If element count exceeds HASH_LOAD_FACTOR*hash_size we expand & re-hash */
+#define HASH_LOAD_FACTOR 2
+/* Factor by which the hash table grows (must be power of 2) */
 #define HASH_EXPAND_SCALE 8
 /* Maximum hash table size (must be power of 2) */
-#define HASH_MAX_SIZE  (1024*HASH_INIT_SIZE)
+#define HASH_MAX_SIZE  (16*1024*HASH_INIT_SIZE)
 
 /* Map a key (ID) to a hash bucket */
 static jint
@@ -289,6 +291,7 @@ findNodeByID(JNIEnv *env, jlong id)
             }
             break;
         }
+        prev = node;
         node = node->next;
     }
     return node;
@@ -331,21 +334,25 @@ newCommonRef(JNIEnv *env, jobject ref)
     }
 
     /* See if hash table needs expansion */
-    if ( gdata->objectsByIDcount > gdata->objectsByIDsize*HASH_EXPAND_SCALE &&
+    if ( gdata->objectsByIDcount > gdata->objectsByIDsize*HASH_LOAD_FACTOR &&
          gdata->objectsByIDsize < HASH_MAX_SIZE ) {
         RefNode **old;
         int       oldsize;
+        int       oldcount;
         int       newsize;
         int       i;
 
         /* Save old information */
-        old     = gdata->objectsByID;
-        oldsize = gdata->objectsByIDsize;
+        old      = gdata->objectsByID;
+        oldsize  = gdata->objectsByIDsize;
+        oldcount = gdata->objectsByIDcount;
         /* Allocate new hash table */
         gdata->objectsByID = NULL;
         newsize = oldsize*HASH_EXPAND_SCALE;
         if ( newsize > HASH_MAX_SIZE ) newsize = HASH_MAX_SIZE;
         initializeObjectsByID(newsize);
+        /* The RefNodes are moved, not created: keep their count */
+        gdata->objectsByIDcount = oldcount;
         /* Walk over old one and hash in all the RefNodes */
         for ( i = 0 ; i < oldsize ; i++ ) {
             RefNode *onode;
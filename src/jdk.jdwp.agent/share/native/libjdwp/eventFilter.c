@@ -369,10 +369,18 @@ eventInstance(EventInfo *evinfo)
  *
  * If shouldDelete is returned true, a count filter has expired
  * and the corresponding node should be deleted.
+ *
+ * Events in debug threads are suppressed by the caller, once per
+ * event rather than once per handler.
+ *
+ * The class name is only looked up when a ClassMatch or
+ * ClassExclude filter needs it; *classname starts out NULL and the
+ * caller frees whatever is left there once all handlers have seen
+ * the event.
  */
 jboolean
 eventFilterRestricted_passesFilter(JNIEnv *env,
-                                   char *classname,
+                                   char **classname,
                                    EventInfo *evinfo,
                                    HandlerNode *node,
                                    jboolean *shouldDelete)
@@ -388,16 +396,6 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
     clazz = evinfo->clazz;
     method = evinfo->method;
 
-    /*
-     * Suppress most events if they happen in debug threads
-     */
-    if ((evinfo->ei != EI_CLASS_PREPARE) &&
-        (evinfo->ei != EI_GC_FINISH) &&
-        (evinfo->ei != EI_CLASS_LOAD) &&
-        threadControl_isDebugThread(thread)) {
-        return JNI_FALSE;
-    }
-
     for (i = 0; i < FILTER_COUNT(node); ++i, ++filter) {
         switch (filter->modifier) {
             case JDWP_REQUEST_MODIFIER(ThreadOnly):
@@ -492,7 +490,10 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
                 break;
 
         case JDWP_REQUEST_MODIFIER(ClassMatch): {
-            if (!patternStringMatch(classname,
+            if (*classname == NULL) {
+                *classname = getClassname(clazz);
+            }
+            if (!patternStringMatch(*classname,
                        filter->u.ClassMatch.classPattern)) {
                 return JNI_FALSE;
             }
@@ -500,7 +501,10 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
         }
 
         case JDWP_REQUEST_MODIFIER(ClassExclude): {
-            if (patternStringMatch(classname,
+            if (*classname == NULL) {
+                *classname = getClassname(clazz);
+            }
+            if (patternStringMatch(*classname,
                       filter->u.ClassExclude.classPattern)) {
                 return JNI_FALSE;
             }
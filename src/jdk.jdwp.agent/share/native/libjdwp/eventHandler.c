@@ -644,14 +644,26 @@ event_callback(JNIEnv *env, EventInfo *evinfo)
         }
 
         node = getHandlerChain(evinfo->ei)->first;
-        classname = getClassname(evinfo->clazz);
+        /* Looked up on demand by the class name filters */
+        classname = NULL;
+
+        /*
+         * Suppress most events if they happen in debug threads
+         */
+        if (node != NULL &&
+            (evinfo->ei != EI_CLASS_PREPARE) &&
+            (evinfo->ei != EI_GC_FINISH) &&
+            (evinfo->ei != EI_CLASS_LOAD) &&
+            threadControl_isDebugThread(thread)) {
+            node = NULL;
+        }
 
         while (node != NULL) {
             /* save next so handlers can remove themselves */
             HandlerNode *next = NEXT(node);
             jboolean shouldDelete;
 
-            if (eventFilterRestricted_passesFilter(env, classname,
+            if (eventFilterRestricted_passesFilter(env, &classname,
                                                    evinfo, node,
                                                    &shouldDelete)) {
                 HandlerFunction func;
@@ -32,7 +32,7 @@
 struct bag;
 
 #define INITIAL_SEGMENT_SIZE   300
-#define MAX_SEGMENT_SIZE     10000
+#define MAX_SEGMENT_SIZE    (256*1024)
 
 typedef struct PacketData {
     int length;
@@ -23,6 +23,7 @@
  * questions.
  */
 
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 #include "Sctp.h"
@@ -72,6 +73,23 @@ jobject SockAddrToInetSocketAddress(JNIEnv* env, struct sockaddr* addr);
 
 jint handleSocketError(JNIEnv *env, jint errorValue);
 
+/*
+ * Received messages nearly always come from the few peer addresses of the
+ * associations on a socket, so the InetSocketAddress created for a peer is
+ * cached and handed out again for its later messages instead of creating
+ * an InetAddress and an InetSocketAddress for every message received.
+ * Both classes are immutable.  The cache is direct mapped by a hash of the
+ * address; entries are global refs that live until they are displaced.
+ */
+#define PEER_CACHE_SIZE 64
+
+static struct {
+    SOCKETADDRESS sa;
+    jobject isa;
+} peerCache[PEER_CACHE_SIZE];
+
+static pthread_mutex_t peerCacheLock = PTHREAD_MUTEX_INITIALIZER;
+
 /*
  * Class:     sun_nio_ch_sctp_SctpChannelImpl
  * Method:    initIDs
@@ -133,6 +151,76 @@ JNIEXPORT void JNICALL Java_sun_nio_ch_sctp_SctpChannelImpl_initIDs
     CHECK_NULL(ss_ctrID);
 }
 
+static jboolean sameSockAddr(SOCKETADDRESS* a, SOCKETADDRESS* b) {
+    if (a->sa.sa_family != b->sa.sa_family) {
+        return JNI_FALSE;
+    }
+    if (a->sa.sa_family == AF_INET) {
+        return a->sa4.sin_port == b->sa4.sin_port &&
+               a->sa4.sin_addr.s_addr == b->sa4.sin_addr.s_addr;
+    }
+    if (a->sa.sa_family == AF_INET6) {
+        return a->sa6.sin6_port == b->sa6.sin6_port &&
+               a->sa6.sin6_scope_id == b->sa6.sin6_scope_id &&
+               memcmp(&a->sa6.sin6_addr, &b->sa6.sin6_addr,
+                      sizeof(struct in6_addr)) == 0;
+    }
+    return JNI_FALSE;
+}
+
+static int peerCacheIndex(SOCKETADDRESS* sap) {
+    unsigned int h;
+    if (sap->sa.sa_family == AF_INET) {
+        h = sap->sa4.sin_addr.s_addr ^ sap->sa4.sin_port;
+    } else {
+        unsigned int w[4];
+        memcpy(w, &sap->sa6.sin6_addr, sizeof(w));
+        h = w[0] ^ w[1] ^ w[2] ^ w[3] ^ sap->sa6.sin6_port;
+    }
+    h ^= h >> 16;
+    h ^= h >> 8;
+    return h % PEER_CACHE_SIZE;
+}
+
+/*
+ * Returns a local ref to the InetSocketAddress for the given peer address,
+ * from the peer cache when possible.
+ */
+static jobject peerToInetSocketAddress(JNIEnv* env, SOCKETADDRESS* sap) {
+    jobject isa, globalIsa;
+    int i;
+
+    if (sap->sa.sa_family != AF_INET && sap->sa.sa_family != AF_INET6) {
+        return SockAddrToInetSocketAddress(env, &sap->sa);
+    }
+    i = peerCacheIndex(sap);
+
+    pthread_mutex_lock(&peerCacheLock);
+    if (peerCache[i].isa != NULL && sameSockAddr(&peerCache[i].sa, sap)) {
+        isa = (*env)->NewLocalRef(env, peerCache[i].isa);
+        pthread_mutex_unlock(&peerCacheLock);
+        return isa;
+    }
+    pthread_mutex_unlock(&peerCacheLock);
+
+    isa = SockAddrToInetSocketAddress(env, &sap->sa);
+    CHECK_NULL_RETURN(isa, NULL);
+    globalIsa = (*env)->NewGlobalRef(env, isa);
+    if (globalIsa == NULL) {
+        /* not cached, but still a valid result */
+        return isa;
+    }
+
+    pthread_mutex_lock(&peerCacheLock);
+    if (peerCache[i].isa != NULL) {
+        (*env)->DeleteGlobalRef(env, peerCache[i].isa);
+    }
+    peerCache[i].sa = *sap;
+    peerCache[i].isa = globalIsa;
+    pthread_mutex_unlock(&peerCacheLock);
+    return isa;
+}
+
 void getControlData
   (struct msghdr* msg, struct controlData* cdata) {
     struct cmsghdr* cmsg;
@@ -391,7 +479,7 @@ void handleMessage
         read = -1;
     }
 
-    isa = SockAddrToInetSocketAddress(env, sap);
+    isa = peerToInetSocketAddress(env, (SOCKETADDRESS*)sap);
     CHECK_NULL(isa);
     getControlData(msg, cdata);
 
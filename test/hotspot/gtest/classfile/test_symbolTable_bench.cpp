@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "microbenchmark.hpp"
+#include "unittest.hpp"
+
+static const int symbol_bench_count = 4 * K;
+static const int symbol_bench_length = 32;
+
+class SymbolTableProbeRound {
+  const char* _names;
+public:
+  SymbolTableProbeRound(const char* names) : _names(names) {}
+  uintx operator()() {
+    uintx found = 0;
+    for (int i = 0; i < symbol_bench_count; i++) {
+      const char* name = _names + i * symbol_bench_length;
+      TempNewSymbol sym = SymbolTable::probe(name, (int)strlen(name));
+      found += (sym != NULL) ? 1 : 0;
+    }
+    return found;
+  }
+};
+
+TEST_VM_BENCH(SymbolTable, probe) {
+  JavaThread* THREAD = JavaThread::current();
+  // the thread should be in vm to use locks
+  ThreadInVMfromNative invm(THREAD);
+  ResourceMark rm(THREAD);
+
+  char* names = NEW_RESOURCE_ARRAY(char, symbol_bench_count * symbol_bench_length);
+  Symbol** symbols = NEW_RESOURCE_ARRAY(Symbol*, symbol_bench_count);
+  for (int i = 0; i < symbol_bench_count; i++) {
+    char* name = names + i * symbol_bench_length;
+    os::snprintf(name, symbol_bench_length, "bench/Symbol%d", i);
+    symbols[i] = SymbolTable::new_symbol(name);
+  }
+
+  SymbolTableProbeRound round(names);
+  MicroBenchmark("SymbolTable.probe", symbol_bench_count).run(round);
+
+  for (int i = 0; i < symbol_bench_count; i++) {
+    symbols[i]->decrement_refcount();
+  }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "code/compressedStream.hpp"
+#include "memory/resourceArea.hpp"
+#include "microbenchmark.hpp"
+#include "unittest.hpp"
+
+static const int compressed_bench_values = 16 * K;
+
+// A mix of small and large values, as found in debug info streams.
+static jint compressed_bench_value(int i) {
+  return (i % 4 == 0) ? i * 997 : i % 64;
+}
+
+class CompressedWriteRound {
+public:
+  uintx operator()() {
+    ResourceMark rm;
+    CompressedWriteStream stream(compressed_bench_values);
+    for (int i = 0; i < compressed_bench_values; i++) {
+      stream.write_int(compressed_bench_value(i));
+    }
+    return stream.position();
+  }
+};
+
+class CompressedReadRound {
+  u_char* _buffer;
+public:
+  CompressedReadRound(u_char* buffer) : _buffer(buffer) {}
+  uintx operator()() {
+    CompressedReadStream stream(_buffer);
+    uintx sum = 0;
+    for (int i = 0; i < compressed_bench_values; i++) {
+      sum += stream.read_int();
+    }
+    return sum;
+  }
+};
+
+TEST_VM_BENCH(CompressedStream, write_int) {
+  CompressedWriteRound round;
+  MicroBenchmark("CompressedStream.write_int", compressed_bench_values).run(round);
+}
+
+TEST_VM_BENCH(CompressedStream, read_int) {
+  ResourceMark rm;
+  CompressedWriteStream stream(compressed_bench_values);
+  for (int i = 0; i < compressed_bench_values; i++) {
+    stream.write_int(compressed_bench_value(i));
+  }
+  CompressedReadRound round(stream.buffer());
+  MicroBenchmark("CompressedStream.read_int", compressed_bench_values).run(round);
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSet.inline.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "unittest.hpp"
+
+class G1CardSetTest : public ::testing::Test {
+  // Counts the cards and containers found during iteration.
+  class CountingVisitor {
+  public:
+    size_t _num_containers;
+    size_t _num_cards;
+    uint _num_per_type[4];
+
+    CountingVisitor() : _num_containers(0), _num_cards(0) {
+      for (uint i = 0; i < ARRAY_SIZE(_num_per_type); i++) {
+        _num_per_type[i] = 0;
+      }
+    }
+
+    bool start_iterate(uint container_type, uint region_idx) {
+      _num_containers++;
+      _num_per_type[container_type]++;
+      return true;
+    }
+
+    void operator()(uint card_idx) { _num_cards++; }
+    void operator()(uint card_idx, uint length) { _num_cards += length; }
+  };
+
+  // Iterates over the card set part by part, as parallel merging does.
+  class VM_IterateInParts : public VM_GTestExecuteAtSafepoint {
+    G1CardSet* _card_set;
+  public:
+    uint _num_parts;
+    CountingVisitor _cl;
+
+    VM_IterateInParts(G1CardSet* card_set) : _card_set(card_set), _num_parts(0), _cl() { }
+
+    void doit() {
+      _num_parts = _card_set->num_iteration_parts();
+      for (uint i = 0; i < _num_parts; i++) {
+        _card_set->iterate_cards_or_ranges_in_part(_cl, i);
+      }
+    }
+  };
+
+protected:
+  Mutex _m;
+  G1CardSet _card_set;
+
+public:
+  G1CardSetTest() :
+    _m(Mutex::leaf, "G1CardSetTest lock", true, Mutex::_safepoint_check_never),
+    _card_set(&_m) { }
+
+  void add_cards(uint region_idx, uint num_cards, uint stride) {
+    for (uint i = 0; i < num_cards; i++) {
+      ASSERT_EQ(Added, _card_set.add_card(region_idx, i * stride));
+    }
+    // Adding the same cards again must not change anything.
+    for (uint i = 0; i < num_cards; i++) {
+      ASSERT_NE(Added, _card_set.add_card(region_idx, i * stride));
+    }
+  }
+
+  void check_contains(uint region_idx, uint num_cards, uint stride) {
+    MutexLocker x(&_m, Mutex::_no_safepoint_check_flag);
+    for (uint i = 0; i < num_cards; i++) {
+      ASSERT_TRUE(_card_set.contains_card(region_idx, i * stride));
+    }
+  }
+
+  void check_iteration(size_t expected_containers, size_t expected_cards, uint expected_type) {
+    CountingVisitor cl;
+    _card_set.iterate_cards_or_ranges(cl);
+    ASSERT_EQ(expected_containers, cl._num_containers);
+    ASSERT_EQ(expected_cards, cl._num_cards);
+    ASSERT_EQ(expected_containers, (size_t)cl._num_per_type[expected_type]);
+  }
+
+  void test_container(uint num_cards, uint expected_type) {
+    const uint region_idx = 7;
+    add_cards(region_idx, num_cards, 1);
+    ASSERT_EQ(num_cards, _card_set.occupied());
+    ASSERT_EQ(1u, _card_set.num_containers());
+    check_contains(region_idx, num_cards, 1);
+    check_iteration(1, num_cards, expected_type);
+
+    _card_set.clear();
+    ASSERT_TRUE(_card_set.is_empty());
+    ASSERT_EQ(0u, _card_set.num_containers());
+  }
+
+  void test_multiple_regions() {
+    const uint num_regions = 100;
+    const uint num_cards = G1CardSetConfiguration::num_cards_in_inline_ptr();
+    for (uint i = 0; i < num_regions; i++) {
+      add_cards(i, num_cards, 3);
+    }
+    ASSERT_EQ(num_regions * num_cards, _card_set.occupied());
+    ASSERT_EQ(num_regions, _card_set.num_containers());
+    for (uint i = 0; i < num_regions; i++) {
+      check_contains(i, num_cards, 3);
+    }
+    check_iteration(num_regions, num_regions * num_cards, G1CardSet::CardSetInlinePtr);
+  }
+
+  void test_iterate_in_parts() {
+    // Enough containers for the hash table to grow beyond a single part.
+    const uint num_regions = 4096;
+    for (uint i = 0; i < num_regions; i++) {
+      add_cards(i, 1, 1);
+    }
+
+    VM_IterateInParts op(&_card_set);
+    {
+      ThreadInVMfromNative invm(JavaThread::current());
+      VMThread::execute(&op);
+    }
+    ASSERT_LT(1u, op._num_parts);
+    ASSERT_EQ((size_t)num_regions, op._cl._num_containers);
+    ASSERT_EQ((size_t)num_regions, op._cl._num_cards);
+  }
+};
+
+TEST_VM_F(G1CardSetTest, inline_ptr) {
+  if (!UseG1GC) {
+    return;
+  }
+  test_container(G1CardSetConfiguration::num_cards_in_inline_ptr(), G1CardSet::CardSetInlinePtr);
+}
+
+TEST_VM_F(G1CardSetTest, array_of_cards) {
+  if (!UseG1GC) {
+    return;
+  }
+  test_container(G1CardSetConfiguration::num_cards_in_array(), G1CardSet::CardSetArrayOfCards);
+}
+
+TEST_VM_F(G1CardSetTest, bitmap) {
+  if (!UseG1GC) {
+    return;
+  }
+  test_container(G1CardSetConfiguration::bitmap_coarsen_threshold() - 1, G1CardSet::CardSetBitMap);
+}
+
+TEST_VM_F(G1CardSetTest, full) {
+  if (!UseG1GC) {
+    return;
+  }
+  // Coarsening to a full container makes all cards of the region part of the
+  // card set.
+  const uint region_idx = 3;
+  add_cards(region_idx, G1CardSetConfiguration::bitmap_coarsen_threshold(), 1);
+  ASSERT_EQ((size_t)HeapRegion::CardsPerRegion, _card_set.occupied());
+  check_contains(region_idx, HeapRegion::CardsPerRegion, 1);
+  check_iteration(1, HeapRegion::CardsPerRegion, G1CardSet::CardSetFull);
+}
+
+TEST_VM_F(G1CardSetTest, multiple_regions) {
+  if (!UseG1GC) {
+    return;
+  }
+  test_multiple_regions();
+}
+
+TEST_VM_F(G1CardSetTest, iterate_in_parts) {
+  if (!UseG1GC) {
+    return;
+  }
+  test_iterate_in_parts();
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/cardTable.hpp"
+#include "unittest.hpp"
+
+typedef CardTable::CardValue CardValue;
+
+static const size_t num_cards = 64;
+
+// Checks the card range helpers for every start and end offset, so that
+// both the unaligned head and tail as well as the word-at-a-time part of
+// the search are exercised.
+static void test_find_first(CardValue* cards, CardValue val) {
+  for (size_t start = 0; start < num_cards; start++) {
+    for (size_t end = start; end <= num_cards; end++) {
+      CardValue* expected_equal = cards + end;
+      for (size_t i = start; i < end; i++) {
+        if (cards[i] == val) {
+          expected_equal = cards + i;
+          break;
+        }
+      }
+      CardValue* expected_not_equal = cards + end;
+      for (size_t i = start; i < end; i++) {
+        if (cards[i] != val) {
+          expected_not_equal = cards + i;
+          break;
+        }
+      }
+      ASSERT_EQ(expected_equal, CardTable::find_first_card_equal(cards + start, cards + end, val))
+          << "start: " << start << " end: " << end;
+      ASSERT_EQ(expected_not_equal, CardTable::find_first_card_not_equal(cards + start, cards + end, val))
+          << "start: " << start << " end: " << end;
+    }
+  }
+}
+
+TEST(CardTable, find_first_card) {
+  const CardValue clean = CardTable::clean_card_val();
+  const CardValue dirty = CardTable::dirty_card_val();
+
+  // Align the cards to exercise the expected number of unaligned cards.
+  uintptr_t storage[num_cards / sizeof(uintptr_t)];
+  CardValue* cards = (CardValue*)storage;
+
+  CardTable::fill_cards(cards, cards + num_cards, clean);
+  test_find_first(cards, clean);
+  test_find_first(cards, dirty);
+
+  size_t const positions[] = { 0, 1, 7, 8, 9, 31, 62, 63 };
+  for (size_t i = 0; i < ARRAY_SIZE(positions); i++) {
+    CardTable::fill_cards(cards, cards + num_cards, clean);
+    cards[positions[i]] = dirty;
+    test_find_first(cards, clean);
+    test_find_first(cards, dirty);
+  }
+
+  // A card value that differs from the searched one only in the high bit.
+  CardTable::fill_cards(cards, cards + num_cards, 0x80);
+  cards[20] = 0;
+  test_find_first(cards, 0);
+  test_find_first(cards, 0x80);
+}
+
+TEST(CardTable, fill_cards) {
+  CardValue cards[num_cards];
+  CardTable::fill_cards(cards, cards + num_cards, CardTable::clean_card_val());
+  CardTable::fill_cards(cards + 3, cards + 3, CardTable::dirty_card_val());
+  CardTable::fill_cards(cards + 5, cards + 40, CardTable::dirty_card_val());
+  for (size_t i = 0; i < num_cards; i++) {
+    CardValue expected = (i >= 5 && i < 40) ? CardTable::dirty_card_val() : CardTable::clean_card_val();
+    ASSERT_EQ(expected, cards[i]) << "card: " << i;
+  }
+}
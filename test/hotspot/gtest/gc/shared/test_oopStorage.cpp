@@ -386,6 +386,59 @@ TEST_VM_F(OopStorageTest, allocate_many) {
   }
 }
 
+TEST_VM_F(OopStorageTest, bulk_allocation) {
+  static const size_t max_entries = 1000;
+  static const size_t zero = 0;
+  oop* entries[max_entries] = {};
+
+  AllocationList& allocation_list = TestAccess::allocation_list(_storage);
+
+  EXPECT_EQ(0u, empty_block_count(_storage));
+  size_t allocated = _storage.allocate(entries, max_entries);
+  ASSERT_NE(allocated, zero);
+  // ASSERT_LE would ODR-use the OopStorage constant.
+  size_t bulk_allocate_limit = OopStorage::bulk_allocate_limit;
+  ASSERT_LE(allocated, bulk_allocate_limit);
+  ASSERT_LE(allocated, max_entries);
+  for (size_t i = 0; i < allocated; ++i) {
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, _storage.allocation_status(entries[i]));
+  }
+  for (size_t i = allocated; i < max_entries; ++i) {
+    EXPECT_TRUE(entries[i] == NULL);
+  }
+  EXPECT_EQ(allocated, _storage.allocation_count());
+  EXPECT_EQ(1u, _storage.block_count());
+  _storage.release(entries, allocated);
+  EXPECT_EQ(0u, _storage.allocation_count());
+  for (size_t i = 0; i < allocated; ++i) {
+    EXPECT_EQ(OopStorage::UNALLOCATED_ENTRY, _storage.allocation_status(entries[i]));
+  }
+  process_deferred_updates(_storage);
+  EXPECT_EQ(1u, list_length(allocation_list));
+  EXPECT_EQ(1u, empty_block_count(_storage));
+}
+
+TEST_VM_F(OopStorageTest, bulk_allocation_partial) {
+  static const size_t requested = 3;
+  oop* entries[requested] = {};
+
+  oop* first = _storage.allocate();
+  ASSERT_TRUE(first != NULL);
+
+  // Request fewer entries than the block has free; the excess is released
+  // and the block goes back on the allocation list.
+  EXPECT_EQ(requested, _storage.allocate(entries, requested));
+  EXPECT_EQ(requested + 1, _storage.allocation_count());
+  process_deferred_updates(_storage);
+  EXPECT_EQ(1u, list_length(TestAccess::allocation_list(_storage)));
+  const OopBlock& block = *TestAccess::active_array(_storage).at(0);
+  EXPECT_EQ(requested + 1, TestAccess::block_allocation_count(block));
+
+  release_entry(_storage, first);
+  _storage.release(entries, requested);
+  EXPECT_EQ(0u, _storage.allocation_count());
+}
+
 TEST_VM_F(OopStorageTestWithAllocation, random_release) {
   static const size_t step = 11;
   ASSERT_NE(0u, _max_entries % step); // max_entries and step are mutually prime
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "microbenchmark.hpp"
+#include "unittest.hpp"
+
+static const size_t oopstorage_bench_entries = 4 * K;
+
+class OopStorageAllocateReleaseRound {
+  OopStorage* _storage;
+  oop** _entries;
+public:
+  OopStorageAllocateReleaseRound(OopStorage* storage, oop** entries) :
+    _storage(storage), _entries(entries) {}
+  uintx operator()() {
+    for (size_t i = 0; i < oopstorage_bench_entries; i++) {
+      _entries[i] = _storage->allocate();
+    }
+    uintx count = _storage->allocation_count();
+    for (size_t i = 0; i < oopstorage_bench_entries; i++) {
+      _storage->release(_entries[i]);
+    }
+    return count;
+  }
+};
+
+class OopStorageBulkReleaseRound {
+  OopStorage* _storage;
+  oop** _entries;
+public:
+  OopStorageBulkReleaseRound(OopStorage* storage, oop** entries) :
+    _storage(storage), _entries(entries) {}
+  uintx operator()() {
+    for (size_t i = 0; i < oopstorage_bench_entries; i++) {
+      _entries[i] = _storage->allocate();
+    }
+    uintx count = _storage->allocation_count();
+    _storage->release(_entries, oopstorage_bench_entries);
+    return count;
+  }
+};
+
+TEST_VM_BENCH(OopStorage, allocate_release) {
+  OopStorage storage("Bench Storage");
+  oop** entries = NEW_C_HEAP_ARRAY(oop*, oopstorage_bench_entries, mtTest);
+  OopStorageAllocateReleaseRound round(&storage, entries);
+  MicroBenchmark("OopStorage.allocate_release", 2 * oopstorage_bench_entries).run(round);
+  FREE_C_HEAP_ARRAY(oop*, entries);
+}
+
+TEST_VM_BENCH(OopStorage, allocate_bulk_release) {
+  OopStorage storage("Bench Storage");
+  oop** entries = NEW_C_HEAP_ARRAY(oop*, oopstorage_bench_entries, mtTest);
+  OopStorageBulkReleaseRound round(&storage, entries);
+  MicroBenchmark("OopStorage.allocate_bulk_release", oopstorage_bench_entries).run(round);
+  FREE_C_HEAP_ARRAY(oop*, entries);
+}
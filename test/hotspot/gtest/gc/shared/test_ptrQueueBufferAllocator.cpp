@@ -101,6 +101,34 @@ TEST_VM(PtrQueueBufferAllocatorTest, test) {
   // destroy allocator.
 }
 
+// Allocation with an empty free list reuses released nodes that are
+// still waiting on the pending list.
+TEST_VM(PtrQueueBufferAllocatorTest, allocate_from_pending) {
+  const size_t buffer_size = 256;
+  BufferNode::Allocator allocator("Test Buffer Allocator", buffer_size);
+
+  BufferNode* nodes[5] = {};
+  const size_t node_count = ARRAY_SIZE(nodes);
+  for (size_t i = 0; i < node_count; ++i) {
+    nodes[i] = allocator.allocate();
+  }
+
+  // Too few releases to trigger a transfer to the free list.
+  for (size_t i = 0; i < node_count; ++i) {
+    allocator.release(nodes[i]);
+  }
+  ASSERT_EQ(0u, allocator.free_count());
+
+  // Allocation transfers the pending nodes rather than allocating anew.
+  ASSERT_EQ(nodes[node_count - 1], allocator.allocate());
+  ASSERT_EQ(node_count - 1, allocator.free_count());
+
+  allocator.release(nodes[node_count - 1]);
+  ASSERT_TRUE(BufferNode::TestSupport::try_transfer_pending(&allocator));
+  ASSERT_EQ(node_count, allocator.free_count());
+  ASSERT_EQ(node_count, allocator.reduce_free_list(node_count));
+}
+
 // Stress test with lock-free allocator and completed buffer list.
 // Completed buffer list pop avoids ABA by also being in a critical
 // section that is synchronized by the allocator's release.
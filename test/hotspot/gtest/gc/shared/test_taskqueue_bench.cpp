@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "microbenchmark.hpp"
+#include "unittest.hpp"
+
+typedef GenericTaskQueue<size_t, mtTest> BenchTaskQueue;
+
+static const size_t taskqueue_bench_tasks = 4 * K;
+
+class TaskQueuePushPopRound {
+  BenchTaskQueue* _queue;
+public:
+  TaskQueuePushPopRound(BenchTaskQueue* queue) : _queue(queue) {}
+  uintx operator()() {
+    for (size_t i = 0; i < taskqueue_bench_tasks; i++) {
+      _queue->push(i);
+    }
+    uintx sum = 0;
+    size_t t;
+    while (_queue->pop_local(t)) {
+      sum += t;
+    }
+    return sum;
+  }
+};
+
+class TaskQueuePushStealRound {
+  BenchTaskQueue* _queue;
+public:
+  TaskQueuePushStealRound(BenchTaskQueue* queue) : _queue(queue) {}
+  uintx operator()() {
+    for (size_t i = 0; i < taskqueue_bench_tasks; i++) {
+      _queue->push(i);
+    }
+    uintx sum = 0;
+    size_t t;
+    while (_queue->pop_global(t)) {
+      sum += t;
+    }
+    return sum;
+  }
+};
+
+TEST_VM_BENCH(TaskQueue, push_pop_local) {
+  BenchTaskQueue* queue = new BenchTaskQueue();
+  queue->initialize();
+  TaskQueuePushPopRound round(queue);
+  MicroBenchmark("TaskQueue.push_pop_local", 2 * taskqueue_bench_tasks).run(round);
+  delete queue;
+}
+
+TEST_VM_BENCH(TaskQueue, push_pop_global) {
+  BenchTaskQueue* queue = new BenchTaskQueue();
+  queue->initialize();
+  TaskQueuePushStealRound round(queue);
+  MicroBenchmark("TaskQueue.push_pop_global", 2 * taskqueue_bench_tasks).run(round);
+  delete queue;
+}
@@ -52,6 +52,28 @@ TEST_VM(LogDecorations, level) {
   }
 }
 
+TEST_VM(LogDecorations, copy) {
+  union {
+    char mem[sizeof(LogDecorations)];
+    jlong dummy;
+  } storage;
+  LogDecorations* original = ::new (&storage) LogDecorations(LogLevel::Info, tagset, default_decorators);
+  char expected[LogDecorators::Count][LogDecorations::DecorationsBufferSize];
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(i);
+    const char* value = original->decoration(decorator);
+    strcpy(expected[i], value == NULL ? "" : value);
+  }
+  LogDecorations copy(*original);
+  // The copy must not refer to the buffer of the original
+  memset(&storage, 0, sizeof(storage));
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(i);
+    const char* value = copy.decoration(decorator);
+    EXPECT_STREQ(expected[i], value == NULL ? "" : value) << "Decoration " << LogDecorators::name(decorator);
+  }
+}
+
 TEST_VM(LogDecorations, uptime) {
   // Verify the format of the decoration
   int a, b;
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "memory/arena.hpp"
+#include "memory/resourceArea.hpp"
+#include "microbenchmark.hpp"
+#include "unittest.hpp"
+
+static const size_t arena_bench_allocations = 16 * K;
+static const size_t arena_bench_size = 24;
+
+class ArenaAllocateRound {
+public:
+  uintx operator()() {
+    Arena arena(mtTest);
+    uintx sum = 0;
+    for (size_t i = 0; i < arena_bench_allocations; i++) {
+      sum += (uintx)arena.Amalloc(arena_bench_size);
+    }
+    return sum;
+  }
+};
+
+class ResourceAreaAllocateRound {
+public:
+  uintx operator()() {
+    ResourceMark rm;
+    uintx sum = 0;
+    for (size_t i = 0; i < arena_bench_allocations; i++) {
+      sum += (uintx)NEW_RESOURCE_ARRAY(char, arena_bench_size);
+    }
+    return sum;
+  }
+};
+
+TEST_VM_BENCH(Arena, allocate) {
+  ArenaAllocateRound round;
+  MicroBenchmark("Arena.allocate", arena_bench_allocations).run(round);
+}
+
+TEST_VM_BENCH(ResourceArea, allocate) {
+  ResourceAreaAllocateRound round;
+  MicroBenchmark("ResourceArea.allocate", arena_bench_allocations).run(round);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef GTEST_MICROBENCHMARK_HPP
+#define GTEST_MICROBENCHMARK_HPP
+
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
+#include "unittest.hpp"
+
+// A small harness for microbenchmarks of VM internals, run by the gtest
+// launcher. Benchmarks are registered as disabled tests so that they stay
+// out of the regular correctness runs. Run them with
+//
+//   --gtest_also_run_disabled_tests --gtest_filter='*.DISABLED_bench_*'
+//
+// A benchmark body constructs a MicroBenchmark and passes it a functor.
+// Each call to the functor performs one round of ops_per_round operations
+// and returns a value derived from them, so the work cannot be optimized
+// away. Warmup rounds are run first and not timed; the timed rounds are
+// summarized on a single line in a fixed format:
+//
+//   Benchmark <name>: <median> ns/op (min <min>, max <max>), <ops> ops x <rounds> rounds
+//
+// The median is used as the headline number since it is the most stable
+// under scheduling noise.
+
+#define TEST_VM_BENCH(category, name) TEST_VM(category, CONCAT(DISABLED_bench_, name))
+
+class MicroBenchmark : public StackObj {
+public:
+  static const uint max_rounds = 64;
+
+private:
+  const char* _name;
+  size_t      _ops_per_round;
+  uint        _warmup_rounds;
+  uint        _rounds;
+  jlong       _times[max_rounds];
+  volatile uintx _sink;
+
+  static int compare_times(jlong a, jlong b) {
+    return a < b ? -1 : (a > b ? 1 : 0);
+  }
+
+  double ns_per_op(jlong round_time) const {
+    return (double)round_time / (double)_ops_per_round;
+  }
+
+public:
+  MicroBenchmark(const char* name, size_t ops_per_round,
+                 uint warmup_rounds = 5, uint rounds = 15) :
+    _name(name),
+    _ops_per_round(ops_per_round),
+    _warmup_rounds(warmup_rounds),
+    _rounds(MIN2(rounds, max_rounds)),
+    _sink(0)
+  {
+    assert(ops_per_round > 0, "must be");
+    assert(_rounds > 0, "must be");
+  }
+
+  template<typename Round>
+  void run(Round& round) {
+    for (uint i = 0; i < _warmup_rounds; i++) {
+      _sink += round();
+    }
+    for (uint i = 0; i < _rounds; i++) {
+      jlong start = os::javaTimeNanos();
+      _sink += round();
+      _times[i] = os::javaTimeNanos() - start;
+    }
+    QuickSort::sort(_times, _rounds, compare_times, false);
+    tty->print_cr("Benchmark %s: %.2f ns/op (min %.2f, max %.2f), " SIZE_FORMAT " ops x %u rounds",
+                  _name,
+                  ns_per_op(_times[_rounds / 2]),
+                  ns_per_op(_times[0]),
+                  ns_per_op(_times[_rounds - 1]),
+                  _ops_per_round, _rounds);
+  }
+};
+
+#endif // GTEST_MICROBENCHMARK_HPP
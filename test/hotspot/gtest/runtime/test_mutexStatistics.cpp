@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/mutexStatistics.hpp"
+#include "unittest.hpp"
+
+TEST_VM(MutexStatistics, lookup_shares_by_name) {
+  MutexStatistics* a = MutexStatistics::lookup("MutexStatisticsTest lock");
+  MutexStatistics* b = MutexStatistics::lookup("MutexStatisticsTest lock");
+  MutexStatistics* c = MutexStatistics::lookup("MutexStatisticsTest other lock");
+  ASSERT_EQ(a, b);
+  ASSERT_NE(a, c);
+  ASSERT_STREQ("MutexStatisticsTest lock", a->name());
+}
+
+TEST_VM(MutexStatistics, histogram) {
+  MutexStatistics* s = MutexStatistics::lookup("MutexStatisticsTest histogram lock");
+  s->record_hold(500);             // < 1us
+  s->record_hold(3 * 1000);        // [2, 4) us
+  s->record_wait(1000 * 1000);     // [512, 1024) us
+  EXPECT_EQ(1u, s->hold().bucket(0));
+  EXPECT_EQ(1u, s->hold().bucket(2));
+  EXPECT_EQ(3500, s->hold().total_nanos());
+  EXPECT_EQ(3000, s->hold().max_nanos());
+  EXPECT_EQ(1u, s->contended());
+  EXPECT_EQ(1u, s->wait().bucket(10));
+  EXPECT_EQ(1000 * 1000, s->wait().max_nanos());
+}
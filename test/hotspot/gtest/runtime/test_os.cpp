@@ -344,3 +344,22 @@ TEST_VM(os, jio_vsnprintf) {
 TEST_VM(os, jio_snprintf) {
   test_snprintf(jio_snprintf, false);
 }
+
+TEST_VM(os, pretouch_memory) {
+  const size_t size = 16 * os::vm_page_size();
+  char* base = os::reserve_memory(size);
+  ASSERT_TRUE(base != NULL);
+  ASSERT_TRUE(os::commit_memory(base, size, !ExecMem));
+
+  // Pre-touching must accept unaligned and empty ranges.
+  os::pretouch_memory(base, base + size);
+  os::pretouch_memory(base + 1, base + size - 1);
+  os::pretouch_memory(base + size, base + size);
+
+  base[0] = 1;
+  base[size - 1] = 1;
+  EXPECT_EQ(1, base[0]);
+  EXPECT_EQ(1, base[size - 1]);
+
+  EXPECT_TRUE(os::release_memory(base, size));
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "memory/resourceArea.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "microbenchmark.hpp"
+#include "unittest.hpp"
+
+static const BitMap::idx_t bitmap_bench_size = 64 * K;
+
+// Sets every seventh bit so that searches cross words of varying density.
+static void fill_bench_bitmap(BitMap& map) {
+  for (BitMap::idx_t i = 0; i < map.size(); i += 7) {
+    map.set_bit(i);
+  }
+}
+
+class BitMapSetClearRound {
+  BitMap& _map;
+public:
+  BitMapSetClearRound(BitMap& map) : _map(map) {}
+  uintx operator()() {
+    for (BitMap::idx_t i = 0; i < _map.size(); i++) {
+      _map.set_bit(i);
+    }
+    for (BitMap::idx_t i = 0; i < _map.size(); i++) {
+      _map.clear_bit(i);
+    }
+    return _map.size();
+  }
+};
+
+class BitMapSearchRound {
+  const BitMap& _map;
+public:
+  BitMapSearchRound(const BitMap& map) : _map(map) {}
+  uintx operator()() {
+    uintx found = 0;
+    for (BitMap::idx_t i = _map.get_next_one_offset(0);
+         i < _map.size();
+         i = _map.get_next_one_offset(i + 1)) {
+      found++;
+    }
+    return found;
+  }
+};
+
+class BitMapCountRound {
+  const BitMap& _map;
+public:
+  BitMapCountRound(const BitMap& map) : _map(map) {}
+  uintx operator()() {
+    return _map.count_one_bits();
+  }
+};
+
+TEST_VM_BENCH(BitMap, set_clear) {
+  ResourceMark rm;
+  ResourceBitMap map(bitmap_bench_size);
+  BitMapSetClearRound round(map);
+  MicroBenchmark("BitMap.set_clear", 2 * bitmap_bench_size).run(round);
+}
+
+TEST_VM_BENCH(BitMap, get_next_one_offset) {
+  ResourceMark rm;
+  ResourceBitMap map(bitmap_bench_size);
+  fill_bench_bitmap(map);
+  BitMapSearchRound round(map);
+  MicroBenchmark("BitMap.get_next_one_offset", bitmap_bench_size / 7 + 1).run(round);
+}
+
+TEST_VM_BENCH(BitMap, count_one_bits) {
+  ResourceMark rm;
+  ResourceBitMap map(bitmap_bench_size);
+  fill_bench_bitmap(map);
+  BitMapCountRound round(map);
+  // One op is one bitmap word.
+  MicroBenchmark("BitMap.count_one_bits", bitmap_bench_size / BitsPerWord).run(round);
+}
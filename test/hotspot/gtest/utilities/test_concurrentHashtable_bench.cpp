@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "microbenchmark.hpp"
+#include "unittest.hpp"
+
+struct BenchCHTConfig : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)value;
+  }
+  static void* allocate_node(size_t size, const Value& value) {
+    return ::malloc(size);
+  }
+  static void free_node(void* memory, const Value& value) {
+    ::free(memory);
+  }
+};
+
+typedef ConcurrentHashTable<BenchCHTConfig, mtTest> BenchCHT;
+
+struct BenchCHTLookup {
+  uintptr_t _val;
+  BenchCHTLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    return BenchCHTConfig::get_hash(_val, NULL);
+  }
+  bool equals(const uintptr_t* value, bool* is_dead) {
+    return _val == *value;
+  }
+};
+
+struct BenchCHTFound {
+  uintptr_t _value;
+  BenchCHTFound() : _value(0) {}
+  void operator()(uintptr_t* value) {
+    _value = *value;
+  }
+};
+
+static const size_t cht_bench_entries = 16 * K;
+
+class CHTGetRound {
+  BenchCHT* _table;
+  Thread* _thread;
+public:
+  CHTGetRound(BenchCHT* table, Thread* thread) : _table(table), _thread(thread) {}
+  uintx operator()() {
+    uintx sum = 0;
+    for (uintptr_t v = 1; v <= cht_bench_entries; v++) {
+      BenchCHTLookup lookup(v);
+      BenchCHTFound found;
+      _table->get(_thread, lookup, found);
+      sum += found._value;
+    }
+    return sum;
+  }
+};
+
+class CHTInsertRemoveRound {
+  BenchCHT* _table;
+  Thread* _thread;
+public:
+  CHTInsertRemoveRound(BenchCHT* table, Thread* thread) : _table(table), _thread(thread) {}
+  uintx operator()() {
+    uintx inserted = 0;
+    for (uintptr_t v = 1; v <= cht_bench_entries; v++) {
+      BenchCHTLookup lookup(v);
+      inserted += _table->insert(_thread, lookup, v) ? 1 : 0;
+    }
+    for (uintptr_t v = 1; v <= cht_bench_entries; v++) {
+      BenchCHTLookup lookup(v);
+      _table->remove(_thread, lookup);
+    }
+    return inserted;
+  }
+};
+
+TEST_VM_BENCH(ConcurrentHashTable, get) {
+  Thread* thread = Thread::current();
+  BenchCHT* table = new BenchCHT(14);
+  for (uintptr_t v = 1; v <= cht_bench_entries; v++) {
+    BenchCHTLookup lookup(v);
+    table->insert(thread, lookup, v);
+  }
+  CHTGetRound round(table, thread);
+  MicroBenchmark("ConcurrentHashTable.get", cht_bench_entries).run(round);
+  delete table;
+}
+
+TEST_VM_BENCH(ConcurrentHashTable, insert_remove) {
+  Thread* thread = Thread::current();
+  BenchCHT* table = new BenchCHT(14);
+  CHTInsertRemoveRound round(table, thread);
+  MicroBenchmark("ConcurrentHashTable.insert_remove", 2 * cht_bench_entries).run(round);
+  delete table;
+}
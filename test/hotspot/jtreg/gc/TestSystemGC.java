@@ -53,6 +53,16 @@ package gc;
  * @summary Runs System.gc() with different flags.
  * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseShenandoahGC gc.TestSystemGC
  * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseShenandoahGC -XX:+ExplicitGCInvokesConcurrent gc.TestSystemGC
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseShenandoahGC -XX:+ExplicitGCInvokesConcurrent -XX:+ShenandoahConcurrentStackProcessing gc.TestSystemGC
+ */
+
+/*
+ * @test TestSystemGCEpsilon
+ * @requires vm.gc.Epsilon
+ * @summary Runs System.gc() with different flags.
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC gc.TestSystemGC
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC gc.TestSystemGC
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:EpsilonSlidingGCOccupancy=50 gc.TestSystemGC
  */
 public class TestSystemGC {
   public static void main(String args[]) throws Exception {
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/**
+ * @test TestConcurrentUncommit
+ * @requires vm.gc.G1
+ * @summary Verify that the memory of regions removed by shrinking is uncommitted
+ *          concurrently by the service thread.
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestConcurrentUncommit
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestConcurrentUncommit {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UseG1GC",
+                                                                  "-XX:+UnlockExperimentalVMOptions",
+                                                                  "-XX:G1UncommitDelayMillis=0",
+                                                                  "-XX:G1HeapRegionSize=1m",
+                                                                  "-XX:MinHeapFreeRatio=10",
+                                                                  "-XX:MaxHeapFreeRatio=20",
+                                                                  "-Xms8m",
+                                                                  "-Xmx256m",
+                                                                  "-XX:+VerifyAfterGC",
+                                                                  "-Xlog:gc+heap=debug",
+                                                                  GCTest.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldContain("Concurrent uncommit:");
+        output.shouldHaveExitValue(0);
+    }
+
+    static class GCTest {
+        public static Object[] garbage;
+
+        public static void main(String [] args) throws Exception {
+            // Expand the heap, then drop everything and shrink it again.
+            garbage = new Object[128];
+            for (int i = 0; i < garbage.length; i++) {
+                garbage[i] = new byte[1024 * 1024];
+            }
+            garbage = null;
+            System.gc();
+
+            System.out.println("Waiting for uncommit...");
+            Thread.sleep(1000);
+            System.out.println("Done");
+        }
+    }
+}
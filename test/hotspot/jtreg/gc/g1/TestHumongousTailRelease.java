@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/**
+ * @test TestHumongousTailRelease
+ * @requires vm.gc.G1
+ * @summary Verify that the memory backing the unused tail of humongous objects
+ *          is released and that the heap stays consistent afterwards.
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestHumongousTailRelease
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestHumongousTailRelease {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UseG1GC",
+                                                                  "-XX:G1HeapRegionSize=1m",
+                                                                  "-Xmx128m",
+                                                                  "-XX:-UseLargePages",
+                                                                  "-XX:+UnlockExperimentalVMOptions",
+                                                                  "-XX:+G1ReleaseHumongousTails",
+                                                                  "-XX:+UnlockDiagnosticVMOptions",
+                                                                  "-XX:+VerifyBeforeGC",
+                                                                  "-XX:+VerifyAfterGC",
+                                                                  "-Xlog:gc+humongous=trace",
+                                                                  GCTest.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldContain("Released humongous tail memory");
+        output.shouldHaveExitValue(0);
+
+        pb = ProcessTools.createJavaProcessBuilder("-XX:+UseG1GC",
+                                                   "-XX:G1HeapRegionSize=1m",
+                                                   "-Xmx128m",
+                                                   "-Xlog:gc+humongous=trace",
+                                                   GCTest.class.getName());
+
+        output = new OutputAnalyzer(pb.start());
+        output.shouldNotContain("Released humongous tail memory");
+        output.shouldHaveExitValue(0);
+    }
+
+    static class GCTest {
+        public static Object[] objects;
+
+        public static void main(String [] args) throws Exception {
+            // Objects of 1.2 regions leave most of their last region unused.
+            objects = new Object[16];
+            for (int i = 0; i < objects.length; i++) {
+                objects[i] = new byte[1200 * 1024];
+            }
+            System.gc();
+            objects = null;
+            System.gc();
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestPinnedObjects
+ * @summary Test that G1 does not move objects pinned by JNI critical sections
+ *          during young and full collections, and does not wait for the
+ *          critical sections to be left.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm/native -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *      -XX:+UseG1GC -Xmx128m -XX:G1HeapRegionSize=1m -XX:+VerifyAfterGC -Xlog:gc
+ *      gc.g1.TestPinnedObjects
+ */
+
+import sun.hotspot.WhiteBox;
+
+public class TestPinnedObjects {
+    static {
+        System.loadLibrary("TestPinnedObjects");
+    }
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int NUM_GARBAGE = 10_000;
+    private static final int HUMONGOUS_LENGTH = 1024 * 1024;
+
+    private static native long pin(int[] a);
+    private static native void unpin(int[] a);
+    private static native long address(int[] a);
+
+    private static Object[] garbage;
+
+    private static void allocateGarbage() {
+        garbage = new Object[NUM_GARBAGE];
+        for (int i = 0; i < NUM_GARBAGE; i++) {
+            garbage[i] = new int[i % 16];
+        }
+        garbage = null;
+    }
+
+    private static int[] createArray(int length) {
+        int[] a = new int[length];
+        for (int i = 0; i < length; i++) {
+            a[i] = i;
+        }
+        return a;
+    }
+
+    private static void check(int[] a, long expectedAddress) {
+        long actualAddress = address(a);
+        if (actualAddress != expectedAddress) {
+            throw new RuntimeException("Pinned object moved from 0x" + Long.toHexString(expectedAddress) +
+                                       " to 0x" + Long.toHexString(actualAddress));
+        }
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] != i) {
+                throw new RuntimeException("Pinned object contents changed at index " + i + ": " + a[i]);
+            }
+        }
+    }
+
+    private static void testPinned(int length) {
+        allocateGarbage();
+        int[] a = createArray(length);
+        allocateGarbage();
+
+        long addr = pin(a);
+        try {
+            WB.youngGC();
+            check(a, addr);
+            allocateGarbage();
+            WB.youngGC();
+            check(a, addr);
+            WB.fullGC();
+            check(a, addr);
+            allocateGarbage();
+            WB.youngGC();
+            check(a, addr);
+        } finally {
+            unpin(a);
+        }
+        // After unpinning the object may be moved again.
+        WB.youngGC();
+        WB.fullGC();
+        check(a, address(a));
+    }
+
+    public static void main(String[] args) {
+        testPinned(10);
+        testPinned(HUMONGOUS_LENGTH);
+    }
+}
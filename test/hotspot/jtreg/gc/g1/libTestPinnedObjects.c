@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * Native support for TestPinnedObjects test.
+ */
+
+#include "jni.h"
+#include <stdint.h>
+
+static jint* pinned;
+
+JNIEXPORT jlong JNICALL
+Java_gc_g1_TestPinnedObjects_pin(JNIEnv *env, jclass unused, jintArray a) {
+  pinned = (*env)->GetPrimitiveArrayCritical(env, a, 0);
+  return (jlong)(intptr_t)pinned;
+}
+
+JNIEXPORT void JNICALL
+Java_gc_g1_TestPinnedObjects_unpin(JNIEnv *env, jclass unused, jintArray a) {
+  (*env)->ReleasePrimitiveArrayCritical(env, a, pinned, 0);
+}
+
+JNIEXPORT jlong JNICALL
+Java_gc_g1_TestPinnedObjects_address(JNIEnv *env, jclass unused, jintArray a) {
+  void* p = (*env)->GetPrimitiveArrayCritical(env, a, 0);
+  (*env)->ReleasePrimitiveArrayCritical(env, a, p, JNI_ABORT);
+  return (jlong)(intptr_t)p;
+}
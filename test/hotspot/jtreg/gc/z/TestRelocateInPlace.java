@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.z;
+
+/*
+ * @test TestRelocateInPlace
+ * @requires vm.gc.Z
+ * @summary Stress in-place relocation with an allocation heavy workload.
+ * @library /test/lib
+ * @run main/othervm -XX:+UseZGC -Xmx256m -Xlog:gc,gc+reloc=debug
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+ZStressRelocateInPlace
+ *                   -XX:+ZVerifyForwarding -XX:+ZVerifyViews
+ *                   gc.z.TestRelocateInPlace
+ */
+
+import java.util.ArrayList;
+import java.util.Random;
+
+public class TestRelocateInPlace {
+    private static final int ITERATIONS = 20;
+    private static final int LIVE = 20_000;
+
+    // Keep a share of the objects alive so that pages selected for
+    // relocation still have live objects to move in-place.
+    private static Object[] live = new Object[LIVE];
+
+    private static void allocate(Random random) {
+        ArrayList<byte[]> garbage = new ArrayList<>();
+        for (int i = 0; i < 200_000; i++) {
+            byte[] array = new byte[random.nextInt(512) + 16];
+            array[0] = (byte)i;
+            if (i % 10 == 0) {
+                live[random.nextInt(LIVE)] = array;
+            } else {
+                garbage.add(array);
+                if (garbage.size() > 1000) {
+                    garbage.clear();
+                }
+            }
+        }
+    }
+
+    private static void verify() {
+        for (Object o : live) {
+            if (o != null && !(o instanceof byte[])) {
+                throw new RuntimeException("Unexpected object " + o);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        for (int i = 0; i < ITERATIONS; i++) {
+            allocate(random);
+            System.gc();
+            verify();
+        }
+    }
+}
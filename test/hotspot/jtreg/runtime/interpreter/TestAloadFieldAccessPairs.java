@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestAloadFieldAccessPairs
+ * @summary Check the _fast_iaccess, _fast_aaccess and _fast_faccess pairs
+ *          of an aload with a following getfield, and the bci of their NPEs.
+ * @run main/othervm -Xint -XX:+RewriteFrequentPairs -XX:+ShowCodeDetailsInExceptionMessages
+ *                   TestAloadFieldAccessPairs
+ */
+
+public class TestAloadFieldAccessPairs {
+    static class Holder {
+        int intField;
+        Object objField;
+        float floatField;
+
+        Holder(int i) {
+            intField = i;
+            objField = Integer.valueOf(i);
+            floatField = i + 0.5f;
+        }
+    }
+
+    // The Holder is in local 4, so it is loaded with aload (not aload_<n>)
+    // right before the getfield.
+    static int getInt(int a, int b, int c, int d, Holder h) {
+        return h.intField;
+    }
+
+    static Object getObj(int a, int b, int c, int d, Holder h) {
+        return h.objField;
+    }
+
+    static float getFloat(int a, int b, int c, int d, Holder h) {
+        return h.floatField;
+    }
+
+    static void check(boolean ok, String what) {
+        if (!ok) {
+            throw new RuntimeException("Wrong value for " + what);
+        }
+    }
+
+    static void checkNPE(Runnable r, String field) {
+        try {
+            r.run();
+        } catch (NullPointerException npe) {
+            // The message is only computed for the getfield bci. For the bci
+            // of the aload no message would be found.
+            String expected = "Cannot read field \"" + field + "\"";
+            String msg = npe.getMessage();
+            if (msg == null || !msg.startsWith(expected)) {
+                throw new RuntimeException("Expected message starting with '" + expected + "', got '" + msg + "'");
+            }
+            return;
+        }
+        throw new RuntimeException("No NullPointerException for " + field);
+    }
+
+    public static void main(String[] args) {
+        // The first executions quicken the getfield and rewrite the aload,
+        // the following ones run the pair bytecodes.
+        for (int i = 0; i < 10; i++) {
+            Holder h = new Holder(i);
+            check(getInt(0, 0, 0, 0, h) == i, "intField");
+            check(getObj(0, 0, 0, 0, h).equals(Integer.valueOf(i)), "objField");
+            check(getFloat(0, 0, 0, 0, h) == i + 0.5f, "floatField");
+        }
+        checkNPE(() -> getInt(0, 0, 0, 0, null), "intField");
+        checkNPE(() -> getObj(0, 0, 0, 0, null), "objField");
+        checkNPE(() -> getFloat(0, 0, 0, 0, null), "floatField");
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestIndyBootstrapClaim
+ * @summary Threads racing to link a fresh invokedynamic call site run its
+ *          bootstrap method once. Recursive bootstraps of a site and more
+ *          concurrent bootstraps than claim slots must not hang.
+ * @modules java.base/jdk.internal.org.objectweb.asm
+ * @run main/othervm TestIndyBootstrapClaim
+ */
+
+import java.lang.invoke.CallSite;
+import java.lang.invoke.ConstantCallSite;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Method;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.CyclicBarrier;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import jdk.internal.org.objectweb.asm.ClassWriter;
+import jdk.internal.org.objectweb.asm.Handle;
+import jdk.internal.org.objectweb.asm.MethodVisitor;
+import static jdk.internal.org.objectweb.asm.Opcodes.*;
+
+public class TestIndyBootstrapClaim {
+    static final int RACE_SITE = 0;
+    static final int RECURSIVE_SITE = 1;
+    static final int FIRST_WIDE_SITE = 2;
+    // More sites than IndyBootstrapClaim has slots.
+    static final int WIDE_SITES = 100;
+    static final int SITES = FIRST_WIDE_SITE + WIDE_SITES;
+    static final int RACE_THREADS = 16;
+
+    static final AtomicInteger[] calls = new AtomicInteger[SITES];
+    static final CountDownLatch wideLatch = new CountDownLatch(WIDE_SITES);
+    static volatile boolean wideLatchReached = true;
+    static Method[] sites = new Method[SITES];
+
+    public static CallSite bsm(MethodHandles.Lookup lookup, String name, MethodType type, int site) throws Throwable {
+        int n = calls[site].incrementAndGet();
+        if (site == RACE_SITE) {
+            // Keep running for longer than the bounded wait for a blocked owner.
+            long end = System.nanoTime() + TimeUnit.MILLISECONDS.toNanos(500);
+            while (System.nanoTime() < end) {
+                Thread.onSpinWait();
+            }
+        } else if (site == RECURSIVE_SITE) {
+            if (n == 1) {
+                // Resolve the site that is being bootstrapped again, on this thread.
+                sites[site].invoke(null);
+            }
+        } else {
+            // Hold the claim until every wide site is being bootstrapped.
+            wideLatch.countDown();
+            if (!wideLatch.await(60, TimeUnit.SECONDS)) {
+                wideLatchReached = false;
+            }
+        }
+        return new ConstantCallSite(MethodHandles.constant(Object.class, Integer.valueOf(site)));
+    }
+
+    static byte[] generateSites() {
+        ClassWriter cw = new ClassWriter(ClassWriter.COMPUTE_MAXS | ClassWriter.COMPUTE_FRAMES);
+        cw.visit(V11, ACC_PUBLIC | ACC_SUPER, "IndySites", null, "java/lang/Object", null);
+        Handle bsm = new Handle(H_INVOKESTATIC, "TestIndyBootstrapClaim", "bsm",
+                                MethodType.methodType(CallSite.class, MethodHandles.Lookup.class, String.class,
+                                                      MethodType.class, int.class).toMethodDescriptorString(),
+                                false);
+        for (int i = 0; i < SITES; i++) {
+            MethodVisitor mv = cw.visitMethod(ACC_PUBLIC | ACC_STATIC, "site" + i, "()Ljava/lang/Object;", null, null);
+            mv.visitCode();
+            mv.visitInvokeDynamicInsn("run", "()Ljava/lang/Object;", bsm, i);
+            mv.visitInsn(ARETURN);
+            mv.visitMaxs(0, 0);
+            mv.visitEnd();
+        }
+        cw.visitEnd();
+        return cw.toByteArray();
+    }
+
+    static class SitesLoader extends ClassLoader {
+        SitesLoader() {
+            super(TestIndyBootstrapClaim.class.getClassLoader());
+        }
+
+        Class<?> define(byte[] bytes) {
+            return defineClass("IndySites", bytes, 0, bytes.length);
+        }
+    }
+
+    static Thread[] start(int count, int firstSite, boolean sameSite, Object[] results, Throwable[] errors) {
+        CyclicBarrier barrier = new CyclicBarrier(count);
+        Thread[] threads = new Thread[count];
+        for (int t = 0; t < count; t++) {
+            final int id = t;
+            final int site = sameSite ? firstSite : firstSite + t;
+            threads[t] = new Thread(() -> {
+                try {
+                    barrier.await();
+                    results[id] = sites[site].invoke(null);
+                } catch (Throwable e) {
+                    errors[id] = e;
+                }
+            });
+            threads[t].start();
+        }
+        return threads;
+    }
+
+    static void join(Thread[] threads, Throwable[] errors) throws Exception {
+        for (Thread t : threads) {
+            t.join();
+        }
+        for (Throwable e : errors) {
+            if (e != null) {
+                throw new RuntimeException("Call site resolution failed", e);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < SITES; i++) {
+            calls[i] = new AtomicInteger();
+        }
+        Class<?> c = new SitesLoader().define(generateSites());
+        for (int i = 0; i < SITES; i++) {
+            sites[i] = c.getMethod("site" + i);
+        }
+
+        // Many threads race on one fresh site with a slow bootstrap method.
+        Object[] results = new Object[RACE_THREADS];
+        Throwable[] errors = new Throwable[RACE_THREADS];
+        join(start(RACE_THREADS, RACE_SITE, true, results, errors), errors);
+        if (calls[RACE_SITE].get() != 1) {
+            throw new RuntimeException("Bootstrap method ran " + calls[RACE_SITE].get() + " times");
+        }
+        for (Object r : results) {
+            if (!Integer.valueOf(RACE_SITE).equals(r)) {
+                throw new RuntimeException("Wrong call site target result " + r);
+            }
+        }
+
+        // The thread that claimed a site can bootstrap it recursively.
+        if (!Integer.valueOf(RECURSIVE_SITE).equals(sites[RECURSIVE_SITE].invoke(null))) {
+            throw new RuntimeException("Wrong result for the recursive site");
+        }
+        if (calls[RECURSIVE_SITE].get() != 2) {
+            throw new RuntimeException("Recursive bootstrap method ran " + calls[RECURSIVE_SITE].get() + " times");
+        }
+
+        // All claim slots are taken, the remaining sites are bootstrapped without one.
+        results = new Object[WIDE_SITES];
+        errors = new Throwable[WIDE_SITES];
+        join(start(WIDE_SITES, FIRST_WIDE_SITE, false, results, errors), errors);
+        if (!wideLatchReached) {
+            throw new RuntimeException("Bootstrap methods of distinct sites did not run concurrently");
+        }
+        for (int i = 0; i < WIDE_SITES; i++) {
+            if (calls[FIRST_WIDE_SITE + i].get() != 1 ||
+                !Integer.valueOf(FIRST_WIDE_SITE + i).equals(results[i])) {
+                throw new RuntimeException("Wrong bootstrap of site " + (FIRST_WIDE_SITE + i));
+            }
+        }
+    }
+}
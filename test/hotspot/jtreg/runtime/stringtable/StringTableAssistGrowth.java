@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test StringTableAssistGrowth
+ * @summary Intern a burst of strings from many threads with AssistTableGrowth,
+ *          so that interning threads request and help a concurrent grow.
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver StringTableAssistGrowth
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class StringTableAssistGrowth {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UnlockExperimentalVMOptions",
+                                                                  "-XX:+AssistTableGrowth",
+                                                                  "-XX:StringTableSize=1024",
+                                                                  "-Xlog:stringtable=debug",
+                                                                  Interner.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Concurrent work triggered");
+        output.shouldContain("Grown to size:");
+    }
+
+    static class Interner {
+        static final int THREADS = 8;
+        static final int STRINGS = 100_000;
+        static final String[][] interned = new String[THREADS][];
+
+        public static void main(String[] args) throws Exception {
+            Thread[] threads = new Thread[THREADS];
+            for (int t = 0; t < THREADS; t++) {
+                final int id = t;
+                threads[t] = new Thread(() -> {
+                    String[] mine = new String[STRINGS];
+                    for (int i = 0; i < STRINGS; i++) {
+                        mine[i] = new String("StringTableAssistGrowth" + i).intern();
+                    }
+                    interned[id] = mine;
+                });
+            }
+            for (Thread t : threads) {
+                t.start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            // Every thread must have got the same canonical instance.
+            for (int i = 0; i < STRINGS; i++) {
+                String s = ("StringTableAssistGrowth" + i).intern();
+                for (int t = 0; t < THREADS; t++) {
+                    if (interned[t][i] != s) {
+                        throw new RuntimeException("Thread " + t + " got a different instance of " + s);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.java.util.concurrent;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Group;
+import org.openjdk.jmh.annotations.GroupThreads;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Control;
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Measures the latency of LockSupport.park/unpark, both when the permit
+ * is already available (no thread ever blocks) and when two threads
+ * hand a token back and forth and each unpark wakes a parked thread.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(3)
+public class LockSupportParkUnpark {
+
+    @State(Scope.Thread)
+    public static class Self {
+        Thread self;
+
+        @Setup
+        public void setup() {
+            self = Thread.currentThread();
+        }
+    }
+
+    /** Unpark with the permit already set: the park-free fast path. */
+    @Benchmark
+    public void unparkWithPermit(Self s) {
+        LockSupport.unpark(s.self);
+    }
+
+    /** Unpark followed by park on the same thread: never blocks. */
+    @Benchmark
+    public void unparkThenPark(Self s) {
+        LockSupport.unpark(s.self);
+        LockSupport.park();
+    }
+
+    @State(Scope.Group)
+    public static class PingPong {
+        final AtomicReference<Thread> turn = new AtomicReference<>();
+        volatile Thread ping;
+        volatile Thread pong;
+    }
+
+    private static void handOff(AtomicReference<Thread> turn, Thread self, Thread other, Control c) {
+        while (turn.get() != self) {
+            if (c.stopMeasurement) {
+                return;
+            }
+            // Timed so that a thread left waiting when the peer stops
+            // iterating notices the end of the measurement.
+            LockSupport.parkNanos(TimeUnit.MILLISECONDS.toNanos(1));
+        }
+        turn.set(other);
+        LockSupport.unpark(other);
+    }
+
+    @Benchmark
+    @Group("pingPong")
+    @GroupThreads(1)
+    public void ping(PingPong p, Control c) {
+        Thread self = Thread.currentThread();
+        p.ping = self;
+        Thread other = p.pong;
+        if (other == null) {
+            return;
+        }
+        p.turn.compareAndSet(null, self);
+        handOff(p.turn, self, other, c);
+    }
+
+    @Benchmark
+    @Group("pingPong")
+    @GroupThreads(1)
+    public void pong(PingPong p, Control c) {
+        Thread self = Thread.currentThread();
+        p.pong = self;
+        Thread other = p.ping;
+        if (other == null) {
+            return;
+        }
+        p.turn.compareAndSet(null, self);
+        handOff(p.turn, self, other, c);
+    }
+}